@@ -0,0 +1,133 @@
+#pragma once
+
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GB {
+
+	/// <summary> The number of bits stored for the cost of each grid square of a CompactNavigationGrid. </summary>
+	enum NAVIGATION_COST_PRECISION_TYPE {
+		NAVIGATION_COST_PRECISION_8_BIT, // costs up to 255 times the weight scale
+		NAVIGATION_COST_PRECISION_16_BIT // costs up to 65535 times the weight scale. Holds every unblocked weight exactly.
+	};
+
+	/// <summary>
+	/// A navigation grid that only stores whether each grid square is passable and a small cost for it.
+	/// Passability is one bit per grid square, derived from BLOCKED_GRID_WEIGHT, so 64 grid squares are tested per word.
+	/// The cost of a passable grid square is its weight divided by the weight scale, rounded and stored in 8 or 16 bits.
+	/// Both planes are flattened in the same x major order as Array2D, and every setter keeps them in sync.
+	/// </summary>
+	class libGameBackbone CompactNavigationGrid {
+	public:
+		//ctr / dtr
+		//default copy and move are fine for this class
+		CompactNavigationGrid();
+		CompactNavigationGrid(unsigned int newSizeX, unsigned int newSizeY, NAVIGATION_COST_PRECISION_TYPE newCostPrecision = NAVIGATION_COST_PRECISION_8_BIT, int newWeightScale = 1);
+		explicit CompactNavigationGrid(NavigationGrid& navigationGrid, NAVIGATION_COST_PRECISION_TYPE newCostPrecision = NAVIGATION_COST_PRECISION_8_BIT);
+		explicit CompactNavigationGrid(const DenseNavigationGrid& navigationGrid, NAVIGATION_COST_PRECISION_TYPE newCostPrecision = NAVIGATION_COST_PRECISION_8_BIT);
+
+		//getters / setters
+
+			//setters
+		void setWeight(unsigned int x, unsigned int y, int newWeight);
+
+			//getters
+
+		/// <summary>
+		/// Determines if a grid square is passable.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>True if the weight of the grid square is below BLOCKED_GRID_WEIGHT. False otherwise.</returns>
+		bool isPassable(unsigned int x, unsigned int y) const {
+			const std::size_t gridIndex = flattenGridCoordinate(x, y);
+			return (passabilityWords[gridIndex / BITS_PER_WORD] >> (gridIndex % BITS_PER_WORD)) & 1u;
+		}
+
+		/// <summary>
+		/// Gets the quantized weight of a grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>BLOCKED_GRID_WEIGHT if the grid square is blocked. Its cost times the weight scale otherwise.</returns>
+		int getWeight(unsigned int x, unsigned int y) const {
+			if (!isPassable(x, y)) {
+				return BLOCKED_GRID_WEIGHT;
+			}
+			const std::size_t gridIndex = flattenGridCoordinate(x, y);
+			const int cost = (costPrecision == NAVIGATION_COST_PRECISION_8_BIT) ? costs8[gridIndex] : costs16[gridIndex];
+			return cost * weightScale;
+		}
+
+		bool isColumnPassable(unsigned int x, unsigned int yBegin, unsigned int yEnd) const;
+		const std::vector<std::uint64_t>& getPassabilityWords() const;
+		NAVIGATION_COST_PRECISION_TYPE getCostPrecision() const;
+		int getWeightScale() const;
+		int getMaxWeight() const;
+
+		/// <summary>
+		/// Gets the grid size in the x dimension.
+		/// </summary>
+		/// <returns>The number of grid squares along x.</returns>
+		unsigned int getArraySizeX() const {
+			return sizeX;
+		}
+
+		/// <summary>
+		/// Gets the grid size in the y dimension.
+		/// </summary>
+		/// <returns>The number of grid squares along y.</returns>
+		unsigned int getArraySizeY() const {
+			return sizeY;
+		}
+
+		std::size_t getMemoryUsage() const;
+
+		//operations
+
+		/// <summary>
+		/// Checks if a grid square is within the grid.
+		/// </summary>
+		/// <param name="x">The x position of the grid square.</param>
+		/// <param name="y">The y position of the grid square.</param>
+		/// <returns>True if the grid square is within the grid. False otherwise.</returns>
+		bool isInArray(unsigned int x, unsigned int y) const {
+			return x < sizeX && y < sizeY;
+		}
+
+		/// <summary>
+		/// Flattens the coordinate of a grid square into its index in the planes.
+		/// </summary>
+		/// <param name="x">The x position of the grid square.</param>
+		/// <param name="y">The y position of the grid square.</param>
+		/// <returns>The flattened index.</returns>
+		std::size_t flattenGridCoordinate(unsigned int x, unsigned int y) const {
+			return static_cast<std::size_t>(x) * sizeY + y;
+		}
+
+		void updateGridSquares(NavigationGrid& navigationGrid, const std::vector<sf::Vector2i>& changedGridSquares);
+		void updateGridSquares(const DenseNavigationGrid& navigationGrid, const std::vector<sf::Vector2i>& changedGridSquares);
+
+	private:
+		/// The number of grid squares in each word of the passability plane.
+		static constexpr std::size_t BITS_PER_WORD = 64;
+
+		//data
+		unsigned int sizeX;
+		unsigned int sizeY;
+		NAVIGATION_COST_PRECISION_TYPE costPrecision;
+		int weightScale;
+		std::vector<std::uint64_t> passabilityWords; // bit i of word w is set if the grid square at index w * 64 + i is passable
+		std::vector<std::uint8_t> costs8; // only used with 8 bit precision
+		std::vector<std::uint16_t> costs16; // only used with 16 bit precision
+	};
+
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+#include <GameBackbone/Navigation/ReservationTable.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Plans the paths of many agents so they do not collide (windowed hierarchical cooperative A*).
+	/// Agents are planned one after another against a shared ReservationTable. Each agent searches space and time
+	/// for the first steps of its path, waiting or stepping aside where the agents planned before it reserved grid squares,
+	/// and follows the cheapest route that ignores the other agents after the window.
+	/// Each step of the window takes one time step, and a repeated grid square means the agent waits.
+	/// The cost of the rest of the route is read from a reverse search of each goal that is resumed as agents need it
+	/// and shared by agents with the same goal.
+	/// Call update once per time step to move every agent one step and roll the window forward.
+	/// Agents replan in turns every half window, so only a fraction of them search in each update.
+	/// Agents that can not reach their goal keep planning so they step out of the way of the others.
+	/// Paths never conflict within the window, unless an agent is trapped and has to wait where another agent planned to move.
+	/// </summary>
+	class libGameBackbone CooperativePathfinder {
+	public:
+
+		/// The number of time steps that are planned without conflicts if no other window size is chosen.
+		static constexpr unsigned int DEFAULT_WINDOW_SIZE = 16;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		CooperativePathfinder();
+		explicit CooperativePathfinder(NavigationGrid* navigationGrid, unsigned int windowSize = DEFAULT_WINDOW_SIZE);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+		void setWindowSize(unsigned int windowSize);
+		void setAgentGoal(unsigned int agent, const sf::Vector2i& goal);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		unsigned int getWindowSize() const;
+		unsigned int getCurrentTime() const;
+		std::size_t getAgentCount() const;
+		const sf::Vector2i& getAgentPosition(unsigned int agent) const;
+		const sf::Vector2i& getAgentGoal(unsigned int agent) const;
+		void getAgentPath(unsigned int agent, std::deque<sf::Vector2i>& returnedPath) const;
+		const ReservationTable& getReservationTable() const;
+		std::size_t getExpandedNodeCount() const;
+
+		//operations
+		void pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths);
+		unsigned int addAgent(const PathRequest& pathRequest);
+		void removeAgent(unsigned int agent);
+		void clearAgents();
+		void update();
+
+	private:
+
+		/// <summary> An agent and its planned steps. </summary>
+		struct Agent {
+			sf::Vector2i position;
+			sf::Vector2i goal;
+			std::deque<sf::Vector2i> windowPath; // one grid square per time step after the current time
+			std::deque<sf::Vector2i> route; // the rest of the route after the window
+			unsigned int reservedUntil; // the last time step the agent holds reservations for
+			bool isActive;
+		};
+
+		/// <summary>
+		/// The cost of reaching one goal from every grid square, found by a search from the goal that is resumed on demand.
+		/// The search heads for the position of the first agent with the goal, so it only covers the grid squares that agent needs.
+		/// </summary>
+		struct GoalDistances {
+			std::vector<int> costs;
+			IndexedPriorityQueue<int> openSet;
+			sf::Vector2i searchTarget;
+			unsigned int agentCount;
+		};
+
+		/// <summary> A grid square at a time step reached by the space time search. </summary>
+		struct SpaceTimeNode {
+			unsigned int gridIndex;
+			unsigned int depth; // time steps after the start of the search
+			int score;
+			unsigned int cameFrom; // index of the previous node
+			bool isClosed;
+		};
+
+		/// <summary> An open node and its priority. The lowest priority is expanded first. </summary>
+		using OpenNode = std::pair<std::uint64_t, unsigned int>;
+
+		//helper functions
+		void replanAgents();
+		void planAgent(unsigned int agent);
+		bool searchWindow(unsigned int agent, GoalDistances* goalDistances, unsigned int& lastNode);
+		void discoverNode(unsigned int gridIndex, unsigned int depth, int score, unsigned int cameFrom, GoalDistances* goalDistances);
+		void reserveAgent(unsigned int agent);
+		void releaseAgent(unsigned int agent);
+		bool isGoalFree(unsigned int agent, unsigned int fromTime) const;
+		const sf::Vector2i& getPlannedGridSquare(unsigned int agent, unsigned int time) const;
+		void buildRoute(const sf::Vector2i& from, GoalDistances& goalDistances, std::deque<sf::Vector2i>& route);
+		GoalDistances& acquireGoalDistances(const sf::Vector2i& goal, const sf::Vector2i& searchTarget);
+		void releaseGoalDistances(const sf::Vector2i& goal);
+		int getGoalDistance(GoalDistances& goalDistances, unsigned int gridIndex);
+		int calcHeuristic(const sf::Vector2i& from, const sf::Vector2i& to) const;
+		void resetHeuristicWeight();
+		int getStepCost(const sf::Vector2i& from, const sf::Vector2i& to) const;
+		sf::Vector2u getGridSize() const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		ReservationTable reservationTable;
+		std::vector<Agent> agents;
+		std::unordered_map<unsigned int, GoalDistances> goalDistancesByGoal; // keyed by the flattened goal
+		std::size_t expandedNodeCount;
+		int heuristicWeight; // the lowest unblocked weight of the grid, which no step costs less than
+
+		//space time search, kept between searches to reuse its memory
+		std::vector<SpaceTimeNode> searchNodes;
+		std::unordered_map<std::uint64_t, unsigned int> searchNodeIndices; // keyed by depth and grid index
+		std::vector<OpenNode> searchOpenSet; // min heap ordered by priority
+	};
+
+}
@@ -5,6 +5,8 @@
 
 #include <SFML/Graphics.hpp>
 
+#include <vector>
+
 namespace GB {
 
 	/// <summary>
@@ -24,6 +26,7 @@ namespace GB {
 		sf::Vector2f convertCoordToWindow(const sf::Vector2i& navGridCoord) const;
 		sf::Vector2i convertCoordToNavGrid(const sf::Vector2f& windowCoord) const;
 		WindowCoordinatePath convertPathToWindow(const NavGridCoordinatePath& navGridPath) const;
+		void convertPathToWindow(const PackedPath& navGridPath, std::vector<sf::Vector2f>& windowPath) const;
 		NavGridCoordinatePath convertPathToNavGrid(const WindowCoordinatePath& windowPath) const;
 
 
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// A navigation grid that stores the data of its grid squares by value.
+	/// The weights and the blocker distances are each stored in one contiguous plane, flattened in the same x major order as Array2D,
+	/// so a search reads neighboring weights from the same cache lines instead of following a pointer for every grid square.
+	/// Derive from ExtendedNavigationGrid to store custom data for each grid square.
+	/// </summary>
+	class libGameBackbone DenseNavigationGrid {
+	public:
+		//ctr / dtr
+		//default copy and move are fine for this class
+		DenseNavigationGrid();
+		DenseNavigationGrid(unsigned int newSizeX, unsigned int newSizeY, const NavigationGridData& gridData = NavigationGridData());
+		explicit DenseNavigationGrid(NavigationGrid& navigationGrid);
+
+		//getters / setters
+
+			//setters
+
+		/// <summary>
+		/// Sets the weight of a grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <param name="newWeight">The weight.</param>
+		void setWeight(unsigned int x, unsigned int y, int newWeight) {
+			weights[flattenGridCoordinate(x, y)] = newWeight;
+		}
+
+		/// <summary>
+		/// Sets the distance of a grid square to the closest blocked grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <param name="newBlockerDist">The distance.</param>
+		void setBlockerDist(unsigned int x, unsigned int y, unsigned int newBlockerDist) {
+			blockerDists[flattenGridCoordinate(x, y)] = newBlockerDist;
+		}
+
+		void setGridData(unsigned int x, unsigned int y, const NavigationGridData& gridData);
+
+			//getters
+
+		/// <summary>
+		/// Gets the weight of a grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>The weight.</returns>
+		int getWeight(unsigned int x, unsigned int y) const {
+			return weights[flattenGridCoordinate(x, y)];
+		}
+
+		/// <summary>
+		/// Gets the distance of a grid square to the closest blocked grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>The distance.</returns>
+		unsigned int getBlockerDist(unsigned int x, unsigned int y) const {
+			return blockerDists[flattenGridCoordinate(x, y)];
+		}
+
+		NavigationGridData getGridData(unsigned int x, unsigned int y) const;
+		const std::vector<int>& getWeights() const;
+		const std::vector<unsigned int>& getBlockerDists() const;
+
+		/// <summary>
+		/// Gets the grid size in the x dimension.
+		/// </summary>
+		/// <returns>The number of grid squares along x.</returns>
+		unsigned int getArraySizeX() const {
+			return sizeX;
+		}
+
+		/// <summary>
+		/// Gets the grid size in the y dimension.
+		/// </summary>
+		/// <returns>The number of grid squares along y.</returns>
+		unsigned int getArraySizeY() const {
+			return sizeY;
+		}
+
+		std::size_t getMemoryUsage() const;
+
+		//operations
+
+		/// <summary>
+		/// Checks if a grid square is within the grid.
+		/// </summary>
+		/// <param name="x">The x position of the grid square.</param>
+		/// <param name="y">The y position of the grid square.</param>
+		/// <returns>True if the grid square is within the grid. False otherwise.</returns>
+		bool isInArray(unsigned int x, unsigned int y) const {
+			return x < sizeX && y < sizeY;
+		}
+
+		/// <summary>
+		/// Flattens the coordinate of a grid square into its index in the planes.
+		/// </summary>
+		/// <param name="x">The x position of the grid square.</param>
+		/// <param name="y">The y position of the grid square.</param>
+		/// <returns>The flattened index.</returns>
+		std::size_t flattenGridCoordinate(unsigned int x, unsigned int y) const {
+			return static_cast<std::size_t>(x) * sizeY + y;
+		}
+
+		void initAllValues(const NavigationGridData& gridData);
+
+	private:
+		//data
+		unsigned int sizeX;
+		unsigned int sizeY;
+		std::vector<int> weights;
+		std::vector<unsigned int> blockerDists;
+	};
+
+	/// <summary>
+	/// A DenseNavigationGrid that also stores custom data for each grid square in a plane of its own.
+	/// Replaces types derived from NavigationGridData without adding a virtual call or an allocation to any grid square.
+	/// Can be passed anywhere a DenseNavigationGrid is used, but must not be destroyed through a pointer to one.
+	/// </summary>
+	template <class CustomGridData>
+	class ExtendedNavigationGrid : public DenseNavigationGrid {
+	public:
+		//ctr / dtr
+		//default copy and move are fine for this class
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ExtendedNavigationGrid"/> class without grid squares.
+		/// </summary>
+		ExtendedNavigationGrid() = default;
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ExtendedNavigationGrid"/> class.
+		/// </summary>
+		/// <param name="newSizeX">The number of grid squares along x.</param>
+		/// <param name="newSizeY">The number of grid squares along y.</param>
+		/// <param name="gridData">The weight and blocker distance of every grid square.</param>
+		/// <param name="customData">The custom data of every grid square.</param>
+		ExtendedNavigationGrid(unsigned int newSizeX, unsigned int newSizeY, const NavigationGridData& gridData = NavigationGridData(), const CustomGridData& customData = CustomGridData()) :
+			DenseNavigationGrid(newSizeX, newSizeY, gridData),
+			customDataPlane(static_cast<std::size_t>(newSizeX) * newSizeY, customData) {
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ExtendedNavigationGrid"/> class with the weights and blocker distances of a NavigationGrid.
+		/// </summary>
+		/// <param name="navigationGrid">The navigation grid to copy.</param>
+		/// <param name="customData">The custom data of every grid square.</param>
+		explicit ExtendedNavigationGrid(NavigationGrid& navigationGrid, const CustomGridData& customData = CustomGridData()) :
+			DenseNavigationGrid(navigationGrid),
+			customDataPlane(static_cast<std::size_t>(navigationGrid.getArraySizeX()) * navigationGrid.getArraySizeY(), customData) {
+		}
+
+		//getters
+
+		/// <summary>
+		/// Accesses the custom data of a grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>A reference to the custom data.</returns>
+		CustomGridData& getCustomData(unsigned int x, unsigned int y) {
+			return customDataPlane[flattenGridCoordinate(x, y)];
+		}
+
+		/// <summary>
+		/// Accesses the custom data of a grid square.
+		/// </summary>
+		/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+		/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+		/// <returns>A reference to the custom data.</returns>
+		const CustomGridData& getCustomData(unsigned int x, unsigned int y) const {
+			return customDataPlane[flattenGridCoordinate(x, y)];
+		}
+
+		/// <summary>
+		/// Gets the number of bytes used by the grid, including its custom data.
+		/// Memory owned by the custom data itself is not counted.
+		/// </summary>
+		/// <returns>The number of bytes.</returns>
+		std::size_t getMemoryUsage() const {
+			return DenseNavigationGrid::getMemoryUsage() + (sizeof(ExtendedNavigationGrid) - sizeof(DenseNavigationGrid)) +
+				customDataPlane.capacity() * sizeof(CustomGridData);
+		}
+
+	private:
+		//data
+		std::vector<CustomGridData> customDataPlane;
+	};
+
+}
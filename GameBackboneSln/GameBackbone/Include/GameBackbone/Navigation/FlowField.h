@@ -0,0 +1,67 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Directions from every grid square of a navigation grid towards one shared destination.
+	/// Generating the field costs one search of the whole grid. Afterwards, any number of agents heading to the
+	/// destination can look up their next step in constant time instead of each running its own path search.
+	/// Uses the same step cost as Pathfinder, so following the field takes the cheapest path to the destination.
+	/// </summary>
+	class libGameBackbone FlowField {
+	public:
+
+		/// The integrated cost of grid squares that cannot reach the destination.
+		static constexpr int UNREACHABLE_COST = INT_MAX;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		FlowField();
+		explicit FlowField(NavigationGrid* navigationGrid);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		const sf::Vector2i& getDestination() const;
+		int getIntegratedCost(const sf::Vector2i& gridSquare) const;
+		sf::Vector2i getDirection(const sf::Vector2i& gridSquare) const;
+		bool isReachable(const sf::Vector2i& gridSquare) const;
+
+		//operations
+		void generate(const sf::Vector2i& destination);
+		void extractPath(const sf::Vector2i& start, NavGridCoordinatePath& path) const;
+
+	private:
+		//helper functions
+		bool isGenerated(const sf::Vector2i& gridSquare) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		sf::Vector2i destination;
+		sf::Vector2u fieldSize;
+
+		// the cost of reaching the destination from each grid square
+		std::vector<int> integratedCosts;
+
+		// the index of the neighbor offset leading each grid square towards the destination
+		std::vector<unsigned char> directions;
+
+		IndexedPriorityQueue<std::uint64_t> openSet;
+	};
+
+}
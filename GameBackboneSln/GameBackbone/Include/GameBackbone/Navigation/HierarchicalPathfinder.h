@@ -0,0 +1,123 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Finds paths on large navigation grids by searching an abstraction of the grid first.
+	/// The grid is split into square clusters. Unblocked openings between neighboring clusters become abstract nodes,
+	/// connected by the cost of the cheapest path between them inside their cluster.
+	/// A request searches the abstract nodes, then refines only the clusters its route crosses into grid squares.
+	/// Paths are close to optimal, but may be slightly longer than a search of the full grid finds.
+	/// </summary>
+	class libGameBackbone HierarchicalPathfinder {
+	public:
+
+		/// The cluster size used when no cluster size is passed.
+		static constexpr unsigned int DEFAULT_CLUSTER_SIZE = 16;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		explicit HierarchicalPathfinder(NavigationGrid* navigationGrid, unsigned int clusterSize = DEFAULT_CLUSTER_SIZE);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		unsigned int getClusterSize() const;
+		std::size_t getClusterCount() const;
+		std::size_t getAbstractNodeCount() const;
+		std::size_t getClusterRebuildCount() const;
+
+		//operations
+		void rebuild();
+		void updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares);
+		void pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) const;
+
+	private:
+
+		/// <summary> A connection from one abstract node to another. </summary>
+		struct AbstractEdge {
+			unsigned int target;
+			int cost;
+		};
+
+		/// <summary> A grid square where paths can cross from one cluster into a neighboring cluster. </summary>
+		struct AbstractNode {
+			sf::Vector2i gridSquare;
+			unsigned int cluster;
+			unsigned int transitionCount; // number of border transitions using the node. Zero if the node is unused.
+			std::vector<AbstractEdge> interEdges; // edges to the nodes across the cluster border
+			std::vector<AbstractEdge> intraEdges; // edges to the nodes of the same cluster
+		};
+
+		/// <summary> A rectangular part of the navigation grid that is searched as a unit. </summary>
+		struct Cluster {
+			sf::Vector2i origin;
+			sf::Vector2i size;
+			int minWeight; // the lowest unblocked weight in the cluster. BLOCKED_GRID_WEIGHT if every grid square is blocked.
+			std::vector<unsigned int> nodes;
+		};
+
+		/// <summary> The pairs of abstract nodes connecting two neighboring clusters. </summary>
+		using BorderTransitions = std::vector<std::pair<unsigned int, unsigned int>>;
+
+		//helper functions
+		void findPath(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const;
+		void rebuildBorder(unsigned int cluster, bool isXBorder);
+		void clearBorder(BorderTransitions& borderTransitions);
+		void rebuildCluster(unsigned int cluster);
+		void updateMinGridWeight();
+		unsigned int acquireNode(const sf::Vector2i& gridSquare);
+		void releaseNode(unsigned int node);
+		void searchCluster(unsigned int cluster, const sf::Vector2i& source, const sf::Vector2i* target) const;
+		void appendClusterPath(unsigned int cluster, const sf::Vector2i& source, const sf::Vector2i& target, std::deque<sf::Vector2i>& path) const;
+		void refineAbstractPath(unsigned int endNode, const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const;
+		unsigned int findCluster(const sf::Vector2i& gridSquare) const;
+		unsigned int getClusterIndex(unsigned int clusterX, unsigned int clusterY) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		unsigned int clusterSize;
+		unsigned int clusterCountX;
+		unsigned int clusterCountY;
+		int minGridWeight;
+		std::size_t clusterRebuildCount;
+
+		//abstraction
+		std::vector<Cluster> clusters;
+		std::vector<AbstractNode> abstractNodes;
+		std::vector<unsigned int> freeAbstractNodes;
+		std::vector<unsigned int> gridSquareNodes; // the abstract node of each grid square. NO_NODE if it has none.
+		std::vector<BorderTransitions> xBorderTransitions; // transitions between each cluster and its neighbor at higher x
+		std::vector<BorderTransitions> yBorderTransitions; // transitions between each cluster and its neighbor at higher y
+
+		//search storage
+		mutable PathSearchWorkspace clusterWorkspace;
+		mutable IndexedPriorityQueue<std::uint64_t> abstractOpenSet;
+		mutable std::vector<int> abstractScores;
+		mutable std::vector<unsigned int> abstractCameFrom;
+		mutable std::vector<PATH_SEARCH_NODE_STATE_TYPE> abstractStates;
+		mutable std::vector<std::pair<unsigned int, int>> endNodeCosts;
+		mutable std::vector<unsigned int> abstractRoute;
+		mutable std::vector<sf::Vector2i> segmentBuffer;
+	};
+
+}
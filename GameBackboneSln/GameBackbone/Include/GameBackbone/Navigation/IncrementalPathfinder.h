@@ -0,0 +1,80 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Keeps the search of one path request alive so it can be repaired when the navigation grid changes (D* Lite).
+	/// The search runs backwards from the end point, so it stays valid while the agent moves towards the end.
+	/// After grid squares change, only the part of the search that depended on them is searched again,
+	/// which costs time proportional to the size of the change instead of the size of the grid.
+	/// Use one IncrementalPathfinder for each agent that needs to replan.
+	/// </summary>
+	class libGameBackbone IncrementalPathfinder {
+	public:
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		IncrementalPathfinder();
+		explicit IncrementalPathfinder(NavigationGrid* navigationGrid);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+		void setPathRequest(const PathRequest& pathRequest);
+		void setStart(const sf::Vector2i& start);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		const PathRequest& getPathRequest() const;
+		std::size_t getExpandedNodeCount() const;
+
+		//operations
+		void updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares);
+		void pathFind(std::deque<sf::Vector2i>& returnedPath);
+
+	private:
+
+		/// <summary> The order of grid squares in the open set. Compared by the first value, then the second. </summary>
+		using SearchKey = std::pair<std::int64_t, std::int64_t>;
+
+		//helper functions
+		void resetSearch();
+		void computeShortestPath();
+		void updateGridSquare(unsigned int gridIndex);
+		void queueIfInconsistent(unsigned int gridIndex);
+		int calculateLookahead(unsigned int gridIndex) const;
+		SearchKey calculateKey(unsigned int gridIndex) const;
+		int calculateHeuristic(const sf::Vector2i& from, const sf::Vector2i& to) const;
+		int getTransitionCost(const sf::Vector2i& from, const sf::Vector2i& to) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		PathRequest pathRequest;
+		bool isSearchValid;
+		std::size_t expandedNodeCount;
+
+		//search
+		sf::Vector2u searchSize;
+		sf::Vector2i lastStart; // the start when the key modifier was last raised
+		std::int64_t keyModifier; // raised by the heuristic distance the start moved, so queued keys stay valid
+		int heuristicWeight; // the lowest unblocked weight of the grid when the search was reset
+		std::vector<int> costs; // the cost of reaching the end point from each grid square as of its last expansion
+		std::vector<int> lookaheadCosts; // the cost of reaching the end point from each grid square through its neighbors
+		IndexedPriorityQueue<SearchKey> openSet;
+	};
+
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Stores the exact four neighborhood path cost from a few landmark grid squares to every grid square of a navigation grid.
+	/// Two grid squares can never be closer to each other than the difference of their costs to any landmark,
+	/// which bounds the cost of a path much more tightly than the distance between them on weighted terrain.
+	/// Building the tables searches the whole grid once for each landmark, so they are meant for large maps that rarely change
+	/// and can be built offline, serialized, and deserialized when the map is loaded.
+	/// The bound never overestimates as long as no weight was lowered since the tables were built.
+	/// Queries do not modify the table, so any number of threads may query it.
+	/// </summary>
+	class libGameBackbone LandmarkTable {
+	public:
+
+		/// The cost to grid squares that are blocked or not connected to a landmark.
+		static constexpr unsigned int UNREACHABLE_COST = UINT_MAX;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		LandmarkTable();
+		LandmarkTable(NavigationGrid* navigationGrid, unsigned int landmarkCount);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		const sf::Vector2u& getGridSize() const;
+		unsigned int getLandmarkCount() const;
+		const std::vector<sf::Vector2i>& getLandmarks() const;
+		unsigned int getCost(unsigned int landmark, const sf::Vector2i& gridSquare) const;
+		std::size_t getMemoryUsage() const;
+
+		//operations
+		void build(unsigned int landmarkCount);
+		void clear();
+		unsigned int calcLowerBound(const sf::Vector2i& start, const sf::Vector2i& end) const;
+		bool isBuiltFor(NavigationGrid* navigationGrid) const;
+		std::string serialize() const;
+		bool deserialize(const std::string& serializedTable);
+
+	private:
+
+		//helper functions
+		unsigned int findLargestArea() const;
+		void searchCosts(const sf::Vector2i& landmark, std::vector<unsigned int>& costs) const;
+		static std::uint64_t calcGridHash(NavigationGrid* navigationGrid);
+		bool isUnblocked(const sf::Vector2i& gridSquare) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		sf::Vector2u gridSize;
+		std::uint64_t gridHash; // identifies the weights the tables were built from
+		std::vector<sf::Vector2i> landmarks;
+
+		// the costs of each grid square to every landmark, stored together so a bound reads one block of memory per grid square
+		std::vector<unsigned int> landmarkCosts;
+	};
+
+}
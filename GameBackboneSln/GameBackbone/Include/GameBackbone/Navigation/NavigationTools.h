@@ -2,13 +2,18 @@
 
 #include <GameBackbone/Core/CompoundSprite.h>
 #include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/PackedPathBatch.h>
 #include <GameBackbone/Util/Array2D.h>
+#include <GameBackbone/Util/ChunkedArray2D.h>
 #include <GameBackbone/Util/DllUtil.h>
 #include <GameBackbone/Util/UtilMath.h>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
 #include <deque>
 #include <memory>
 #include <math.h>
@@ -17,11 +22,77 @@
 
 
 namespace GB {
+	class CompactNavigationGrid;
+	class DenseNavigationGrid;
+
 	libGameBackbone typedef Array2D<NavigationGridData*> NavigationGrid;
+	libGameBackbone typedef ChunkedArray2D<NavigationGridData> ChunkedNavigationGrid; // stores grid square data by value in tiles, for very large or streamed worlds
 	libGameBackbone typedef std::deque<sf::Vector2f> WindowCoordinatePath;
 	libGameBackbone typedef std::shared_ptr<WindowCoordinatePath> WindowCoordinatePathPtr;
 	libGameBackbone typedef std::deque<sf::Vector2i> NavGridCoordinatePath;
 
+	//---------------------------------------------------------------------------------------------------------------------
+	// grid squares and steps
+
+	/// The four grid squares sharing a side with a grid square. Opposite offsets are next to each other, so flipping the lowest bit of an index reverses its offset.
+	const sf::Vector2i FOUR_NEIGHBOR_OFFSETS[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+	/// The eight grid squares sharing a side or a corner with a grid square. Starts with the four neighborhood.
+	const sf::Vector2i EIGHT_NEIGHBOR_OFFSETS[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+	/// <summary>
+	/// Determines if a coordinate is within a grid.
+	/// </summary>
+	/// <param name="gridCoordinate">The coordinate.</param>
+	/// <param name="gridSize">The number of grid squares along x and y.</param>
+	/// <returns>True if the coordinate is a grid square of the grid. False otherwise.</returns>
+	inline bool isInGrid(const sf::Vector2i& gridCoordinate, const sf::Vector2u& gridSize) {
+		return static_cast<unsigned int>(gridCoordinate.x) < gridSize.x && static_cast<unsigned int>(gridCoordinate.y) < gridSize.y;
+	}
+
+	/// <summary>
+	/// Flattens a coordinate of a grid into an index for per grid square storage.
+	/// Uses the same x major ordering as Array2D, so lower indexes are also lower according to IsVector2Less.
+	/// </summary>
+	/// <param name="gridCoordinate">The coordinate. Must be within the grid.</param>
+	/// <param name="gridSizeY">The number of grid squares along y.</param>
+	/// <returns>The flattened index of the coordinate.</returns>
+	inline unsigned int flattenGridCoordinate(const sf::Vector2i& gridCoordinate, unsigned int gridSizeY) {
+		return static_cast<unsigned int>(gridCoordinate.x) * gridSizeY + static_cast<unsigned int>(gridCoordinate.y);
+	}
+
+	/// <summary>
+	/// Converts an index made by flattenGridCoordinate back into a coordinate of the grid.
+	/// </summary>
+	/// <param name="gridIndex">The flattened index.</param>
+	/// <param name="gridSizeY">The number of grid squares along y.</param>
+	/// <returns>The coordinate of the grid square.</returns>
+	inline sf::Vector2i expandGridIndex(unsigned int gridIndex, unsigned int gridSizeY) {
+		return sf::Vector2i{static_cast<int>(gridIndex / gridSizeY), static_cast<int>(gridIndex % gridSizeY)};
+	}
+
+	/// <summary>
+	/// Gets the weight of a grid square of a navigation grid.
+	/// </summary>
+	/// <param name="navGrid">The navigation grid.</param>
+	/// <param name="gridSquare">The coordinate of the grid square. Must be within the navigation grid.</param>
+	/// <returns>The weight of the grid square.</returns>
+	inline int getGridWeight(NavigationGrid& navGrid, const sf::Vector2i& gridSquare) {
+		return navGrid.at(static_cast<unsigned int>(gridSquare.x), static_cast<unsigned int>(gridSquare.y))->weight;
+	}
+
+	/// <summary>
+	/// Calculates the cost of a step between two grid squares, which is the average of their weights times the length of the step.
+	/// Every search uses this, so the costs of their paths can be compared.
+	/// </summary>
+	/// <param name="fromWeight">The weight of the grid square the step leaves.</param>
+	/// <param name="toWeight">The weight of the grid square the step enters.</param>
+	/// <param name="stepLength">The length of the step. 1 for a step to a grid square sharing a side.</param>
+	/// <returns>The cost of the step.</returns>
+	inline int calcStepCost(int fromWeight, int toWeight, int stepLength = 1) {
+		return stepLength * (fromWeight + toWeight) / 2;
+	}
+
 	//---------------------------------------------------------------------------------------------------------------------
 	// NavigationGrid memory
 
@@ -44,6 +115,79 @@ namespace GB {
 
 	libGameBackbone extern void freeAllNavigationGridData(NavigationGrid& navGrid);
 
+	//---------------------------------------------------------------------------------------------------------------------
+	// line of sight
+
+	libGameBackbone extern bool hasLineOfSight(NavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern int calcLineOfSightWeight(NavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern bool hasLineOfSight(const DenseNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern int calcLineOfSightWeight(const DenseNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern bool hasLineOfSight(const CompactNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern int calcLineOfSightWeight(const CompactNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern bool hasLineOfSight(const ChunkedNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+	libGameBackbone extern int calcLineOfSightWeight(const ChunkedNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1);
+
+	/// <summary>
+	/// Walks the grid squares the straight line between the centers of two grid squares touches, like calcLineOfSightWeight.
+	/// Use this to check a line against weights that are not stored in a grid, like weights that block grid squares without enough clearance.
+	/// </summary>
+	/// <param name="getWeight">Gets the weight of the grid square at an x and y position.</param>
+	/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+	/// <param name="to">The grid square the line ends in.</param>
+	/// <param name="maxWeight">The highest weight to look past.</param>
+	/// <returns>The weight of the line as described by calcLineOfSightWeight.</returns>
+	template <class WeightGetter>
+	int walkLineOfSight(const WeightGetter& getWeight, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight = BLOCKED_GRID_WEIGHT - 1) {
+		const int xDistance = std::abs(to.x - from.x);
+		const int yDistance = std::abs(to.y - from.y);
+		const int xStep = (to.x > from.x) ? 1 : -1;
+		const int yStep = (to.y > from.y) ? 1 : -1;
+
+		// walk the grid squares in the order the line enters them
+		int lineWeight = INT_MIN;
+		sf::Vector2i current = from;
+		int xStepsTaken = 0;
+		int yStepsTaken = 0;
+		while (xStepsTaken < xDistance || yStepsTaken < yDistance) {
+			// compares where the line leaves the current column and row. Zero means it passes through the corner.
+			const int decision = (1 + 2 * xStepsTaken) * yDistance - (1 + 2 * yStepsTaken) * xDistance;
+			if (decision == 0) {
+				lineWeight = std::max({lineWeight, getWeight(current.x + xStep, current.y), getWeight(current.x, current.y + yStep)});
+				if (lineWeight > maxWeight) {
+					return lineWeight;
+				}
+				current.x += xStep;
+				current.y += yStep;
+				++xStepsTaken;
+				++yStepsTaken;
+			}
+			else if (decision < 0) {
+				current.x += xStep;
+				++xStepsTaken;
+			}
+			else {
+				current.y += yStep;
+				++yStepsTaken;
+			}
+
+			lineWeight = std::max(lineWeight, getWeight(current.x, current.y));
+			if (lineWeight > maxWeight) {
+				return lineWeight;
+			}
+		}
+		return lineWeight;
+	}
+
+	//---------------------------------------------------------------------------------------------------------------------
+	// blocker distance
+
+	libGameBackbone extern void calcBlockerDistances(NavigationGrid& navGrid);
+	libGameBackbone extern void calcBlockerDistances(DenseNavigationGrid& navGrid);
+	libGameBackbone extern void calcBlockerDistances(ChunkedNavigationGrid& navGrid);
+	libGameBackbone extern void updateBlockerDistances(NavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares);
+	libGameBackbone extern void updateBlockerDistances(DenseNavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares);
+	libGameBackbone extern void updateBlockerDistances(ChunkedNavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares);
+
 	//---------------------------------------------------------------------------------------------------------------------
 	// sprite movement to point
 
@@ -146,5 +290,39 @@ namespace GB {
 		}
 	}
 
+	/// <summary>
+	/// Moves a sprite one step forward along a path read directly from a PackedPathBatch.
+	/// Each waypoint is converted to window coordinates when the sprite walks to it, so the path is never copied.
+	/// The sprite will stop after reaching each point in the path even if it is capable of moving farther.
+	/// </summary>
+	/// <param name="sprite">The sprite.</param>
+	/// <param name="path">The path in navigation grid coordinates. Reached waypoints are dropped from its front.</param>
+	/// <param name="converter">Converts navigation grid coordinates to window coordinates, such as a CoordinateConverter.</param>
+	/// <param name="usPassed">Time passed in microseconds.</param>
+	/// <param name="distPerUs">The maximum distance that the sprite can move per microseconds.</param>
+	/// <param name="orientSpriteToDestination">Whether or not the sprites should be oriented to face their destinations.</param>
+	template <class T, class Converter>
+	inline void moveSpriteAlongPath(T& sprite,
+									PackedPath& path,
+									const Converter& converter,
+									sf::Int64 usPassed,
+									float distPerUs,
+									const bool orientSpriteToDestination = true) {
+
+		if (path.empty()) {
+			return;
+		}
+
+		const sf::Vector2f destination = converter.convertCoordToWindow(path.front());
+		const float maxStepLength = usPassed * distPerUs;
+
+		moveSpriteStepTowardsPoint(sprite, destination, maxStepLength, orientSpriteToDestination);
+
+		// if the sprite has reached destination, move on to next point in path
+		if (sprite.getPosition() == destination) {
+			path.popFront();
+		}
+	}
+
 	//---------------------------------------------------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+namespace GB {
+
+	/// <summary> How the waypoints of a PackedPathBatch are stored. </summary>
+	enum PATH_ENCODING_TYPE {
+		PATH_ENCODING_NONE, // every waypoint is stored as its grid square. Fastest to read.
+		PATH_ENCODING_DELTA, // every waypoint is stored as its offset from the previous waypoint in as few bytes as the offset needs
+		PATH_ENCODING_RUN_LENGTH // repeated offsets are stored once with their count. Smallest for paths of grid steps.
+	};
+
+	/// <summary>
+	/// Reads the waypoints of one path of a PackedPathBatch in order, decoding them as it goes.
+	/// </summary>
+	class libGameBackbone PackedPathIterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = sf::Vector2i;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const sf::Vector2i*;
+		using reference = const sf::Vector2i&;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		PackedPathIterator();
+		PackedPathIterator(PATH_ENCODING_TYPE newEncoding,
+						   const sf::Vector2i* newWaypoint,
+						   const std::uint8_t* newEncodedWaypoint,
+						   std::size_t newRemainingWaypointCount);
+
+		//operations
+		reference operator*() const;
+		pointer operator->() const;
+		PackedPathIterator& operator++();
+		PackedPathIterator operator++(int);
+		bool operator==(const PackedPathIterator& other) const;
+		bool operator!=(const PackedPathIterator& other) const;
+
+	private:
+
+		//helper functions
+		void decodeWaypoint();
+		int readSignedValue();
+		std::uint32_t readUnsignedValue();
+
+		//data
+		PATH_ENCODING_TYPE encoding;
+		const sf::Vector2i* waypoint; // the next unencoded waypoint
+		const std::uint8_t* encodedWaypoint; // the next byte of encoded waypoints
+		std::size_t remainingWaypointCount; // includes the current waypoint
+		std::size_t remainingRunLength; // the steps of the current run after the current waypoint
+		sf::Vector2i runOffset;
+		sf::Vector2i currentWaypoint;
+	};
+
+	/// <summary>
+	/// The waypoints of one path stored in a PackedPathBatch. Does not own the waypoints, so it is cheap to copy.
+	/// Waypoints can be dropped from the front, which lets a sprite follow the path without copying it.
+	/// The view is invalidated when its batch is modified or destroyed.
+	/// </summary>
+	class libGameBackbone PackedPath {
+	public:
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		PackedPath();
+		PackedPath(const PackedPathIterator& newBegin, std::size_t newSize);
+
+		//getters
+		PackedPathIterator begin() const;
+		PackedPathIterator end() const;
+		std::size_t size() const;
+		bool empty() const;
+		const sf::Vector2i& front() const;
+
+		//operations
+		void popFront();
+
+	private:
+		PackedPathIterator first;
+		std::size_t waypointCount;
+	};
+
+	/// <summary>
+	/// Stores the paths of a batch of path requests in one contiguous buffer, instead of one deque per path.
+	/// Each path is found by its offset into the buffer at the same index as its request. Like the paths of the Pathfinder,
+	/// every path excludes its start. Encoded paths are decoded while they are read, so they are only read front to back.
+	/// </summary>
+	class libGameBackbone PackedPathBatch {
+	public:
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		PackedPathBatch();
+		explicit PackedPathBatch(PATH_ENCODING_TYPE newEncoding);
+
+		//getters / setters
+
+			//setters
+		void setEncoding(PATH_ENCODING_TYPE newEncoding);
+
+			//getters
+		PATH_ENCODING_TYPE getEncoding() const;
+		std::size_t getPathCount() const;
+		std::size_t getWaypointCount() const;
+		std::size_t getMemoryUsage() const;
+		PackedPath getPath(std::size_t pathIndex) const;
+		void getPath(std::size_t pathIndex, std::deque<sf::Vector2i>& returnedPath) const;
+
+		//operations
+		template <typename WaypointIterator>
+		void appendPath(WaypointIterator first, WaypointIterator last);
+		void appendPath(const std::deque<sf::Vector2i>& path);
+		void appendPath(const PackedPathBatch& otherBatch, std::size_t pathIndex);
+		void assign(const std::vector<std::deque<sf::Vector2i>>& paths);
+		void clear();
+
+	private:
+
+		//helper functions
+		void finishPath(std::size_t pathSize);
+		void writeRun(const sf::Vector2i& runOffset, std::size_t runLength);
+		void writeSignedValue(int value);
+		void writeUnsignedValue(std::uint32_t value);
+
+		//data
+		PATH_ENCODING_TYPE encoding;
+		std::vector<sf::Vector2i> waypoints; // the waypoints of every path without encoding
+		std::vector<std::uint8_t> encodedWaypoints; // the waypoints of every path with delta or run length encoding
+		std::vector<std::size_t> pathOffsets; // the offset of every path into the buffer in use, and the end of the last path
+		std::vector<std::size_t> pathSizes; // the number of waypoints of every path
+		std::size_t waypointCount;
+	};
+
+	//---------------------------------------------------------------------------------------------------------------------
+	// PackedPathIterator
+
+	// The iterator is read for every waypoint a sprite walks to, so it is defined here to be inlined.
+
+	/// <summary> Creates an iterator that is equal to the end of every path. </summary>
+	inline PackedPathIterator::PackedPathIterator() : PackedPathIterator(PATH_ENCODING_NONE, nullptr, nullptr, 0) {
+	}
+
+	/// <summary>
+	/// Creates an iterator at the first waypoint of a path.
+	/// </summary>
+	/// <param name="newEncoding">How the waypoints are stored.</param>
+	/// <param name="newWaypoint">The first unencoded waypoint. Only read without encoding.</param>
+	/// <param name="newEncodedWaypoint">The first byte of the encoded waypoints. Only read with encoding.</param>
+	/// <param name="newRemainingWaypointCount">The number of waypoints of the path.</param>
+	inline PackedPathIterator::PackedPathIterator(PATH_ENCODING_TYPE newEncoding,
+												  const sf::Vector2i* newWaypoint,
+												  const std::uint8_t* newEncodedWaypoint,
+												  std::size_t newRemainingWaypointCount) :
+		encoding(newEncoding),
+		waypoint(newWaypoint),
+		encodedWaypoint(newEncodedWaypoint),
+		remainingWaypointCount(newRemainingWaypointCount),
+		remainingRunLength(0) {
+		if (remainingWaypointCount > 0) {
+			decodeWaypoint();
+		}
+	}
+
+	/// <summary> Gets the current waypoint. Must not be called at the end of the path. </summary>
+	inline PackedPathIterator::reference PackedPathIterator::operator*() const {
+		return currentWaypoint;
+	}
+
+	/// <summary> Gets the current waypoint. Must not be called at the end of the path. </summary>
+	inline PackedPathIterator::pointer PackedPathIterator::operator->() const {
+		return &currentWaypoint;
+	}
+
+	/// <summary> Moves to the next waypoint. </summary>
+	inline PackedPathIterator& PackedPathIterator::operator++() {
+		--remainingWaypointCount;
+		if (remainingWaypointCount > 0) {
+			decodeWaypoint();
+		}
+		return *this;
+	}
+
+	/// <summary> Moves to the next waypoint. </summary>
+	/// <returns>A copy of the iterator before it moved.</returns>
+	inline PackedPathIterator PackedPathIterator::operator++(int) {
+		PackedPathIterator previous = *this;
+		++(*this);
+		return previous;
+	}
+
+	/// <summary> Iterators of the same path are equal when the same number of waypoints remain after them. </summary>
+	inline bool PackedPathIterator::operator==(const PackedPathIterator& other) const {
+		return remainingWaypointCount == other.remainingWaypointCount;
+	}
+
+	/// <summary> Iterators of the same path are equal when the same number of waypoints remain after them. </summary>
+	inline bool PackedPathIterator::operator!=(const PackedPathIterator& other) const {
+		return !(*this == other);
+	}
+
+	/// <summary> Reads the next waypoint into the current waypoint. </summary>
+	inline void PackedPathIterator::decodeWaypoint() {
+		switch (encoding) {
+		case PATH_ENCODING_NONE:
+			currentWaypoint = *waypoint;
+			++waypoint;
+			break;
+		case PATH_ENCODING_DELTA:
+			currentWaypoint.x += readSignedValue();
+			currentWaypoint.y += readSignedValue();
+			break;
+		case PATH_ENCODING_RUN_LENGTH:
+			if (remainingRunLength == 0) {
+				runOffset.x = readSignedValue();
+				runOffset.y = readSignedValue();
+				remainingRunLength = readUnsignedValue();
+			}
+			currentWaypoint += runOffset;
+			--remainingRunLength;
+			break;
+		}
+	}
+
+	/// <summary>
+	/// Reads a value in the format of readUnsignedValue whose lowest bit holds its sign.
+	/// </summary>
+	/// <returns>The value.</returns>
+	inline int PackedPathIterator::readSignedValue() {
+		const std::uint32_t value = readUnsignedValue();
+		return static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1u);
+	}
+
+	/// <summary>
+	/// Reads a value stored in groups of seven bits, lowest group first. The high bit of each byte marks that another group follows.
+	/// </summary>
+	/// <returns>The value.</returns>
+	inline std::uint32_t PackedPathIterator::readUnsignedValue() {
+		std::uint32_t value = 0;
+		int shift = 0;
+		std::uint8_t byte;
+		do {
+			byte = *encodedWaypoint;
+			++encodedWaypoint;
+			value |= (byte & 0x7Fu) << shift;
+			shift += 7;
+		} while ((byte & 0x80u) != 0);
+		return value;
+	}
+
+
+	//---------------------------------------------------------------------------------------------------------------------
+	// PackedPathBatch
+
+	/// <summary>
+	/// Stores a path after the stored paths. Each waypoint is encoded as it is read, so the path needs no other storage.
+	/// </summary>
+	/// <param name="first">An iterator at the first waypoint of the path.</param>
+	/// <param name="last">An iterator past the last waypoint of the path.</param>
+	template <typename WaypointIterator>
+	void PackedPathBatch::appendPath(WaypointIterator first, WaypointIterator last) {
+		std::size_t pathSize = 0;
+		switch (encoding) {
+		case PATH_ENCODING_NONE: {
+			const std::size_t previousSize = waypoints.size();
+			waypoints.insert(waypoints.end(), first, last);
+			pathSize = waypoints.size() - previousSize;
+			break;
+		}
+		case PATH_ENCODING_DELTA: {
+			// the first waypoint is stored as its offset from the origin
+			sf::Vector2i previous;
+			for (; first != last; ++first) {
+				writeSignedValue(first->x - previous.x);
+				writeSignedValue(first->y - previous.y);
+				previous = *first;
+				++pathSize;
+			}
+			break;
+		}
+		case PATH_ENCODING_RUN_LENGTH: {
+			// a run is written once the next offset differs from it
+			sf::Vector2i previous;
+			sf::Vector2i runOffset;
+			std::size_t runLength = 0;
+			for (; first != last; ++first) {
+				const sf::Vector2i offset = *first - previous;
+				if (runLength != 0 && offset != runOffset) {
+					writeRun(runOffset, runLength);
+					runLength = 0;
+				}
+				runOffset = offset;
+				++runLength;
+				previous = *first;
+				++pathSize;
+			}
+			if (runLength != 0) {
+				writeRun(runOffset, runLength);
+			}
+			break;
+		}
+		}
+		finishPath(pathSize);
+	}
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Remembers found paths so repeated path requests are answered without searching.
+	/// Paths are keyed by their start, end, search mode, and the version of the navigation grid they were found on.
+	/// When the cached paths exceed the memory limit, the least recently used paths are discarded first.
+	/// Only paths that exist are cached, since a missing path can be created by a change anywhere on the grid.
+	/// </summary>
+	class libGameBackbone PathCache {
+	public:
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		PathCache();
+
+		//getters / setters
+
+			//setters
+		void setMemoryLimit(std::size_t maxBytes);
+
+			//getters
+		std::size_t getMemoryLimit() const;
+		std::size_t getMemoryUsage() const;
+		std::size_t getPathCount() const;
+		std::uint64_t getGridVersion() const;
+		std::size_t getHitCount() const;
+		std::size_t getMissCount() const;
+
+		//operations
+		bool find(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath);
+		void insert(const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path);
+		void fitToGridSize(const sf::Vector2u& gridSize);
+		void updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares);
+		void invalidate();
+		void clear();
+		void resetCounters();
+
+	private:
+
+		/// <summary> Identifies a cached path. </summary>
+		struct PathKey {
+			sf::Vector2i start;
+			sf::Vector2i end;
+			PATH_SEARCH_MODE_TYPE searchMode;
+			std::uint64_t gridVersion;
+
+			bool operator==(const PathKey& other) const;
+		};
+
+		/// <summary> Hashes a PathKey. </summary>
+		struct PathKeyHash {
+			std::size_t operator()(const PathKey& key) const;
+		};
+
+		/// <summary> A cached path and the memory it is charged for. </summary>
+		struct CachedPath {
+			PathKey key;
+			std::vector<sf::Vector2i> path;
+			std::size_t byteCount;
+		};
+
+		using CachedPathList = std::list<CachedPath>;
+
+		//helper functions
+		PathKey makeKey(const PathRequest& pathRequest) const;
+		CachedPathList::iterator erasePath(CachedPathList::iterator cachedPathIt);
+		void referenceGridSquares(const CachedPath& cachedPath, int referenceChange);
+
+		//data
+		std::size_t memoryLimit;
+		std::size_t memoryUsage;
+		std::uint64_t gridVersion;
+		std::size_t hitCount;
+		std::size_t missCount;
+		sf::Vector2u cacheGridSize;
+
+		CachedPathList cachedPaths; // most recently used first
+		std::unordered_map<PathKey, CachedPathList::iterator, PathKeyHash> pathLookup;
+
+		// the number of cached paths through each grid square, so changes away from every cached path are skipped quickly
+		std::vector<unsigned int> gridSquareReferences;
+		std::vector<unsigned char> changedGridSquareMarks;
+	};
+
+}
@@ -2,24 +2,68 @@
 
 #include <GameBackbone/Util/DllUtil.h>
 #include <GameBackbone/Util/Array2D.h>
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
 #include <GameBackbone/Navigation/NavigationGridData.h>
 #include <GameBackbone/Navigation/PathRequest.h>
 #include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PackedPathBatch.h>
+#include <GameBackbone/Navigation/PathCache.h>
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
 
+#include <SFML/Config.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <deque>
-#include <map>
-#include <set>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace GB {
 
+	class LandmarkTable;
+	class ReachabilityIndex;
+	class WorkerPool;
+
+	/// <summary> Identifies a path request that is solved over several updates. Zero never identifies a request. </summary>
+	using PathRequestHandle = std::uint64_t;
+
+	/// <summary> The grid squares a path may step to from each grid square. </summary>
+	enum PATH_NEIGHBORHOOD_TYPE {
+		PATH_NEIGHBORHOOD_FOUR, // the grid squares sharing a side
+		PATH_NEIGHBORHOOD_EIGHT, // the grid squares sharing a side or a corner
+		PATH_NEIGHBORHOOD_CUSTOM // the offsets passed to setCustomNeighborhood
+	};
+
+	/// <summary> When a diagonal step may pass the corner of a blocked grid square. </summary>
+	enum PATH_CORNER_CUTTING_TYPE {
+		PATH_CORNER_CUTTING_ALLOWED, // diagonal steps ignore the grid squares they pass
+		PATH_CORNER_CUTTING_NO_SQUEEZING, // a diagonal step may not pass between two blocked grid squares
+		PATH_CORNER_CUTTING_FORBIDDEN // a diagonal step may not pass any blocked grid square
+	};
+
+	/// <summary> How a search estimates the remaining cost from a grid square to the end point. </summary>
+	enum PATH_HEURISTIC_TYPE {
+		PATH_HEURISTIC_AUTOMATIC, // the closest estimate that never overestimates in the current neighborhood
+		PATH_HEURISTIC_MANHATTAN, // the number of straight steps. Overestimates when diagonal steps are allowed.
+		PATH_HEURISTIC_OCTILE, // straight and diagonal steps. Overestimates in custom neighborhoods with longer steps.
+		PATH_HEURISTIC_EUCLIDEAN, // the straight line distance. Never overestimates.
+		PATH_HEURISTIC_LANDMARK, // the bound of the landmark table, at least the manhattan distance. Only used in the four neighborhood.
+		PATH_HEURISTIC_NONE // no estimate. Searches every direction equally.
+	};
+
 	/// <summary> used to calculate groups of paths in one navigation grid. </summary>
 	class libGameBackbone Pathfinder {
 	public:
 		//ctr / dtr
 		Pathfinder();
 		explicit Pathfinder(NavigationGrid* navigationGrid);
-		~Pathfinder() = default;
+		explicit Pathfinder(DenseNavigationGrid* navigationGrid);
+		explicit Pathfinder(CompactNavigationGrid* navigationGrid);
+		explicit Pathfinder(const ChunkedNavigationGrid* navigationGrid);
+		explicit Pathfinder(std::nullptr_t);
+		~Pathfinder();
 
 		//deleted copy and assignment
 		Pathfinder(const Pathfinder&) = delete;
@@ -31,22 +75,187 @@ namespace GB {
 
 			//setters
 		void setNavigationGrid(NavigationGrid* navigationGrid);
+		void setNavigationGrid(DenseNavigationGrid* navigationGrid);
+		void setNavigationGrid(CompactNavigationGrid* navigationGrid);
+		void setNavigationGrid(const ChunkedNavigationGrid* navigationGrid);
+		void setNavigationGrid(std::nullptr_t);
+		void setWorkerThreadCount(unsigned int workerThreadCount);
+		void setSearchMode(PATH_SEARCH_MODE_TYPE searchMode);
+		void setReachabilityIndex(const ReachabilityIndex* reachabilityIndex);
+		void setPathCacheMemoryLimit(std::size_t maxBytes);
+		void setNeighborhood(PATH_NEIGHBORHOOD_TYPE neighborhood);
+		void setCustomNeighborhood(const std::vector<sf::Vector2i>& neighborOffsets);
+		void setCornerCutting(PATH_CORNER_CUTTING_TYPE cornerCutting);
+		void setHeuristic(PATH_HEURISTIC_TYPE heuristic);
+		void setHeuristicWeight(double heuristicWeight);
+		void setLandmarkTable(const LandmarkTable* landmarkTable);
+		void setBidirectionalSearchDistance(unsigned int minDistance);
+		void setUnitRadius(unsigned int unitRadius);
 
 		//getters
 		NavigationGrid* getNavigationGrid();
+		DenseNavigationGrid* getDenseNavigationGrid();
+		CompactNavigationGrid* getCompactNavigationGrid();
+		const ChunkedNavigationGrid* getChunkedNavigationGrid() const;
+		unsigned int getWorkerThreadCount() const;
+		std::size_t getWorkspaceAllocationCount() const;
+		PATH_SEARCH_MODE_TYPE getSearchMode() const;
+		const ReachabilityIndex* getReachabilityIndex() const;
+		std::size_t getExpandedNodeCount() const;
+		std::size_t getLineOfSightCheckCount() const;
+		PATH_REQUEST_STATUS_TYPE getPathRequestStatus(PathRequestHandle pathRequestHandle) const;
+		std::size_t getPendingPathRequestCount() const;
+		const PathCache& getPathCache() const;
+		PATH_NEIGHBORHOOD_TYPE getNeighborhood() const;
+		const std::vector<sf::Vector2i>& getNeighborOffsets() const;
+		PATH_CORNER_CUTTING_TYPE getCornerCutting() const;
+		PATH_HEURISTIC_TYPE getHeuristic() const;
+		double getHeuristicWeight() const;
+		const LandmarkTable* getLandmarkTable() const;
+		unsigned int getBidirectionalSearchDistance() const;
+		unsigned int getUnitRadius() const;
 
 		//operations
 		void pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) const;
+		void pathFind(const std::vector<PathRequest>& pathRequests, PackedPathBatch* const returnedPaths) const;
+		PathRequestHandle requestPath(const PathRequest& pathRequest);
+		void cancelPathRequest(PathRequestHandle pathRequestHandle);
+		std::size_t advancePathRequests(std::size_t maxExpandedNodes);
+		std::size_t advancePathRequestsFor(sf::Int64 maxMicroseconds);
+		bool takePath(PathRequestHandle pathRequestHandle, std::deque<sf::Vector2i>& returnedPath);
+		void updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares);
+		void invalidatePathCache();
 
 	private:
+		struct PathRequestRange;
+
+		// lets GameBackboneBenchmarks time the steps of a search on their own
+		friend struct PathfinderBenchmarkAccess;
+
+		/// <summary> The arguments of a call to pathFind, shared with the worker threads. </summary>
+		struct PathBatch {
+			const std::vector<PathRequest>* pathRequests;
+			std::vector<std::deque<sf::Vector2i>>* returnedPaths; // null when each worker packs its paths into its own PackedPathBatch
+			unsigned int workerCount;
+		};
+
+		/// <summary> Where the packed path of a request was stored by the worker that found it. </summary>
+		struct PackedPathLocation {
+			unsigned int workerIndex;
+			std::size_t pathIndex;
+		};
+
+		/// <summary> A path request that is solved over several calls to advancePathRequests. </summary>
+		struct TimeSlicedPathRequest {
+			PathRequest pathRequest;
+			std::deque<sf::Vector2i> path;
+			bool isComplete;
+		};
 
 		//helper functions
-		sf::Vector2i chooseNextGridSquare(const PathRequest& pathRequest, const std::set<sf::Vector2i, IsVector2Less<int>>& availableGridSquares, std::map<sf::Vector2i, int, IsVector2Less<int>>& score) const;
-		std::vector<sf::Vector2i> getNeighbors(const sf::Vector2i& gridCoordinate) const;
-		std::deque<sf::Vector2i> reconstructPath(const sf::Vector2i& endPoint, const std::map<sf::Vector2i, sf::Vector2i, IsVector2Less<int>>& cameFrom) const;
+		unsigned int prepareBatch(const std::vector<PathRequest>& pathRequests) const;
+		void searchBatch(const PathBatch& batch) const;
+		void storeFoundPath(const PathBatch& batch, std::size_t requestIndex, unsigned int workerIndex) const;
+		void findPath(const PathRequest& pathRequest, PathSearchWorkspace& workspace) const;
+		bool beginSearch(const PathRequest& pathRequest, PathSearchWorkspace& workspace) const;
+		bool continueSearch(const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const;
+		template <typename GridReader> bool continueSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const;
+		template <typename GridReader> bool continueBidirectionalSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const;
+		template <typename GridReader> bool continueAnyAngleSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const;
+		std::size_t advanceQueuedPathRequest(std::size_t maxExpandedNodes);
+		bool isPathCacheEnabled() const;
+		bool findCachedPath(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const;
+		bool isCachedRequest(std::size_t requestIndex) const;
+		bool isPathCacheable(const PathRequest& pathRequest) const;
+		PathRequest resolveSearchMode(const PathRequest& pathRequest) const;
+		void prepareWorkspaces(unsigned int workerCount) const;
+		template <typename GridReader> void expandNeighbors(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const;
+		template <typename GridReader> void expandNeighborhood(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const;
+		template <typename GridReader> void expandBidirectionalNeighbors(const GridReader& gridReader, unsigned int currentIndex, PATH_SEARCH_DIRECTION_TYPE direction, const PathRequest& pathRequest, PathSearchWorkspace& workspace) const;
+		template <typename GridReader> void expandAnyAngleNeighbors(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const;
+		template <typename GridReader> void verifyAnyAngleParent(const GridReader& gridReader, unsigned int currentIndex, PathSearchWorkspace& workspace) const;
+		int calcLineCost(const sf::Vector2i& from, const sf::Vector2i& to, int fromWeight, int lineWeight) const;
+		template <typename GridReader> void expandJumpPoints(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const;
+		template <typename GridReader> bool findJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& direction, int regionWeight, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const;
+		template <typename GridReader> bool findHorizontalJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, int xDirection, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const;
+		template <typename GridReader> bool findVerticalJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, int yDirection, int regionWeight, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const;
+		bool isJumpPointSearch(const PathRequest& pathRequest) const;
+		void updateJumpDistances() const;
+		template <typename GridReader> void updateJumpDistances(const GridReader& gridReader) const;
+		template <typename GridReader> int getJumpDistance(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& direction) const;
+		void discoverGridSquare(unsigned int gridIndex, const sf::Vector2i& gridSquare, unsigned int cameFrom, int tentativeScore, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const;
+		bool improveGridSquare(unsigned int gridIndex, unsigned int cameFrom, int tentativeScore, PathSearchWorkspace& workspace, PATH_SEARCH_DIRECTION_TYPE direction) const;
+		template <typename GridReader> bool isCornerCutAllowed(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& offset) const;
+		int getScoreScale(PATH_SEARCH_MODE_TYPE requestSearchMode) const;
+		std::uint64_t calcGridSquarePriority(const sf::Vector2i& gridSquare, const sf::Vector2i& endPoint, int score, PATH_SEARCH_MODE_TYPE requestSearchMode) const;
+		std::uint64_t calcHeuristic(const sf::Vector2i& gridSquare, const sf::Vector2i& endPoint, PATH_SEARCH_MODE_TYPE requestSearchMode) const;
+		PATH_HEURISTIC_TYPE resolveHeuristic(PATH_SEARCH_MODE_TYPE requestSearchMode) const;
+		bool isLandmarkTableUsable() const;
+		void updateNeighborSteps();
+		void updateMinGridWeight() const;
+		bool isReachabilityIndexUsable() const;
+		void getNeighbors(const sf::Vector2i& gridCoordinate, std::vector<sf::Vector2i>& neighbors) const;
+		template <typename GridReader> void getNeighbors(const GridReader& gridReader, const sf::Vector2i& gridCoordinate, std::vector<sf::Vector2i>& neighbors) const;
+		void reconstructPath(unsigned int endIndex, PathSearchWorkspace& workspace, PATH_SEARCH_MODE_TYPE requestSearchMode) const;
+		void reconstructBidirectionalPath(PathSearchWorkspace& workspace) const;
+		bool hasNavigationGrid() const;
+		template <typename Visitor> auto visitGridReader(Visitor&& visitor) const;
+		unsigned int getGridSizeX() const;
+		unsigned int getGridSizeY() const;
+		bool isInGrid(const sf::Vector2i& gridCoordinate) const;
+		int getGridWeight(const sf::Vector2i& gridCoordinate) const;
+		unsigned int flattenGridCoordinate(const sf::Vector2i& gridCoordinate) const;
+		sf::Vector2i expandGridIndex(unsigned int gridIndex) const;
 
 		//data
 		NavigationGrid* navigationGrid;
+		DenseNavigationGrid* denseNavigationGrid; // searched instead of the navigation grid when set
+		CompactNavigationGrid* compactNavigationGrid; // searched instead of the navigation grid when set
+		const ChunkedNavigationGrid* chunkedNavigationGrid; // searched instead of the navigation grid when set. Only read, so no tile is allocated.
+		std::unique_ptr<WorkerPool> workerPool;
+		std::unique_ptr<PathRequestRange[]> requestRanges;
+		PATH_SEARCH_MODE_TYPE searchMode;
+		unsigned int bidirectionalSearchDistance; // requests at least this far apart search from both ends. 0 never switches.
+		const ReachabilityIndex* reachabilityIndex;
+		unsigned int unitRadius; // grid squares with a blocker distance of at most this are blocked. 0 ignores blocker distances.
+
+		//neighborhood
+		PATH_NEIGHBORHOOD_TYPE neighborhood;
+		PATH_CORNER_CUTTING_TYPE cornerCutting;
+		std::vector<sf::Vector2i> neighborOffsets;
+		std::vector<int> neighborStepLengths; // the length of each offset, scaled by STEP_LENGTH_SCALE and rounded
+		double customHeuristicScale; // scales straight line distances so they never exceed the cost of a custom neighborhood path
+
+		//heuristic
+		PATH_HEURISTIC_TYPE heuristic;
+		double heuristicWeight;
+		const LandmarkTable* landmarkTable;
+		mutable int minGridWeight; // the cheapest weight of the grid. Scales heuristics so they never overestimate.
+		mutable bool isMinGridWeightStale; // set when the grid changed, so the next search finds the cheapest weight again
+
+		// jump point search
+		mutable std::vector<int> jumpDistances; // four for each grid square. See updateJumpDistances.
+		mutable bool isJumpDistancesStale; // set when the grid changed, so the next jump point search finds the distances again
+
+		// one reusable set of search storage for each worker thread
+		mutable std::vector<PathSearchWorkspace> workspaces;
+		mutable std::size_t workspaceAllocationCount;
+
+		// paths of repeated requests. Only used by the thread calling pathFind.
+		mutable PathCache pathCache;
+		mutable std::vector<unsigned char> cachedRequestMarks; // marks the requests of the current batch that were found in the cache
+		mutable std::deque<sf::Vector2i> cachedPath; // a path moved between the cache and a packed batch, kept to reuse its memory
+
+		// packed paths of the current batch, one PackedPathBatch for each worker thread
+		mutable std::vector<PackedPathBatch> workerPackedPaths;
+		mutable std::vector<PackedPathLocation> packedPathLocations; // where the path of each request of the batch was packed
+
+		// requests solved over several updates. Only the request at the front of the queue is being searched.
+		std::unordered_map<PathRequestHandle, TimeSlicedPathRequest> timeSlicedPathRequests;
+		std::deque<PathRequestHandle> queuedPathRequests;
+		PathRequestHandle lastPathRequestHandle;
+		bool isTimeSlicedSearchStarted;
+		PathSearchWorkspace timeSlicedWorkspace;
 	};
 
 }
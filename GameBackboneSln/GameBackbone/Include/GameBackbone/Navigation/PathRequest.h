@@ -4,10 +4,28 @@
 #include <SFML/System/Vector2.hpp>
 
 namespace GB {
+
+	/// <summary> The search used to solve a path request. </summary>
+	enum PATH_SEARCH_MODE_TYPE {
+		PATH_SEARCH_MODE_DEFAULT, // use the search mode of the Pathfinder
+		PATH_SEARCH_MODE_STANDARD, // expand every neighbor of every evaluated grid square
+		PATH_SEARCH_MODE_JUMP_POINT, // jump across areas of equal weight and only evaluate the grid squares where paths can turn
+		PATH_SEARCH_MODE_BIDIRECTIONAL, // search from the start and the end at the same time until both searches meet
+		PATH_SEARCH_MODE_ANY_ANGLE // connect grid squares by straight lines of sight at any angle. Paths only hold the grid squares they turn at.
+	};
+
+	/// <summary> The progress of a path request that is solved over several updates. </summary>
+	enum PATH_REQUEST_STATUS_TYPE {
+		PATH_REQUEST_STATUS_INVALID, // the handle does not belong to a request, or its path was already taken
+		PATH_REQUEST_STATUS_PENDING, // the request is waiting for its search or being searched
+		PATH_REQUEST_STATUS_COMPLETE // the search is finished and the path can be taken
+	};
+
 	/// <summary> A request to calculate a path from the start coordinate to the end coordinate. </summary>
 	struct libGameBackbone PathRequest {
 		sf::Vector2i start;
 		sf::Vector2i end;
+		PATH_SEARCH_MODE_TYPE searchMode = PATH_SEARCH_MODE_DEFAULT;
 	};
 
 }
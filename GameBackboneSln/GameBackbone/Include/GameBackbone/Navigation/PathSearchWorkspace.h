@@ -0,0 +1,376 @@
+#pragma once
+
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GB {
+
+	/// <summary> Search state of a single grid square during a path search. </summary>
+	enum PATH_SEARCH_NODE_STATE_TYPE : unsigned char {
+		PATH_SEARCH_NODE_UNVISITED,
+		PATH_SEARCH_NODE_OPEN,
+		PATH_SEARCH_NODE_CLOSED
+	};
+
+	/// <summary> The direction of one half of a bidirectional search. </summary>
+	enum PATH_SEARCH_DIRECTION_TYPE : unsigned char {
+		PATH_SEARCH_DIRECTION_FORWARD, // from the start point towards the end point. The only direction of other searches.
+		PATH_SEARCH_DIRECTION_REVERSE // from the end point back towards the start point
+	};
+
+	/// <summary>
+	/// Reusable storage for one path search over a navigation grid.
+	/// Nodes are indexed by flattened grid coordinate. Every node is stamped with the search that last wrote it,
+	/// so starting a new search does not need to touch every node. Nodes with an old stamp read as unvisited.
+	/// Once fit to a grid, searches on that grid do not allocate.
+	/// Bidirectional searches store their reverse half separately, which is only allocated once a bidirectional search needs it.
+	/// Any angle searches store the weight of the line to each predecessor, which is also only allocated once needed.
+	/// </summary>
+	class PathSearchWorkspace {
+	public:
+
+		/// Marks a node without a predecessor.
+		static constexpr unsigned int NO_NODE = UINT_MAX;
+
+		/// Marks a node whose line to its predecessor is not known.
+		static constexpr int NO_LINE_WEIGHT = INT_MIN;
+
+		/// The largest number of neighbors a node can have.
+		static constexpr std::size_t MAX_NEIGHBOR_COUNT = 8;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="PathSearchWorkspace"/> class that fits an empty grid.
+		/// </summary>
+		PathSearchWorkspace() : meetingNode(NO_NODE), meetingScore(0), currentSearch(0), allocationCount(0), expandedNodeCount(0), lineOfSightCheckCount(0) {}
+
+		//getters / setters
+
+		/// <summary>
+		/// Ensures that the workspace can hold every grid square of a grid of the passed size.
+		/// Discards the current search if the size changes.
+		/// </summary>
+		/// <param name="gridSize">The number of grid squares.</param>
+		/// <returns>True if the storage was reallocated. False if it already fit the grid.</returns>
+		bool fitToGridSize(std::size_t gridSize) {
+			if (nodes.size() == gridSize) {
+				return false;
+			}
+			nodes.assign(gridSize, Node{0, 0, NO_NODE, PATH_SEARCH_NODE_UNVISITED});
+			openSet.setCapacity(gridSize);
+			reverseNodes.clear();
+			reverseOpenSet.setCapacity(0);
+			lineWeights.clear();
+			neighborBuffer.reserve(MAX_NEIGHBOR_COUNT);
+			currentSearch = 0;
+			++allocationCount;
+			return true;
+		}
+
+		/// <summary>
+		/// Ensures that the reverse half of a bidirectional search fits the same grid as the workspace.
+		/// Discards the current search if storage is allocated.
+		/// </summary>
+		/// <returns>True if the storage was allocated. False if it already fit the grid.</returns>
+		bool fitReverseSearch() {
+			if (reverseNodes.size() == nodes.size()) {
+				return false;
+			}
+			reverseNodes.assign(nodes.size(), Node{0, 0, NO_NODE, PATH_SEARCH_NODE_UNVISITED});
+			reverseOpenSet.setCapacity(nodes.size());
+			++allocationCount;
+			return true;
+		}
+
+		/// <summary>
+		/// Ensures that the line weights of an any angle search fit the same grid as the workspace.
+		/// </summary>
+		/// <returns>True if the storage was allocated. False if it already fit the grid.</returns>
+		bool fitAnyAngleSearch() {
+			if (lineWeights.size() == nodes.size()) {
+				return false;
+			}
+			lineWeights.assign(nodes.size(), NO_LINE_WEIGHT);
+			++allocationCount;
+			return true;
+		}
+
+		/// <summary>
+		/// Gets the number of grid squares the workspace fits.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getGridSize() const {
+			return nodes.size();
+		}
+
+		/// <summary>
+		/// Gets the number of times the workspace allocated storage.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getAllocationCount() const {
+			return allocationCount;
+		}
+
+		/// <summary>
+		/// Gets the number of nodes expanded since the counter was last reset.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getExpandedNodeCount() const {
+			return expandedNodeCount;
+		}
+
+		/// <summary>
+		/// Gets the number of lines of sight checked since the counter was last reset.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getLineOfSightCheckCount() const {
+			return lineOfSightCheckCount;
+		}
+
+		/// <summary>
+		/// Gets the state of a node in the current search.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns>The state of the node. Unvisited if the current search has not written the node.</returns>
+		PATH_SEARCH_NODE_STATE_TYPE getState(unsigned int node, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) const {
+			const Node& searchNode = getNodes(direction)[node];
+			return (searchNode.searchStamp == currentSearch) ? searchNode.state : PATH_SEARCH_NODE_UNVISITED;
+		}
+
+		/// <summary>
+		/// Sets the state of a node in the current search.
+		/// A node leaving the unvisited state must also have its score and predecessor set.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="state">The new state.</param>
+		/// <param name="direction">The half of the search.</param>
+		void setState(unsigned int node, PATH_SEARCH_NODE_STATE_TYPE state, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) {
+			Node& searchNode = getNodes(direction)[node];
+			searchNode.searchStamp = currentSearch;
+			searchNode.state = state;
+		}
+
+		/// <summary>
+		/// Gets the cost of reaching a visited node from the start, or from the end in the reverse half.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns></returns>
+		int getScore(unsigned int node, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) const {
+			return getNodes(direction)[node].score;
+		}
+
+		/// <summary>
+		/// Sets the cost of reaching a visited node from the start, or from the end in the reverse half.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="score">The new cost.</param>
+		/// <param name="direction">The half of the search.</param>
+		void setScore(unsigned int node, int score, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) {
+			getNodes(direction)[node].score = score;
+		}
+
+		/// <summary>
+		/// Gets the node a visited node can most efficiently be reached from.
+		/// In the reverse half, this is the node that follows it on the way to the end.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns>The predecessor of the node. NO_NODE if the node has no predecessor.</returns>
+		unsigned int getCameFrom(unsigned int node, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) const {
+			return getNodes(direction)[node].cameFrom;
+		}
+
+		/// <summary>
+		/// Sets the node a visited node can most efficiently be reached from.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="cameFrom">The predecessor of the node. NO_NODE if the node has no predecessor.</param>
+		/// <param name="direction">The half of the search.</param>
+		void setCameFrom(unsigned int node, unsigned int cameFrom, PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) {
+			getNodes(direction)[node].cameFrom = cameFrom;
+		}
+
+		/// <summary>
+		/// Gets the heaviest weight the line from an evaluated node to its predecessor crosses in an any angle search.
+		/// Only valid for closed nodes of the current search.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <returns>The weight of the line. NO_LINE_WEIGHT if it is not known.</returns>
+		int getLineWeight(unsigned int node) const {
+			return lineWeights[node];
+		}
+
+		/// <summary>
+		/// Sets the heaviest weight the line from an evaluated node to its predecessor crosses in an any angle search.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node.</param>
+		/// <param name="lineWeight">The weight of the line. NO_LINE_WEIGHT if it is not known.</param>
+		void setLineWeight(unsigned int node, int lineWeight) {
+			lineWeights[node] = lineWeight;
+		}
+
+		/// <summary>
+		/// Gets the currently discovered nodes that are not evaluated yet, ordered by how promising they are.
+		/// </summary>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns></returns>
+		IndexedPriorityQueue<std::uint64_t>& getOpenSet(PATH_SEARCH_DIRECTION_TYPE direction = PATH_SEARCH_DIRECTION_FORWARD) {
+			return (direction == PATH_SEARCH_DIRECTION_FORWARD) ? openSet : reverseOpenSet;
+		}
+
+		/// <summary>
+		/// Gets the node where both halves of a bidirectional search join into the cheapest path found so far.
+		/// </summary>
+		/// <returns>The node. NO_NODE if the halves have not met.</returns>
+		unsigned int getMeetingNode() const {
+			return meetingNode;
+		}
+
+		/// <summary>
+		/// Gets the cost of the path through the meeting node.
+		/// </summary>
+		/// <returns></returns>
+		int getMeetingScore() const {
+			return meetingScore;
+		}
+
+		/// <summary>
+		/// Records a cheaper path joining both halves of a bidirectional search.
+		/// </summary>
+		/// <param name="node">The flattened grid coordinate of the node where the halves meet.</param>
+		/// <param name="score">The cost of the path through the node.</param>
+		void setMeeting(unsigned int node, int score) {
+			meetingNode = node;
+			meetingScore = score;
+		}
+
+		/// <summary>
+		/// Gets storage for the neighbors of the node being expanded.
+		/// </summary>
+		/// <returns></returns>
+		std::vector<sf::Vector2i>& getNeighborBuffer() {
+			return neighborBuffer;
+		}
+
+		/// <summary>
+		/// Gets storage for the waypoints of the found path, from the end back to the start.
+		/// </summary>
+		/// <returns></returns>
+		std::vector<sf::Vector2i>& getPathBuffer() {
+			return pathBuffer;
+		}
+
+		/// <summary>
+		/// Gets storage for the waypoints of the found path, from the end back to the start.
+		/// </summary>
+		/// <returns></returns>
+		const std::vector<sf::Vector2i>& getPathBuffer() const {
+			return pathBuffer;
+		}
+
+		//operations
+
+		/// <summary>
+		/// Records that the search expanded another node.
+		/// </summary>
+		void countExpandedNode() {
+			++expandedNodeCount;
+		}
+
+		/// <summary>
+		/// Records that the search checked another line of sight.
+		/// </summary>
+		void countLineOfSightCheck() {
+			++lineOfSightCheckCount;
+		}
+
+		/// <summary>
+		/// Resets the number of expanded nodes and checked lines of sight to zero.
+		/// </summary>
+		void resetSearchCounters() {
+			expandedNodeCount = 0;
+			lineOfSightCheckCount = 0;
+		}
+
+		/// <summary>
+		/// Discards the previous search and prepares for a new one. Every node becomes unvisited.
+		/// </summary>
+		void beginSearch() {
+			openSet.clear();
+			reverseOpenSet.clear();
+			meetingNode = NO_NODE;
+			++currentSearch;
+
+			// the stamps wrapped around. Old stamps could match the new search, so clear them.
+			if (currentSearch == 0) {
+				for (Node& node : nodes) {
+					node.searchStamp = 0;
+				}
+				for (Node& node : reverseNodes) {
+					node.searchStamp = 0;
+				}
+				currentSearch = 1;
+			}
+		}
+
+	private:
+
+		/// <summary> Everything a search stores for one grid square. </summary>
+		struct Node {
+			unsigned int searchStamp;
+			int score;
+			unsigned int cameFrom;
+			PATH_SEARCH_NODE_STATE_TYPE state;
+		};
+
+		/// <summary>
+		/// Gets the nodes of one half of the search.
+		/// </summary>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns></returns>
+		std::vector<Node>& getNodes(PATH_SEARCH_DIRECTION_TYPE direction) {
+			return (direction == PATH_SEARCH_DIRECTION_FORWARD) ? nodes : reverseNodes;
+		}
+
+		/// <summary>
+		/// Gets the nodes of one half of the search.
+		/// </summary>
+		/// <param name="direction">The half of the search.</param>
+		/// <returns></returns>
+		const std::vector<Node>& getNodes(PATH_SEARCH_DIRECTION_TYPE direction) const {
+			return (direction == PATH_SEARCH_DIRECTION_FORWARD) ? nodes : reverseNodes;
+		}
+
+		//storage
+		std::vector<Node> nodes;
+		IndexedPriorityQueue<std::uint64_t> openSet;
+		std::vector<sf::Vector2i> neighborBuffer;
+		std::vector<sf::Vector2i> pathBuffer;
+
+		//bidirectional storage
+		std::vector<Node> reverseNodes;
+		IndexedPriorityQueue<std::uint64_t> reverseOpenSet;
+		unsigned int meetingNode;
+		int meetingScore;
+
+		//any angle storage
+		std::vector<int> lineWeights;
+
+		//properties
+		unsigned int currentSearch;
+		std::size_t allocationCount;
+		std::size_t expandedNodeCount;
+		std::size_t lineOfSightCheckCount;
+	};
+
+}
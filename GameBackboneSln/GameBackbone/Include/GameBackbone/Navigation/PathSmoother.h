@@ -0,0 +1,66 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Navigation/CoordinateConverter.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <deque>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Shortens the paths of a Pathfinder to the waypoints a sprite has to turn at.
+	/// Collinear waypoints are removed, and waypoints that can be skipped by walking a straight line are pulled out of the path.
+	/// A straight line is only taken if it does not cross a grid square that is heavier than the grid squares of the path it replaces,
+	/// so shortened paths never cut through blocked or costly terrain the original path went around.
+	/// The remaining waypoints can be turned into a smooth curve in window coordinates.
+	/// Like the paths of the Pathfinder, every path excludes its start.
+	/// </summary>
+	class libGameBackbone PathSmoother {
+	public:
+
+		/// The number of points each segment of a smoothed path is split into if no other count is chosen.
+		static constexpr unsigned int DEFAULT_SAMPLES_PER_SEGMENT = 4;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		PathSmoother();
+		explicit PathSmoother(NavigationGrid* newNavigationGrid);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* newNavigationGrid);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+
+		//operations
+		void removeCollinearWaypoints(const sf::Vector2i& start, std::deque<sf::Vector2i>& path) const;
+		void pullStrings(const sf::Vector2i& start, std::deque<sf::Vector2i>& path) const;
+		void pullStrings(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const paths) const;
+		void smoothPath(const sf::Vector2f& start,
+						const WindowCoordinatePath& path,
+						const CoordinateConverter& converter,
+						WindowCoordinatePath& smoothedPath,
+						unsigned int samplesPerSegment = DEFAULT_SAMPLES_PER_SEGMENT) const;
+
+	private:
+
+		//helper functions
+		bool isCurveClear(const sf::Vector2f& beforeStart,
+						  const sf::Vector2f& segmentStart,
+						  const sf::Vector2f& segmentEnd,
+						  const sf::Vector2f& afterEnd,
+						  const CoordinateConverter& converter,
+						  unsigned int samplesPerSegment) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+	};
+
+}
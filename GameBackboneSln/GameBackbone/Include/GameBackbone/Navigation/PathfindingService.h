@@ -0,0 +1,109 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// <summary> The order in which a PathfindingService searches queued path requests. </summary>
+	enum PATH_REQUEST_PRIORITY_TYPE {
+		PATH_REQUEST_PRIORITY_HIGH, // searched before any other request, for example for units controlled by the player
+		PATH_REQUEST_PRIORITY_NORMAL,
+		PATH_REQUEST_PRIORITY_LOW, // only searched when no other request waits, for example for ambient characters
+		PATH_REQUEST_PRIORITY_COUNT
+	};
+
+	/// <summary>
+	/// Solves path requests on background threads so the thread submitting them never waits for a search.
+	/// The searches read a copy of the navigation grid that is only replaced by updateSnapshot,
+	/// so the game may modify its own grid at any time.
+	/// Requests of the same priority are searched in the order they were submitted.
+	/// </summary>
+	class libGameBackbone PathfindingService {
+	public:
+
+		/// <summary> Receives the path of a request. Empty if no path exists. </summary>
+		using PathCallback = std::function<void(PathRequestHandle, NavGridCoordinatePath)>;
+
+		/// <summary> A submitted path request and the path it will produce. </summary>
+		struct PendingPath {
+			PathRequestHandle handle;
+			std::future<NavGridCoordinatePath> path;
+		};
+
+		//ctr / dtr
+		PathfindingService(NavigationGrid* navigationGrid, unsigned int threadCount);
+		~PathfindingService();
+
+		//deleted copy and assignment
+		PathfindingService(const PathfindingService&) = delete;
+		PathfindingService(PathfindingService&&) = delete;
+		PathfindingService& operator=(const PathfindingService&) = delete;
+		PathfindingService& operator=(PathfindingService&&) = delete;
+
+		//getters
+		unsigned int getThreadCount() const;
+
+		//operations
+		void updateSnapshot(NavigationGrid* navigationGrid);
+		PendingPath requestPath(const PathRequest& pathRequest, PATH_REQUEST_PRIORITY_TYPE priority = PATH_REQUEST_PRIORITY_NORMAL);
+		PathRequestHandle requestPath(const PathRequest& pathRequest, PATH_REQUEST_PRIORITY_TYPE priority, PathCallback callback);
+		void cancelPathRequest(PathRequestHandle pathRequestHandle);
+		std::size_t dispatchCompletedPaths();
+
+	private:
+
+		/// <summary> A copy of a navigation grid. The data of its grid squares is stored by value. </summary>
+		struct GridSnapshot {
+			DenseNavigationGrid navigationGrid;
+		};
+
+		/// <summary> A submitted path request. Owned by the service until its path is delivered or it is canceled. </summary>
+		struct PathJob {
+			PathRequestHandle handle;
+			PathRequest pathRequest;
+			std::promise<NavGridCoordinatePath> promise;
+			PathCallback callback;
+			NavGridCoordinatePath path; // the found path of a callback request until it is dispatched
+			std::atomic<bool> isCanceled{false};
+		};
+
+		//helper functions
+		PathRequestHandle queueJob(std::shared_ptr<PathJob> job, PATH_REQUEST_PRIORITY_TYPE priority);
+		void runWorker();
+		std::shared_ptr<PathJob> popNextJob();
+		bool searchPath(Pathfinder& pathfinder, PathJob& job, NavGridCoordinatePath& returnedPath) const;
+		void completeJob(const std::shared_ptr<PathJob>& job, NavGridCoordinatePath& path);
+		static std::shared_ptr<GridSnapshot> copyNavigationGrid(NavigationGrid* navigationGrid);
+
+		//data
+		std::vector<std::thread> threads;
+		std::mutex serviceMutex;
+		std::condition_variable jobQueued;
+		bool isStopping;
+		PathRequestHandle lastPathRequestHandle;
+		std::shared_ptr<GridSnapshot> snapshot;
+
+		// jobs that were neither delivered nor canceled, by handle
+		std::unordered_map<PathRequestHandle, std::shared_ptr<PathJob>> jobs;
+		std::deque<std::shared_ptr<PathJob>> queuedJobs[PATH_REQUEST_PRIORITY_COUNT];
+		std::vector<PathRequestHandle> completedCallbackJobs;
+	};
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Labels the connected areas of unblocked grid squares of a navigation grid,
+	/// so whether a path exists can be answered without searching.
+	/// Unblocking a grid square merges the areas around it. Blocking one only relabels the area it was part of,
+	/// and only if the grid squares around it are not still connected to each other.
+	/// Queries do not modify the index, so any number of threads may query it while it is not being updated.
+	/// </summary>
+	class libGameBackbone ReachabilityIndex {
+	public:
+
+		/// The component of blocked grid squares and coordinates outside of the grid.
+		static constexpr unsigned int NO_COMPONENT = UINT_MAX;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		ReachabilityIndex();
+		explicit ReachabilityIndex(NavigationGrid* navigationGrid);
+
+		//getters / setters
+
+			//setters
+		void setNavigationGrid(NavigationGrid* navigationGrid);
+
+			//getters
+		NavigationGrid* getNavigationGrid();
+		std::size_t getComponentCount() const;
+		unsigned int getComponent(const sf::Vector2i& gridSquare) const;
+		bool isReachable(const sf::Vector2i& start, const sf::Vector2i& end) const;
+		bool isBuiltFor(const NavigationGrid* otherNavigationGrid) const;
+
+		//operations
+		void rebuild();
+		void updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares);
+
+	private:
+
+		/// The most parts an area can split into when one grid square is blocked.
+		static constexpr unsigned int MAX_SPLIT_SEARCHES = 4;
+
+		//helper functions
+		void blockGridSquare(const sf::Vector2i& gridSquare);
+		void unblockGridSquare(const sf::Vector2i& gridSquare);
+		void splitComponent(const sf::Vector2i* neighbors, unsigned int neighborCount, unsigned int oldLabel);
+		bool areNeighborsLocallyConnected(const sf::Vector2i& gridSquare) const;
+		std::size_t floodComponent(const sf::Vector2i& source, unsigned int label);
+		unsigned int createLabel();
+		unsigned int findLabel(unsigned int label) const;
+		unsigned int mergeLabels(unsigned int lhs, unsigned int rhs);
+		bool isUnblocked(const sf::Vector2i& gridSquare) const;
+
+		//data
+		NavigationGrid* navigationGrid;
+		sf::Vector2u indexSize;
+		std::size_t componentCount;
+
+		// the label of each grid square. Labels that were merged point to the label they were merged into.
+		std::vector<unsigned int> gridSquareLabels;
+		std::vector<unsigned int> labelParents;
+		std::vector<unsigned int> labelSizes; // the number of grid squares of each component, valid for root labels
+		std::vector<sf::Vector2i> floodBuffer;
+
+		//split search storage
+		unsigned int visitGeneration;
+		std::vector<unsigned int> visitGenerations; // the split search that visited each grid square is valid if this matches visitGeneration
+		std::vector<unsigned char> visitSearches;
+		std::vector<sf::Vector2i> splitBuffers[MAX_SPLIT_SEARCHES];
+	};
+
+}
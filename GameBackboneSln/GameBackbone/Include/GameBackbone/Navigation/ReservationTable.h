@@ -0,0 +1,70 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Records which agent occupies which grid square at each time step of a window that starts at the current time.
+	/// Agents that plan against the table avoid the grid squares others reserved, and never swap grid squares with another agent.
+	/// Only the reservations inside the window are stored, so the memory used depends on the number of agents and the window size,
+	/// not on the size of the grid. Advancing the time discards the reservations that fell out of the window.
+	/// </summary>
+	class libGameBackbone ReservationTable {
+	public:
+
+		/// The agent of grid squares that are not reserved.
+		static constexpr unsigned int NO_AGENT = UINT_MAX;
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+		ReservationTable();
+		explicit ReservationTable(unsigned int windowSize);
+
+		//getters / setters
+
+			//setters
+		void setWindowSize(unsigned int windowSize);
+
+			//getters
+		unsigned int getWindowSize() const;
+		unsigned int getCurrentTime() const;
+		std::size_t getReservationCount() const;
+		unsigned int getAgent(const sf::Vector2i& gridSquare, unsigned int time) const;
+
+		//operations
+		bool reserve(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent);
+		void release(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent);
+		bool isFree(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent) const;
+		bool isMoveFree(const sf::Vector2i& from, const sf::Vector2i& to, unsigned int time, unsigned int agent) const;
+		bool isInWindow(unsigned int time) const;
+		void advanceTime(unsigned int steps);
+		void clear();
+
+	private:
+
+		/// <summary> The reservations of one time step, keyed by grid square. </summary>
+		using ReservationLayer = std::unordered_map<std::uint64_t, unsigned int>;
+
+		//helper functions
+		ReservationLayer& getLayer(unsigned int time);
+		const ReservationLayer& getLayer(unsigned int time) const;
+		static std::uint64_t makeKey(const sf::Vector2i& gridSquare);
+
+		//data
+		unsigned int currentTime;
+		std::size_t reservationCount;
+
+		// one layer for each time step of the window, reused as the window moves
+		std::vector<ReservationLayer> layers;
+	};
+
+}
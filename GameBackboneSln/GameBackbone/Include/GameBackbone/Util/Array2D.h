@@ -1,13 +1,132 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace GB {
 
 	/// <summary>
-	/// Store any type in a two dimensional array
+	/// Stores the elements of an Array2D in x major order, so the elements along y are next to each other.
+	/// This is the default layout, and the only one with a contiguous column for each x.
 	/// </summary>
-	template <class templateClass>
+	struct ColumnMajorLayout {
+		/// The elements with the same x are next to each other, so operator[] may return them as one array.
+		static constexpr bool IS_Y_CONTIGUOUS = true;
+
+		/// <summary>
+		/// Calculates the number of elements stored for an array.
+		/// </summary>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The number of stored elements.</returns>
+		static std::size_t calcStorageSize(unsigned int xLength, unsigned int yLength) {
+			return static_cast<std::size_t>(xLength) * yLength;
+		}
+
+		/// <summary>
+		/// Flattens the 2d coordinate into a 1d position.
+		/// </summary>
+		/// <param name="x">The x position of the 2d coordinate.</param>
+		/// <param name="y">The y position of the 2d coordinate.</param>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The position of the 2d coordinate in a 1d format.</returns>
+		static std::size_t flatten2dCoordinate(unsigned int x, unsigned int y, unsigned int /*xLength*/, unsigned int yLength) {
+			return static_cast<std::size_t>(x) * yLength + y;
+		}
+	};
+
+	/// <summary>
+	/// Stores the elements of an Array2D in y major order, so the elements along x are next to each other.
+	/// </summary>
+	struct RowMajorLayout {
+		static constexpr bool IS_Y_CONTIGUOUS = false;
+
+		/// <summary>
+		/// Calculates the number of elements stored for an array.
+		/// </summary>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The number of stored elements.</returns>
+		static std::size_t calcStorageSize(unsigned int xLength, unsigned int yLength) {
+			return static_cast<std::size_t>(xLength) * yLength;
+		}
+
+		/// <summary>
+		/// Flattens the 2d coordinate into a 1d position.
+		/// </summary>
+		/// <param name="x">The x position of the 2d coordinate.</param>
+		/// <param name="y">The y position of the 2d coordinate.</param>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The position of the 2d coordinate in a 1d format.</returns>
+		static std::size_t flatten2dCoordinate(unsigned int x, unsigned int y, unsigned int xLength, unsigned int /*yLength*/) {
+			return static_cast<std::size_t>(y) * xLength + x;
+		}
+	};
+
+	/// <summary>
+	/// Stores the elements of an Array2D in square blocks laid out in x major order, with the elements of each block in Morton (Z) order.
+	/// Neighbors along both x and y are usually in the same cache line or the one next to it, which suits searches and flood fills.
+	/// Blocks along the far edges are padded, so the storage grows to whole blocks.
+	/// </summary>
+	template <unsigned int blockSizeLog2 = 4>
+	struct MortonLayout {
+		static_assert(blockSizeLog2 <= 8, "Morton blocks may be at most 256 elements wide");
+
+		static constexpr bool IS_Y_CONTIGUOUS = false;
+
+		/// The number of elements along each side of a block.
+		static constexpr unsigned int BLOCK_SIZE = 1u << blockSizeLog2;
+
+		/// <summary>
+		/// Calculates the number of elements stored for an array.
+		/// </summary>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The number of stored elements.</returns>
+		static std::size_t calcStorageSize(unsigned int xLength, unsigned int yLength) {
+			return static_cast<std::size_t>(calcBlockCount(xLength)) * calcBlockCount(yLength) * BLOCK_SIZE * BLOCK_SIZE;
+		}
+
+		/// <summary>
+		/// Flattens the 2d coordinate into a 1d position.
+		/// </summary>
+		/// <param name="x">The x position of the 2d coordinate.</param>
+		/// <param name="y">The y position of the 2d coordinate.</param>
+		/// <param name="xLength">Length of the x dimension.</param>
+		/// <param name="yLength">Length of the y dimension.</param>
+		/// <returns>The position of the 2d coordinate in a 1d format.</returns>
+		static std::size_t flatten2dCoordinate(unsigned int x, unsigned int y, unsigned int /*xLength*/, unsigned int yLength) {
+			const std::size_t blockIndex = static_cast<std::size_t>(x >> blockSizeLog2) * calcBlockCount(yLength) + (y >> blockSizeLog2);
+			const unsigned int mortonIndex = (spreadBits(x & (BLOCK_SIZE - 1)) << 1) | spreadBits(y & (BLOCK_SIZE - 1));
+			return (blockIndex << (2 * blockSizeLog2)) + mortonIndex;
+		}
+
+	private:
+		/// <summary>
+		/// Calculates the number of blocks along a dimension.
+		/// </summary>
+		static unsigned int calcBlockCount(unsigned int length) {
+			return (length + BLOCK_SIZE - 1) >> blockSizeLog2;
+		}
+
+		/// <summary>
+		/// Moves each of the low 8 bits of a value to twice its position, so the bits of two values can be interleaved.
+		/// </summary>
+		static unsigned int spreadBits(unsigned int value) {
+			value = (value | (value << 4)) & 0x0F0Fu;
+			value = (value | (value << 2)) & 0x3333u;
+			value = (value | (value << 1)) & 0x5555u;
+			return value;
+		}
+	};
+
+	/// <summary>
+	/// Store any type in a two dimensional array.
+	/// The layout policy decides the order of the elements in memory. See ColumnMajorLayout, RowMajorLayout and MortonLayout.
+	/// </summary>
+	template <class templateClass, class layoutPolicy = ColumnMajorLayout>
 	class Array2D {
 	public:
 
@@ -33,13 +152,13 @@ namespace GB {
 		Array2D(unsigned int xLength, unsigned int yLength) {
 			this->xLength = xLength;
 			this->yLength = yLength;
-			internalArray.resize(xLength * yLength);
+			internalArray.resize(layoutPolicy::calcStorageSize(xLength, yLength));
 		}
 
-		Array2D(const Array2D<templateClass>& other) = default;
-		Array2D(Array2D<templateClass>&& other) noexcept = default;
-		Array2D& operator= (const Array2D<templateClass>& other) = default;
-		Array2D& operator= (Array2D<templateClass>&& other) noexcept = default;
+		Array2D(const Array2D& other) = default;
+		Array2D(Array2D&& other) noexcept = default;
+		Array2D& operator= (const Array2D& other) = default;
+		Array2D& operator= (Array2D&& other) noexcept = default;
 
 		~Array2D() = default;
 
@@ -58,11 +177,12 @@ namespace GB {
 		}
 
 		/// <summary>
-		/// Returns the 1d array for the passed row coordinate
+		/// Returns the 1d array for the passed row coordinate. Only layouts with contiguous columns support this.
 		/// </summary>
 		/// <param name="x">The position of the row to return.</param>
 		/// <returns>Returns the 1d array for the passed row coordinate.</returns>
 		templateClass* operator[] (unsigned int x) {
+			static_assert(layoutPolicy::IS_Y_CONTIGUOUS, "operator[] needs a layout that stores the elements along y next to each other");
 			return &internalArray[flatten2dCoordinate(x, 0)];
 		}
 
@@ -79,7 +199,7 @@ namespace GB {
 		}
 
 		/// <summary>
-		/// Returns the 1d array for the passed row coordinate
+		/// Returns the 1d array for the passed row coordinate. Only layouts with contiguous columns support this.
 		/// </summary>
 		/// <param name="x">The position of the row to return.</param>
 		/// <returns>Returns the 1d array for the passed row coordinate.</returns>
@@ -140,9 +260,8 @@ namespace GB {
         /// <param name="x">The x position of the 2d coordinate.</param>
         /// <param name="y">The y position of the 2d coordinate.</param>
         /// <returns>The position of the 2d coordinate in a 1d format.</returns>
-		unsigned int flatten2dCoordinate(unsigned int x, unsigned int y) const {
-			//return y * xLength + x;
-			return x * yLength + y;
+		std::size_t flatten2dCoordinate(unsigned int x, unsigned int y) const {
+			return layoutPolicy::flatten2dCoordinate(x, y, xLength, yLength);
 		}
 
 		//properties
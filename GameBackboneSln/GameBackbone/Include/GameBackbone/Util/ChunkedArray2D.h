@@ -0,0 +1,329 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Store any type in a two dimensional array that is split into square tiles.
+	/// Tiles are only allocated once an element in them is written, so large worlds that are mostly empty stay small,
+	/// and tiles can be evicted and loaded again to stream regions of a world in and out.
+	/// Elements of tiles that are not allocated read as the default value.
+	/// Tiles, and the elements inside of each tile, use the same x major order as Array2D.
+	/// </summary>
+	template <class templateClass, unsigned int tileSize = 64>
+	class ChunkedArray2D {
+	public:
+		static_assert(tileSize != 0 && (tileSize & (tileSize - 1)) == 0, "the tile size must be a power of two");
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ChunkedArray2D"/> class without elements.
+		/// </summary>
+		ChunkedArray2D() : ChunkedArray2D(0, 0) {}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ChunkedArray2D"/> class with passed x and y dimensions. No tiles are allocated.
+		/// </summary>
+		/// <param name="newXLength">Length of the x dimension.</param>
+		/// <param name="newYLength">Length of the y dimension.</param>
+		/// <param name="newDefaultValue">The value of every element until it is written.</param>
+		ChunkedArray2D(unsigned int newXLength, unsigned int newYLength, const templateClass& newDefaultValue = templateClass()) :
+			xLength(newXLength),
+			yLength(newYLength),
+			tileCountX((newXLength + tileSize - 1) / tileSize),
+			tileCountY((newYLength + tileSize - 1) / tileSize),
+			allocatedTileCount(0),
+			defaultValue(newDefaultValue) {
+			tiles.resize(static_cast<std::size_t>(tileCountX) * tileCountY);
+		}
+
+		//getters / setters
+
+			//reference accessors
+
+		/// <summary>
+		/// Accesses the element at the passed index, allocating its tile if needed.
+		/// </summary>
+		/// <param name="x">The x position of the element. Must be within the array.</param>
+		/// <param name="y">The y position of the element. Must be within the array.</param>
+		/// <returns>Returns a reference to the element at the passed index.</returns>
+		templateClass& operator() (unsigned int x, unsigned int y) {
+			return allocateTile(x / tileSize, y / tileSize)[flattenTileCoordinate(x % tileSize, y % tileSize)];
+		}
+
+		/// <summary>
+		/// Reads the element at the passed index without allocating its tile.
+		/// </summary>
+		/// <param name="x">The x position of the element. Must be within the array.</param>
+		/// <param name="y">The y position of the element. Must be within the array.</param>
+		/// <returns>Returns a reference to the element, or to the default value if its tile is not allocated.</returns>
+		const templateClass& operator() (unsigned int x, unsigned int y) const {
+			const std::vector<templateClass>& tile = tiles[flattenTileIndex(x / tileSize, y / tileSize)];
+			if (tile.empty()) {
+				return defaultValue;
+			}
+			return tile[flattenTileCoordinate(x % tileSize, y % tileSize)];
+		}
+
+		//accessors
+
+		/// <summary>
+		/// Accesses the element at the passed index, allocating its tile if needed.
+		/// </summary>
+		/// <param name="x">The x position of the element. Must be within the array.</param>
+		/// <param name="y">The y position of the element. Must be within the array.</param>
+		/// <returns>Returns a reference to the element at the passed index.</returns>
+		templateClass& at(unsigned int x, unsigned int y) {
+			return (*this)(x, y);
+		}
+
+		/// <summary>
+		/// Reads the element at the passed index without allocating its tile.
+		/// </summary>
+		/// <param name="x">The x position of the element. Must be within the array.</param>
+		/// <param name="y">The y position of the element. Must be within the array.</param>
+		/// <returns>Returns a reference to the element, or to the default value if its tile is not allocated.</returns>
+		const templateClass& at(unsigned int x, unsigned int y) const {
+			return (*this)(x, y);
+		}
+
+		/// <summary>
+		/// Gets the elements of an allocated tile, flattened in x major order with the tile size as the length of each dimension.
+		/// Elements of tiles along the far edges that are outside of the array are kept but never read.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <returns>The first element of the tile, or null if the tile is not allocated.</returns>
+		templateClass* getTileData(unsigned int tileX, unsigned int tileY) {
+			std::vector<templateClass>& tile = tiles[flattenTileIndex(tileX, tileY)];
+			return tile.empty() ? nullptr : tile.data();
+		}
+
+		/// <summary>
+		/// Gets the elements of an allocated tile, like the non const getTileData.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <returns>The first element of the tile, or null if the tile is not allocated.</returns>
+		const templateClass* getTileData(unsigned int tileX, unsigned int tileY) const {
+			const std::vector<templateClass>& tile = tiles[flattenTileIndex(tileX, tileY)];
+			return tile.empty() ? nullptr : tile.data();
+		}
+
+		//getters
+
+		/// <summary>
+		/// Gets the array size in the x dimension.
+		/// </summary>
+		/// <returns></returns>
+		unsigned int getArraySizeX() const {
+			return xLength;
+		}
+
+		/// <summary>
+		/// Gets the array size in the y dimension.
+		/// </summary>
+		/// <returns></returns>
+		unsigned int getArraySizeY() const {
+			return yLength;
+		}
+
+		/// <summary>
+		/// Gets the number of tiles along x.
+		/// </summary>
+		/// <returns></returns>
+		unsigned int getTileCountX() const {
+			return tileCountX;
+		}
+
+		/// <summary>
+		/// Gets the number of tiles along y.
+		/// </summary>
+		/// <returns></returns>
+		unsigned int getTileCountY() const {
+			return tileCountY;
+		}
+
+		/// <summary>
+		/// Gets the number of elements along each dimension of a tile.
+		/// </summary>
+		/// <returns></returns>
+		static constexpr unsigned int getTileSize() {
+			return tileSize;
+		}
+
+		/// <summary>
+		/// Gets the number of tiles that are allocated.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getAllocatedTileCount() const {
+			return allocatedTileCount;
+		}
+
+		/// <summary>
+		/// Gets the value of every element whose tile is not allocated.
+		/// </summary>
+		/// <returns></returns>
+		const templateClass& getDefaultValue() const {
+			return defaultValue;
+		}
+
+		/// <summary>
+		/// Checks if a tile is allocated.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <returns>True if the tile is allocated. False otherwise.</returns>
+		bool isTileAllocated(unsigned int tileX, unsigned int tileY) const {
+			return !tiles[flattenTileIndex(tileX, tileY)].empty();
+		}
+
+		//operations
+
+		/// <summary>
+		/// Allocates a tile, filling it with the default value. Allocated tiles are left unchanged.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <returns>The first element of the tile.</returns>
+		templateClass* allocateTile(unsigned int tileX, unsigned int tileY) {
+			std::vector<templateClass>& tile = tiles[flattenTileIndex(tileX, tileY)];
+			if (tile.empty()) {
+				tile.assign(TILE_AREA, defaultValue);
+				++allocatedTileCount;
+			}
+			return tile.data();
+		}
+
+		/// <summary>
+		/// Frees a tile so its elements read as the default value again.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <returns>The elements of the tile in the order of getTileData, so they can be stored and loaded later. Empty if the tile was not allocated.</returns>
+		std::vector<templateClass> evictTile(unsigned int tileX, unsigned int tileY) {
+			std::vector<templateClass> tile = std::move(tiles[flattenTileIndex(tileX, tileY)]);
+			tiles[flattenTileIndex(tileX, tileY)] = std::vector<templateClass>();
+			if (!tile.empty()) {
+				--allocatedTileCount;
+			}
+			return tile;
+		}
+
+		/// <summary>
+		/// Replaces the elements of a tile, for example with elements returned by evictTile.
+		/// Missing elements get the default value, and extra elements are dropped.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <param name="tileValues">The elements in the order of getTileData.</param>
+		void loadTile(unsigned int tileX, unsigned int tileY, std::vector<templateClass> tileValues) {
+			std::vector<templateClass>& tile = tiles[flattenTileIndex(tileX, tileY)];
+			if (tile.empty()) {
+				++allocatedTileCount;
+			}
+			tileValues.resize(TILE_AREA, defaultValue);
+			tile = std::move(tileValues);
+		}
+
+		/// <summary>
+		/// Calls a function with the position of every allocated tile, in x major order.
+		/// </summary>
+		/// <param name="visitTile">Called with the x and y position of each allocated tile.</param>
+		template <class TileVisitor>
+		void forEachAllocatedTile(const TileVisitor& visitTile) const {
+			for (unsigned int tileX = 0; tileX < tileCountX; ++tileX) {
+				for (unsigned int tileY = 0; tileY < tileCountY; ++tileY) {
+					if (isTileAllocated(tileX, tileY)) {
+						visitTile(tileX, tileY);
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Calls a function with every element of a tile that is within the array. Allocates the tile if needed.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile. Must be within the tiles.</param>
+		/// <param name="tileY">The y position of the tile. Must be within the tiles.</param>
+		/// <param name="visitElement">Called with the x and y position of each element in the array and a reference to it.</param>
+		template <class ElementVisitor>
+		void forEachInTile(unsigned int tileX, unsigned int tileY, const ElementVisitor& visitElement) {
+			templateClass* tile = allocateTile(tileX, tileY);
+			const unsigned int xBegin = tileX * tileSize;
+			const unsigned int yBegin = tileY * tileSize;
+			const unsigned int xEnd = (xLength - xBegin < tileSize) ? xLength : xBegin + tileSize;
+			const unsigned int yEnd = (yLength - yBegin < tileSize) ? yLength : yBegin + tileSize;
+			for (unsigned int x = xBegin; x < xEnd; ++x) {
+				for (unsigned int y = yBegin; y < yEnd; ++y) {
+					visitElement(x, y, tile[flattenTileCoordinate(x - xBegin, y - yBegin)]);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Sets the value of every element and frees every tile. Existing values are overwritten.
+		/// </summary>
+		/// <param name="value">The new value for every element in the array.</param>
+		void initAllValues(const templateClass& value) {
+			defaultValue = value;
+			for (std::vector<templateClass>& tile : tiles) {
+				tile = std::vector<templateClass>();
+			}
+			allocatedTileCount = 0;
+		}
+
+		/// <summary>
+		/// Checks if the given element is within the ChunkedArray2D
+		/// </summary>
+		/// <param name="x">The x position of the element.</param>
+		/// <param name="y">The y position of the element.</param>
+		/// <returns>Returns true if in the ChunkedArray2D, false if not.</returns>
+		bool isInArray(unsigned int x, unsigned int y) const {
+			return x < xLength && y < yLength;
+		}
+
+	private:
+		/// The number of elements in each tile.
+		static constexpr std::size_t TILE_AREA = static_cast<std::size_t>(tileSize) * tileSize;
+
+		//internal helper functions
+
+		/// <summary>
+		/// Flattens the position of a tile into its index in the tile storage.
+		/// </summary>
+		/// <param name="tileX">The x position of the tile.</param>
+		/// <param name="tileY">The y position of the tile.</param>
+		/// <returns>The index of the tile.</returns>
+		std::size_t flattenTileIndex(unsigned int tileX, unsigned int tileY) const {
+			return static_cast<std::size_t>(tileX) * tileCountY + tileY;
+		}
+
+		/// <summary>
+		/// Flattens the position of an element inside of its tile into its index in the tile.
+		/// </summary>
+		/// <param name="localX">The x position of the element inside of its tile.</param>
+		/// <param name="localY">The y position of the element inside of its tile.</param>
+		/// <returns>The index of the element in its tile.</returns>
+		static std::size_t flattenTileCoordinate(unsigned int localX, unsigned int localY) {
+			return static_cast<std::size_t>(localX) * tileSize + localY;
+		}
+
+		//properties
+		unsigned int xLength;
+		unsigned int yLength;
+		unsigned int tileCountX;
+		unsigned int tileCountY;
+		std::size_t allocatedTileCount;
+		templateClass defaultValue;
+
+		//storage
+		std::vector<std::vector<templateClass>> tiles; // an empty tile is not allocated
+	};
+
+}
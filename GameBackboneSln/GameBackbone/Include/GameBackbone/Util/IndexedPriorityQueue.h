@@ -0,0 +1,264 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Binary min heap of unsigned integer handles in the range [0, capacity).
+	/// Each handle can be in the queue at most once. The position of every handle is tracked,
+	/// so the priority of a queued handle can be changed in O(log n) (decrease-key).
+	/// Handles with equal priorities are ordered by their value, lowest first.
+	/// </summary>
+	template <class PriorityType>
+	class IndexedPriorityQueue {
+	public:
+
+		//ctr / dtr
+		//default copy and move are fine for this class
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="IndexedPriorityQueue"/> class that can not hold any handles.
+		/// </summary>
+		IndexedPriorityQueue() = default;
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="IndexedPriorityQueue"/> class that can hold the handles [0, capacity).
+		/// </summary>
+		/// <param name="capacity">One more than the largest handle that can be stored.</param>
+		explicit IndexedPriorityQueue(std::size_t capacity) {
+			setCapacity(capacity);
+		}
+
+		IndexedPriorityQueue(const IndexedPriorityQueue<PriorityType>& other) = default;
+		IndexedPriorityQueue(IndexedPriorityQueue<PriorityType>&& other) noexcept = default;
+		IndexedPriorityQueue& operator= (const IndexedPriorityQueue<PriorityType>& other) = default;
+		IndexedPriorityQueue& operator= (IndexedPriorityQueue<PriorityType>&& other) noexcept = default;
+
+		~IndexedPriorityQueue() = default;
+
+		//getters / setters
+
+		/// <summary>
+		/// Empties the queue and changes the range of handles that it can hold to [0, capacity).
+		/// </summary>
+		/// <param name="capacity">One more than the largest handle that can be stored.</param>
+		void setCapacity(std::size_t capacity) {
+			heap.clear();
+			heap.reserve(capacity);
+			positions.assign(capacity, NOT_QUEUED);
+		}
+
+		/// <summary>
+		/// Gets one more than the largest handle that can be stored.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t getCapacity() const {
+			return positions.size();
+		}
+
+		/// <summary>
+		/// Gets the number of queued handles.
+		/// </summary>
+		/// <returns></returns>
+		std::size_t size() const {
+			return heap.size();
+		}
+
+		/// <summary>
+		/// Checks if there are no queued handles.
+		/// </summary>
+		/// <returns>True if the queue is empty. False otherwise.</returns>
+		bool isEmpty() const {
+			return heap.empty();
+		}
+
+		/// <summary>
+		/// Checks if a handle is in the queue.
+		/// </summary>
+		/// <param name="handle">The handle.</param>
+		/// <returns>True if the handle is queued. False otherwise.</returns>
+		bool isQueued(unsigned int handle) const {
+			return positions[handle] != NOT_QUEUED;
+		}
+
+		/// <summary>
+		/// Gets the queued handle with the lowest priority without removing it.
+		/// The queue must not be empty.
+		/// </summary>
+		/// <returns></returns>
+		unsigned int getTop() const {
+			return heap.front().handle;
+		}
+
+		/// <summary>
+		/// Gets the priority of the queued handle with the lowest priority.
+		/// The queue must not be empty.
+		/// </summary>
+		/// <returns></returns>
+		PriorityType getTopPriority() const {
+			return heap.front().priority;
+		}
+
+		/// <summary>
+		/// Gets the priority of a queued handle.
+		/// </summary>
+		/// <param name="handle">The queued handle.</param>
+		/// <returns></returns>
+		PriorityType getPriority(unsigned int handle) const {
+			return heap[positions[handle]].priority;
+		}
+
+		//operations
+
+		/// <summary>
+		/// Adds a handle to the queue or changes its priority if it is already queued.
+		/// </summary>
+		/// <param name="handle">The handle.</param>
+		/// <param name="priority">The new priority of the handle.</param>
+		void pushOrUpdate(unsigned int handle, PriorityType priority) {
+			if (!isQueued(handle)) {
+				positions[handle] = static_cast<unsigned int>(heap.size());
+				heap.push_back(Entry{priority, handle});
+				siftUp(positions[handle]);
+				return;
+			}
+
+			const unsigned int position = positions[handle];
+			const PriorityType oldPriority = heap[position].priority;
+			heap[position].priority = priority;
+			if (priority < oldPriority) {
+				siftUp(position);
+			}
+			else {
+				siftDown(position);
+			}
+		}
+
+		/// <summary>
+		/// Removes and returns the queued handle with the lowest priority.
+		/// The queue must not be empty.
+		/// </summary>
+		/// <returns>The removed handle.</returns>
+		unsigned int pop() {
+			const unsigned int topHandle = heap.front().handle;
+			positions[topHandle] = NOT_QUEUED;
+
+			const Entry last = heap.back();
+			heap.pop_back();
+			if (!heap.empty()) {
+				heap.front() = last;
+				positions[last.handle] = 0;
+				siftDown(0);
+			}
+			return topHandle;
+		}
+
+		/// <summary>
+		/// Removes a handle from the queue. Does nothing if the handle is not queued.
+		/// </summary>
+		/// <param name="handle">The handle.</param>
+		void remove(unsigned int handle) {
+			if (!isQueued(handle)) {
+				return;
+			}
+			const unsigned int position = positions[handle];
+			positions[handle] = NOT_QUEUED;
+
+			const Entry last = heap.back();
+			heap.pop_back();
+			if (position < heap.size()) {
+				heap[position] = last;
+				positions[last.handle] = position;
+				siftUp(position);
+				siftDown(positions[last.handle]);
+			}
+		}
+
+		/// <summary>
+		/// Removes every handle from the queue.
+		/// Runs in time proportional to the number of queued handles, not the capacity.
+		/// </summary>
+		void clear() {
+			for (const Entry& entry : heap) {
+				positions[entry.handle] = NOT_QUEUED;
+			}
+			heap.clear();
+		}
+
+	private:
+
+		/// <summary> A handle and its priority stored in the heap. </summary>
+		struct Entry {
+			PriorityType priority;
+			unsigned int handle;
+		};
+
+		/// Position of handles that are not in the heap.
+		static constexpr unsigned int NOT_QUEUED = UINT_MAX;
+
+		//internal helper functions
+
+		/// <summary>
+		/// Checks if the first entry should be closer to the top of the heap than the second.
+		/// </summary>
+		/// <param name="lhs">The first entry.</param>
+		/// <param name="rhs">The second entry.</param>
+		/// <returns>True if lhs has the lower priority, or the same priority and the lower handle.</returns>
+		static bool isHigherInHeap(const Entry& lhs, const Entry& rhs) {
+			return lhs.priority < rhs.priority || (!(rhs.priority < lhs.priority) && lhs.handle < rhs.handle);
+		}
+
+		/// <summary>
+		/// Moves the entry at the passed position towards the top of the heap until the heap is ordered.
+		/// </summary>
+		/// <param name="position">The position of the entry.</param>
+		void siftUp(unsigned int position) {
+			const Entry moving = heap[position];
+			while (position > 0) {
+				const unsigned int parent = (position - 1) / 2;
+				if (!isHigherInHeap(moving, heap[parent])) {
+					break;
+				}
+				heap[position] = heap[parent];
+				positions[heap[position].handle] = position;
+				position = parent;
+			}
+			heap[position] = moving;
+			positions[moving.handle] = position;
+		}
+
+		/// <summary>
+		/// Moves the entry at the passed position towards the bottom of the heap until the heap is ordered.
+		/// </summary>
+		/// <param name="position">The position of the entry.</param>
+		void siftDown(unsigned int position) {
+			const Entry moving = heap[position];
+			const std::size_t heapSize = heap.size();
+			while (true) {
+				std::size_t child = 2 * static_cast<std::size_t>(position) + 1;
+				if (child >= heapSize) {
+					break;
+				}
+				if (child + 1 < heapSize && isHigherInHeap(heap[child + 1], heap[child])) {
+					++child;
+				}
+				if (!isHigherInHeap(heap[child], moving)) {
+					break;
+				}
+				heap[position] = heap[child];
+				positions[heap[position].handle] = position;
+				position = static_cast<unsigned int>(child);
+			}
+			heap[position] = moving;
+			positions[moving.handle] = position;
+		}
+
+		//storage
+		std::vector<Entry> heap;
+		std::vector<unsigned int> positions;
+	};
+
+}
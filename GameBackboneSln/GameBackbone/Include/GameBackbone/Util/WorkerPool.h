@@ -0,0 +1,53 @@
+#pragma once
+
+#include <GameBackbone/Util/DllUtil.h>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// A fixed set of persistent worker threads that run the same job in parallel.
+	/// The thread that starts a job participates as worker 0, so a pool of N workers owns N - 1 threads.
+	/// </summary>
+	class libGameBackbone WorkerPool {
+	public:
+		//ctr / dtr
+		explicit WorkerPool(unsigned int workerCount);
+		~WorkerPool();
+
+		//deleted copy and assignment
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool(WorkerPool&&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+		WorkerPool& operator=(WorkerPool&&) = delete;
+
+		//getters
+		unsigned int getWorkerCount() const;
+
+		//operations
+		void runOnAllWorkers(const std::function<void(unsigned int)>& job);
+
+	private:
+		//helper functions
+		void runWorker(unsigned int workerIndex);
+		void runJob(const std::function<void(unsigned int)>& currentJob, unsigned int workerIndex);
+
+		//data
+		std::vector<std::thread> threads;
+		std::mutex poolMutex;
+		std::condition_variable jobStarted;
+		std::condition_variable jobFinished;
+		const std::function<void(unsigned int)>* job;
+		unsigned int jobGeneration;
+		unsigned int busyThreadCount;
+		bool isStopping;
+		std::exception_ptr firstJobException;
+	};
+
+}
@@ -0,0 +1,253 @@
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// <summary>
+	/// Gets the highest cost a grid square can store.
+	/// </summary>
+	/// <param name="costPrecision">The number of bits stored for each cost.</param>
+	/// <returns>The highest cost.</returns>
+	int calcMaxCost(NAVIGATION_COST_PRECISION_TYPE costPrecision) {
+		return (costPrecision == NAVIGATION_COST_PRECISION_8_BIT) ? std::numeric_limits<std::uint8_t>::max() : std::numeric_limits<std::uint16_t>::max();
+	}
+
+	/// <summary>
+	/// Finds the smallest weight scale that stores every unblocked weight of a grid without clamping.
+	/// </summary>
+	/// <param name="getWeight">Gets the weight of the grid square at an x and y position.</param>
+	/// <param name="sizeX">The number of grid squares along x.</param>
+	/// <param name="sizeY">The number of grid squares along y.</param>
+	/// <param name="costPrecision">The number of bits stored for each cost.</param>
+	/// <returns>The weight scale. At least 1.</returns>
+	template <class WeightGetter>
+	int calcWeightScale(const WeightGetter& getWeight, unsigned int sizeX, unsigned int sizeY, NAVIGATION_COST_PRECISION_TYPE costPrecision) {
+		int maxWeight = 0;
+		for (unsigned int x = 0; x < sizeX; ++x) {
+			for (unsigned int y = 0; y < sizeY; ++y) {
+				const int weight = getWeight(x, y);
+				if (weight < BLOCKED_GRID_WEIGHT) {
+					maxWeight = std::max(maxWeight, weight);
+				}
+			}
+		}
+		const int maxCost = calcMaxCost(costPrecision);
+		return std::max(1, (maxWeight + maxCost - 1) / maxCost);
+	}
+
+	/// <summary>
+	/// Gets the weight of a grid square of a NavigationGrid. Grid squares without data weigh 0.
+	/// </summary>
+	int getNavigationGridWeight(NavigationGrid& navigationGrid, unsigned int x, unsigned int y) {
+		const NavigationGridData* gridData = navigationGrid.at(x, y);
+		return (gridData == nullptr) ? 0 : gridData->weight;
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CompactNavigationGrid"/> class without grid squares.
+/// </summary>
+CompactNavigationGrid::CompactNavigationGrid() : CompactNavigationGrid(0, 0) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CompactNavigationGrid"/> class. Every grid square is passable and weighs 0.
+/// </summary>
+/// <param name="newSizeX">The number of grid squares along x.</param>
+/// <param name="newSizeY">The number of grid squares along y.</param>
+/// <param name="newCostPrecision">The number of bits stored for the cost of each grid square.</param>
+/// <param name="newWeightScale">The weight of one unit of cost. Values below 1 are raised to 1.</param>
+CompactNavigationGrid::CompactNavigationGrid(unsigned int newSizeX, unsigned int newSizeY, NAVIGATION_COST_PRECISION_TYPE newCostPrecision, int newWeightScale) :
+	sizeX(newSizeX),
+	sizeY(newSizeY),
+	costPrecision(newCostPrecision),
+	weightScale(std::max(newWeightScale, 1)) {
+	const std::size_t gridSquareCount = static_cast<std::size_t>(newSizeX) * newSizeY;
+	passabilityWords.assign((gridSquareCount + BITS_PER_WORD - 1) / BITS_PER_WORD, ~std::uint64_t{0});
+	if (costPrecision == NAVIGATION_COST_PRECISION_8_BIT) {
+		costs8.assign(gridSquareCount, 0);
+	}
+	else {
+		costs16.assign(gridSquareCount, 0);
+	}
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CompactNavigationGrid"/> class with the weights of a NavigationGrid.
+/// The weight scale is the smallest that stores the heaviest unblocked weight without clamping.
+/// Grid squares without data weigh 0.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid to convert.</param>
+/// <param name="newCostPrecision">The number of bits stored for the cost of each grid square.</param>
+CompactNavigationGrid::CompactNavigationGrid(NavigationGrid& navigationGrid, NAVIGATION_COST_PRECISION_TYPE newCostPrecision) :
+	CompactNavigationGrid(navigationGrid.getArraySizeX(), navigationGrid.getArraySizeY(), newCostPrecision,
+		calcWeightScale([&navigationGrid](unsigned int x, unsigned int y) { return getNavigationGridWeight(navigationGrid, x, y); },
+			navigationGrid.getArraySizeX(), navigationGrid.getArraySizeY(), newCostPrecision)) {
+	for (unsigned int x = 0; x < sizeX; ++x) {
+		for (unsigned int y = 0; y < sizeY; ++y) {
+			setWeight(x, y, getNavigationGridWeight(navigationGrid, x, y));
+		}
+	}
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CompactNavigationGrid"/> class with the weights of a DenseNavigationGrid.
+/// The weight scale is the smallest that stores the heaviest unblocked weight without clamping.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid to convert.</param>
+/// <param name="newCostPrecision">The number of bits stored for the cost of each grid square.</param>
+CompactNavigationGrid::CompactNavigationGrid(const DenseNavigationGrid& navigationGrid, NAVIGATION_COST_PRECISION_TYPE newCostPrecision) :
+	CompactNavigationGrid(navigationGrid.getArraySizeX(), navigationGrid.getArraySizeY(), newCostPrecision,
+		calcWeightScale([&navigationGrid](unsigned int x, unsigned int y) { return navigationGrid.getWeight(x, y); },
+			navigationGrid.getArraySizeX(), navigationGrid.getArraySizeY(), newCostPrecision)) {
+	for (unsigned int x = 0; x < sizeX; ++x) {
+		for (unsigned int y = 0; y < sizeY; ++y) {
+			setWeight(x, y, navigationGrid.getWeight(x, y));
+		}
+	}
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the weight of a grid square, updating its passability and its cost together.
+/// Weights of BLOCKED_GRID_WEIGHT and above block the grid square. Lower weights are divided by the weight scale,
+/// rounded to the closest cost and clamped to the costs the precision can store. Negative weights cost 0.
+/// </summary>
+/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+/// <param name="newWeight">The weight.</param>
+void CompactNavigationGrid::setWeight(unsigned int x, unsigned int y, int newWeight) {
+	const std::size_t gridIndex = flattenGridCoordinate(x, y);
+	const std::uint64_t passabilityBit = std::uint64_t{1} << (gridIndex % BITS_PER_WORD);
+	int cost = 0;
+	if (newWeight >= BLOCKED_GRID_WEIGHT) {
+		passabilityWords[gridIndex / BITS_PER_WORD] &= ~passabilityBit;
+	}
+	else {
+		passabilityWords[gridIndex / BITS_PER_WORD] |= passabilityBit;
+		cost = std::min((std::max(newWeight, 0) + weightScale / 2) / weightScale, calcMaxCost(costPrecision));
+	}
+
+	if (costPrecision == NAVIGATION_COST_PRECISION_8_BIT) {
+		costs8[gridIndex] = static_cast<std::uint8_t>(cost);
+	}
+	else {
+		costs16[gridIndex] = static_cast<std::uint16_t>(cost);
+	}
+}
+
+//getters
+
+/// <summary>
+/// Determines if a run of grid squares with the same x position is passable.
+/// The grid squares of a column are adjacent in the passability plane, so up to 64 of them are tested at once.
+/// </summary>
+/// <param name="x">The x position of the column. Must be within the grid.</param>
+/// <param name="yBegin">The y position of the first grid square of the run.</param>
+/// <param name="yEnd">The y position after the last grid square of the run. Must not exceed the grid size in the y dimension.</param>
+/// <returns>True if every grid square of the run is passable, or if the run is empty. False otherwise.</returns>
+bool CompactNavigationGrid::isColumnPassable(unsigned int x, unsigned int yBegin, unsigned int yEnd) const {
+	if (yBegin >= yEnd) {
+		return true;
+	}
+	std::size_t gridIndex = flattenGridCoordinate(x, yBegin);
+	const std::size_t endIndex = gridIndex + (yEnd - yBegin);
+	while (gridIndex < endIndex) {
+		const std::size_t firstBit = gridIndex % BITS_PER_WORD;
+		const std::size_t bitCount = std::min(BITS_PER_WORD - firstBit, endIndex - gridIndex);
+		const std::uint64_t mask = (bitCount == BITS_PER_WORD) ? ~std::uint64_t{0} : (((std::uint64_t{1} << bitCount) - 1) << firstBit);
+		if ((passabilityWords[gridIndex / BITS_PER_WORD] & mask) != mask) {
+			return false;
+		}
+		gridIndex += bitCount;
+	}
+	return true;
+}
+
+/// <summary>
+/// Gets the passability plane. Bit i of word w is set if the grid square flattened to w * 64 + i is passable.
+/// Bits past the last grid square are set.
+/// </summary>
+/// <returns>The passability plane.</returns>
+const std::vector<std::uint64_t>& CompactNavigationGrid::getPassabilityWords() const {
+	return passabilityWords;
+}
+
+/// <summary>
+/// Gets the number of bits stored for the cost of each grid square.
+/// </summary>
+/// <returns>The cost precision.</returns>
+NAVIGATION_COST_PRECISION_TYPE CompactNavigationGrid::getCostPrecision() const {
+	return costPrecision;
+}
+
+/// <summary>
+/// Gets the weight of one unit of cost.
+/// </summary>
+/// <returns>The weight scale.</returns>
+int CompactNavigationGrid::getWeightScale() const {
+	return weightScale;
+}
+
+/// <summary>
+/// Gets the highest weight a passable grid square can have. Heavier unblocked weights are clamped to it.
+/// </summary>
+/// <returns>The highest cost times the weight scale.</returns>
+int CompactNavigationGrid::getMaxWeight() const {
+	return calcMaxCost(costPrecision) * weightScale;
+}
+
+/// <summary>
+/// Gets the number of bytes used by the grid.
+/// </summary>
+/// <returns>The number of bytes.</returns>
+std::size_t CompactNavigationGrid::getMemoryUsage() const {
+	return sizeof(CompactNavigationGrid) + passabilityWords.capacity() * sizeof(std::uint64_t) +
+		costs8.capacity() * sizeof(std::uint8_t) + costs16.capacity() * sizeof(std::uint16_t);
+}
+
+//operations
+
+/// <summary>
+/// Copies the weights of edited grid squares from the NavigationGrid the compact grid was converted from.
+/// The weight scale is kept, so weights above the max weight are clamped.
+/// </summary>
+/// <param name="navigationGrid">The edited navigation grid. Must have the size of the compact grid.</param>
+/// <param name="changedGridSquares">The grid squares whose weight changed. Grid squares outside of the grid are ignored.</param>
+void CompactNavigationGrid::updateGridSquares(NavigationGrid& navigationGrid, const std::vector<sf::Vector2i>& changedGridSquares) {
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		const unsigned int x = static_cast<unsigned int>(gridSquare.x);
+		const unsigned int y = static_cast<unsigned int>(gridSquare.y);
+		if (isInArray(x, y)) {
+			setWeight(x, y, getNavigationGridWeight(navigationGrid, x, y));
+		}
+	}
+}
+
+/// <summary>
+/// Copies the weights of edited grid squares from the DenseNavigationGrid the compact grid was converted from.
+/// The weight scale is kept, so weights above the max weight are clamped.
+/// </summary>
+/// <param name="navigationGrid">The edited navigation grid. Must have the size of the compact grid.</param>
+/// <param name="changedGridSquares">The grid squares whose weight changed. Grid squares outside of the grid are ignored.</param>
+void CompactNavigationGrid::updateGridSquares(const DenseNavigationGrid& navigationGrid, const std::vector<sf::Vector2i>& changedGridSquares) {
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		const unsigned int x = static_cast<unsigned int>(gridSquare.x);
+		const unsigned int y = static_cast<unsigned int>(gridSquare.y);
+		if (isInArray(x, y)) {
+			setWeight(x, y, navigationGrid.getWeight(x, y));
+		}
+	}
+}
@@ -0,0 +1,635 @@
+#include <GameBackbone/Navigation/CooperativePathfinder.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// The cost of grid squares that can not reach the goal.
+	const int UNREACHABLE_COST = INT_MAX;
+
+	/// The index of the node before the first node of a search.
+	const unsigned int NO_NODE = UINT_MAX;
+
+	/// Bits of a node priority that break ties between equal estimates in favor of nodes closer to the goal.
+	const unsigned int TIE_BREAK_BITS = 20;
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CooperativePathfinder"/> class without a navigation grid.
+/// </summary>
+CooperativePathfinder::CooperativePathfinder() : CooperativePathfinder(nullptr) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="CooperativePathfinder"/> class.
+/// </summary>
+/// <param name="navigationGrid">The grid to find paths on. May be null.</param>
+/// <param name="windowSize">The number of time steps each agent plans without conflicts. At least 1.</param>
+CooperativePathfinder::CooperativePathfinder(NavigationGrid* newNavigationGrid, unsigned int windowSize) :
+	navigationGrid(newNavigationGrid),
+	reservationTable(std::max(windowSize, 1u)),
+	expandedNodeCount(0),
+	heuristicWeight(0) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid. Every agent forgets the costs of its goal and plans again.
+/// Must also be called after the weights of the current grid change.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void CooperativePathfinder::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+	goalDistancesByGoal.clear();
+	for (Agent& agent : agents) {
+		if (agent.isActive && isInGrid(agent.goal, getGridSize())) {
+			acquireGoalDistances(agent.goal, agent.position);
+		}
+	}
+	replanAgents();
+}
+
+/// <summary>
+/// Sets the number of time steps each agent plans without conflicts. Every agent plans again.
+/// Larger windows resolve more conflicts in advance, but every search costs more.
+/// </summary>
+/// <param name="windowSize">The number of time steps. At least 1.</param>
+void CooperativePathfinder::setWindowSize(unsigned int windowSize) {
+	reservationTable.setWindowSize(std::max(windowSize, 1u));
+	replanAgents();
+}
+
+/// <summary>
+/// Moves the goal of an agent. The agent plans again right away.
+/// </summary>
+/// <param name="agent">The agent returned by addAgent.</param>
+/// <param name="goal">The new goal.</param>
+void CooperativePathfinder::setAgentGoal(unsigned int agent, const sf::Vector2i& goal) {
+	if (!agents[agent].isActive) {
+		return;
+	}
+	releaseGoalDistances(agents[agent].goal);
+	agents[agent].goal = goal;
+	if (isInGrid(goal, getGridSize())) {
+		acquireGoalDistances(goal, agents[agent].position);
+	}
+	planAgent(agent);
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* CooperativePathfinder::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the number of time steps each agent plans without conflicts.
+/// </summary>
+/// <returns>The window size.</returns>
+unsigned int CooperativePathfinder::getWindowSize() const {
+	return reservationTable.getWindowSize();
+}
+
+/// <summary>
+/// Gets the number of times update was called.
+/// </summary>
+/// <returns>The current time step.</returns>
+unsigned int CooperativePathfinder::getCurrentTime() const {
+	return reservationTable.getCurrentTime();
+}
+
+/// <summary>
+/// Gets the number of agents that were added, including removed agents.
+/// </summary>
+/// <returns>One more than the largest agent.</returns>
+std::size_t CooperativePathfinder::getAgentCount() const {
+	return agents.size();
+}
+
+/// <summary>
+/// Gets the grid square an agent occupies at the current time step.
+/// </summary>
+/// <param name="agent">The agent returned by addAgent.</param>
+/// <returns>The position of the agent.</returns>
+const sf::Vector2i& CooperativePathfinder::getAgentPosition(unsigned int agent) const {
+	return agents[agent].position;
+}
+
+/// <summary>
+/// Gets the goal of an agent.
+/// </summary>
+/// <param name="agent">The agent returned by addAgent.</param>
+/// <returns>The goal of the agent.</returns>
+const sf::Vector2i& CooperativePathfinder::getAgentGoal(unsigned int agent) const {
+	return agents[agent].goal;
+}
+
+/// <summary>
+/// Gets the planned path of an agent, excluding its position.
+/// The steps inside the window take one time step each and may repeat a grid square where the agent waits.
+/// The steps after the window are the cheapest route to the goal and ignore the other agents.
+/// </summary>
+/// <param name="agent">The agent returned by addAgent.</param>
+/// <param name="returnedPath">Output deque. Receives the planned path. Empty if the agent waits or can not reach its goal.</param>
+void CooperativePathfinder::getAgentPath(unsigned int agent, std::deque<sf::Vector2i>& returnedPath) const {
+	const Agent& plannedAgent = agents[agent];
+	returnedPath.assign(plannedAgent.windowPath.begin(), plannedAgent.windowPath.end());
+	returnedPath.insert(returnedPath.end(), plannedAgent.route.begin(), plannedAgent.route.end());
+}
+
+/// <summary>
+/// Gets the reservations of every agent.
+/// </summary>
+/// <returns>The reservation table.</returns>
+const ReservationTable& CooperativePathfinder::getReservationTable() const {
+	return reservationTable;
+}
+
+/// <summary>
+/// Gets the number of space time nodes that were expanded since the most recent call to pathFind or update.
+/// </summary>
+/// <returns>The number of expanded nodes.</returns>
+std::size_t CooperativePathfinder::getExpandedNodeCount() const {
+	return expandedNodeCount;
+}
+
+//operations
+
+/// <summary>
+/// Replaces every agent with one agent for each path request and plans their paths in the order of the requests.
+/// The agent of each request is its index, so update can move the agents along their paths afterwards.
+/// </summary>
+/// <param name="pathRequests">The start and goal of each agent. Their search modes are ignored.</param>
+/// <param name="returnedPaths">Output vector. Receives the planned path of each agent as returned by getAgentPath.</param>
+void CooperativePathfinder::pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) {
+	clearAgents();
+	expandedNodeCount = 0;
+	for (const PathRequest& pathRequest : pathRequests) {
+		addAgent(pathRequest);
+	}
+
+	returnedPaths->resize(pathRequests.size());
+	for (unsigned int agent = 0; agent < pathRequests.size(); ++agent) {
+		getAgentPath(agent, (*returnedPaths)[agent]);
+	}
+}
+
+/// <summary>
+/// Adds an agent and plans its path around the agents that were already planned.
+/// </summary>
+/// <param name="pathRequest">The position and goal of the agent. Its search mode is ignored.</param>
+/// <returns>The agent, which identifies it in the other calls.</returns>
+unsigned int CooperativePathfinder::addAgent(const PathRequest& pathRequest) {
+	const unsigned int agent = static_cast<unsigned int>(agents.size());
+	agents.push_back(Agent{pathRequest.start, pathRequest.end, {}, {}, getCurrentTime(), true});
+	if (isInGrid(pathRequest.end, getGridSize())) {
+		acquireGoalDistances(pathRequest.end, pathRequest.start);
+	}
+	planAgent(agent);
+	return agent;
+}
+
+/// <summary>
+/// Removes an agent and releases its reservations. Other agents keep their numbers.
+/// </summary>
+/// <param name="agent">The agent returned by addAgent.</param>
+void CooperativePathfinder::removeAgent(unsigned int agent) {
+	if (!agents[agent].isActive) {
+		return;
+	}
+	releaseAgent(agent);
+	releaseGoalDistances(agents[agent].goal);
+	agents[agent].isActive = false;
+	agents[agent].windowPath.clear();
+	agents[agent].route.clear();
+}
+
+/// <summary>
+/// Removes every agent and every reservation.
+/// </summary>
+void CooperativePathfinder::clearAgents() {
+	agents.clear();
+	goalDistancesByGoal.clear();
+	reservationTable.clear();
+}
+
+/// <summary>
+/// Moves every agent one step along its path and rolls the window forward by one time step.
+/// Agents plan again in turns every half window, and whenever their reservations run out.
+/// </summary>
+void CooperativePathfinder::update() {
+	expandedNodeCount = 0;
+	reservationTable.advanceTime(1);
+	for (Agent& agent : agents) {
+		if (agent.isActive && !agent.windowPath.empty()) {
+			agent.position = agent.windowPath.front();
+			agent.windowPath.pop_front();
+		}
+	}
+
+	// spread the searches over the updates
+	const unsigned int replanInterval = std::max(getWindowSize() / 2, 1u);
+	const unsigned int currentTime = getCurrentTime();
+	for (unsigned int agent = 0; agent < agents.size(); ++agent) {
+		if (agents[agent].isActive && ((currentTime + agent) % replanInterval == 0 || currentTime >= agents[agent].reservedUntil)) {
+			planAgent(agent);
+		}
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Discards every reservation and plans every agent again in the order they were added.
+/// </summary>
+void CooperativePathfinder::replanAgents() {
+	reservationTable.clear();
+	for (unsigned int agent = 0; agent < agents.size(); ++agent) {
+		agents[agent].reservedUntil = getCurrentTime();
+	}
+	for (unsigned int agent = 0; agent < agents.size(); ++agent) {
+		if (agents[agent].isActive) {
+			planAgent(agent);
+		}
+	}
+}
+
+/// <summary>
+/// Replaces the plan of an agent with a new plan around the reservations of the other agents, and reserves it.
+/// Agents that can not reach their goal still plan, so they step out of the way of the others.
+/// Agents that find no plan at all wait where they are.
+/// </summary>
+/// <param name="agent">The agent.</param>
+void CooperativePathfinder::planAgent(unsigned int agent) {
+	releaseAgent(agent);
+	Agent& plannedAgent = agents[agent];
+	plannedAgent.windowPath.clear();
+	plannedAgent.route.clear();
+	if (!isInGrid(plannedAgent.position, getGridSize())) {
+		reserveAgent(agent);
+		return;
+	}
+
+	GoalDistances* goalDistances = nullptr;
+	if (isInGrid(plannedAgent.goal, getGridSize())) {
+		const auto goalDistancesIt = goalDistancesByGoal.find(flattenGridCoordinate(plannedAgent.goal, navigationGrid->getArraySizeY()));
+		if (goalDistancesIt != goalDistancesByGoal.end() && getGoalDistance(goalDistancesIt->second, flattenGridCoordinate(plannedAgent.position, navigationGrid->getArraySizeY())) != UNREACHABLE_COST) {
+			goalDistances = &goalDistancesIt->second;
+		}
+	}
+
+	unsigned int lastNode = NO_NODE;
+	if (searchWindow(agent, goalDistances, lastNode)) {
+		// the route after the window continues from the last planned grid square
+		if (goalDistances != nullptr && searchNodes[lastNode].gridIndex != flattenGridCoordinate(plannedAgent.goal, navigationGrid->getArraySizeY())) {
+			buildRoute(expandGridIndex(searchNodes[lastNode].gridIndex, navigationGrid->getArraySizeY()), *goalDistances, plannedAgent.route);
+		}
+		for (unsigned int node = lastNode; searchNodes[node].cameFrom != NO_NODE; node = searchNodes[node].cameFrom) {
+			plannedAgent.windowPath.push_front(expandGridIndex(searchNodes[node].gridIndex, navigationGrid->getArraySizeY()));
+		}
+
+		// the agent holds its last grid square after its planned steps, so waiting there is implied
+		if (plannedAgent.route.empty()) {
+			while (!plannedAgent.windowPath.empty() &&
+				plannedAgent.windowPath.back() == ((plannedAgent.windowPath.size() == 1) ? plannedAgent.position : plannedAgent.windowPath[plannedAgent.windowPath.size() - 2])) {
+				plannedAgent.windowPath.pop_back();
+			}
+		}
+	}
+
+	reserveAgent(agent);
+}
+
+/// <summary>
+/// Searches space and time for the cheapest steps of an agent that do not conflict with the reservations of other agents.
+/// The search ends at the goal once the goal stays free until the end of the window, or at the end of the window.
+/// Grid squares at the end of the window are ranked by the cost of the rest of their route, so the steps lead towards the goal.
+/// </summary>
+/// <param name="agent">The agent. Its reservations must be released.</param>
+/// <param name="goalDistances">The costs of reaching the goal of the agent. Null if the agent can not reach its goal and only avoids the others.</param>
+/// <param name="lastNode">Output index. Receives the node the search ended at.</param>
+/// <returns>True if the search found steps. False if the agent is trapped.</returns>
+bool CooperativePathfinder::searchWindow(unsigned int agent, GoalDistances* goalDistances, unsigned int& lastNode) {
+	searchNodes.clear();
+	searchNodeIndices.clear();
+	searchOpenSet.clear();
+
+	const Agent& plannedAgent = agents[agent];
+	const unsigned int startTime = getCurrentTime();
+	const unsigned int windowSize = getWindowSize();
+	const sf::Vector2u gridSize = getGridSize();
+	const unsigned int goalIndex = (goalDistances == nullptr) ? NO_NODE : flattenGridCoordinate(plannedAgent.goal, gridSize.y);
+	discoverNode(flattenGridCoordinate(plannedAgent.position, gridSize.y), 0, 0, NO_NODE, goalDistances);
+
+	while (!searchOpenSet.empty()) {
+		std::pop_heap(searchOpenSet.begin(), searchOpenSet.end(), std::greater<OpenNode>());
+		const unsigned int currentNode = searchOpenSet.back().second;
+		searchOpenSet.pop_back();
+		if (searchNodes[currentNode].isClosed) {
+			continue; // an outdated entry of a node that was reached more cheaply
+		}
+		searchNodes[currentNode].isClosed = true;
+		++expandedNodeCount;
+
+		const SpaceTimeNode current = searchNodes[currentNode];
+		if (current.depth == windowSize || (current.gridIndex == goalIndex && isGoalFree(agent, startTime + current.depth))) {
+			lastNode = currentNode;
+			return true;
+		}
+
+		// waiting costs as much as a step between grid squares of the same weight
+		const sf::Vector2i currentSquare = expandGridIndex(current.gridIndex, gridSize.y);
+		const unsigned int time = startTime + current.depth;
+		if (reservationTable.isMoveFree(currentSquare, currentSquare, time, agent)) {
+			discoverNode(current.gridIndex, current.depth + 1, current.score + getGridWeight(*navigationGrid, currentSquare), currentNode, goalDistances);
+		}
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = currentSquare + offset;
+			if (!isInGrid(neighbor, gridSize) || getGridWeight(*navigationGrid, neighbor) >= BLOCKED_GRID_WEIGHT || !reservationTable.isMoveFree(currentSquare, neighbor, time, agent)) {
+				continue;
+			}
+			discoverNode(flattenGridCoordinate(neighbor, gridSize.y), current.depth + 1, current.score + getStepCost(currentSquare, neighbor), currentNode, goalDistances);
+		}
+	}
+	return false;
+}
+
+/// <summary>
+/// Records a cheaper way of reaching a grid square at a time step and queues it.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square.</param>
+/// <param name="depth">The number of time steps after the start of the search.</param>
+/// <param name="score">The cost of reaching the grid square at the time step.</param>
+/// <param name="cameFrom">The index of the previous node.</param>
+/// <param name="goalDistances">The costs of reaching the goal. Null if every grid square is ranked by its score alone.</param>
+void CooperativePathfinder::discoverNode(unsigned int gridIndex, unsigned int depth, int score, unsigned int cameFrom, GoalDistances* goalDistances) {
+	const int goalDistance = (goalDistances == nullptr) ? 0 : getGoalDistance(*goalDistances, gridIndex);
+	if (goalDistance == UNREACHABLE_COST) {
+		return;
+	}
+
+	const std::uint64_t key = (static_cast<std::uint64_t>(depth) << 32) | gridIndex;
+	const auto insertResult = searchNodeIndices.emplace(key, static_cast<unsigned int>(searchNodes.size()));
+	const unsigned int nodeIndex = insertResult.first->second;
+	if (insertResult.second) {
+		searchNodes.push_back(SpaceTimeNode{gridIndex, depth, score, cameFrom, false});
+	}
+	else if (searchNodes[nodeIndex].isClosed || score >= searchNodes[nodeIndex].score) {
+		return;
+	}
+	else {
+		searchNodes[nodeIndex].score = score;
+		searchNodes[nodeIndex].cameFrom = cameFrom;
+	}
+
+	// agents without a goal prefer the nodes closest to the end of the window
+	const std::uint64_t estimate = static_cast<std::uint64_t>(score) + static_cast<std::uint64_t>(goalDistance);
+	const std::uint64_t remainingSteps = (goalDistances == nullptr) ? getWindowSize() - depth : static_cast<std::uint64_t>(goalDistance);
+	const std::uint64_t tieBreak = std::min<std::uint64_t>(remainingSteps, (1ull << TIE_BREAK_BITS) - 1);
+	searchOpenSet.emplace_back((estimate << TIE_BREAK_BITS) | tieBreak, nodeIndex);
+	std::push_heap(searchOpenSet.begin(), searchOpenSet.end(), std::greater<OpenNode>());
+}
+
+/// <summary>
+/// Reserves the grid square of an agent at every time step from the current time to the end of the window.
+/// After its planned steps, the agent holds its last grid square.
+/// </summary>
+/// <param name="agent">The agent.</param>
+void CooperativePathfinder::reserveAgent(unsigned int agent) {
+	const unsigned int startTime = getCurrentTime();
+	agents[agent].reservedUntil = startTime + getWindowSize();
+	for (unsigned int time = startTime; time <= agents[agent].reservedUntil; ++time) {
+		reservationTable.reserve(getPlannedGridSquare(agent, time), time, agent);
+	}
+}
+
+/// <summary>
+/// Releases the reservations an agent holds from the current time on.
+/// </summary>
+/// <param name="agent">The agent.</param>
+void CooperativePathfinder::releaseAgent(unsigned int agent) {
+	for (unsigned int time = getCurrentTime(); time <= agents[agent].reservedUntil; ++time) {
+		reservationTable.release(getPlannedGridSquare(agent, time), time, agent);
+	}
+}
+
+/// <summary>
+/// Checks if the goal of an agent stays free from a time step to the end of the window, so the agent can stay there.
+/// </summary>
+/// <param name="agent">The agent.</param>
+/// <param name="fromTime">The time step the agent arrives at the goal.</param>
+/// <returns>True if no other agent reserved the goal in that time. False otherwise.</returns>
+bool CooperativePathfinder::isGoalFree(unsigned int agent, unsigned int fromTime) const {
+	const unsigned int endTime = getCurrentTime() + getWindowSize();
+	for (unsigned int time = fromTime; time <= endTime; ++time) {
+		if (!reservationTable.isFree(agents[agent].goal, time, agent)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// <summary>
+/// Gets the grid square an agent plans to occupy at a time step inside of the window.
+/// </summary>
+/// <param name="agent">The agent.</param>
+/// <param name="time">The time step. Not before the current time.</param>
+/// <returns>The planned grid square. The last planned grid square after the planned steps.</returns>
+const sf::Vector2i& CooperativePathfinder::getPlannedGridSquare(unsigned int agent, unsigned int time) const {
+	const Agent& plannedAgent = agents[agent];
+	const std::size_t step = time - getCurrentTime();
+	if (step == 0 || plannedAgent.windowPath.empty()) {
+		return plannedAgent.position;
+	}
+	return plannedAgent.windowPath[std::min(step, plannedAgent.windowPath.size()) - 1];
+}
+
+/// <summary>
+/// Follows the cheapest route from a grid square to the goal, ignoring the other agents.
+/// </summary>
+/// <param name="from">The grid square to start at. Excluded from the route.</param>
+/// <param name="goalDistances">The costs of reaching the goal.</param>
+/// <param name="route">Output deque. Receives the grid squares of the route.</param>
+void CooperativePathfinder::buildRoute(const sf::Vector2i& from, GoalDistances& goalDistances, std::deque<sf::Vector2i>& route) {
+	const sf::Vector2u gridSize = getGridSize();
+	sf::Vector2i current = from;
+	int currentDistance = getGoalDistance(goalDistances, flattenGridCoordinate(current, gridSize.y));
+	while (currentDistance > 0 && currentDistance != UNREACHABLE_COST) {
+		// step to the neighbor the cheapest route runs through
+		sf::Vector2i next = current;
+		int nextDistance = UNREACHABLE_COST;
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + offset;
+			if (!isInGrid(neighbor, gridSize) || getGridWeight(*navigationGrid, neighbor) >= BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+			const int neighborDistance = getGoalDistance(goalDistances, flattenGridCoordinate(neighbor, gridSize.y));
+			if (neighborDistance != UNREACHABLE_COST && neighborDistance + getStepCost(current, neighbor) == currentDistance && neighborDistance < nextDistance) {
+				next = neighbor;
+				nextDistance = neighborDistance;
+			}
+		}
+		if (next == current) {
+			break;
+		}
+		route.push_back(next);
+		current = next;
+		currentDistance = nextDistance;
+	}
+}
+
+/// <summary>
+/// Gets the costs of reaching a goal, starting a new search from the goal if no other agent shares it.
+/// </summary>
+/// <param name="goal">The goal. Must be within the navigation grid.</param>
+/// <param name="searchTarget">The grid square a new search heads for.</param>
+/// <returns>The costs of reaching the goal.</returns>
+CooperativePathfinder::GoalDistances& CooperativePathfinder::acquireGoalDistances(const sf::Vector2i& goal, const sf::Vector2i& searchTarget) {
+	// the first search since the grid was set finds the weight of the heuristic
+	if (goalDistancesByGoal.empty()) {
+		resetHeuristicWeight();
+	}
+
+	const unsigned int goalIndex = flattenGridCoordinate(goal, navigationGrid->getArraySizeY());
+	const auto insertResult = goalDistancesByGoal.emplace(goalIndex, GoalDistances());
+	GoalDistances& goalDistances = insertResult.first->second;
+	if (insertResult.second) {
+		const std::size_t gridSquareCount = static_cast<std::size_t>(navigationGrid->getArraySizeX()) * navigationGrid->getArraySizeY();
+		goalDistances.costs.assign(gridSquareCount, UNREACHABLE_COST);
+		goalDistances.openSet.setCapacity(gridSquareCount);
+		goalDistances.searchTarget = searchTarget;
+		goalDistances.agentCount = 0;
+
+		// blocked goals can not be reached
+		if (getGridWeight(*navigationGrid, goal) < BLOCKED_GRID_WEIGHT) {
+			goalDistances.costs[goalIndex] = 0;
+			goalDistances.openSet.pushOrUpdate(goalIndex, calcHeuristic(goal, searchTarget));
+		}
+	}
+	++goalDistances.agentCount;
+	return goalDistances;
+}
+
+/// <summary>
+/// Releases the costs of reaching a goal. They are discarded once no agent shares the goal.
+/// </summary>
+/// <param name="goal">The goal.</param>
+void CooperativePathfinder::releaseGoalDistances(const sf::Vector2i& goal) {
+	if (!isInGrid(goal, getGridSize())) {
+		return;
+	}
+	const auto goalDistancesIt = goalDistancesByGoal.find(flattenGridCoordinate(goal, navigationGrid->getArraySizeY()));
+	if (goalDistancesIt != goalDistancesByGoal.end() && --goalDistancesIt->second.agentCount == 0) {
+		goalDistancesByGoal.erase(goalDistancesIt);
+	}
+}
+
+/// <summary>
+/// Gets the cost of the cheapest route from a grid square to a goal, ignoring the other agents.
+/// The search from the goal is resumed until the grid square is settled. Its heuristic never overestimates,
+/// so every grid square it settles has its final cost, even when it is not the grid square the search heads for.
+/// Blocked grid squares can only be left, so their cost is found through their neighbors.
+/// </summary>
+/// <param name="goalDistances">The costs of reaching the goal.</param>
+/// <param name="gridIndex">The flattened coordinate of the grid square.</param>
+/// <returns>The cost of the route. UNREACHABLE_COST if the goal can not be reached.</returns>
+int CooperativePathfinder::getGoalDistance(GoalDistances& goalDistances, unsigned int gridIndex) {
+	const sf::Vector2u gridSize = getGridSize();
+	const sf::Vector2i gridSquare = expandGridIndex(gridIndex, gridSize.y);
+	if (getGridWeight(*navigationGrid, gridSquare) >= BLOCKED_GRID_WEIGHT) {
+		int cheapestDistance = UNREACHABLE_COST;
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = gridSquare + offset;
+			if (isInGrid(neighbor, gridSize) && getGridWeight(*navigationGrid, neighbor) < BLOCKED_GRID_WEIGHT) {
+				const int neighborDistance = getGoalDistance(goalDistances, flattenGridCoordinate(neighbor, gridSize.y));
+				if (neighborDistance != UNREACHABLE_COST) {
+					cheapestDistance = std::min(cheapestDistance, neighborDistance + getStepCost(gridSquare, neighbor));
+				}
+			}
+		}
+		return cheapestDistance;
+	}
+
+	// grid squares are settled once they leave the open set
+	std::vector<int>& costs = goalDistances.costs;
+	IndexedPriorityQueue<int>& openSet = goalDistances.openSet;
+	while ((costs[gridIndex] == UNREACHABLE_COST || openSet.isQueued(gridIndex)) && !openSet.isEmpty()) {
+		const unsigned int currentIndex = openSet.pop();
+		const sf::Vector2i current = expandGridIndex(currentIndex, gridSize.y);
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + offset;
+			if (!isInGrid(neighbor, gridSize) || getGridWeight(*navigationGrid, neighbor) >= BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+			const unsigned int neighborIndex = flattenGridCoordinate(neighbor, gridSize.y);
+			const int neighborCost = costs[currentIndex] + getStepCost(neighbor, current);
+			if (neighborCost < costs[neighborIndex]) {
+				costs[neighborIndex] = neighborCost;
+				openSet.pushOrUpdate(neighborIndex, neighborCost + calcHeuristic(neighbor, goalDistances.searchTarget));
+			}
+		}
+	}
+	return costs[gridIndex];
+}
+
+/// <summary>
+/// Estimates the cost of the cheapest route between two grid squares without overestimating it.
+/// </summary>
+/// <param name="from">The first grid square.</param>
+/// <param name="to">The second grid square.</param>
+/// <returns>The estimated cost.</returns>
+int CooperativePathfinder::calcHeuristic(const sf::Vector2i& from, const sf::Vector2i& to) const {
+	return (std::abs(from.x - to.x) + std::abs(from.y - to.y)) * heuristicWeight;
+}
+
+/// <summary>
+/// Finds the lowest unblocked weight of the navigation grid. No step costs less, which keeps the heuristic admissible.
+/// </summary>
+void CooperativePathfinder::resetHeuristicWeight() {
+	heuristicWeight = BLOCKED_GRID_WEIGHT;
+	for (unsigned int x = 0; x < navigationGrid->getArraySizeX(); ++x) {
+		for (unsigned int y = 0; y < navigationGrid->getArraySizeY(); ++y) {
+			heuristicWeight = std::min(heuristicWeight, navigationGrid->at(x, y)->weight);
+		}
+	}
+	heuristicWeight = std::max(heuristicWeight, 0);
+}
+
+/// <summary>
+/// Gets the cost of a step between two adjacent grid squares.
+/// </summary>
+/// <param name="from">The grid square the step leaves.</param>
+/// <param name="to">The grid square the step enters.</param>
+/// <returns>The cost of the step.</returns>
+int CooperativePathfinder::getStepCost(const sf::Vector2i& from, const sf::Vector2i& to) const {
+	return calcStepCost(getGridWeight(*navigationGrid, from), getGridWeight(*navigationGrid, to));
+}
+
+/// <summary>
+/// Gets the size of the navigation grid.
+/// </summary>
+/// <returns>The number of grid squares along x and y. Zero without a navigation grid.</returns>
+sf::Vector2u CooperativePathfinder::getGridSize() const {
+	if (navigationGrid == nullptr) {
+		return sf::Vector2u(0, 0);
+	}
+	return sf::Vector2u(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+}
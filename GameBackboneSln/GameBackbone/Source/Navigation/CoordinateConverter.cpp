@@ -69,6 +69,20 @@ WindowCoordinatePath CoordinateConverter::convertPathToWindow(const NavGridCoord
 	return convertedPath;
 }
 
+/// <summary>
+/// Converts a path read directly from a PackedPathBatch to an equivalent
+/// path in window coordinates. The waypoints are converted as they are decoded.
+/// </summary>
+/// <param name="navGridPath">The nav grid path.</param>
+/// <param name="windowPath">Replaced by the window path. Its memory is reused.</param>
+void CoordinateConverter::convertPathToWindow(const PackedPath& navGridPath, std::vector<sf::Vector2f>& windowPath) const {
+	windowPath.clear();
+	windowPath.reserve(navGridPath.size());
+	for (const sf::Vector2i& coordinate : navGridPath) {
+		windowPath.push_back(convertCoordToWindow(coordinate));
+	}
+}
+
 /// <summary>
 /// Converts a path represented in window coordinates to an equivalent
 /// path in navigation grid coordinates.
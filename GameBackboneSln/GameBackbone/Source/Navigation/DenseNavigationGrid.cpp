@@ -0,0 +1,109 @@
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+using namespace GB;
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="DenseNavigationGrid"/> class without grid squares.
+/// </summary>
+DenseNavigationGrid::DenseNavigationGrid() : sizeX(0), sizeY(0) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="DenseNavigationGrid"/> class.
+/// </summary>
+/// <param name="newSizeX">The number of grid squares along x.</param>
+/// <param name="newSizeY">The number of grid squares along y.</param>
+/// <param name="gridData">The weight and blocker distance of every grid square.</param>
+DenseNavigationGrid::DenseNavigationGrid(unsigned int newSizeX, unsigned int newSizeY, const NavigationGridData& gridData) :
+	sizeX(newSizeX),
+	sizeY(newSizeY),
+	weights(static_cast<std::size_t>(newSizeX) * newSizeY, gridData.weight),
+	blockerDists(static_cast<std::size_t>(newSizeX) * newSizeY, gridData.blockerDist) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="DenseNavigationGrid"/> class with the weights and blocker distances of a NavigationGrid.
+/// Grid squares without data get the default NavigationGridData. Data of types derived from NavigationGridData is sliced off.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid to copy.</param>
+DenseNavigationGrid::DenseNavigationGrid(NavigationGrid& navigationGrid) :
+	DenseNavigationGrid(navigationGrid.getArraySizeX(), navigationGrid.getArraySizeY()) {
+	for (unsigned int x = 0; x < sizeX; ++x) {
+		for (unsigned int y = 0; y < sizeY; ++y) {
+			const NavigationGridData* gridData = navigationGrid.at(x, y);
+			if (gridData != nullptr) {
+				setGridData(x, y, *gridData);
+			}
+		}
+	}
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the weight and blocker distance of a grid square.
+/// </summary>
+/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+/// <param name="gridData">The weight and blocker distance.</param>
+void DenseNavigationGrid::setGridData(unsigned int x, unsigned int y, const NavigationGridData& gridData) {
+	const std::size_t gridIndex = flattenGridCoordinate(x, y);
+	weights[gridIndex] = gridData.weight;
+	blockerDists[gridIndex] = gridData.blockerDist;
+}
+
+//getters
+
+/// <summary>
+/// Gets the weight and blocker distance of a grid square.
+/// </summary>
+/// <param name="x">The x position of the grid square. Must be within the grid.</param>
+/// <param name="y">The y position of the grid square. Must be within the grid.</param>
+/// <returns>A copy of the weight and blocker distance.</returns>
+NavigationGridData DenseNavigationGrid::getGridData(unsigned int x, unsigned int y) const {
+	const std::size_t gridIndex = flattenGridCoordinate(x, y);
+	return NavigationGridData(weights[gridIndex], blockerDists[gridIndex]);
+}
+
+/// <summary>
+/// Gets the weight of every grid square, flattened like flattenGridCoordinate.
+/// </summary>
+/// <returns>The weight plane.</returns>
+const std::vector<int>& DenseNavigationGrid::getWeights() const {
+	return weights;
+}
+
+/// <summary>
+/// Gets the blocker distance of every grid square, flattened like flattenGridCoordinate.
+/// </summary>
+/// <returns>The blocker distance plane.</returns>
+const std::vector<unsigned int>& DenseNavigationGrid::getBlockerDists() const {
+	return blockerDists;
+}
+
+/// <summary>
+/// Gets the number of bytes used by the grid.
+/// </summary>
+/// <returns>The number of bytes.</returns>
+std::size_t DenseNavigationGrid::getMemoryUsage() const {
+	return sizeof(DenseNavigationGrid) + weights.capacity() * sizeof(int) + blockerDists.capacity() * sizeof(unsigned int);
+}
+
+//operations
+
+/// <summary>
+/// Sets the weight and blocker distance of every grid square. Custom data is left unchanged.
+/// </summary>
+/// <param name="gridData">The weight and blocker distance.</param>
+void DenseNavigationGrid::initAllValues(const NavigationGridData& gridData) {
+	std::fill(weights.begin(), weights.end(), gridData.weight);
+	std::fill(blockerDists.begin(), blockerDists.end(), gridData.blockerDist);
+}
@@ -0,0 +1,240 @@
+#include <GameBackbone/Navigation/FlowField.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// The number of neighbor offsets.
+	const unsigned char NEIGHBOR_COUNT = 4;
+
+	/// The direction of grid squares that have no next step. Either the destination or unreachable.
+	const unsigned char NO_DIRECTION = NEIGHBOR_COUNT;
+
+	/// <summary>
+	/// Gets the neighbor offset pointing the opposite way of another. Opposite offsets of FOUR_NEIGHBOR_OFFSETS are next to each other.
+	/// </summary>
+	/// <param name="direction">The index of the neighbor offset.</param>
+	/// <returns>The index of the opposite neighbor offset.</returns>
+	unsigned char getOppositeDirection(unsigned char direction) {
+		return direction ^ 1u;
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="FlowField"/> class without a navigation grid.
+/// </summary>
+FlowField::FlowField() : FlowField(nullptr) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="FlowField"/> class.
+/// No directions are available until generate is called.
+/// </summary>
+/// <param name="navigationGrid">The grid to generate the field on. May be null.</param>
+FlowField::FlowField(NavigationGrid* newNavigationGrid) :
+	navigationGrid(newNavigationGrid),
+	destination(0, 0),
+	fieldSize(0, 0) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid. The current field is discarded.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void FlowField::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+	fieldSize = sf::Vector2u(0, 0);
+	integratedCosts.clear();
+	directions.clear();
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* FlowField::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the destination of the last generated field.
+/// </summary>
+/// <returns>The destination grid square.</returns>
+const sf::Vector2i& FlowField::getDestination() const {
+	return destination;
+}
+
+/// <summary>
+/// Gets the cost of the cheapest path from a grid square to the destination.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <returns>The cost of reaching the destination. UNREACHABLE_COST if the destination can not be reached or the grid square is outside of the field.</returns>
+int FlowField::getIntegratedCost(const sf::Vector2i& gridSquare) const {
+	if (!isGenerated(gridSquare)) {
+		return UNREACHABLE_COST;
+	}
+	return integratedCosts[flattenGridCoordinate(gridSquare, fieldSize.y)];
+}
+
+/// <summary>
+/// Gets the step an agent on a grid square should take towards the destination.
+/// </summary>
+/// <param name="gridSquare">The grid square the agent is on.</param>
+/// <returns>The offset to the next grid square. (0, 0) on the destination or if the destination can not be reached.</returns>
+sf::Vector2i FlowField::getDirection(const sf::Vector2i& gridSquare) const {
+	if (!isGenerated(gridSquare)) {
+		return sf::Vector2i(0, 0);
+	}
+	const unsigned char direction = directions[flattenGridCoordinate(gridSquare, fieldSize.y)];
+	return (direction == NO_DIRECTION) ? sf::Vector2i(0, 0) : FOUR_NEIGHBOR_OFFSETS[direction];
+}
+
+/// <summary>
+/// Determines whether the destination can be reached from a grid square.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <returns>True if the destination can be reached. False otherwise.</returns>
+bool FlowField::isReachable(const sf::Vector2i& gridSquare) const {
+	return getIntegratedCost(gridSquare) != UNREACHABLE_COST;
+}
+
+//operations
+
+/// <summary>
+/// Generates the field for a destination from the current weights of the navigation grid.
+/// Must be called again after the navigation grid changes.
+/// Agents on a blocked grid square next to an unblocked one are directed off of it, as Pathfinder does for blocked starts.
+/// </summary>
+/// <param name="newDestination">The grid square every agent is heading to.</param>
+void FlowField::generate(const sf::Vector2i& newDestination) {
+	destination = newDestination;
+	if (navigationGrid == nullptr) {
+		fieldSize = sf::Vector2u(0, 0);
+		integratedCosts.clear();
+		directions.clear();
+		return;
+	}
+
+	fieldSize = sf::Vector2u(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	const std::size_t gridSquareCount = static_cast<std::size_t>(fieldSize.x) * fieldSize.y;
+	integratedCosts.assign(gridSquareCount, UNREACHABLE_COST);
+	directions.assign(gridSquareCount, NO_DIRECTION);
+
+	if (!isInGrid(destination, fieldSize) || getGridWeight(*navigationGrid, destination) >= BLOCKED_GRID_WEIGHT) {
+		return;
+	}
+
+	// Search outwards from the destination. The weights are non-negative, so a grid square's cost is final once it is popped.
+	if (openSet.getCapacity() < gridSquareCount) {
+		openSet.setCapacity(gridSquareCount);
+	}
+	openSet.clear();
+	const unsigned int destinationIndex = flattenGridCoordinate(destination, fieldSize.y);
+	integratedCosts[destinationIndex] = 0;
+	openSet.pushOrUpdate(destinationIndex, 0);
+
+	while (!openSet.isEmpty()) {
+		const unsigned int currentIndex = openSet.pop();
+		const sf::Vector2i current = expandGridIndex(currentIndex, fieldSize.y);
+		const int currentCost = integratedCosts[currentIndex];
+		const int currentWeight = getGridWeight(*navigationGrid, current);
+
+		for (unsigned char direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+			const sf::Vector2i neighbor = current + FOUR_NEIGHBOR_OFFSETS[direction];
+			if (!isInGrid(neighbor, fieldSize)) {
+				continue;
+			}
+
+			const int neighborWeight = getGridWeight(*navigationGrid, neighbor);
+			if (neighborWeight >= BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+
+			const unsigned int neighborIndex = flattenGridCoordinate(neighbor, fieldSize.y);
+			const int neighborCost = currentCost + calcStepCost(neighborWeight, currentWeight);
+			if (neighborCost < integratedCosts[neighborIndex]) {
+				integratedCosts[neighborIndex] = neighborCost;
+				directions[neighborIndex] = getOppositeDirection(direction);
+				openSet.pushOrUpdate(neighborIndex, static_cast<std::uint64_t>(neighborCost));
+			}
+		}
+	}
+
+	// Blocked grid squares can only be left, so each one takes its cheapest step onto a reachable neighbor.
+	for (unsigned int x = 0; x < fieldSize.x; ++x) {
+		for (unsigned int y = 0; y < fieldSize.y; ++y) {
+			const sf::Vector2i blocked(static_cast<int>(x), static_cast<int>(y));
+			const int blockedWeight = getGridWeight(*navigationGrid, blocked);
+			if (blockedWeight < BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+
+			const unsigned int blockedIndex = flattenGridCoordinate(blocked, fieldSize.y);
+			for (unsigned char direction = 0; direction < NEIGHBOR_COUNT; ++direction) {
+				const sf::Vector2i neighbor = blocked + FOUR_NEIGHBOR_OFFSETS[direction];
+				if (!isInGrid(neighbor, fieldSize)) {
+					continue;
+				}
+
+				const unsigned int neighborIndex = flattenGridCoordinate(neighbor, fieldSize.y);
+				const int neighborCost = integratedCosts[neighborIndex];
+				const int neighborWeight = getGridWeight(*navigationGrid, neighbor);
+				if (neighborCost == UNREACHABLE_COST || neighborWeight >= BLOCKED_GRID_WEIGHT) {
+					continue;
+				}
+
+				const int blockedCost = neighborCost + calcStepCost(blockedWeight, neighborWeight);
+				if (blockedCost < integratedCosts[blockedIndex]) {
+					integratedCosts[blockedIndex] = blockedCost;
+					directions[blockedIndex] = direction;
+				}
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Follows the field from a start to the destination.
+/// Lets a single agent use path based movement such as moveSpriteAlongPath without searching again.
+/// </summary>
+/// <param name="start">The grid square to start from.</param>
+/// <param name="path">Set to the path to the destination. The path does not include the start. Empty if there is no path.</param>
+void FlowField::extractPath(const sf::Vector2i& start, NavGridCoordinatePath& path) const {
+	path.clear();
+	if (!isReachable(start)) {
+		return;
+	}
+
+	sf::Vector2i current = start;
+	unsigned char direction = directions[flattenGridCoordinate(current, fieldSize.y)];
+	while (direction != NO_DIRECTION) {
+		current += FOUR_NEIGHBOR_OFFSETS[direction];
+		path.push_back(current);
+		direction = directions[flattenGridCoordinate(current, fieldSize.y)];
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Determines whether the last generated field covers a grid square.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <returns>True if the grid square is within the generated field. False otherwise.</returns>
+bool FlowField::isGenerated(const sf::Vector2i& gridSquare) const {
+	return isInGrid(gridSquare, fieldSize) && !integratedCosts.empty();
+}
@@ -0,0 +1,654 @@
+#include <GameBackbone/Navigation/HierarchicalPathfinder.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// Openings between clusters that are at least this long get a transition at both ends instead of one in the middle.
+	const int ENTRANCE_SPLIT_LENGTH = 6;
+
+	/// <summary>
+	/// Removes every edge leading to the target from a list of edges.
+	/// </summary>
+	/// <param name="edges">The list of edges.</param>
+	/// <param name="target">The abstract node the removed edges lead to.</param>
+	template <class Edge>
+	void eraseEdgesTo(std::vector<Edge>& edges, unsigned int target) {
+		edges.erase(std::remove_if(edges.begin(), edges.end(), [target](const Edge& edge) { return edge.target == target; }), edges.end());
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="HierarchicalPathfinder"/> class and builds the abstraction of the grid.
+/// </summary>
+/// <param name="navigationGrid">The grid to find paths on. May be null.</param>
+/// <param name="clusterSize">The width and height of each cluster in grid squares. Values below 1 are treated as 1.</param>
+HierarchicalPathfinder::HierarchicalPathfinder(NavigationGrid* newNavigationGrid, unsigned int newClusterSize) :
+	navigationGrid(newNavigationGrid),
+	clusterSize(std::max(newClusterSize, 1u)),
+	clusterCountX(0),
+	clusterCountY(0),
+	minGridWeight(0),
+	clusterRebuildCount(0) {
+
+	rebuild();
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid and rebuilds the abstraction for it.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void HierarchicalPathfinder::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+	rebuild();
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* HierarchicalPathfinder::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the width and height of each cluster in grid squares. Clusters at the far edges of the grid may be smaller.
+/// </summary>
+/// <returns></returns>
+unsigned int HierarchicalPathfinder::getClusterSize() const {
+	return clusterSize;
+}
+
+/// <summary>
+/// Gets the number of clusters the navigation grid is split into.
+/// </summary>
+/// <returns></returns>
+std::size_t HierarchicalPathfinder::getClusterCount() const {
+	return clusters.size();
+}
+
+/// <summary>
+/// Gets the number of abstract nodes connecting the clusters.
+/// </summary>
+/// <returns></returns>
+std::size_t HierarchicalPathfinder::getAbstractNodeCount() const {
+	return abstractNodes.size() - freeAbstractNodes.size();
+}
+
+/// <summary>
+/// Gets the number of times the paths inside a cluster were precomputed, including the initial build.
+/// </summary>
+/// <returns></returns>
+std::size_t HierarchicalPathfinder::getClusterRebuildCount() const {
+	return clusterRebuildCount;
+}
+
+//operations
+
+/// <summary>
+/// Discards the abstraction and builds it again from the whole navigation grid.
+/// </summary>
+void HierarchicalPathfinder::rebuild() {
+	clusters.clear();
+	abstractNodes.clear();
+	freeAbstractNodes.clear();
+	xBorderTransitions.clear();
+	yBorderTransitions.clear();
+	gridSquareNodes.clear();
+	clusterCountX = 0;
+	clusterCountY = 0;
+	minGridWeight = 0;
+	if (navigationGrid == nullptr) {
+		return;
+	}
+
+	const unsigned int gridSizeX = navigationGrid->getArraySizeX();
+	const unsigned int gridSizeY = navigationGrid->getArraySizeY();
+	const std::size_t gridSize = static_cast<std::size_t>(gridSizeX) * gridSizeY;
+	clusterCountX = (gridSizeX + clusterSize - 1) / clusterSize;
+	clusterCountY = (gridSizeY + clusterSize - 1) / clusterSize;
+	gridSquareNodes.assign(gridSize, PathSearchWorkspace::NO_NODE);
+	clusterWorkspace.fitToGridSize(gridSize);
+
+	// split the grid into clusters
+	clusters.resize(static_cast<std::size_t>(clusterCountX) * clusterCountY);
+	for (unsigned int clusterX = 0; clusterX < clusterCountX; ++clusterX) {
+		for (unsigned int clusterY = 0; clusterY < clusterCountY; ++clusterY) {
+			Cluster& cluster = clusters[getClusterIndex(clusterX, clusterY)];
+			cluster.origin = sf::Vector2i{static_cast<int>(clusterX * clusterSize), static_cast<int>(clusterY * clusterSize)};
+			cluster.size = sf::Vector2i{
+				static_cast<int>(std::min(clusterSize, gridSizeX - clusterX * clusterSize)),
+				static_cast<int>(std::min(clusterSize, gridSizeY - clusterY * clusterSize))
+			};
+			cluster.minWeight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+
+	// connect the clusters and precompute the paths inside of them
+	xBorderTransitions.resize(clusters.size());
+	yBorderTransitions.resize(clusters.size());
+	for (unsigned int clusterX = 0; clusterX < clusterCountX; ++clusterX) {
+		for (unsigned int clusterY = 0; clusterY < clusterCountY; ++clusterY) {
+			if (clusterX + 1 < clusterCountX) {
+				rebuildBorder(getClusterIndex(clusterX, clusterY), true);
+			}
+			if (clusterY + 1 < clusterCountY) {
+				rebuildBorder(getClusterIndex(clusterX, clusterY), false);
+			}
+		}
+	}
+	for (unsigned int cluster = 0; cluster < clusters.size(); ++cluster) {
+		rebuildCluster(cluster);
+	}
+	updateMinGridWeight();
+}
+
+/// <summary>
+/// Updates the abstraction after the weights of grid squares changed.
+/// Only the clusters containing a changed grid square, and the neighbors sharing a changed border with them, are rebuilt.
+/// Must be called after the navigation grid changes and before the next call to pathFind.
+/// </summary>
+/// <param name="changedGridSquares">The coordinates of the changed grid squares. Coordinates outside of the grid are ignored.</param>
+void HierarchicalPathfinder::updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares) {
+	if (navigationGrid == nullptr) {
+		return;
+	}
+
+	// find the clusters and borders touched by the changes
+	std::vector<bool> isClusterDirty(clusters.size(), false);
+	std::vector<bool> isXBorderDirty(clusters.size(), false);
+	std::vector<bool> isYBorderDirty(clusters.size(), false);
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		if (!navigationGrid->isInArray(static_cast<unsigned int>(gridSquare.x), static_cast<unsigned int>(gridSquare.y))) {
+			continue;
+		}
+		const unsigned int cluster = findCluster(gridSquare);
+		const unsigned int clusterX = cluster / clusterCountY;
+		const unsigned int clusterY = cluster % clusterCountY;
+		const sf::Vector2i localSquare = gridSquare - clusters[cluster].origin;
+		isClusterDirty[cluster] = true;
+		if (localSquare.x == clusters[cluster].size.x - 1 && clusterX + 1 < clusterCountX) {
+			isXBorderDirty[cluster] = true;
+		}
+		if (localSquare.x == 0 && clusterX > 0) {
+			isXBorderDirty[getClusterIndex(clusterX - 1, clusterY)] = true;
+		}
+		if (localSquare.y == clusters[cluster].size.y - 1 && clusterY + 1 < clusterCountY) {
+			isYBorderDirty[cluster] = true;
+		}
+		if (localSquare.y == 0 && clusterY > 0) {
+			isYBorderDirty[getClusterIndex(clusterX, clusterY - 1)] = true;
+		}
+	}
+
+	// rebuilding a border changes the abstract nodes of the clusters on both sides
+	for (unsigned int cluster = 0; cluster < clusters.size(); ++cluster) {
+		if (isXBorderDirty[cluster]) {
+			rebuildBorder(cluster, true);
+			isClusterDirty[cluster] = true;
+			isClusterDirty[cluster + clusterCountY] = true;
+		}
+		if (isYBorderDirty[cluster]) {
+			rebuildBorder(cluster, false);
+			isClusterDirty[cluster] = true;
+			isClusterDirty[cluster + 1] = true;
+		}
+	}
+
+	for (unsigned int cluster = 0; cluster < clusters.size(); ++cluster) {
+		if (isClusterDirty[cluster]) {
+			rebuildCluster(cluster);
+		}
+	}
+	updateMinGridWeight();
+}
+
+/// <summary>
+/// Creates a path of adjacent grid squares for each path request.
+/// The search mode of the requests is ignored.
+/// </summary>
+/// <param name="pathRequests">vector containing the requirements for each path.</param>
+/// <param name="returnedPaths">vector containing the found path for each PathRequest. The path is found at the same index as its corresponding request.</param>
+void HierarchicalPathfinder::pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) const {
+	returnedPaths->resize(pathRequests.size());
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		findPath(pathRequests[i], (*returnedPaths)[i]);
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Creates a path of adjacent grid squares for a single path request.
+/// Searches from the start point to the abstract nodes of its cluster or of the clusters next to it, across the abstract nodes,
+/// and from the abstract nodes of the end cluster to the end point. Then refines the found route.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="returnedPath">The found path. Empty if no path exists.</param>
+void HierarchicalPathfinder::findPath(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const {
+	returnedPath.clear();
+
+	const sf::Vector2i startPoint = pathRequest.start;
+	const sf::Vector2i endPoint = pathRequest.end;
+	if (navigationGrid == nullptr ||
+		!navigationGrid->isInArray(static_cast<unsigned int>(startPoint.x), static_cast<unsigned int>(startPoint.y)) ||
+		!navigationGrid->isInArray(static_cast<unsigned int>(endPoint.x), static_cast<unsigned int>(endPoint.y))) {
+		return; // there is no path to or from outside of the grid
+	}
+	if (startPoint == endPoint || getGridWeight(*navigationGrid, endPoint) >= BLOCKED_GRID_WEIGHT) {
+		return;
+	}
+	const unsigned int startCluster = findCluster(startPoint);
+	const unsigned int endCluster = findCluster(endPoint);
+
+	// the end point is one node past the abstract nodes
+	const unsigned int endNode = static_cast<unsigned int>(abstractNodes.size());
+	const std::size_t searchNodeCount = abstractNodes.size() + 1;
+	if (abstractOpenSet.getCapacity() != searchNodeCount) {
+		abstractOpenSet.setCapacity(searchNodeCount);
+		abstractScores.resize(searchNodeCount);
+		abstractCameFrom.resize(searchNodeCount);
+	}
+	abstractOpenSet.clear();
+	abstractStates.assign(searchNodeCount, PATH_SEARCH_NODE_UNVISITED);
+
+	// the heuristic never overestimates, since every step costs at least the lowest weight of the grid
+	auto calcPriority = [this, &endPoint](const sf::Vector2i& gridSquare, int score) {
+		const std::uint64_t distance = static_cast<std::uint64_t>(std::abs(gridSquare.x - endPoint.x) + std::abs(gridSquare.y - endPoint.y));
+		return static_cast<std::uint64_t>(score) + distance * static_cast<std::uint64_t>(minGridWeight);
+	};
+	auto discoverNode = [this, endNode, &endPoint, &calcPriority](unsigned int node, unsigned int cameFrom, int tentativeScore) {
+		if (abstractStates[node] == PATH_SEARCH_NODE_CLOSED ||
+			(abstractStates[node] == PATH_SEARCH_NODE_OPEN && tentativeScore >= abstractScores[node])) {
+			return;
+		}
+		abstractStates[node] = PATH_SEARCH_NODE_OPEN;
+		abstractScores[node] = tentativeScore;
+		abstractCameFrom[node] = cameFrom;
+		const sf::Vector2i& gridSquare = (node == endNode) ? endPoint : abstractNodes[node].gridSquare;
+		abstractOpenSet.pushOrUpdate(node, calcPriority(gridSquare, tentativeScore));
+	};
+
+	// costs from the abstract nodes of the end cluster to the end point
+	searchCluster(endCluster, endPoint, nullptr);
+	endNodeCosts.clear();
+	for (const unsigned int node : clusters[endCluster].nodes) {
+		const unsigned int gridIndex = flattenGridCoordinate(abstractNodes[node].gridSquare, navigationGrid->getArraySizeY());
+		if (clusterWorkspace.getState(gridIndex) == PATH_SEARCH_NODE_CLOSED) {
+			endNodeCosts.emplace_back(node, clusterWorkspace.getScore(gridIndex));
+		}
+	}
+
+	// costs from the start point to the abstract nodes of the start cluster, and directly to the end point
+	searchCluster(startCluster, startPoint, nullptr);
+	for (const unsigned int node : clusters[startCluster].nodes) {
+		const unsigned int gridIndex = flattenGridCoordinate(abstractNodes[node].gridSquare, navigationGrid->getArraySizeY());
+		if (clusterWorkspace.getState(gridIndex) == PATH_SEARCH_NODE_CLOSED) {
+			discoverNode(node, PathSearchWorkspace::NO_NODE, clusterWorkspace.getScore(gridIndex));
+		}
+	}
+	if (startCluster == endCluster && clusterWorkspace.getState(flattenGridCoordinate(endPoint, navigationGrid->getArraySizeY())) == PATH_SEARCH_NODE_CLOSED) {
+		discoverNode(endNode, PathSearchWorkspace::NO_NODE, clusterWorkspace.getScore(flattenGridCoordinate(endPoint, navigationGrid->getArraySizeY())));
+	}
+
+	// a start point on a cluster border may also step straight into the neighboring cluster. Blocked start points can only leave that way.
+	const int startWeight = getGridWeight(*navigationGrid, startPoint);
+	for (const sf::Vector2i& neighborOffset : FOUR_NEIGHBOR_OFFSETS) {
+		const sf::Vector2i neighbor = startPoint + neighborOffset;
+		if (!navigationGrid->isInArray(static_cast<unsigned int>(neighbor.x), static_cast<unsigned int>(neighbor.y)) ||
+			findCluster(neighbor) == startCluster || getGridWeight(*navigationGrid, neighbor) >= BLOCKED_GRID_WEIGHT) {
+			continue;
+		}
+		const unsigned int neighborCluster = findCluster(neighbor);
+		const int stepCost = calcStepCost(startWeight, getGridWeight(*navigationGrid, neighbor));
+		searchCluster(neighborCluster, neighbor, nullptr);
+		for (const unsigned int node : clusters[neighborCluster].nodes) {
+			const unsigned int gridIndex = flattenGridCoordinate(abstractNodes[node].gridSquare, navigationGrid->getArraySizeY());
+			if (clusterWorkspace.getState(gridIndex) == PATH_SEARCH_NODE_CLOSED) {
+				discoverNode(node, PathSearchWorkspace::NO_NODE, stepCost + clusterWorkspace.getScore(gridIndex));
+			}
+		}
+		if (neighborCluster == endCluster && clusterWorkspace.getState(flattenGridCoordinate(endPoint, navigationGrid->getArraySizeY())) == PATH_SEARCH_NODE_CLOSED) {
+			discoverNode(endNode, PathSearchWorkspace::NO_NODE, stepCost + clusterWorkspace.getScore(flattenGridCoordinate(endPoint, navigationGrid->getArraySizeY())));
+		}
+	}
+
+	// search the abstract nodes
+	while (!abstractOpenSet.isEmpty()) {
+		const unsigned int current = abstractOpenSet.pop();
+		if (current == endNode) {
+			refineAbstractPath(endNode, pathRequest, returnedPath);
+			return;
+		}
+		abstractStates[current] = PATH_SEARCH_NODE_CLOSED;
+
+		const AbstractNode& currentNode = abstractNodes[current];
+		const int currentScore = abstractScores[current];
+		for (const AbstractEdge& edge : currentNode.interEdges) {
+			discoverNode(edge.target, current, currentScore + edge.cost);
+		}
+		for (const AbstractEdge& edge : currentNode.intraEdges) {
+			discoverNode(edge.target, current, currentScore + edge.cost);
+		}
+		if (currentNode.cluster == endCluster) {
+			for (const std::pair<unsigned int, int>& endNodeCost : endNodeCosts) {
+				if (endNodeCost.first == current) {
+					discoverNode(endNode, current, currentScore + endNodeCost.second);
+				}
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Replaces the transitions across one border of a cluster with transitions for the current weights.
+/// Every contiguous opening along the border gets a transition in its middle, or one at each end if it is long.
+/// </summary>
+/// <param name="cluster">The cluster on the lower side of the border.</param>
+/// <param name="isXBorder">True for the border with the neighbor at higher x. False for the neighbor at higher y.</param>
+void HierarchicalPathfinder::rebuildBorder(unsigned int cluster, bool isXBorder) {
+	BorderTransitions& borderTransitions = isXBorder ? xBorderTransitions[cluster] : yBorderTransitions[cluster];
+	clearBorder(borderTransitions);
+
+	// the border runs along the last column or row of the cluster
+	const Cluster& borderCluster = clusters[cluster];
+	const sf::Vector2i across = isXBorder ? sf::Vector2i{1, 0} : sf::Vector2i{0, 1};
+	const sf::Vector2i along = isXBorder ? sf::Vector2i{0, 1} : sf::Vector2i{1, 0};
+	const sf::Vector2i borderStart = isXBorder ?
+		sf::Vector2i{borderCluster.origin.x + borderCluster.size.x - 1, borderCluster.origin.y} :
+		sf::Vector2i{borderCluster.origin.x, borderCluster.origin.y + borderCluster.size.y - 1};
+	const int borderLength = isXBorder ? borderCluster.size.y : borderCluster.size.x;
+
+	auto addTransition = [this, &borderTransitions, &across](const sf::Vector2i& gridSquare) {
+		const sf::Vector2i neighbor = gridSquare + across;
+		const unsigned int node = acquireNode(gridSquare);
+		const unsigned int neighborNode = acquireNode(neighbor);
+		const int cost = calcStepCost(getGridWeight(*navigationGrid, gridSquare), getGridWeight(*navigationGrid, neighbor));
+		abstractNodes[node].interEdges.push_back(AbstractEdge{neighborNode, cost});
+		abstractNodes[neighborNode].interEdges.push_back(AbstractEdge{node, cost});
+		borderTransitions.emplace_back(node, neighborNode);
+	};
+
+	// find each opening where both sides of the border are unblocked
+	int openingStart = -1;
+	for (int i = 0; i <= borderLength; ++i) {
+		bool isOpen = false;
+		if (i < borderLength) {
+			const sf::Vector2i gridSquare = borderStart + along * i;
+			isOpen = getGridWeight(*navigationGrid, gridSquare) < BLOCKED_GRID_WEIGHT && getGridWeight(*navigationGrid, gridSquare + across) < BLOCKED_GRID_WEIGHT;
+		}
+
+		if (isOpen && openingStart < 0) {
+			openingStart = i;
+		}
+		else if (!isOpen && openingStart >= 0) {
+			const int openingLength = i - openingStart;
+			if (openingLength < ENTRANCE_SPLIT_LENGTH) {
+				addTransition(borderStart + along * (openingStart + openingLength / 2));
+			}
+			else {
+				addTransition(borderStart + along * openingStart);
+				addTransition(borderStart + along * (i - 1));
+			}
+			openingStart = -1;
+		}
+	}
+}
+
+/// <summary>
+/// Removes every transition across a border. Abstract nodes that are no longer used by any border are freed.
+/// </summary>
+/// <param name="borderTransitions">The transitions of the border.</param>
+void HierarchicalPathfinder::clearBorder(BorderTransitions& borderTransitions) {
+	for (const std::pair<unsigned int, unsigned int>& transition : borderTransitions) {
+		eraseEdgesTo(abstractNodes[transition.first].interEdges, transition.second);
+		eraseEdgesTo(abstractNodes[transition.second].interEdges, transition.first);
+		releaseNode(transition.first);
+		releaseNode(transition.second);
+	}
+	borderTransitions.clear();
+}
+
+/// <summary>
+/// Precomputes the cost of the cheapest path inside a cluster between each pair of its abstract nodes.
+/// </summary>
+/// <param name="cluster">The cluster.</param>
+void HierarchicalPathfinder::rebuildCluster(unsigned int cluster) {
+	Cluster& rebuiltCluster = clusters[cluster];
+	++clusterRebuildCount;
+
+	// find the lowest weight, which bounds the cost of every step through the cluster
+	rebuiltCluster.minWeight = BLOCKED_GRID_WEIGHT;
+	for (int x = rebuiltCluster.origin.x; x < rebuiltCluster.origin.x + rebuiltCluster.size.x; ++x) {
+		for (int y = rebuiltCluster.origin.y; y < rebuiltCluster.origin.y + rebuiltCluster.size.y; ++y) {
+			rebuiltCluster.minWeight = std::min(rebuiltCluster.minWeight, getGridWeight(*navigationGrid, sf::Vector2i{x, y}));
+		}
+	}
+	// connect every pair of abstract nodes that can reach each other inside the cluster
+	for (const unsigned int node : rebuiltCluster.nodes) {
+		abstractNodes[node].intraEdges.clear();
+	}
+	for (const unsigned int node : rebuiltCluster.nodes) {
+		searchCluster(cluster, abstractNodes[node].gridSquare, nullptr);
+		for (const unsigned int otherNode : rebuiltCluster.nodes) {
+			const unsigned int gridIndex = flattenGridCoordinate(abstractNodes[otherNode].gridSquare, navigationGrid->getArraySizeY());
+			if (otherNode != node && clusterWorkspace.getState(gridIndex) == PATH_SEARCH_NODE_CLOSED) {
+				abstractNodes[node].intraEdges.push_back(AbstractEdge{otherNode, clusterWorkspace.getScore(gridIndex)});
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Finds the lowest weight of the navigation grid from the lowest weight of each cluster.
+/// </summary>
+void HierarchicalPathfinder::updateMinGridWeight() {
+	minGridWeight = BLOCKED_GRID_WEIGHT;
+	for (const Cluster& cluster : clusters) {
+		minGridWeight = std::min(minGridWeight, cluster.minWeight);
+	}
+}
+
+/// <summary>
+/// Gets the abstract node of a grid square, creating it if the grid square has none, and counts another transition using it.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square.</param>
+/// <returns>The index of the abstract node.</returns>
+unsigned int HierarchicalPathfinder::acquireNode(const sf::Vector2i& gridSquare) {
+	unsigned int& gridSquareNode = gridSquareNodes[flattenGridCoordinate(gridSquare, navigationGrid->getArraySizeY())];
+	if (gridSquareNode == PathSearchWorkspace::NO_NODE) {
+		if (freeAbstractNodes.empty()) {
+			gridSquareNode = static_cast<unsigned int>(abstractNodes.size());
+			abstractNodes.emplace_back();
+		}
+		else {
+			gridSquareNode = freeAbstractNodes.back();
+			freeAbstractNodes.pop_back();
+		}
+		AbstractNode& node = abstractNodes[gridSquareNode];
+		node.gridSquare = gridSquare;
+		node.cluster = findCluster(gridSquare);
+		node.transitionCount = 0;
+		clusters[node.cluster].nodes.push_back(gridSquareNode);
+	}
+	++abstractNodes[gridSquareNode].transitionCount;
+	return gridSquareNode;
+}
+
+/// <summary>
+/// Counts one less transition using an abstract node. Frees the node once no transition uses it.
+/// Edges of the same cluster leading to a freed node stay until the cluster is rebuilt.
+/// </summary>
+/// <param name="node">The index of the abstract node.</param>
+void HierarchicalPathfinder::releaseNode(unsigned int node) {
+	AbstractNode& releasedNode = abstractNodes[node];
+	if (--releasedNode.transitionCount > 0) {
+		return;
+	}
+	std::vector<unsigned int>& clusterNodes = clusters[releasedNode.cluster].nodes;
+	clusterNodes.erase(std::find(clusterNodes.begin(), clusterNodes.end(), node));
+	gridSquareNodes[flattenGridCoordinate(releasedNode.gridSquare, navigationGrid->getArraySizeY())] = PathSearchWorkspace::NO_NODE;
+	releasedNode.interEdges.clear();
+	releasedNode.intraEdges.clear();
+	freeAbstractNodes.push_back(node);
+}
+
+/// <summary>
+/// Finds the cheapest paths from a grid square to the other grid squares of a cluster without leaving the cluster.
+/// Afterwards, every reached grid square is closed in the cluster workspace and holds its cost and predecessor.
+/// </summary>
+/// <param name="cluster">The cluster to search.</param>
+/// <param name="source">The grid square to start from. Must be in the cluster.</param>
+/// <param name="target">The grid square to stop at. Null to reach every grid square of the cluster.</param>
+void HierarchicalPathfinder::searchCluster(unsigned int cluster, const sf::Vector2i& source, const sf::Vector2i* target) const {
+	const Cluster& searchedCluster = clusters[cluster];
+	const sf::Vector2i clusterEnd = searchedCluster.origin + searchedCluster.size;
+	IndexedPriorityQueue<std::uint64_t>& openSet = clusterWorkspace.getOpenSet();
+	const unsigned int targetIndex = (target == nullptr) ? PathSearchWorkspace::NO_NODE : flattenGridCoordinate(*target, navigationGrid->getArraySizeY());
+
+	const unsigned int sourceIndex = flattenGridCoordinate(source, navigationGrid->getArraySizeY());
+	clusterWorkspace.beginSearch();
+	clusterWorkspace.setState(sourceIndex, PATH_SEARCH_NODE_OPEN);
+	clusterWorkspace.setScore(sourceIndex, 0);
+	clusterWorkspace.setCameFrom(sourceIndex, PathSearchWorkspace::NO_NODE);
+	openSet.pushOrUpdate(sourceIndex, 0);
+
+	while (!openSet.isEmpty()) {
+		const unsigned int currentIndex = openSet.pop();
+		clusterWorkspace.setState(currentIndex, PATH_SEARCH_NODE_CLOSED);
+		if (currentIndex == targetIndex) {
+			return;
+		}
+
+		const sf::Vector2i current = expandGridIndex(currentIndex, navigationGrid->getArraySizeY());
+		const int currentWeight = getGridWeight(*navigationGrid, current);
+		const int currentScore = clusterWorkspace.getScore(currentIndex);
+		for (const sf::Vector2i& neighborOffset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + neighborOffset;
+			if (neighbor.x < searchedCluster.origin.x || neighbor.x >= clusterEnd.x ||
+				neighbor.y < searchedCluster.origin.y || neighbor.y >= clusterEnd.y) {
+				continue;
+			}
+			const unsigned int neighborIndex = flattenGridCoordinate(neighbor, navigationGrid->getArraySizeY());
+			const PATH_SEARCH_NODE_STATE_TYPE neighborState = clusterWorkspace.getState(neighborIndex);
+			if (neighborState == PATH_SEARCH_NODE_CLOSED) {
+				continue;
+			}
+			const int neighborWeight = getGridWeight(*navigationGrid, neighbor);
+			if (neighborWeight >= BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+
+			const int tentativeScore = currentScore + calcStepCost(currentWeight, neighborWeight);
+			if (neighborState == PATH_SEARCH_NODE_OPEN && tentativeScore >= clusterWorkspace.getScore(neighborIndex)) {
+				continue; // found a worse path
+			}
+			clusterWorkspace.setState(neighborIndex, PATH_SEARCH_NODE_OPEN);
+			clusterWorkspace.setScore(neighborIndex, tentativeScore);
+			clusterWorkspace.setCameFrom(neighborIndex, currentIndex);
+			openSet.pushOrUpdate(neighborIndex, static_cast<std::uint64_t>(tentativeScore));
+		}
+	}
+}
+
+/// <summary>
+/// Appends the cheapest path between two grid squares of the same cluster to a path. The source is not appended.
+/// </summary>
+/// <param name="cluster">The cluster containing both grid squares.</param>
+/// <param name="source">The grid square the path continues from.</param>
+/// <param name="target">The grid square to reach. Must be reachable from the source inside the cluster.</param>
+/// <param name="path">The path to extend.</param>
+void HierarchicalPathfinder::appendClusterPath(unsigned int cluster, const sf::Vector2i& source, const sf::Vector2i& target, std::deque<sf::Vector2i>& path) const {
+	searchCluster(cluster, source, &target);
+
+	segmentBuffer.clear();
+	const unsigned int sourceIndex = flattenGridCoordinate(source, navigationGrid->getArraySizeY());
+	for (unsigned int gridIndex = flattenGridCoordinate(target, navigationGrid->getArraySizeY()); gridIndex != sourceIndex; gridIndex = clusterWorkspace.getCameFrom(gridIndex)) {
+		segmentBuffer.push_back(expandGridIndex(gridIndex, navigationGrid->getArraySizeY()));
+	}
+	path.insert(path.end(), segmentBuffer.rbegin(), segmentBuffer.rend());
+}
+
+/// <summary>
+/// Turns the route found by the abstract search into grid squares.
+/// Steps across cluster borders are taken directly. Everything else is searched again inside its cluster.
+/// </summary>
+/// <param name="endNode">The index of the end point in the abstract search.</param>
+/// <param name="pathRequest">The request being solved.</param>
+/// <param name="returnedPath">Output deque. Receives the grid squares of the path, excluding the start point.</param>
+void HierarchicalPathfinder::refineAbstractPath(unsigned int endNode, const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const {
+
+	// collect the abstract nodes from the start to the end
+	abstractRoute.clear();
+	for (unsigned int node = abstractCameFrom[endNode]; node != PathSearchWorkspace::NO_NODE; node = abstractCameFrom[node]) {
+		abstractRoute.push_back(node);
+	}
+	std::reverse(abstractRoute.begin(), abstractRoute.end());
+
+	sf::Vector2i previousSquare = pathRequest.start;
+	unsigned int previousCluster = findCluster(pathRequest.start);
+
+	// the route leaves the start cluster immediately if it begins in another cluster
+	const unsigned int firstCluster = abstractRoute.empty() ? findCluster(pathRequest.end) : abstractNodes[abstractRoute.front()].cluster;
+	if (firstCluster != previousCluster) {
+		for (const sf::Vector2i& neighborOffset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = pathRequest.start + neighborOffset;
+			if (navigationGrid->isInArray(static_cast<unsigned int>(neighbor.x), static_cast<unsigned int>(neighbor.y)) &&
+				findCluster(neighbor) == firstCluster) {
+				returnedPath.push_back(neighbor);
+				previousSquare = neighbor;
+				previousCluster = firstCluster;
+				break;
+			}
+		}
+	}
+	for (const unsigned int node : abstractRoute) {
+		const AbstractNode& routeNode = abstractNodes[node];
+		if (routeNode.cluster == previousCluster) {
+			appendClusterPath(previousCluster, previousSquare, routeNode.gridSquare, returnedPath);
+		}
+		else {
+			returnedPath.push_back(routeNode.gridSquare);
+		}
+		previousSquare = routeNode.gridSquare;
+		previousCluster = routeNode.cluster;
+	}
+	appendClusterPath(previousCluster, previousSquare, pathRequest.end, returnedPath);
+}
+
+/// <summary>
+/// Finds the cluster containing a grid square.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square. Must be within the navigation grid.</param>
+/// <returns>The index of the cluster.</returns>
+unsigned int HierarchicalPathfinder::findCluster(const sf::Vector2i& gridSquare) const {
+	return getClusterIndex(static_cast<unsigned int>(gridSquare.x) / clusterSize, static_cast<unsigned int>(gridSquare.y) / clusterSize);
+}
+
+/// <summary>
+/// Gets the index of the cluster at a position in the grid of clusters.
+/// </summary>
+/// <param name="clusterX">The x position of the cluster.</param>
+/// <param name="clusterY">The y position of the cluster.</param>
+/// <returns>The index of the cluster.</returns>
+unsigned int HierarchicalPathfinder::getClusterIndex(unsigned int clusterX, unsigned int clusterY) const {
+	return clusterX * clusterCountY + clusterY;
+}
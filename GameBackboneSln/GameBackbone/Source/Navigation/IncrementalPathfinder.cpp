@@ -0,0 +1,372 @@
+#include <GameBackbone/Navigation/IncrementalPathfinder.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// The cost of grid squares that can not reach the end point.
+	const int UNREACHABLE_COST = INT_MAX;
+
+	/// <summary>
+	/// Adds two costs. The sum is unreachable if either cost is.
+	/// </summary>
+	/// <param name="lhs">The first cost.</param>
+	/// <param name="rhs">The second cost.</param>
+	/// <returns>The sum of the costs.</returns>
+	int addCosts(int lhs, int rhs) {
+		if (lhs == UNREACHABLE_COST || rhs == UNREACHABLE_COST) {
+			return UNREACHABLE_COST;
+		}
+		return lhs + rhs;
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="IncrementalPathfinder"/> class without a navigation grid.
+/// </summary>
+IncrementalPathfinder::IncrementalPathfinder() : IncrementalPathfinder(nullptr) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="IncrementalPathfinder"/> class.
+/// </summary>
+/// <param name="navigationGrid">The grid to find paths on. May be null.</param>
+IncrementalPathfinder::IncrementalPathfinder(NavigationGrid* newNavigationGrid) :
+	navigationGrid(newNavigationGrid),
+	pathRequest{sf::Vector2i(0, 0), sf::Vector2i(0, 0)},
+	isSearchValid(false),
+	expandedNodeCount(0),
+	searchSize(0, 0),
+	lastStart(0, 0),
+	keyModifier(0),
+	heuristicWeight(0) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid. The next call to pathFind searches from scratch.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void IncrementalPathfinder::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+	isSearchValid = false;
+}
+
+/// <summary>
+/// Sets the path request to solve. The next call to pathFind searches from scratch.
+/// Use setStart instead when only the start point moved.
+/// </summary>
+/// <param name="newPathRequest">The path request. Its search mode is ignored.</param>
+void IncrementalPathfinder::setPathRequest(const PathRequest& newPathRequest) {
+	pathRequest = newPathRequest;
+	isSearchValid = false;
+}
+
+/// <summary>
+/// Moves the start point of the path request, for example as the agent walks along its path.
+/// The search is kept, so the next call to pathFind only repairs it.
+/// </summary>
+/// <param name="newStart">The new start point.</param>
+void IncrementalPathfinder::setStart(const sf::Vector2i& newStart) {
+	if (isSearchValid && isInGrid(newStart, searchSize)) {
+		keyModifier += calculateHeuristic(lastStart, newStart);
+		lastStart = newStart;
+	}
+	pathRequest.start = newStart;
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* IncrementalPathfinder::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the path request being solved.
+/// </summary>
+/// <returns></returns>
+const PathRequest& IncrementalPathfinder::getPathRequest() const {
+	return pathRequest;
+}
+
+/// <summary>
+/// Gets the number of grid squares that were expanded during the most recent call to pathFind.
+/// </summary>
+/// <returns>The number of expanded grid squares.</returns>
+std::size_t IncrementalPathfinder::getExpandedNodeCount() const {
+	return expandedNodeCount;
+}
+
+//operations
+
+/// <summary>
+/// Marks the parts of the search that depended on grid squares whose weights changed.
+/// Must be called after the navigation grid changes and before the next call to pathFind.
+/// If a weight drops below the lowest weight the search was started with, the next call to pathFind searches from scratch.
+/// </summary>
+/// <param name="changedGridSquares">The coordinates of the changed grid squares. Coordinates outside of the grid are ignored.</param>
+void IncrementalPathfinder::updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares) {
+	if (!isSearchValid) {
+		return;
+	}
+
+	for (const sf::Vector2i& changedGridSquare : changedGridSquares) {
+		if (!isInGrid(changedGridSquare, searchSize)) {
+			continue;
+		}
+
+		// the heuristic is only admissible while no step is cheaper than the weight it was calculated with
+		const int changedWeight = getGridWeight(*navigationGrid, changedGridSquare);
+		if (changedWeight < heuristicWeight) {
+			isSearchValid = false;
+			return;
+		}
+
+		// the transitions into and out of the grid square changed, so it and each of its neighbors may have a new lookahead cost
+		updateGridSquare(flattenGridCoordinate(changedGridSquare, searchSize.y));
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = changedGridSquare + offset;
+			if (isInGrid(neighbor, searchSize)) {
+				updateGridSquare(flattenGridCoordinate(neighbor, searchSize.y));
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Creates an unblocked path of adjacent grid squares for the path request.
+/// Repairs the previous search if there is one, otherwise searches from scratch.
+/// </summary>
+/// <param name="returnedPath">The found path. It does not include the start point. Empty if no path exists.</param>
+void IncrementalPathfinder::pathFind(std::deque<sf::Vector2i>& returnedPath) {
+	returnedPath.clear();
+	expandedNodeCount = 0;
+
+	if (navigationGrid == nullptr) {
+		return;
+	}
+	const sf::Vector2u gridSize(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	if (!isInGrid(pathRequest.start, gridSize) || !isInGrid(pathRequest.end, gridSize) ||
+		pathRequest.start == pathRequest.end || getGridWeight(*navigationGrid, pathRequest.end) >= BLOCKED_GRID_WEIGHT) {
+		return;
+	}
+
+	if (!isSearchValid || searchSize != gridSize) {
+		resetSearch();
+	}
+	else if (lastStart != pathRequest.start) {
+		// the start was moved outside of the grid and back since the last call
+		keyModifier += calculateHeuristic(lastStart, pathRequest.start);
+		lastStart = pathRequest.start;
+	}
+	computeShortestPath();
+
+	const unsigned int startIndex = flattenGridCoordinate(pathRequest.start, searchSize.y);
+	if (lookaheadCosts[startIndex] == UNREACHABLE_COST) {
+		return;
+	}
+
+	// follow the cheapest transitions down to the end point
+	const std::size_t maxPathLength = costs.size();
+	sf::Vector2i current = pathRequest.start;
+	while (current != pathRequest.end) {
+		sf::Vector2i next = current;
+		int nextCost = UNREACHABLE_COST;
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + offset;
+			if (!isInGrid(neighbor, searchSize)) {
+				continue;
+			}
+			const int neighborCost = addCosts(getTransitionCost(current, neighbor), costs[flattenGridCoordinate(neighbor, searchSize.y)]);
+			if (neighborCost < nextCost) {
+				next = neighbor;
+				nextCost = neighborCost;
+			}
+		}
+
+		if (nextCost == UNREACHABLE_COST || returnedPath.size() >= maxPathLength) {
+			returnedPath.clear(); // the search is inconsistent. This can only happen if a change was not reported.
+			return;
+		}
+		returnedPath.push_back(next);
+		current = next;
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Discards the search and starts a new one from the end point of the path request.
+/// </summary>
+void IncrementalPathfinder::resetSearch() {
+	searchSize = sf::Vector2u(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	const std::size_t gridSquareCount = static_cast<std::size_t>(searchSize.x) * searchSize.y;
+	costs.assign(gridSquareCount, UNREACHABLE_COST);
+	lookaheadCosts.assign(gridSquareCount, UNREACHABLE_COST);
+	if (openSet.getCapacity() != gridSquareCount) {
+		openSet.setCapacity(gridSquareCount);
+	}
+	openSet.clear();
+
+	// steps never cost less than the lowest unblocked weight, which keeps the heuristic admissible
+	heuristicWeight = BLOCKED_GRID_WEIGHT;
+	for (unsigned int x = 0; x < searchSize.x; ++x) {
+		for (unsigned int y = 0; y < searchSize.y; ++y) {
+			heuristicWeight = std::min(heuristicWeight, navigationGrid->at(x, y)->weight);
+		}
+	}
+	heuristicWeight = std::max(heuristicWeight, 0);
+
+	lastStart = pathRequest.start;
+	keyModifier = 0;
+	const unsigned int endIndex = flattenGridCoordinate(pathRequest.end, searchSize.y);
+	lookaheadCosts[endIndex] = 0;
+	openSet.pushOrUpdate(endIndex, calculateKey(endIndex));
+	isSearchValid = true;
+}
+
+/// <summary>
+/// Expands grid squares until the cost of the start point is known.
+/// </summary>
+void IncrementalPathfinder::computeShortestPath() {
+	const unsigned int startIndex = flattenGridCoordinate(pathRequest.start, searchSize.y);
+	while (!openSet.isEmpty() &&
+		(openSet.getTopPriority() < calculateKey(startIndex) || lookaheadCosts[startIndex] != costs[startIndex])) {
+
+		const unsigned int currentIndex = openSet.getTop();
+		const SearchKey oldKey = openSet.getTopPriority();
+		const SearchKey newKey = calculateKey(currentIndex);
+		if (oldKey < newKey) {
+			// the key was calculated before the start moved
+			openSet.pushOrUpdate(currentIndex, newKey);
+			continue;
+		}
+
+		openSet.pop();
+		++expandedNodeCount;
+		const sf::Vector2i current = expandGridIndex(currentIndex, searchSize.y);
+		if (costs[currentIndex] > lookaheadCosts[currentIndex]) {
+			// the grid square got cheaper. Its neighbors may now be cheaper through it.
+			costs[currentIndex] = lookaheadCosts[currentIndex];
+			for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+				const sf::Vector2i neighbor = current + offset;
+				if (!isInGrid(neighbor, searchSize)) {
+					continue;
+				}
+				const unsigned int neighborIndex = flattenGridCoordinate(neighbor, searchSize.y);
+				const int throughCurrent = addCosts(getTransitionCost(neighbor, current), costs[currentIndex]);
+				if (throughCurrent < lookaheadCosts[neighborIndex]) {
+					lookaheadCosts[neighborIndex] = throughCurrent;
+					queueIfInconsistent(neighborIndex);
+				}
+			}
+		}
+		else {
+			// the grid square got more expensive. Everything that went through it has to be evaluated again.
+			costs[currentIndex] = UNREACHABLE_COST;
+			updateGridSquare(currentIndex);
+			for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+				const sf::Vector2i neighbor = current + offset;
+				if (isInGrid(neighbor, searchSize)) {
+					updateGridSquare(flattenGridCoordinate(neighbor, searchSize.y));
+				}
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Recalculates the lookahead cost of a grid square from its neighbors.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square.</param>
+void IncrementalPathfinder::updateGridSquare(unsigned int gridIndex) {
+	lookaheadCosts[gridIndex] = calculateLookahead(gridIndex);
+	queueIfInconsistent(gridIndex);
+}
+
+/// <summary>
+/// Queues a grid square whose cost does not match its lookahead cost. Removes it from the open set otherwise.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square.</param>
+void IncrementalPathfinder::queueIfInconsistent(unsigned int gridIndex) {
+	if (lookaheadCosts[gridIndex] != costs[gridIndex]) {
+		openSet.pushOrUpdate(gridIndex, calculateKey(gridIndex));
+	}
+	else {
+		openSet.remove(gridIndex);
+	}
+}
+
+/// <summary>
+/// Calculates the cost of reaching the end point from a grid square through its cheapest neighbor.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square.</param>
+/// <returns>The lookahead cost. Zero for the end point.</returns>
+int IncrementalPathfinder::calculateLookahead(unsigned int gridIndex) const {
+	const sf::Vector2i gridSquare = expandGridIndex(gridIndex, searchSize.y);
+	if (gridSquare == pathRequest.end) {
+		return 0;
+	}
+
+	int lookahead = UNREACHABLE_COST;
+	for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+		const sf::Vector2i neighbor = gridSquare + offset;
+		if (isInGrid(neighbor, searchSize)) {
+			lookahead = std::min(lookahead, addCosts(getTransitionCost(gridSquare, neighbor), costs[flattenGridCoordinate(neighbor, searchSize.y)]));
+		}
+	}
+	return lookahead;
+}
+
+/// <summary>
+/// Calculates the position of a grid square in the open set.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square. Must have a reachable cost or lookahead cost.</param>
+/// <returns>The key of the grid square.</returns>
+IncrementalPathfinder::SearchKey IncrementalPathfinder::calculateKey(unsigned int gridIndex) const {
+	const std::int64_t cost = std::min(costs[gridIndex], lookaheadCosts[gridIndex]);
+	return SearchKey(cost + calculateHeuristic(pathRequest.start, expandGridIndex(gridIndex, searchSize.y)) + keyModifier, cost);
+}
+
+/// <summary>
+/// Estimates the cost of the cheapest path between two grid squares without overestimating it.
+/// </summary>
+/// <param name="from">The first grid square.</param>
+/// <param name="to">The second grid square.</param>
+/// <returns>The estimated cost.</returns>
+int IncrementalPathfinder::calculateHeuristic(const sf::Vector2i& from, const sf::Vector2i& to) const {
+	return (std::abs(from.x - to.x) + std::abs(from.y - to.y)) * heuristicWeight;
+}
+
+/// <summary>
+/// Gets the cost of stepping from a grid square onto its neighbor.
+/// Blocked grid squares can be left, but not entered.
+/// </summary>
+/// <param name="from">The grid square stepped from. Must be within the navigation grid.</param>
+/// <param name="to">The neighbor stepped onto. Must be within the navigation grid.</param>
+/// <returns>The cost of the step. UNREACHABLE_COST if the neighbor is blocked.</returns>
+int IncrementalPathfinder::getTransitionCost(const sf::Vector2i& from, const sf::Vector2i& to) const {
+	const int toWeight = getGridWeight(*navigationGrid, to);
+	if (toWeight >= BLOCKED_GRID_WEIGHT) {
+		return UNREACHABLE_COST;
+	}
+	return calcStepCost(getGridWeight(*navigationGrid, from), toWeight);
+}
@@ -0,0 +1,446 @@
+#include <GameBackbone/Navigation/LandmarkTable.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// Identifies serialized landmark tables.
+	const char SERIALIZED_TABLE_TAG[] = {'G', 'B', 'L', 'T'};
+
+	/// Returned when no grid square is found.
+	constexpr unsigned int NO_GRID_SQUARE = UINT_MAX;
+
+	/// The version of the serialized format. Increased whenever the format changes.
+	constexpr std::uint32_t SERIALIZED_TABLE_VERSION = 1;
+
+	/// The number of 32 bit fields following the tag: version, grid size x and y, landmark count, and both halves of the grid hash.
+	constexpr std::size_t SERIALIZED_HEADER_FIELDS = 6;
+
+	/// <summary>
+	/// Appends a value to a serialized table, least significant byte first, so tables load on any platform.
+	/// </summary>
+	/// <param name="value">The value.</param>
+	/// <param name="serializedTable">The serialized table.</param>
+	void appendUint32(std::uint32_t value, std::string& serializedTable) {
+		for (int byte = 0; byte < 4; ++byte) {
+			serializedTable.push_back(static_cast<char>((value >> (8 * byte)) & 0xFFu));
+		}
+	}
+
+	/// <summary>
+	/// Reads a value written by appendUint32.
+	/// </summary>
+	/// <param name="serializedTable">The serialized table.</param>
+	/// <param name="offset">The position of the value. Advanced past it.</param>
+	/// <returns>The value.</returns>
+	std::uint32_t readUint32(const std::string& serializedTable, std::size_t& offset) {
+		std::uint32_t value = 0;
+		for (int byte = 0; byte < 4; ++byte) {
+			value |= static_cast<std::uint32_t>(static_cast<unsigned char>(serializedTable[offset++])) << (8 * byte);
+		}
+		return value;
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="LandmarkTable"/> class without a navigation grid or landmarks.
+/// </summary>
+LandmarkTable::LandmarkTable() : LandmarkTable(nullptr, 0) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="LandmarkTable"/> class and builds the tables.
+/// </summary>
+/// <param name="navigationGrid">The grid to build the tables for. May be null.</param>
+/// <param name="landmarkCount">The number of landmarks to place.</param>
+LandmarkTable::LandmarkTable(NavigationGrid* newNavigationGrid, unsigned int landmarkCount) :
+	navigationGrid(newNavigationGrid),
+	gridSize(0, 0),
+	gridHash(0) {
+
+	build(landmarkCount);
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid the tables are built from.
+/// The current tables are kept, so tables deserialized for the grid stay usable.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void LandmarkTable::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* LandmarkTable::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the size of the grid the tables were built for.
+/// </summary>
+/// <returns>The size of the grid. Zero if there are no tables.</returns>
+const sf::Vector2u& LandmarkTable::getGridSize() const {
+	return gridSize;
+}
+
+/// <summary>
+/// Gets the number of landmarks. May be less than requested if the largest area of the grid has fewer grid squares.
+/// </summary>
+/// <returns>The number of landmarks.</returns>
+unsigned int LandmarkTable::getLandmarkCount() const {
+	return static_cast<unsigned int>(landmarks.size());
+}
+
+/// <summary>
+/// Gets the grid squares the costs are measured from.
+/// </summary>
+/// <returns>The landmarks.</returns>
+const std::vector<sf::Vector2i>& LandmarkTable::getLandmarks() const {
+	return landmarks;
+}
+
+/// <summary>
+/// Gets the cost of the cheapest path between a landmark and a grid square.
+/// </summary>
+/// <param name="landmark">The index of the landmark.</param>
+/// <param name="gridSquare">The coordinate of the grid square.</param>
+/// <returns>The cost, or UNREACHABLE_COST if the grid square is blocked, not connected to the landmark, or outside of the grid.</returns>
+unsigned int LandmarkTable::getCost(unsigned int landmark, const sf::Vector2i& gridSquare) const {
+	if (landmark >= landmarks.size() || !isInGrid(gridSquare, gridSize)) {
+		return UNREACHABLE_COST;
+	}
+	return landmarkCosts[static_cast<std::size_t>(flattenGridCoordinate(gridSquare, gridSize.y)) * landmarks.size() + landmark];
+}
+
+/// <summary>
+/// Gets the memory used by the tables.
+/// </summary>
+/// <returns>The number of bytes.</returns>
+std::size_t LandmarkTable::getMemoryUsage() const {
+	return landmarkCosts.size() * sizeof(unsigned int) + landmarks.size() * sizeof(sf::Vector2i);
+}
+
+//operations
+
+/// <summary>
+/// Places landmarks on the navigation grid and measures the cost from each of them to every grid square.
+/// Each landmark is placed on the grid square that is farthest from the landmarks placed before it,
+/// which spreads them along the edges of the map where they bound the most paths.
+/// Every landmark is placed in the largest area of connected grid squares. Paths in other areas are not bounded.
+/// </summary>
+/// <param name="landmarkCount">The number of landmarks to place. Zero discards the tables.</param>
+void LandmarkTable::build(unsigned int landmarkCount) {
+	clear();
+	if (navigationGrid == nullptr || landmarkCount == 0) {
+		return;
+	}
+	gridSize = sf::Vector2u(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	gridHash = calcGridHash(navigationGrid);
+	const std::size_t gridSquareCount = static_cast<std::size_t>(gridSize.x) * gridSize.y;
+
+	// landmarks only bound paths within their own area, so they are all placed in the largest area
+	const unsigned int largestAreaIndex = findLargestArea();
+	if (largestAreaIndex == NO_GRID_SQUARE) {
+		return; // every grid square is blocked
+	}
+	std::vector<unsigned int> nearestLandmarkCosts;
+	std::vector<unsigned int> costs;
+	searchCosts(expandGridIndex(largestAreaIndex, gridSize.y), nearestLandmarkCosts);
+
+	std::vector<unsigned char> isLandmark(gridSquareCount, 0);
+	std::vector<std::vector<unsigned int>> costsByLandmark;
+	while (landmarks.size() < landmarkCount) {
+		// the grid square of the area farthest from every landmark placed so far
+		unsigned int farthestIndex = NO_GRID_SQUARE;
+		for (unsigned int gridIndex = 0; gridIndex < gridSquareCount; ++gridIndex) {
+			if (nearestLandmarkCosts[gridIndex] != UNREACHABLE_COST && isLandmark[gridIndex] == 0 &&
+				(farthestIndex == NO_GRID_SQUARE || nearestLandmarkCosts[gridIndex] > nearestLandmarkCosts[farthestIndex])) {
+				farthestIndex = gridIndex;
+			}
+		}
+		if (farthestIndex == NO_GRID_SQUARE) {
+			break; // every grid square of the area is already a landmark
+		}
+		isLandmark[farthestIndex] = 1;
+
+		const sf::Vector2i landmark = expandGridIndex(farthestIndex, gridSize.y);
+		searchCosts(landmark, costs);
+		for (std::size_t gridIndex = 0; gridIndex < gridSquareCount; ++gridIndex) {
+			nearestLandmarkCosts[gridIndex] = std::min(nearestLandmarkCosts[gridIndex], costs[gridIndex]);
+		}
+		landmarks.push_back(landmark);
+		costsByLandmark.push_back(costs);
+	}
+
+	// interleave the costs so each grid square's costs are adjacent
+	landmarkCosts.resize(gridSquareCount * landmarks.size());
+	for (std::size_t gridIndex = 0; gridIndex < gridSquareCount; ++gridIndex) {
+		for (std::size_t landmark = 0; landmark < landmarks.size(); ++landmark) {
+			landmarkCosts[gridIndex * landmarks.size() + landmark] = costsByLandmark[landmark][gridIndex];
+		}
+	}
+}
+
+/// <summary>
+/// Discards the tables.
+/// </summary>
+void LandmarkTable::clear() {
+	gridSize = sf::Vector2u(0, 0);
+	gridHash = 0;
+	landmarks.clear();
+	landmarkCosts.clear();
+}
+
+/// <summary>
+/// Calculates a cost that the cheapest four neighborhood path between two grid squares never falls below.
+/// </summary>
+/// <param name="start">The start of the path. May be blocked.</param>
+/// <param name="end">The end of the path.</param>
+/// <returns>The largest difference between the costs of both grid squares to a landmark. Zero if no landmark reaches both.</returns>
+unsigned int LandmarkTable::calcLowerBound(const sf::Vector2i& start, const sf::Vector2i& end) const {
+	if (!isInGrid(start, gridSize) || !isInGrid(end, gridSize)) {
+		return 0;
+	}
+	const std::size_t landmarkCount = landmarks.size();
+	const unsigned int* startCosts = landmarkCosts.data() + static_cast<std::size_t>(flattenGridCoordinate(start, gridSize.y)) * landmarkCount;
+	const unsigned int* endCosts = landmarkCosts.data() + static_cast<std::size_t>(flattenGridCoordinate(end, gridSize.y)) * landmarkCount;
+	unsigned int lowerBound = 0;
+	for (std::size_t landmark = 0; landmark < landmarkCount; ++landmark) {
+		const unsigned int startCost = startCosts[landmark];
+		const unsigned int endCost = endCosts[landmark];
+		if (startCost == UNREACHABLE_COST || endCost == UNREACHABLE_COST) {
+			continue;
+		}
+		lowerBound = std::max(lowerBound, (startCost > endCost) ? startCost - endCost : endCost - startCost);
+	}
+	return lowerBound;
+}
+
+/// <summary>
+/// Determines if the tables were built from a grid of the same size and weights as the passed grid.
+/// </summary>
+/// <param name="otherNavigationGrid">The navigation grid.</param>
+/// <returns>True if the tables exist and match the grid.</returns>
+bool LandmarkTable::isBuiltFor(NavigationGrid* otherNavigationGrid) const {
+	if (otherNavigationGrid == nullptr || landmarks.empty() ||
+		otherNavigationGrid->getArraySizeX() != gridSize.x || otherNavigationGrid->getArraySizeY() != gridSize.y) {
+		return false;
+	}
+	return calcGridHash(otherNavigationGrid) == gridHash;
+}
+
+/// <summary>
+/// Writes the tables to a binary string, for example to save them with a FileWriter.
+/// </summary>
+/// <returns>The serialized tables.</returns>
+std::string LandmarkTable::serialize() const {
+	std::string serializedTable(std::begin(SERIALIZED_TABLE_TAG), std::end(SERIALIZED_TABLE_TAG));
+	serializedTable.reserve(serializedTable.size() + 4 * (SERIALIZED_HEADER_FIELDS + 2 * landmarks.size() + landmarkCosts.size()));
+	appendUint32(SERIALIZED_TABLE_VERSION, serializedTable);
+	appendUint32(gridSize.x, serializedTable);
+	appendUint32(gridSize.y, serializedTable);
+	appendUint32(static_cast<std::uint32_t>(landmarks.size()), serializedTable);
+	appendUint32(static_cast<std::uint32_t>(gridHash), serializedTable);
+	appendUint32(static_cast<std::uint32_t>(gridHash >> 32), serializedTable);
+	for (const sf::Vector2i& landmark : landmarks) {
+		appendUint32(static_cast<std::uint32_t>(landmark.x), serializedTable);
+		appendUint32(static_cast<std::uint32_t>(landmark.y), serializedTable);
+	}
+	for (const unsigned int cost : landmarkCosts) {
+		appendUint32(cost, serializedTable);
+	}
+	return serializedTable;
+}
+
+/// <summary>
+/// Replaces the tables with tables written by serialize.
+/// </summary>
+/// <param name="serializedTable">The serialized tables.</param>
+/// <returns>True if the tables were read. False if the string does not hold valid tables, in which case the current tables are kept.</returns>
+bool LandmarkTable::deserialize(const std::string& serializedTable) {
+	const std::size_t headerSize = sizeof(SERIALIZED_TABLE_TAG) + 4 * SERIALIZED_HEADER_FIELDS;
+	if (serializedTable.size() < headerSize || !std::equal(std::begin(SERIALIZED_TABLE_TAG), std::end(SERIALIZED_TABLE_TAG), serializedTable.begin())) {
+		return false;
+	}
+	std::size_t offset = sizeof(SERIALIZED_TABLE_TAG);
+	if (readUint32(serializedTable, offset) != SERIALIZED_TABLE_VERSION) {
+		return false;
+	}
+	// every field is read in its own statement, since the evaluation order of function arguments is unspecified
+	sf::Vector2u newGridSize;
+	newGridSize.x = readUint32(serializedTable, offset);
+	newGridSize.y = readUint32(serializedTable, offset);
+	const std::size_t landmarkCount = readUint32(serializedTable, offset);
+	std::uint64_t newGridHash = readUint32(serializedTable, offset);
+	newGridHash |= static_cast<std::uint64_t>(readUint32(serializedTable, offset)) << 32;
+
+	// each landmark stores its coordinate and one cost for every grid square. The size must match exactly, which also rejects truncated strings.
+	const std::uint64_t gridSquareCount = static_cast<std::uint64_t>(newGridSize.x) * newGridSize.y;
+	const std::size_t payloadFieldCount = (serializedTable.size() - headerSize) / 4;
+	if ((serializedTable.size() - headerSize) % 4 != 0 ||
+		(landmarkCount == 0 && payloadFieldCount != 0) ||
+		(landmarkCount != 0 && (payloadFieldCount % landmarkCount != 0 || payloadFieldCount / landmarkCount != gridSquareCount + 2))) {
+		return false;
+	}
+
+	// the payload holds exactly the coordinates and the costs, so the cost count fits in memory
+	const std::size_t landmarkCostCount = payloadFieldCount - 2 * landmarkCount;
+
+	std::vector<sf::Vector2i> newLandmarks;
+	newLandmarks.reserve(landmarkCount);
+	for (std::size_t landmark = 0; landmark < landmarkCount; ++landmark) {
+		sf::Vector2i gridSquare;
+		gridSquare.x = static_cast<int>(readUint32(serializedTable, offset));
+		gridSquare.y = static_cast<int>(readUint32(serializedTable, offset));
+		if (gridSquare.x < 0 || gridSquare.y < 0 ||
+			static_cast<unsigned int>(gridSquare.x) >= newGridSize.x || static_cast<unsigned int>(gridSquare.y) >= newGridSize.y) {
+			return false;
+		}
+		newLandmarks.push_back(gridSquare);
+	}
+	std::vector<unsigned int> newLandmarkCosts(landmarkCostCount);
+	for (unsigned int& cost : newLandmarkCosts) {
+		cost = readUint32(serializedTable, offset);
+	}
+
+	gridSize = newGridSize;
+	gridHash = newGridHash;
+	landmarks = std::move(newLandmarks);
+	landmarkCosts = std::move(newLandmarkCosts);
+	return true;
+}
+
+// private helper functions
+
+/// <summary>
+/// Finds the largest area of connected unblocked grid squares.
+/// </summary>
+/// <returns>The flattened coordinate of a grid square in the area, or NO_GRID_SQUARE if every grid square is blocked.</returns>
+unsigned int LandmarkTable::findLargestArea() const {
+	const std::size_t gridSquareCount = static_cast<std::size_t>(gridSize.x) * gridSize.y;
+	std::vector<unsigned char> isVisited(gridSquareCount, 0);
+	std::vector<sf::Vector2i> floodBuffer;
+	unsigned int largestAreaIndex = NO_GRID_SQUARE;
+	std::size_t largestAreaSize = 0;
+	for (unsigned int gridIndex = 0; gridIndex < gridSquareCount; ++gridIndex) {
+		const sf::Vector2i areaStart = expandGridIndex(gridIndex, gridSize.y);
+		if (isVisited[gridIndex] != 0 || !isUnblocked(areaStart)) {
+			continue;
+		}
+
+		// flood the area of the grid square
+		std::size_t areaSize = 0;
+		isVisited[gridIndex] = 1;
+		floodBuffer.assign(1, areaStart);
+		while (!floodBuffer.empty()) {
+			const sf::Vector2i current = floodBuffer.back();
+			floodBuffer.pop_back();
+			++areaSize;
+			for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+				const sf::Vector2i neighbor = current + offset;
+				if (isInGrid(neighbor, gridSize) && isVisited[flattenGridCoordinate(neighbor, gridSize.y)] == 0 && isUnblocked(neighbor)) {
+					isVisited[flattenGridCoordinate(neighbor, gridSize.y)] = 1;
+					floodBuffer.push_back(neighbor);
+				}
+			}
+		}
+		if (areaSize > largestAreaSize) {
+			largestAreaSize = areaSize;
+			largestAreaIndex = gridIndex;
+		}
+	}
+	return largestAreaIndex;
+}
+
+/// <summary>
+/// Measures the cost of the cheapest four neighborhood path from a grid square to every grid square.
+/// Like the Pathfinder, each step costs the average weight of the two grid squares, and blocked grid squares are never entered.
+/// </summary>
+/// <param name="landmark">The grid square to measure from.</param>
+/// <param name="costs">Output costs by flattened grid coordinate. UNREACHABLE_COST for grid squares without a path.</param>
+void LandmarkTable::searchCosts(const sf::Vector2i& landmark, std::vector<unsigned int>& costs) const {
+	const std::size_t gridSquareCount = static_cast<std::size_t>(gridSize.x) * gridSize.y;
+	costs.assign(gridSquareCount, UNREACHABLE_COST);
+	std::vector<unsigned char> isClosed(gridSquareCount, 0);
+	IndexedPriorityQueue<unsigned int> openSet(gridSquareCount);
+
+	const unsigned int landmarkIndex = flattenGridCoordinate(landmark, gridSize.y);
+	costs[landmarkIndex] = 0;
+	openSet.pushOrUpdate(landmarkIndex, 0);
+	while (!openSet.isEmpty()) {
+		const unsigned int currentIndex = openSet.pop();
+		isClosed[currentIndex] = 1;
+		const sf::Vector2i current = expandGridIndex(currentIndex, gridSize.y);
+		const int currentWeight = getGridWeight(*navigationGrid, current);
+
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + offset;
+			if (!isInGrid(neighbor, gridSize)) {
+				continue;
+			}
+			const unsigned int neighborIndex = flattenGridCoordinate(neighbor, gridSize.y);
+			const int neighborWeight = getGridWeight(*navigationGrid, neighbor);
+			if (isClosed[neighborIndex] != 0 || neighborWeight >= BLOCKED_GRID_WEIGHT) {
+				continue;
+			}
+			const unsigned int tentativeCost = costs[currentIndex] + static_cast<unsigned int>(calcStepCost(currentWeight, neighborWeight));
+			if (tentativeCost < costs[neighborIndex]) {
+				costs[neighborIndex] = tentativeCost;
+				openSet.pushOrUpdate(neighborIndex, tentativeCost);
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Hashes the size and weights of a navigation grid, so tables loaded for a different map can be recognized.
+/// All blocked weights hash the same.
+/// </summary>
+/// <param name="hashedNavigationGrid">The navigation grid. Must not be null.</param>
+/// <returns>The hash.</returns>
+std::uint64_t LandmarkTable::calcGridHash(NavigationGrid* hashedNavigationGrid) {
+	// FNV-1a
+	std::uint64_t hash = 14695981039346656037ull;
+	const auto hashValue = [&hash](std::uint32_t value) {
+		for (int byte = 0; byte < 4; ++byte) {
+			hash = (hash ^ ((value >> (8 * byte)) & 0xFFu)) * 1099511628211ull;
+		}
+	};
+	hashValue(hashedNavigationGrid->getArraySizeX());
+	hashValue(hashedNavigationGrid->getArraySizeY());
+	for (unsigned int x = 0; x < hashedNavigationGrid->getArraySizeX(); ++x) {
+		for (unsigned int y = 0; y < hashedNavigationGrid->getArraySizeY(); ++y) {
+			hashValue(static_cast<std::uint32_t>(std::min(hashedNavigationGrid->at(x, y)->weight, BLOCKED_GRID_WEIGHT)));
+		}
+	}
+	return hash;
+}
+
+/// <summary>
+/// Determines if a grid square of the navigation grid may be entered.
+/// </summary>
+/// <param name="gridSquare">The coordinate. Must be within the grid.</param>
+/// <returns>True if the grid square is not blocked.</returns>
+bool LandmarkTable::isUnblocked(const sf::Vector2i& gridSquare) const {
+	return getGridWeight(*navigationGrid, gridSquare) < BLOCKED_GRID_WEIGHT;
+}
@@ -1,7 +1,219 @@
 #include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <utility>
+#include <vector>
 
 using namespace GB;
 
+namespace {
+
+	/// Marks a grid square whose blocker distance is being recomputed by updateBlockerDistances.
+	const unsigned int UNKNOWN_BLOCKER_DIST = UINT_MAX;
+
+	/// <summary> Reads and writes the blocker distances of a NavigationGrid for the blocker distance transform. </summary>
+	struct NavigationGridBlockerAccess {
+		NavigationGrid& navGrid;
+
+		unsigned int getSizeX() const { return navGrid.getArraySizeX(); }
+		unsigned int getSizeY() const { return navGrid.getArraySizeY(); }
+		bool isBlocked(unsigned int x, unsigned int y) const { return navGrid.at(x, y)->weight >= BLOCKED_GRID_WEIGHT; }
+		unsigned int getBlockerDist(unsigned int x, unsigned int y) const { return navGrid.at(x, y)->blockerDist; }
+		void setBlockerDist(unsigned int x, unsigned int y, unsigned int newBlockerDist) const { navGrid.at(x, y)->blockerDist = newBlockerDist; }
+	};
+
+	/// <summary> Reads and writes the blocker distances of a DenseNavigationGrid for the blocker distance transform. </summary>
+	struct DenseNavigationGridBlockerAccess {
+		DenseNavigationGrid& navGrid;
+
+		unsigned int getSizeX() const { return navGrid.getArraySizeX(); }
+		unsigned int getSizeY() const { return navGrid.getArraySizeY(); }
+		bool isBlocked(unsigned int x, unsigned int y) const { return navGrid.getWeight(x, y) >= BLOCKED_GRID_WEIGHT; }
+		unsigned int getBlockerDist(unsigned int x, unsigned int y) const { return navGrid.getBlockerDist(x, y); }
+		void setBlockerDist(unsigned int x, unsigned int y, unsigned int newBlockerDist) const { navGrid.setBlockerDist(x, y, newBlockerDist); }
+	};
+
+	/// <summary>
+	/// Reads and writes the blocker distances of a ChunkedNavigationGrid for the blocker distance transform.
+	/// Reads never allocate a tile. Writes only allocate a tile when they change a distance.
+	/// </summary>
+	struct ChunkedNavigationGridBlockerAccess {
+		ChunkedNavigationGrid& navGrid;
+
+		unsigned int getSizeX() const { return navGrid.getArraySizeX(); }
+		unsigned int getSizeY() const { return navGrid.getArraySizeY(); }
+		bool isBlocked(unsigned int x, unsigned int y) const { return getGridData(x, y).weight >= BLOCKED_GRID_WEIGHT; }
+		unsigned int getBlockerDist(unsigned int x, unsigned int y) const { return getGridData(x, y).blockerDist; }
+		void setBlockerDist(unsigned int x, unsigned int y, unsigned int newBlockerDist) const {
+			if (getBlockerDist(x, y) != newBlockerDist) {
+				navGrid.at(x, y).blockerDist = newBlockerDist;
+			}
+		}
+		const NavigationGridData& getGridData(unsigned int x, unsigned int y) const { return static_cast<const ChunkedNavigationGrid&>(navGrid).at(x, y); }
+	};
+
+	/// <summary>
+	/// Calls a function with each of the up to 8 grid squares surrounding a grid square that are inside of the grid.
+	/// </summary>
+	/// <param name="grid">The grid access.</param>
+	/// <param name="gridSquare">The grid square at the center.</param>
+	/// <param name="visitNeighbor">Called with the x and y position of each neighbor.</param>
+	template <class GridAccess, class NeighborVisitor>
+	void forEachNeighbor(const GridAccess& grid, const sf::Vector2u& gridSquare, const NeighborVisitor& visitNeighbor) {
+		const unsigned int xBegin = (gridSquare.x == 0) ? 0 : gridSquare.x - 1;
+		const unsigned int yBegin = (gridSquare.y == 0) ? 0 : gridSquare.y - 1;
+		const unsigned int xEnd = std::min(gridSquare.x + 2, grid.getSizeX());
+		const unsigned int yEnd = std::min(gridSquare.y + 2, grid.getSizeY());
+		for (unsigned int x = xBegin; x < xEnd; ++x) {
+			for (unsigned int y = yBegin; y < yEnd; ++y) {
+				if (x != gridSquare.x || y != gridSquare.y) {
+					visitNeighbor(x, y);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Calculates the blocker distance of a grid square that only has the edge of the grid to measure against.
+	/// Everything outside of the grid counts as blocked.
+	/// </summary>
+	/// <param name="grid">The grid access.</param>
+	/// <param name="x">The x position of the grid square.</param>
+	/// <param name="y">The y position of the grid square.</param>
+	/// <returns>The number of steps to the first grid square outside of the grid.</returns>
+	template <class GridAccess>
+	unsigned int calcEdgeDist(const GridAccess& grid, unsigned int x, unsigned int y) {
+		return std::min({x + 1, y + 1, grid.getSizeX() - x, grid.getSizeY() - y});
+	}
+
+	/// <summary>
+	/// Pushes a grid square onto the bucket of its blocker distance.
+	/// </summary>
+	/// <param name="buckets">The grid squares to expand, bucketed by their blocker distance.</param>
+	/// <param name="gridSquare">The grid square.</param>
+	/// <param name="blockerDist">The blocker distance of the grid square.</param>
+	void pushBlockerDistBucket(std::vector<std::vector<sf::Vector2u>>& buckets, const sf::Vector2u& gridSquare, unsigned int blockerDist) {
+		if (buckets.size() <= blockerDist) {
+			buckets.resize(blockerDist + 1);
+		}
+		buckets[blockerDist].push_back(gridSquare);
+	}
+
+	/// <summary>
+	/// Lowers blocker distances outwards from the bucketed grid squares in order of distance, like a multi source breadth first search.
+	/// A grid square is lowered to one more than its neighbor. Each grid square is expanded once per distance it is lowered to.
+	/// </summary>
+	/// <param name="grid">The grid access.</param>
+	/// <param name="buckets">The grid squares to expand, bucketed by their blocker distance. Emptied by the call.</param>
+	template <class GridAccess>
+	void propagateBlockerDistances(const GridAccess& grid, std::vector<std::vector<sf::Vector2u>>& buckets) {
+		// lowering a grid square only ever pushes onto the next bucket, so the buckets may grow while they are walked
+		for (unsigned int blockerDist = 0; blockerDist < buckets.size(); ++blockerDist) {
+			for (std::size_t ii = 0; ii < buckets[blockerDist].size(); ++ii) {
+				const sf::Vector2u gridSquare = buckets[blockerDist][ii];
+				// skip grid squares that were lowered after they were pushed
+				if (grid.getBlockerDist(gridSquare.x, gridSquare.y) != blockerDist) {
+					continue;
+				}
+				forEachNeighbor(grid, gridSquare, [&grid, &buckets, blockerDist](unsigned int x, unsigned int y) {
+					if (blockerDist + 1 < grid.getBlockerDist(x, y)) {
+						grid.setBlockerDist(x, y, blockerDist + 1);
+						pushBlockerDistBucket(buckets, sf::Vector2u(x, y), blockerDist + 1);
+					}
+				});
+			}
+			buckets[blockerDist].clear();
+		}
+	}
+
+	/// <summary>
+	/// Sets the blocker distance of every grid square. See calcBlockerDistances.
+	/// </summary>
+	/// <param name="grid">The grid access.</param>
+	template <class GridAccess>
+	void calcBlockerDistancesImpl(const GridAccess& grid) {
+		std::vector<std::vector<sf::Vector2u>> buckets(1);
+		for (unsigned int x = 0; x < grid.getSizeX(); ++x) {
+			for (unsigned int y = 0; y < grid.getSizeY(); ++y) {
+				if (grid.isBlocked(x, y)) {
+					grid.setBlockerDist(x, y, 0);
+					buckets[0].emplace_back(x, y);
+				}
+				else {
+					grid.setBlockerDist(x, y, calcEdgeDist(grid, x, y));
+				}
+			}
+		}
+		propagateBlockerDistances(grid, buckets);
+	}
+
+	/// <summary>
+	/// Repairs the blocker distances around grid squares that were blocked or unblocked. See updateBlockerDistances.
+	/// </summary>
+	/// <param name="grid">The grid access.</param>
+	/// <param name="changedGridSquares">The grid squares whose weights changed.</param>
+	template <class GridAccess>
+	void updateBlockerDistancesImpl(const GridAccess& grid, const std::vector<sf::Vector2i>& changedGridSquares) {
+		std::vector<std::vector<sf::Vector2u>> buckets(1);
+
+		// New blockers lower the distances around them. Removed blockers raise every distance that was measured to them.
+		// A removed blocker still has a distance of 0, so it is found without knowing the old weight.
+		std::vector<std::pair<sf::Vector2u, unsigned int>> raisedGridSquares;
+		for (const sf::Vector2i& changedGridSquare : changedGridSquares) {
+			if (changedGridSquare.x < 0 || changedGridSquare.y < 0 ||
+				static_cast<unsigned int>(changedGridSquare.x) >= grid.getSizeX() || static_cast<unsigned int>(changedGridSquare.y) >= grid.getSizeY()) {
+				continue;
+			}
+			const sf::Vector2u gridSquare(static_cast<unsigned int>(changedGridSquare.x), static_cast<unsigned int>(changedGridSquare.y));
+			const unsigned int oldBlockerDist = grid.getBlockerDist(gridSquare.x, gridSquare.y);
+			if (grid.isBlocked(gridSquare.x, gridSquare.y)) {
+				if (oldBlockerDist != 0) {
+					grid.setBlockerDist(gridSquare.x, gridSquare.y, 0);
+					buckets[0].push_back(gridSquare);
+				}
+			}
+			else if (oldBlockerDist == 0) {
+				grid.setBlockerDist(gridSquare.x, gridSquare.y, UNKNOWN_BLOCKER_DIST);
+				raisedGridSquares.emplace_back(gridSquare, oldBlockerDist);
+			}
+		}
+
+		// Mark every grid square whose old distance may have been measured to a removed blocker.
+		// Those are the grid squares reached by counting up by one from a removed blocker.
+		for (std::size_t ii = 0; ii < raisedGridSquares.size(); ++ii) {
+			const sf::Vector2u gridSquare = raisedGridSquares[ii].first;
+			const unsigned int oldBlockerDist = raisedGridSquares[ii].second;
+			forEachNeighbor(grid, gridSquare, [&grid, &raisedGridSquares, oldBlockerDist](unsigned int x, unsigned int y) {
+				const unsigned int neighborBlockerDist = grid.getBlockerDist(x, y);
+				if (neighborBlockerDist != UNKNOWN_BLOCKER_DIST && neighborBlockerDist == oldBlockerDist + 1) {
+					grid.setBlockerDist(x, y, UNKNOWN_BLOCKER_DIST);
+					raisedGridSquares.emplace_back(sf::Vector2u(x, y), neighborBlockerDist);
+				}
+			});
+		}
+
+		// The unmarked grid squares bordering the marked ones still hold correct distances. They are the sources for the marked grid squares.
+		for (const auto& raisedGridSquare : raisedGridSquares) {
+			forEachNeighbor(grid, raisedGridSquare.first, [&grid, &buckets](unsigned int x, unsigned int y) {
+				const unsigned int neighborBlockerDist = grid.getBlockerDist(x, y);
+				if (neighborBlockerDist != UNKNOWN_BLOCKER_DIST) {
+					pushBlockerDistBucket(buckets, sf::Vector2u(x, y), neighborBlockerDist);
+				}
+			});
+		}
+		for (const auto& raisedGridSquare : raisedGridSquares) {
+			const sf::Vector2u gridSquare = raisedGridSquare.first;
+			grid.setBlockerDist(gridSquare.x, gridSquare.y, calcEdgeDist(grid, gridSquare.x, gridSquare.y));
+		}
+
+		propagateBlockerDistances(grid, buckets);
+	}
+}
+
 /// <summary>
 /// Frees all memory stored in the NavigationGrid
 /// </summary>
@@ -15,3 +227,197 @@ void GB::freeAllNavigationGridData(NavigationGrid& navGrid) {
 	}
 }
 
+
+/// <summary>
+/// Checks if the straight line between the centers of two grid squares only crosses grid squares that are light enough.
+/// Every grid square the line touches is checked. A line through the corner of two grid squares touches both of them,
+/// so the line never squeezes between two diagonal blockers.
+/// The weight of the grid square the line starts in is ignored, so a line may always leave its start.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight a grid square on the line may have.</param>
+/// <returns>True if no grid square after the start is heavier than the max weight. False otherwise.</returns>
+bool GB::hasLineOfSight(NavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	return calcLineOfSightWeight(navGrid, from, to, maxWeight) <= maxWeight;
+}
+
+/// <summary>
+/// Finds the heaviest grid square the straight line between the centers of two grid squares touches, like hasLineOfSight.
+/// Stops at the first grid square that is heavier than the max weight.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight to look past.</param>
+/// <returns>
+/// The heaviest weight after the start if no grid square is heavier than the max weight. Otherwise the first weight that is.
+/// INT_MIN if the line ends in its start.
+/// </returns>
+int GB::calcLineOfSightWeight(NavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	const auto getWeight = [&navGrid](int x, int y) {
+		return navGrid.at(static_cast<unsigned int>(x), static_cast<unsigned int>(y))->weight;
+	};
+	return walkLineOfSight(getWeight, from, to, maxWeight);
+}
+
+/// <summary>
+/// Checks if the straight line between the centers of two grid squares only crosses grid squares that are light enough, like hasLineOfSight.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight a grid square on the line may have.</param>
+/// <returns>True if no grid square after the start is heavier than the max weight. False otherwise.</returns>
+bool GB::hasLineOfSight(const DenseNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	return calcLineOfSightWeight(navGrid, from, to, maxWeight) <= maxWeight;
+}
+
+/// <summary>
+/// Finds the heaviest grid square the straight line between the centers of two grid squares touches, like calcLineOfSightWeight.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight to look past.</param>
+/// <returns>
+/// The heaviest weight after the start if no grid square is heavier than the max weight. Otherwise the first weight that is.
+/// INT_MIN if the line ends in its start.
+/// </returns>
+int GB::calcLineOfSightWeight(const DenseNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	const auto getWeight = [&navGrid](int x, int y) {
+		return navGrid.getWeight(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+	};
+	return walkLineOfSight(getWeight, from, to, maxWeight);
+}
+
+/// <summary>
+/// Checks if the straight line between the centers of two grid squares only crosses grid squares that are light enough, like hasLineOfSight.
+/// When every passable weight is light enough, a line along a column is tested against the passability plane 64 grid squares at a time.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight a grid square on the line may have.</param>
+/// <returns>True if no grid square after the start is heavier than the max weight. False otherwise.</returns>
+bool GB::hasLineOfSight(const CompactNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	if (from.x == to.x && maxWeight >= navGrid.getMaxWeight() && maxWeight < BLOCKED_GRID_WEIGHT) {
+		// the start is skipped
+		const unsigned int x = static_cast<unsigned int>(from.x);
+		if (to.y > from.y) {
+			return navGrid.isColumnPassable(x, static_cast<unsigned int>(from.y + 1), static_cast<unsigned int>(to.y + 1));
+		}
+		return navGrid.isColumnPassable(x, static_cast<unsigned int>(to.y), static_cast<unsigned int>(from.y));
+	}
+	return calcLineOfSightWeight(navGrid, from, to, maxWeight) <= maxWeight;
+}
+
+/// <summary>
+/// Finds the heaviest grid square the straight line between the centers of two grid squares touches, like calcLineOfSightWeight.
+/// Blocked grid squares weigh BLOCKED_GRID_WEIGHT, and passable grid squares weigh their quantized weight.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight to look past.</param>
+/// <returns>
+/// The heaviest weight after the start if no grid square is heavier than the max weight. Otherwise the first weight that is.
+/// INT_MIN if the line ends in its start.
+/// </returns>
+int GB::calcLineOfSightWeight(const CompactNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	const auto getWeight = [&navGrid](int x, int y) {
+		return navGrid.getWeight(static_cast<unsigned int>(x), static_cast<unsigned int>(y));
+	};
+	return walkLineOfSight(getWeight, from, to, maxWeight);
+}
+
+/// <summary>
+/// Checks if the straight line between the centers of two grid squares only crosses grid squares that are light enough, like hasLineOfSight.
+/// No tile of the grid is allocated.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight a grid square on the line may have.</param>
+/// <returns>True if no grid square after the start is heavier than the max weight. False otherwise.</returns>
+bool GB::hasLineOfSight(const ChunkedNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	return calcLineOfSightWeight(navGrid, from, to, maxWeight) <= maxWeight;
+}
+
+/// <summary>
+/// Finds the heaviest grid square the straight line between the centers of two grid squares touches, like calcLineOfSightWeight.
+/// No tile of the grid is allocated.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Both grid squares must be inside of it.</param>
+/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="maxWeight">The highest weight to look past.</param>
+/// <returns>
+/// The heaviest weight after the start if no grid square is heavier than the max weight. Otherwise the first weight that is.
+/// INT_MIN if the line ends in its start.
+/// </returns>
+int GB::calcLineOfSightWeight(const ChunkedNavigationGrid& navGrid, const sf::Vector2i& from, const sf::Vector2i& to, int maxWeight) {
+	const auto getWeight = [&navGrid](int x, int y) {
+		return navGrid.at(static_cast<unsigned int>(x), static_cast<unsigned int>(y)).weight;
+	};
+	return walkLineOfSight(getWeight, from, to, maxWeight);
+}
+
+/// <summary>
+/// Sets the blocker distance of every grid square to the number of steps to the closest blocked grid square.
+/// A step moves to any of the 8 surrounding grid squares, so a grid square with a blocker distance of d has no blocked grid square
+/// in the square of 2d - 1 grid squares centered on it. Everything outside of the grid counts as blocked. Blocked grid squares get 0.
+/// Runs in time linear in the number of grid squares.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Every grid square must have data.</param>
+void GB::calcBlockerDistances(NavigationGrid& navGrid) {
+	calcBlockerDistancesImpl(NavigationGridBlockerAccess{navGrid});
+}
+
+/// <summary>
+/// Sets the blocker distance of every grid square, like calcBlockerDistances.
+/// </summary>
+/// <param name="navGrid">The navigation grid.</param>
+void GB::calcBlockerDistances(DenseNavigationGrid& navGrid) {
+	calcBlockerDistancesImpl(DenseNavigationGridBlockerAccess{navGrid});
+}
+
+/// <summary>
+/// Sets the blocker distance of every grid square, like calcBlockerDistances.
+/// Tiles that are not allocated are allocated when the distance of one of their grid squares differs from the default value.
+/// </summary>
+/// <param name="navGrid">The navigation grid.</param>
+void GB::calcBlockerDistances(ChunkedNavigationGrid& navGrid) {
+	calcBlockerDistancesImpl(ChunkedNavigationGridBlockerAccess{navGrid});
+}
+
+/// <summary>
+/// Repairs the blocker distances after grid squares were blocked or unblocked.
+/// The blocker distances must have been correct before the weights changed, for example from calcBlockerDistances.
+/// Only the grid squares whose distance changes and their neighbors are visited, so local edits are cheap.
+/// </summary>
+/// <param name="navGrid">The navigation grid. Every grid square must have data.</param>
+/// <param name="changedGridSquares">The grid squares whose weights changed. Grid squares outside of the grid are skipped.</param>
+void GB::updateBlockerDistances(NavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares) {
+	updateBlockerDistancesImpl(NavigationGridBlockerAccess{navGrid}, changedGridSquares);
+}
+
+/// <summary>
+/// Repairs the blocker distances after grid squares were blocked or unblocked, like updateBlockerDistances.
+/// </summary>
+/// <param name="navGrid">The navigation grid.</param>
+/// <param name="changedGridSquares">The grid squares whose weights changed. Grid squares outside of the grid are skipped.</param>
+void GB::updateBlockerDistances(DenseNavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares) {
+	updateBlockerDistancesImpl(DenseNavigationGridBlockerAccess{navGrid}, changedGridSquares);
+}
+
+/// <summary>
+/// Repairs the blocker distances after grid squares were blocked or unblocked, like updateBlockerDistances.
+/// Only tiles whose distances change are allocated.
+/// </summary>
+/// <param name="navGrid">The navigation grid.</param>
+/// <param name="changedGridSquares">The grid squares whose weights changed. Grid squares outside of the grid are skipped.</param>
+void GB::updateBlockerDistances(ChunkedNavigationGrid& navGrid, const std::vector<sf::Vector2i>& changedGridSquares) {
+	updateBlockerDistancesImpl(ChunkedNavigationGridBlockerAccess{navGrid}, changedGridSquares);
+}
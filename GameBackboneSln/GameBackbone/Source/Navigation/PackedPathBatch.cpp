@@ -0,0 +1,267 @@
+#include <GameBackbone/Navigation/PackedPathBatch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+//---------------------------------------------------------------------------------------------------------------------
+// PackedPath
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PackedPath"/> class without waypoints.
+/// </summary>
+PackedPath::PackedPath() : waypointCount(0) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PackedPath"/> class.
+/// </summary>
+/// <param name="newBegin">An iterator at the first waypoint of the path.</param>
+/// <param name="newSize">The number of waypoints of the path.</param>
+PackedPath::PackedPath(const PackedPathIterator& newBegin, std::size_t newSize) : first(newBegin), waypointCount(newSize) {
+}
+
+//getters
+
+/// <summary>
+/// Gets an iterator at the first remaining waypoint.
+/// </summary>
+/// <returns>The iterator.</returns>
+PackedPathIterator PackedPath::begin() const {
+	return first;
+}
+
+/// <summary>
+/// Gets an iterator past the last waypoint.
+/// </summary>
+/// <returns>The iterator.</returns>
+PackedPathIterator PackedPath::end() const {
+	return PackedPathIterator();
+}
+
+/// <summary>
+/// Gets the number of remaining waypoints.
+/// </summary>
+/// <returns>The number of waypoints.</returns>
+std::size_t PackedPath::size() const {
+	return waypointCount;
+}
+
+/// <summary>
+/// Checks if every waypoint was dropped.
+/// </summary>
+/// <returns>True if no waypoints remain. False otherwise.</returns>
+bool PackedPath::empty() const {
+	return waypointCount == 0;
+}
+
+/// <summary>
+/// Gets the first remaining waypoint. Must not be called on an empty path.
+/// </summary>
+/// <returns>The waypoint.</returns>
+const sf::Vector2i& PackedPath::front() const {
+	return *first;
+}
+
+//operations
+
+/// <summary>
+/// Drops the first remaining waypoint. Must not be called on an empty path.
+/// </summary>
+void PackedPath::popFront() {
+	++first;
+	--waypointCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// PackedPathBatch
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PackedPathBatch"/> class that stores waypoints without encoding.
+/// </summary>
+PackedPathBatch::PackedPathBatch() : PackedPathBatch(PATH_ENCODING_NONE) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PackedPathBatch"/> class.
+/// </summary>
+/// <param name="newEncoding">How the waypoints are stored.</param>
+PackedPathBatch::PackedPathBatch(PATH_ENCODING_TYPE newEncoding) : encoding(newEncoding), pathOffsets{0}, waypointCount(0) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets how the waypoints are stored. Removes every path, since stored paths are not encoded again.
+/// </summary>
+/// <param name="newEncoding">The encoding.</param>
+void PackedPathBatch::setEncoding(PATH_ENCODING_TYPE newEncoding) {
+	encoding = newEncoding;
+	clear();
+}
+
+//getters
+
+/// <summary>
+/// Gets how the waypoints are stored.
+/// </summary>
+/// <returns>The encoding.</returns>
+PATH_ENCODING_TYPE PackedPathBatch::getEncoding() const {
+	return encoding;
+}
+
+/// <summary>
+/// Gets the number of stored paths.
+/// </summary>
+/// <returns>The number of paths.</returns>
+std::size_t PackedPathBatch::getPathCount() const {
+	return pathSizes.size();
+}
+
+/// <summary>
+/// Gets the number of waypoints of every stored path together.
+/// </summary>
+/// <returns>The number of waypoints.</returns>
+std::size_t PackedPathBatch::getWaypointCount() const {
+	return waypointCount;
+}
+
+/// <summary>
+/// Gets the memory held by the batch, including memory kept for reuse after clear.
+/// </summary>
+/// <returns>The memory usage in bytes.</returns>
+std::size_t PackedPathBatch::getMemoryUsage() const {
+	return sizeof(PackedPathBatch) +
+		waypoints.capacity() * sizeof(sf::Vector2i) +
+		encodedWaypoints.capacity() * sizeof(std::uint8_t) +
+		pathOffsets.capacity() * sizeof(std::size_t) +
+		pathSizes.capacity() * sizeof(std::size_t);
+}
+
+/// <summary>
+/// Gets a view of a stored path that reads it directly from the batch.
+/// </summary>
+/// <param name="pathIndex">The index of the path. Paths are stored in the order they were appended.</param>
+/// <returns>The path. Invalidated when the batch is modified.</returns>
+PackedPath PackedPathBatch::getPath(std::size_t pathIndex) const {
+	const std::size_t pathOffset = pathOffsets[pathIndex];
+	const std::size_t pathSize = pathSizes[pathIndex];
+	if (encoding == PATH_ENCODING_NONE) {
+		return PackedPath(PackedPathIterator(encoding, waypoints.data() + pathOffset, nullptr, pathSize), pathSize);
+	}
+	return PackedPath(PackedPathIterator(encoding, nullptr, encodedWaypoints.data() + pathOffset, pathSize), pathSize);
+}
+
+/// <summary>
+/// Copies a stored path into a deque.
+/// </summary>
+/// <param name="pathIndex">The index of the path. Paths are stored in the order they were appended.</param>
+/// <param name="returnedPath">Replaced by the waypoints of the path.</param>
+void PackedPathBatch::getPath(std::size_t pathIndex, std::deque<sf::Vector2i>& returnedPath) const {
+	const PackedPath path = getPath(pathIndex);
+	returnedPath.assign(path.begin(), path.end());
+}
+
+//operations
+
+/// <summary>
+/// Stores a path after the stored paths.
+/// </summary>
+/// <param name="path">The path.</param>
+void PackedPathBatch::appendPath(const std::deque<sf::Vector2i>& path) {
+	appendPath(path.begin(), path.end());
+}
+
+/// <summary>
+/// Stores a path of another batch after the stored paths. Both batches must have the same encoding.
+/// Every path is encoded on its own, so the path is copied without decoding it.
+/// </summary>
+/// <param name="otherBatch">The batch that stores the path.</param>
+/// <param name="pathIndex">The index of the path in the other batch.</param>
+void PackedPathBatch::appendPath(const PackedPathBatch& otherBatch, std::size_t pathIndex) {
+	const std::size_t pathOffset = otherBatch.pathOffsets[pathIndex];
+	const std::size_t pathEnd = otherBatch.pathOffsets[pathIndex + 1];
+	if (encoding == PATH_ENCODING_NONE) {
+		waypoints.insert(waypoints.end(), otherBatch.waypoints.begin() + static_cast<std::ptrdiff_t>(pathOffset), otherBatch.waypoints.begin() + static_cast<std::ptrdiff_t>(pathEnd));
+	}
+	else {
+		encodedWaypoints.insert(encodedWaypoints.end(), otherBatch.encodedWaypoints.begin() + static_cast<std::ptrdiff_t>(pathOffset), otherBatch.encodedWaypoints.begin() + static_cast<std::ptrdiff_t>(pathEnd));
+	}
+	finishPath(otherBatch.pathSizes[pathIndex]);
+}
+
+/// <summary>
+/// Replaces the stored paths.
+/// </summary>
+/// <param name="paths">The paths to store, in order.</param>
+void PackedPathBatch::assign(const std::vector<std::deque<sf::Vector2i>>& paths) {
+	clear();
+	pathOffsets.reserve(paths.size() + 1);
+	pathSizes.reserve(paths.size());
+	for (const std::deque<sf::Vector2i>& path : paths) {
+		appendPath(path);
+	}
+}
+
+/// <summary>
+/// Removes every path. The memory of the batch is kept to store the next paths.
+/// </summary>
+void PackedPathBatch::clear() {
+	waypoints.clear();
+	encodedWaypoints.clear();
+	pathOffsets.assign(1, 0);
+	pathSizes.clear();
+	waypointCount = 0;
+}
+
+// private helper functions
+
+/// <summary>
+/// Records the end of a path whose waypoints were just stored.
+/// </summary>
+/// <param name="pathSize">The number of waypoints of the path.</param>
+void PackedPathBatch::finishPath(std::size_t pathSize) {
+	pathOffsets.push_back((encoding == PATH_ENCODING_NONE) ? waypoints.size() : encodedWaypoints.size());
+	pathSizes.push_back(pathSize);
+	waypointCount += pathSize;
+}
+
+/// <summary>
+/// Stores a run of equal offsets for run length encoding.
+/// </summary>
+/// <param name="runOffset">The offset of each waypoint of the run from the waypoint before it.</param>
+/// <param name="runLength">The number of waypoints of the run.</param>
+void PackedPathBatch::writeRun(const sf::Vector2i& runOffset, std::size_t runLength) {
+	writeSignedValue(runOffset.x);
+	writeSignedValue(runOffset.y);
+	writeUnsignedValue(static_cast<std::uint32_t>(runLength));
+}
+
+/// <summary>
+/// Stores a value in the format of writeUnsignedValue with its sign in the lowest bit, so small negative values stay small.
+/// </summary>
+/// <param name="value">The value.</param>
+void PackedPathBatch::writeSignedValue(int value) {
+	writeUnsignedValue((static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31));
+}
+
+/// <summary>
+/// Stores a value in groups of seven bits, lowest group first. The high bit of each byte marks that another group follows.
+/// </summary>
+/// <param name="value">The value.</param>
+void PackedPathBatch::writeUnsignedValue(std::uint32_t value) {
+	while (value >= 0x80u) {
+		encodedWaypoints.push_back(static_cast<std::uint8_t>(value | 0x80u));
+		value >>= 7;
+	}
+	encodedWaypoints.push_back(static_cast<std::uint8_t>(value));
+}
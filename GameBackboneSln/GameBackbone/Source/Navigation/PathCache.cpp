@@ -0,0 +1,277 @@
+#include <GameBackbone/Navigation/PathCache.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+using namespace GB;
+
+namespace {
+
+	/// The memory each cached path is charged for besides its grid squares, covering the list and lookup nodes.
+	constexpr std::size_t PATH_OVERHEAD_BYTES = 8 * sizeof(void*);
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PathCache"/> class without memory, which caches nothing.
+/// </summary>
+PathCache::PathCache() :
+	memoryLimit(0),
+	memoryUsage(0),
+	gridVersion(0),
+	hitCount(0),
+	missCount(0),
+	cacheGridSize(0, 0) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the most memory the cached paths may use. Discards the least recently used paths until they fit.
+/// </summary>
+/// <param name="maxBytes">The memory limit in bytes. Zero disables the cache.</param>
+void PathCache::setMemoryLimit(std::size_t maxBytes) {
+	memoryLimit = maxBytes;
+	while (memoryUsage > memoryLimit) {
+		erasePath(std::prev(cachedPaths.end()));
+	}
+}
+
+//getters
+
+/// <summary>
+/// Gets the most memory the cached paths may use.
+/// </summary>
+/// <returns>The memory limit in bytes. Zero if the cache is disabled.</returns>
+std::size_t PathCache::getMemoryLimit() const {
+	return memoryLimit;
+}
+
+/// <summary>
+/// Gets the memory used by the cached paths.
+/// </summary>
+/// <returns>The memory usage in bytes.</returns>
+std::size_t PathCache::getMemoryUsage() const {
+	return memoryUsage;
+}
+
+/// <summary>
+/// Gets the number of cached paths, including paths of previous grid versions that were not discarded yet.
+/// </summary>
+/// <returns></returns>
+std::size_t PathCache::getPathCount() const {
+	return cachedPaths.size();
+}
+
+/// <summary>
+/// Gets the version of the navigation grid that new paths are cached for.
+/// </summary>
+/// <returns></returns>
+std::uint64_t PathCache::getGridVersion() const {
+	return gridVersion;
+}
+
+/// <summary>
+/// Gets the number of lookups that found a path since the counters were last reset.
+/// </summary>
+/// <returns></returns>
+std::size_t PathCache::getHitCount() const {
+	return hitCount;
+}
+
+/// <summary>
+/// Gets the number of lookups that did not find a path since the counters were last reset.
+/// </summary>
+/// <returns></returns>
+std::size_t PathCache::getMissCount() const {
+	return missCount;
+}
+
+//operations
+
+/// <summary>
+/// Looks up the path of a path request on the current grid version.
+/// </summary>
+/// <param name="pathRequest">The path request. Its search mode must not be PATH_SEARCH_MODE_DEFAULT.</param>
+/// <param name="returnedPath">The cached path. Unchanged if no path is cached.</param>
+/// <returns>True if a path was cached for the request.</returns>
+bool PathCache::find(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) {
+	const auto lookupIt = pathLookup.find(makeKey(pathRequest));
+	if (lookupIt == pathLookup.end()) {
+		++missCount;
+		return false;
+	}
+	++hitCount;
+
+	// mark the path as most recently used
+	cachedPaths.splice(cachedPaths.begin(), cachedPaths, lookupIt->second);
+	returnedPath.assign(lookupIt->second->path.begin(), lookupIt->second->path.end());
+	return true;
+}
+
+/// <summary>
+/// Caches the path of a path request on the current grid version.
+/// Empty paths and paths larger than the memory limit are not cached.
+/// </summary>
+/// <param name="pathRequest">The path request. Its search mode must not be PATH_SEARCH_MODE_DEFAULT.</param>
+/// <param name="path">The found path.</param>
+void PathCache::insert(const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+	const std::size_t byteCount = sizeof(CachedPath) + PATH_OVERHEAD_BYTES + path.size() * sizeof(sf::Vector2i);
+	if (path.empty() || byteCount > memoryLimit || !isInGrid(pathRequest.start, cacheGridSize)) {
+		return;
+	}
+	const PathKey key = makeKey(pathRequest);
+	const auto lookupIt = pathLookup.find(key);
+	if (lookupIt != pathLookup.end()) {
+		erasePath(lookupIt->second);
+	}
+
+	cachedPaths.push_front(CachedPath{key, std::vector<sf::Vector2i>(path.begin(), path.end()), byteCount});
+	pathLookup.emplace(key, cachedPaths.begin());
+	referenceGridSquares(cachedPaths.front(), 1);
+	memoryUsage += byteCount;
+
+	// discard the least recently used paths until the cache fits
+	while (memoryUsage > memoryLimit) {
+		erasePath(std::prev(cachedPaths.end()));
+	}
+}
+
+/// <summary>
+/// Prepares the cache for a navigation grid of the passed size. Discards every path if the size changed.
+/// </summary>
+/// <param name="gridSize">The size of the navigation grid.</param>
+void PathCache::fitToGridSize(const sf::Vector2u& gridSize) {
+	if (gridSize == cacheGridSize) {
+		return;
+	}
+	clear();
+	cacheGridSize = gridSize;
+	const std::size_t gridSquareCount = static_cast<std::size_t>(gridSize.x) * gridSize.y;
+	gridSquareReferences.assign(gridSquareCount, 0);
+	changedGridSquareMarks.assign(gridSquareCount, 0);
+}
+
+/// <summary>
+/// Discards every cached path that starts at or passes through a changed grid square.
+/// Paths elsewhere are kept, even if a cheaper path now exists through a grid square whose weight was lowered.
+/// Use invalidate when that matters.
+/// </summary>
+/// <param name="changedGridSquares">The grid squares whose weight changed.</param>
+void PathCache::updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares) {
+	bool isAnyPathChanged = false;
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		if (isInGrid(gridSquare, cacheGridSize) && gridSquareReferences[flattenGridCoordinate(gridSquare, cacheGridSize.y)] > 0) {
+			changedGridSquareMarks[flattenGridCoordinate(gridSquare, cacheGridSize.y)] = 1;
+			isAnyPathChanged = true;
+		}
+	}
+	if (!isAnyPathChanged) {
+		return;
+	}
+
+	const auto isChanged = [this](const sf::Vector2i& gridSquare) {
+		return changedGridSquareMarks[flattenGridCoordinate(gridSquare, cacheGridSize.y)] != 0;
+	};
+	for (auto cachedPathIt = cachedPaths.begin(); cachedPathIt != cachedPaths.end();) {
+		bool isPathChanged = isChanged(cachedPathIt->key.start);
+		for (auto gridSquareIt = cachedPathIt->path.begin(); !isPathChanged && gridSquareIt != cachedPathIt->path.end(); ++gridSquareIt) {
+			isPathChanged = isChanged(*gridSquareIt);
+		}
+		cachedPathIt = isPathChanged ? erasePath(cachedPathIt) : std::next(cachedPathIt);
+	}
+
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		if (isInGrid(gridSquare, cacheGridSize)) {
+			changedGridSquareMarks[flattenGridCoordinate(gridSquare, cacheGridSize.y)] = 0;
+		}
+	}
+}
+
+/// <summary>
+/// Advances the grid version, so no path cached before is found again.
+/// The old paths are discarded as newer paths need their memory.
+/// </summary>
+void PathCache::invalidate() {
+	++gridVersion;
+}
+
+/// <summary>
+/// Discards every cached path.
+/// </summary>
+void PathCache::clear() {
+	cachedPaths.clear();
+	pathLookup.clear();
+	std::fill(gridSquareReferences.begin(), gridSquareReferences.end(), 0);
+	memoryUsage = 0;
+}
+
+/// <summary>
+/// Resets the hit and miss counters.
+/// </summary>
+void PathCache::resetCounters() {
+	hitCount = 0;
+	missCount = 0;
+}
+
+// private helper functions
+
+/// <summary>
+/// Compares two keys.
+/// </summary>
+/// <param name="other">The other key.</param>
+/// <returns>True if both keys identify the same path.</returns>
+bool PathCache::PathKey::operator==(const PathKey& other) const {
+	return start == other.start && end == other.end && searchMode == other.searchMode && gridVersion == other.gridVersion;
+}
+
+/// <summary>
+/// Hashes a key.
+/// </summary>
+/// <param name="key">The key.</param>
+/// <returns>The hash of the key.</returns>
+std::size_t PathCache::PathKeyHash::operator()(const PathKey& key) const {
+	std::uint64_t hash = key.gridVersion;
+	for (int value : {key.start.x, key.start.y, key.end.x, key.end.y, static_cast<int>(key.searchMode)}) {
+		hash = (hash ^ static_cast<std::uint32_t>(value)) * 0x100000001b3ull;
+	}
+	return std::hash<std::uint64_t>()(hash);
+}
+
+/// <summary>
+/// Creates the key of a path request on the current grid version.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+/// <returns>The key.</returns>
+PathCache::PathKey PathCache::makeKey(const PathRequest& pathRequest) const {
+	return PathKey{pathRequest.start, pathRequest.end, pathRequest.searchMode, gridVersion};
+}
+
+/// <summary>
+/// Discards a cached path.
+/// </summary>
+/// <param name="cachedPathIt">The path.</param>
+/// <returns>The path after the discarded path.</returns>
+PathCache::CachedPathList::iterator PathCache::erasePath(CachedPathList::iterator cachedPathIt) {
+	referenceGridSquares(*cachedPathIt, -1);
+	memoryUsage -= cachedPathIt->byteCount;
+	pathLookup.erase(cachedPathIt->key);
+	return cachedPaths.erase(cachedPathIt);
+}
+
+/// <summary>
+/// Adds or removes a reference to the start and each grid square of a cached path.
+/// </summary>
+/// <param name="cachedPath">The path.</param>
+/// <param name="referenceChange">1 to add a reference, -1 to remove one.</param>
+void PathCache::referenceGridSquares(const CachedPath& cachedPath, int referenceChange) {
+	gridSquareReferences[flattenGridCoordinate(cachedPath.key.start, cacheGridSize.y)] += static_cast<unsigned int>(referenceChange);
+	for (const sf::Vector2i& gridSquare : cachedPath.path) {
+		gridSquareReferences[flattenGridCoordinate(gridSquare, cacheGridSize.y)] += static_cast<unsigned int>(referenceChange);
+	}
+}
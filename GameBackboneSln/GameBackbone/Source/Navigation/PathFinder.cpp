@@ -1,166 +1,2241 @@
 #include <GameBackbone/Navigation/PathFinder.h>
-#include <GameBackbone/Util/UtilMath.h>
+#include <GameBackbone/Navigation/LandmarkTable.h>
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
+#include <GameBackbone/Navigation/ReachabilityIndex.h>
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+#include <GameBackbone/Util/WorkerPool.h>
 
-#include <climits>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
 #include <deque>
-#include <map>
-#include <queue>
-#include <set>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 using namespace GB;
 
+namespace {
+
+	/// The number of grid squares expanded between checks of the clock when requests are advanced for a duration.
+	constexpr std::size_t EXPANSIONS_PER_CLOCK_CHECK = 64;
+
+	/// The cost of a straight step relative to the weights of its grid squares, outside of the four neighborhood.
+	/// Step lengths are scaled by this, so diagonal steps can cost 1.4 times as much as straight steps without fractions.
+	constexpr int STEP_LENGTH_SCALE = 10;
+
+	/// The length of a diagonal step, scaled by STEP_LENGTH_SCALE.
+	constexpr int DIAGONAL_STEP_LENGTH = 14;
+
+	/// The number of low bits of a priority that break ties between grid squares of equal estimated path cost.
+	/// Ties go to the grid square closer to the end point, which avoids expanding every equally good path.
+	constexpr int TIE_BREAK_BITS = 20;
+
+	/// The number of jump distances stored for each grid square, one for each offset of FOUR_NEIGHBOR_OFFSETS.
+	constexpr std::size_t FOUR_NEIGHBOR_COUNT = 4;
+
+	/// <summary>
+	/// Calculates the sign of a value.
+	/// </summary>
+	/// <param name="value">The value.</param>
+	/// <returns>1 if the value is positive, -1 if it is negative, and 0 otherwise.</returns>
+	int calcSign(int value) {
+		return (value > 0) - (value < 0);
+	}
+
+	/// <summary>
+	/// Determines if a weight belongs to an unblocked grid square outside of an area of equal weight.
+	/// </summary>
+	/// <param name="weight">The weight of the grid square.</param>
+	/// <param name="regionWeight">The weight of the area.</param>
+	/// <returns>True if the weight is unblocked and differs from the weight of the area.</returns>
+	bool isOtherUnblockedWeight(int weight, int regionWeight) {
+		return weight != regionWeight && weight < BLOCKED_GRID_WEIGHT;
+	}
+
+	/// <summary>
+	/// Finds the position of a horizontal or vertical unit step in FOUR_NEIGHBOR_OFFSETS.
+	/// </summary>
+	/// <param name="direction">The unit step.</param>
+	/// <returns>The index of the offset.</returns>
+	std::size_t getFourNeighborIndex(const sf::Vector2i& direction) {
+		if (direction.x != 0) {
+			return (direction.x > 0) ? 0 : 1;
+		}
+		return (direction.y > 0) ? 2 : 3;
+	}
+
+	/// <summary>
+	/// Reads the weight of a grid square of a NavigationGrid.
+	/// </summary>
+	/// <param name="navigationGrid">The navigation grid.</param>
+	/// <param name="x">The x coordinate of the grid square. Must be within the navigation grid.</param>
+	/// <param name="y">The y coordinate of the grid square. Must be within the navigation grid.</param>
+	/// <param name="unitRadius">Grid squares with a blocker distance of at most this are blocked. 0 ignores blocker distances.</param>
+	/// <returns>The weight of the grid square, or BLOCKED_GRID_WEIGHT if it has no room for the unit radius.</returns>
+	int readGridWeight(NavigationGrid& navigationGrid, unsigned int x, unsigned int y, unsigned int unitRadius) {
+		const NavigationGridData* gridData = navigationGrid.at(x, y);
+		if (unitRadius != 0 && gridData->blockerDist <= unitRadius) {
+			return BLOCKED_GRID_WEIGHT;
+		}
+		return gridData->weight;
+	}
+
+	/// <summary>
+	/// Reads the weight of a grid square of a DenseNavigationGrid.
+	/// </summary>
+	/// <returns>The weight of the grid square, or BLOCKED_GRID_WEIGHT if it has no room for the unit radius.</returns>
+	int readGridWeight(const DenseNavigationGrid& navigationGrid, unsigned int x, unsigned int y, unsigned int unitRadius) {
+		if (unitRadius != 0 && navigationGrid.getBlockerDist(x, y) <= unitRadius) {
+			return BLOCKED_GRID_WEIGHT;
+		}
+		return navigationGrid.getWeight(x, y);
+	}
+
+	/// <summary>
+	/// Reads the weight of a grid square of a CompactNavigationGrid. Compact grids store no blocker distances, so the unit radius is ignored.
+	/// </summary>
+	/// <returns>The quantized weight of the grid square, or BLOCKED_GRID_WEIGHT if it is not passable.</returns>
+	int readGridWeight(const CompactNavigationGrid& navigationGrid, unsigned int x, unsigned int y, unsigned int) {
+		return navigationGrid.getWeight(x, y);
+	}
+
+	/// <summary>
+	/// Reads the weight of a grid square of a ChunkedNavigationGrid without allocating its tile.
+	/// </summary>
+	/// <returns>The weight of the grid square, or BLOCKED_GRID_WEIGHT if it has no room for the unit radius.</returns>
+	int readGridWeight(const ChunkedNavigationGrid& navigationGrid, unsigned int x, unsigned int y, unsigned int unitRadius) {
+		const NavigationGridData& gridData = navigationGrid.at(x, y);
+		if (unitRadius != 0 && gridData.blockerDist <= unitRadius) {
+			return BLOCKED_GRID_WEIGHT;
+		}
+		return gridData.weight;
+	}
+
+	/// <summary>
+	/// Determines if a grid square can be entered.
+	/// </summary>
+	/// <returns>True if the weight of the grid square is not blocked.</returns>
+	template <typename GridType>
+	bool isGridSquarePassable(GridType& navigationGrid, unsigned int x, unsigned int y, unsigned int unitRadius) {
+		return readGridWeight(navigationGrid, x, y, unitRadius) < BLOCKED_GRID_WEIGHT;
+	}
+
+	/// <summary>
+	/// Determines if a grid square of a CompactNavigationGrid can be entered. Only the passability plane is read.
+	/// </summary>
+	/// <returns>True if the grid square is passable.</returns>
+	bool isGridSquarePassable(const CompactNavigationGrid& navigationGrid, unsigned int x, unsigned int y, unsigned int) {
+		return navigationGrid.isPassable(x, y);
+	}
+
+	/// <summary>
+	/// Reads the grid squares of one kind of navigation grid for a search.
+	/// The kind of grid is chosen once when a search is continued, so reading a grid square never checks which grid is set.
+	/// Grid squares without room for the unit radius weigh BLOCKED_GRID_WEIGHT.
+	/// </summary>
+	template <typename GridType>
+	class GridSquareReader {
+	public:
+		GridSquareReader(GridType& newNavigationGrid, unsigned int newUnitRadius) :
+			navigationGrid(newNavigationGrid),
+			gridSize(newNavigationGrid.getArraySizeX(), newNavigationGrid.getArraySizeY()),
+			unitRadius(newUnitRadius) {
+		}
+
+		/// <summary>
+		/// Gets the size of the grid.
+		/// </summary>
+		/// <returns>The number of grid squares along x and y.</returns>
+		const sf::Vector2u& getGridSize() const {
+			return gridSize;
+		}
+
+		/// <summary>
+		/// Determines if a coordinate is within the grid.
+		/// </summary>
+		/// <returns>True if the coordinate is a grid square.</returns>
+		bool isInGrid(const sf::Vector2i& gridCoordinate) const {
+			return GB::isInGrid(gridCoordinate, gridSize);
+		}
+
+		/// <summary>
+		/// Flattens a coordinate of the grid into an index for the per grid square search storage, like Pathfinder::flattenGridCoordinate.
+		/// </summary>
+		/// <returns>The flattened index of the coordinate.</returns>
+		unsigned int flattenGridCoordinate(const sf::Vector2i& gridCoordinate) const {
+			return GB::flattenGridCoordinate(gridCoordinate, gridSize.y);
+		}
+
+		/// <summary>
+		/// Converts a flattened index back into a coordinate of the grid.
+		/// </summary>
+		/// <returns>The coordinate of the grid square.</returns>
+		sf::Vector2i expandGridIndex(unsigned int gridIndex) const {
+			return GB::expandGridIndex(gridIndex, gridSize.y);
+		}
+
+		/// <summary>
+		/// Gets the weight of a grid square.
+		/// </summary>
+		/// <param name="gridCoordinate">The coordinate of the grid square. Must be within the grid.</param>
+		/// <returns>The weight of the grid square.</returns>
+		int getWeight(const sf::Vector2i& gridCoordinate) const {
+			return readGridWeight(navigationGrid, static_cast<unsigned int>(gridCoordinate.x), static_cast<unsigned int>(gridCoordinate.y), unitRadius);
+		}
+
+		/// <summary>
+		/// Gets the weight of a grid square. Coordinates outside of the grid are blocked.
+		/// </summary>
+		/// <param name="gridCoordinate">The coordinate. May be outside of the grid.</param>
+		/// <returns>The weight of the grid square.</returns>
+		int getWeightOrBlocked(const sf::Vector2i& gridCoordinate) const {
+			if (!isInGrid(gridCoordinate)) {
+				return BLOCKED_GRID_WEIGHT;
+			}
+			return getWeight(gridCoordinate);
+		}
+
+		/// <summary>
+		/// Determines if a grid square is blocked. Coordinates outside of the grid are blocked.
+		/// </summary>
+		/// <param name="gridCoordinate">The coordinate. May be outside of the grid.</param>
+		/// <returns>True if the grid square can not be entered.</returns>
+		bool isBlocked(const sf::Vector2i& gridCoordinate) const {
+			if (!isInGrid(gridCoordinate)) {
+				return true;
+			}
+			return !isGridSquarePassable(navigationGrid, static_cast<unsigned int>(gridCoordinate.x), static_cast<unsigned int>(gridCoordinate.y), unitRadius);
+		}
+
+		/// <summary>
+		/// Determines if a coordinate is a grid square of an area with the passed weight.
+		/// </summary>
+		/// <param name="gridCoordinate">The coordinate. May be outside of the grid.</param>
+		/// <param name="regionWeight">The weight of the area. Must not be blocked.</param>
+		/// <returns>True if the coordinate is within the grid and has the weight of the area.</returns>
+		bool isInRegion(const sf::Vector2i& gridCoordinate, int regionWeight) const {
+			return getWeightOrBlocked(gridCoordinate) == regionWeight;
+		}
+
+		/// <summary>
+		/// Finds the heaviest grid square that the line between two grid squares touches.
+		/// Lines are checked against the same clearance as steps.
+		/// </summary>
+		/// <param name="from">The grid square the line starts in. Its weight is ignored.</param>
+		/// <param name="to">The grid square the line ends in.</param>
+		/// <returns>The weight of the line, as returned by calcLineOfSightWeight.</returns>
+		int calcLineWeight(const sf::Vector2i& from, const sf::Vector2i& to) const {
+			const auto getLineWeight = [this](int x, int y) {
+				return readGridWeight(navigationGrid, static_cast<unsigned int>(x), static_cast<unsigned int>(y), unitRadius);
+			};
+			return walkLineOfSight(getLineWeight, from, to);
+		}
+
+	private:
+		GridType& navigationGrid;
+		sf::Vector2u gridSize;
+		unsigned int unitRadius;
+	};
+}
+
+/// <summary>
+/// Calls a function with a reader of the searched grid. Only checks which kind of grid is set once.
+/// </summary>
+/// <param name="visitor">Called with a GridSquareReader of the searched grid.</param>
+/// <returns>The result of the visitor.</returns>
+template <typename Visitor>
+auto Pathfinder::visitGridReader(Visitor&& visitor) const {
+	if (denseNavigationGrid != nullptr) {
+		return visitor(GridSquareReader<const DenseNavigationGrid>(*denseNavigationGrid, unitRadius));
+	}
+	if (compactNavigationGrid != nullptr) {
+		return visitor(GridSquareReader<const CompactNavigationGrid>(*compactNavigationGrid, unitRadius));
+	}
+	if (chunkedNavigationGrid != nullptr) {
+		return visitor(GridSquareReader<const ChunkedNavigationGrid>(*chunkedNavigationGrid, unitRadius));
+	}
+	return visitor(GridSquareReader<NavigationGrid>(*navigationGrid, unitRadius));
+}
+
+/// <summary>
+/// A contiguous range of a batch of path requests owned by one worker.
+/// Any worker may claim the next request of the range, which lets idle workers steal work.
+/// </summary>
+struct Pathfinder::PathRequestRange {
+	std::atomic<std::size_t> next{0};
+	std::size_t end = 0;
+};
+
 //ctr / dtr
 
 /// <summary> Creates a PathFinder with a null navigation grid. </summary>
 Pathfinder::Pathfinder() : Pathfinder(nullptr) {}
 
-/// <summary> Creates a PathFinder with an assigned navigation grid. </summary>
-/// <param name = "navigationGrid"> Three dimensional grid to be used when path-finding. </param>
-Pathfinder::Pathfinder(NavigationGrid* newNavigationGrid) {
-	this->navigationGrid = newNavigationGrid;
+/// <summary> Creates a PathFinder with a null navigation grid. </summary>
+Pathfinder::Pathfinder(std::nullptr_t) : Pathfinder(static_cast<NavigationGrid*>(nullptr)) {}
+
+/// <summary> Creates a PathFinder with an assigned navigation grid. </summary>
+/// <param name = "navigationGrid"> Three dimensional grid to be used when path-finding. </param>
+Pathfinder::Pathfinder(NavigationGrid* newNavigationGrid) :
+	searchMode(PATH_SEARCH_MODE_STANDARD),
+	bidirectionalSearchDistance(0),
+	reachabilityIndex(nullptr),
+	unitRadius(0),
+	neighborhood(PATH_NEIGHBORHOOD_FOUR),
+	cornerCutting(PATH_CORNER_CUTTING_ALLOWED),
+	neighborOffsets(std::begin(FOUR_NEIGHBOR_OFFSETS), std::end(FOUR_NEIGHBOR_OFFSETS)),
+	customHeuristicScale(STEP_LENGTH_SCALE),
+	heuristic(PATH_HEURISTIC_AUTOMATIC),
+	heuristicWeight(1.0),
+	landmarkTable(nullptr),
+	minGridWeight(0),
+	isMinGridWeightStale(true),
+	isJumpDistancesStale(true),
+	workspaceAllocationCount(0),
+	lastPathRequestHandle(0),
+	isTimeSlicedSearchStarted(false) {
+	this->navigationGrid = newNavigationGrid;
+	this->denseNavigationGrid = nullptr;
+	this->compactNavigationGrid = nullptr;
+	this->chunkedNavigationGrid = nullptr;
+	updateNeighborSteps();
+}
+
+/// <summary> Creates a PathFinder that searches a DenseNavigationGrid. </summary>
+/// <param name = "navigationGrid"> The grid to be used when path-finding. </param>
+Pathfinder::Pathfinder(DenseNavigationGrid* newNavigationGrid) : Pathfinder(nullptr) {
+	setNavigationGrid(newNavigationGrid);
+}
+
+/// <summary> Creates a PathFinder that searches a CompactNavigationGrid. </summary>
+/// <param name = "navigationGrid"> The grid to be used when path-finding. </param>
+Pathfinder::Pathfinder(CompactNavigationGrid* newNavigationGrid) : Pathfinder(nullptr) {
+	setNavigationGrid(newNavigationGrid);
+}
+
+/// <summary> Creates a PathFinder that searches a ChunkedNavigationGrid. </summary>
+/// <param name = "navigationGrid"> The grid to be used when path-finding. </param>
+Pathfinder::Pathfinder(const ChunkedNavigationGrid* newNavigationGrid) : Pathfinder(nullptr) {
+	setNavigationGrid(newNavigationGrid);
+}
+
+/// <summary> Destroys the PathFinder and stops its worker threads. </summary>
+Pathfinder::~Pathfinder() = default;
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid.
+/// A time sliced search that is in progress is restarted on the new grid, and cached paths are no longer used.
+/// The grid may be edited in place afterwards, but every changed grid square must be reported with updateGridSquares
+/// before the next search. Lowering a weight without reporting it is misuse, since heuristics may then overestimate.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid.</param>
+void Pathfinder::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	this->navigationGrid = newNavigationGrid;
+	this->denseNavigationGrid = nullptr;
+	this->compactNavigationGrid = nullptr;
+	this->chunkedNavigationGrid = nullptr;
+	isTimeSlicedSearchStarted = false;
+	pathCache.invalidate();
+	isMinGridWeightStale = true;
+	isJumpDistancesStale = true;
+}
+
+/// <summary>
+/// Sets a DenseNavigationGrid to search instead of a NavigationGrid.
+/// A time sliced search that is in progress is restarted on the new grid, and cached paths are no longer used.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid.</param>
+void Pathfinder::setNavigationGrid(DenseNavigationGrid* newNavigationGrid) {
+	setNavigationGrid(static_cast<NavigationGrid*>(nullptr));
+	this->denseNavigationGrid = newNavigationGrid;
+	isMinGridWeightStale = true;
+}
+
+/// <summary>
+/// Sets a CompactNavigationGrid to search instead of a NavigationGrid.
+/// A time sliced search that is in progress is restarted on the new grid, and cached paths are no longer used.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid.</param>
+void Pathfinder::setNavigationGrid(CompactNavigationGrid* newNavigationGrid) {
+	setNavigationGrid(static_cast<NavigationGrid*>(nullptr));
+	this->compactNavigationGrid = newNavigationGrid;
+	isMinGridWeightStale = true;
+}
+
+/// <summary>
+/// Sets a ChunkedNavigationGrid to search instead of a NavigationGrid.
+/// Grid squares of tiles that are not allocated are searched with the default value of the grid.
+/// A time sliced search that is in progress is restarted on the new grid, and cached paths are no longer used.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid.</param>
+void Pathfinder::setNavigationGrid(const ChunkedNavigationGrid* newNavigationGrid) {
+	setNavigationGrid(static_cast<NavigationGrid*>(nullptr));
+	this->chunkedNavigationGrid = newNavigationGrid;
+	isMinGridWeightStale = true;
+}
+
+/// <summary>
+/// Removes the navigation grid.
+/// </summary>
+void Pathfinder::setNavigationGrid(std::nullptr_t) {
+	setNavigationGrid(static_cast<NavigationGrid*>(nullptr));
+}
+
+/// <summary>
+/// Sets the number of threads used to solve a batch of path requests.
+/// The thread calling pathFind is one of the workers. Any value below 2 solves every request on the calling thread.
+/// </summary>
+/// <param name="workerThreadCount">The number of worker threads.</param>
+void Pathfinder::setWorkerThreadCount(unsigned int workerThreadCount) {
+	workerThreadCount = std::max(workerThreadCount, 1u);
+	if (workerThreadCount == getWorkerThreadCount()) {
+		return;
+	}
+	workerPool.reset();
+	requestRanges.reset();
+	if (workerThreadCount > 1) {
+		workerPool = std::make_unique<WorkerPool>(workerThreadCount);
+		requestRanges = std::make_unique<PathRequestRange[]>(workerThreadCount);
+	}
+}
+
+/// <summary>
+/// Sets the search used for path requests that do not choose their own search mode.
+/// A time sliced search that is in progress is restarted with the new search mode.
+/// </summary>
+/// <param name="newSearchMode">The search mode. PATH_SEARCH_MODE_DEFAULT selects the standard search.</param>
+void Pathfinder::setSearchMode(PATH_SEARCH_MODE_TYPE newSearchMode) {
+	searchMode = (newSearchMode == PATH_SEARCH_MODE_DEFAULT) ? PATH_SEARCH_MODE_STANDARD : newSearchMode;
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Sets the index used to reject path requests without a path before searching.
+/// Without an index, a request whose end can not be reached searches every grid square reachable from its start.
+/// The index must be kept up to date with the navigation grid by its owner.
+/// </summary>
+/// <param name="newReachabilityIndex">The reachability index of the navigation grid. May be null.</param>
+void Pathfinder::setReachabilityIndex(const ReachabilityIndex* newReachabilityIndex) {
+	reachabilityIndex = newReachabilityIndex;
+}
+
+/// <summary>
+/// Sets the most memory used to cache found paths, so repeated requests are answered without searching.
+/// Changes to the navigation grid must be reported with updateGridSquares or invalidatePathCache while the cache is enabled.
+/// </summary>
+/// <param name="maxBytes">The memory limit in bytes. Zero disables the cache, which is the default.</param>
+void Pathfinder::setPathCacheMemoryLimit(std::size_t maxBytes) {
+	pathCache.setMemoryLimit(maxBytes);
+}
+
+/// <summary>
+/// Sets the grid squares a path may step to from each grid square.
+/// Outside of the four neighborhood, steps cost their length times the average weight of their grid squares,
+/// and PATH_HEURISTIC_AUTOMATIC switches to a heuristic that never overestimates them.
+/// The four neighborhood keeps its own faster search, and the jump point search mode only applies to it.
+/// Selecting PATH_NEIGHBORHOOD_CUSTOM keeps the current offsets.
+/// </summary>
+/// <param name="newNeighborhood">The neighborhood.</param>
+void Pathfinder::setNeighborhood(PATH_NEIGHBORHOOD_TYPE newNeighborhood) {
+	if (newNeighborhood == PATH_NEIGHBORHOOD_FOUR) {
+		neighborOffsets.assign(std::begin(FOUR_NEIGHBOR_OFFSETS), std::end(FOUR_NEIGHBOR_OFFSETS));
+	}
+	else if (newNeighborhood == PATH_NEIGHBORHOOD_EIGHT) {
+		neighborOffsets.assign(std::begin(EIGHT_NEIGHBOR_OFFSETS), std::end(EIGHT_NEIGHBOR_OFFSETS));
+	}
+	neighborhood = newNeighborhood;
+	updateNeighborSteps();
+}
+
+/// <summary>
+/// Lets paths step by the passed offsets, for example to add knight moves to the eight neighborhood.
+/// </summary>
+/// <param name="newNeighborOffsets">The offsets from a grid square to its neighbors. Zero and repeated offsets are ignored.</param>
+void Pathfinder::setCustomNeighborhood(const std::vector<sf::Vector2i>& newNeighborOffsets) {
+	neighborOffsets.clear();
+	for (const sf::Vector2i& offset : newNeighborOffsets) {
+		if (offset != sf::Vector2i(0, 0) && std::find(neighborOffsets.begin(), neighborOffsets.end(), offset) == neighborOffsets.end()) {
+			neighborOffsets.push_back(offset);
+		}
+	}
+	neighborhood = PATH_NEIGHBORHOOD_CUSTOM;
+	updateNeighborSteps();
+}
+
+/// <summary>
+/// Sets when a diagonal step may pass the corner of a blocked grid square. Has no effect on the four neighborhood.
+/// A step passes the two grid squares that share a side with both the grid square it starts on and the one it ends on.
+/// </summary>
+/// <param name="newCornerCutting">The corner cutting rule.</param>
+void Pathfinder::setCornerCutting(PATH_CORNER_CUTTING_TYPE newCornerCutting) {
+	cornerCutting = newCornerCutting;
+	updateNeighborSteps();
+}
+
+/// <summary>
+/// Sets how searches estimate the remaining cost to the end point.
+/// A heuristic that never overestimates finds the cheapest path, as long as unblocked weights are at least 1.
+/// Closer estimates expand fewer grid squares.
+/// </summary>
+/// <param name="newHeuristic">The heuristic.</param>
+void Pathfinder::setHeuristic(PATH_HEURISTIC_TYPE newHeuristic) {
+	heuristic = newHeuristic;
+
+	// cached paths and running searches used the previous heuristic
+	pathCache.invalidate();
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Sets how much the heuristic counts compared to the cost already travelled.
+/// A weight above 1 expands fewer grid squares but may find more expensive paths.
+/// With a heuristic that never overestimates, a found path never costs more than the weight times the cheapest path.
+/// </summary>
+/// <param name="newHeuristicWeight">The weight of the heuristic. Negative weights are treated as 0. The default is 1.</param>
+void Pathfinder::setHeuristicWeight(double newHeuristicWeight) {
+	heuristicWeight = std::max(newHeuristicWeight, 0.0);
+
+	// cached paths and running searches used the previous weight
+	pathCache.invalidate();
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Sets the landmark table that bounds path costs in the four neighborhood.
+/// PATH_HEURISTIC_AUTOMATIC uses it whenever it was built for a grid of the same size as the navigation grid.
+/// The table must not be modified while paths are found, and must be rebuilt after weights of the navigation grid are lowered.
+/// </summary>
+/// <param name="newLandmarkTable">The landmark table. May be null.</param>
+void Pathfinder::setLandmarkTable(const LandmarkTable* newLandmarkTable) {
+	landmarkTable = newLandmarkTable;
+
+	// a running search can not change its heuristic
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Lets path requests that use the standard search of the Pathfinder search from both ends once their
+/// start and end are far apart. A single search spreads in every direction from the start,
+/// while two searches meet in the middle having covered a smaller area.
+/// Requests that choose their own search mode are not switched.
+/// </summary>
+/// <param name="minDistance">The manhattan distance from which requests are searched from both ends. Zero never switches, which is the default.</param>
+void Pathfinder::setBidirectionalSearchDistance(unsigned int minDistance) {
+	bidirectionalSearchDistance = minDistance;
+
+	// a running search can not change its search mode
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Sets the radius of the units paths are found for, so paths keep that much clearance from blocked grid squares.
+/// A unit centered on a grid square covers the square of 2 * radius + 1 grid squares around it, so it only fits on grid squares
+/// whose blocker distance is above the radius. Every other grid square is searched as if it were blocked, at no extra cost per grid square.
+/// The blocker distances must be kept up to date with calcBlockerDistances and updateBlockerDistances.
+/// A CompactNavigationGrid stores no blocker distances, so the radius is ignored when one is searched.
+/// A start grid square without enough clearance is left like a blocked start grid square.
+/// </summary>
+/// <param name="newUnitRadius">The radius in grid squares. Zero ignores blocker distances, which is the default.</param>
+void Pathfinder::setUnitRadius(unsigned int newUnitRadius) {
+	unitRadius = newUnitRadius;
+
+	// cached paths and running searches used the previous radius
+	pathCache.invalidate();
+	isTimeSlicedSearchStarted = false;
+	isMinGridWeightStale = true;
+	isJumpDistancesStale = true;
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer. Null if another kind of grid is searched.</returns>
+NavigationGrid* Pathfinder::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the DenseNavigationGrid.
+/// </summary>
+/// <returns>DenseNavigationGrid pointer. Null if another kind of grid is searched.</returns>
+DenseNavigationGrid* Pathfinder::getDenseNavigationGrid() {
+	return denseNavigationGrid;
+}
+
+/// <summary>
+/// Gets the CompactNavigationGrid.
+/// </summary>
+/// <returns>CompactNavigationGrid pointer. Null if another kind of grid is searched.</returns>
+CompactNavigationGrid* Pathfinder::getCompactNavigationGrid() {
+	return compactNavigationGrid;
+}
+
+/// <summary>
+/// Gets the ChunkedNavigationGrid.
+/// </summary>
+/// <returns>ChunkedNavigationGrid pointer. Null if another kind of grid is searched.</returns>
+const ChunkedNavigationGrid* Pathfinder::getChunkedNavigationGrid() const {
+	return chunkedNavigationGrid;
+}
+
+/// <summary>
+/// Gets the number of threads used to solve a batch of path requests.
+/// </summary>
+/// <returns>The number of worker threads, including the thread calling pathFind.</returns>
+unsigned int Pathfinder::getWorkerThreadCount() const {
+	return (workerPool == nullptr) ? 1 : workerPool->getWorkerCount();
+}
+
+/// <summary>
+/// Gets the number of times the Pathfinder allocated search storage.
+/// The storage is sized to the navigation grid and reused across requests and calls to pathFind,
+/// so this only grows when the grid size or the number of worker threads grows.
+/// </summary>
+/// <returns>The number of search storage allocations.</returns>
+std::size_t Pathfinder::getWorkspaceAllocationCount() const {
+	return workspaceAllocationCount;
+}
+
+/// <summary>
+/// Gets the search used for path requests that do not choose their own search mode.
+/// </summary>
+/// <returns></returns>
+PATH_SEARCH_MODE_TYPE Pathfinder::getSearchMode() const {
+	return searchMode;
+}
+
+/// <summary>
+/// Gets the index used to reject path requests without a path before searching.
+/// </summary>
+/// <returns>ReachabilityIndex pointer. Null if no index is used.</returns>
+const ReachabilityIndex* Pathfinder::getReachabilityIndex() const {
+	return reachabilityIndex;
+}
+
+/// <summary>
+/// Gets the number of grid squares that were expanded during the most recent call to pathFind.
+/// Useful to compare the amount of work done by different search modes.
+/// </summary>
+/// <returns>The number of expanded grid squares across all requests of the last batch.</returns>
+std::size_t Pathfinder::getExpandedNodeCount() const {
+	std::size_t expandedNodeCount = 0;
+	for (const PathSearchWorkspace& workspace : workspaces) {
+		expandedNodeCount += workspace.getExpandedNodeCount();
+	}
+	return expandedNodeCount;
+}
+
+/// <summary>
+/// Gets the number of lines of sight that any angle searches checked during the most recent call to pathFind.
+/// </summary>
+/// <returns>The number of checked lines of sight across all requests of the last batch.</returns>
+std::size_t Pathfinder::getLineOfSightCheckCount() const {
+	std::size_t lineOfSightCheckCount = 0;
+	for (const PathSearchWorkspace& workspace : workspaces) {
+		lineOfSightCheckCount += workspace.getLineOfSightCheckCount();
+	}
+	return lineOfSightCheckCount;
+}
+
+/// <summary>
+/// Gets the progress of a path request made with requestPath.
+/// </summary>
+/// <param name="pathRequestHandle">The handle returned by requestPath.</param>
+/// <returns>The status of the request. PATH_REQUEST_STATUS_INVALID if the request was canceled or its path was taken.</returns>
+PATH_REQUEST_STATUS_TYPE Pathfinder::getPathRequestStatus(PathRequestHandle pathRequestHandle) const {
+	const auto requestIt = timeSlicedPathRequests.find(pathRequestHandle);
+	if (requestIt == timeSlicedPathRequests.end()) {
+		return PATH_REQUEST_STATUS_INVALID;
+	}
+	return requestIt->second.isComplete ? PATH_REQUEST_STATUS_COMPLETE : PATH_REQUEST_STATUS_PENDING;
+}
+
+/// <summary>
+/// Gets the number of path requests made with requestPath whose search is not finished.
+/// </summary>
+/// <returns></returns>
+std::size_t Pathfinder::getPendingPathRequestCount() const {
+	return queuedPathRequests.size();
+}
+
+/// <summary>
+/// Gets the cache of found paths. Its hit and miss counters help choose its memory limit.
+/// </summary>
+/// <returns></returns>
+const PathCache& Pathfinder::getPathCache() const {
+	return pathCache;
+}
+
+/// <summary>
+/// Gets the grid squares a path may step to from each grid square.
+/// </summary>
+/// <returns></returns>
+PATH_NEIGHBORHOOD_TYPE Pathfinder::getNeighborhood() const {
+	return neighborhood;
+}
+
+/// <summary>
+/// Gets the offsets from a grid square to its neighbors.
+/// </summary>
+/// <returns></returns>
+const std::vector<sf::Vector2i>& Pathfinder::getNeighborOffsets() const {
+	return neighborOffsets;
+}
+
+/// <summary>
+/// Gets when a diagonal step may pass the corner of a blocked grid square.
+/// </summary>
+/// <returns></returns>
+PATH_CORNER_CUTTING_TYPE Pathfinder::getCornerCutting() const {
+	return cornerCutting;
+}
+
+/// <summary>
+/// Gets how searches estimate the remaining cost to the end point.
+/// </summary>
+/// <returns>The heuristic.</returns>
+PATH_HEURISTIC_TYPE Pathfinder::getHeuristic() const {
+	return heuristic;
+}
+
+/// <summary>
+/// Gets how much the heuristic counts compared to the cost already travelled.
+/// </summary>
+/// <returns>The weight of the heuristic.</returns>
+double Pathfinder::getHeuristicWeight() const {
+	return heuristicWeight;
+}
+
+/// <summary>
+/// Gets the landmark table.
+/// </summary>
+/// <returns>The landmark table, or null if none is set.</returns>
+const LandmarkTable* Pathfinder::getLandmarkTable() const {
+	return landmarkTable;
+}
+
+/// <summary>
+/// Gets the manhattan distance from which requests using the standard search are searched from both ends.
+/// </summary>
+/// <returns>The distance. Zero if requests are never switched.</returns>
+unsigned int Pathfinder::getBidirectionalSearchDistance() const {
+	return bidirectionalSearchDistance;
+}
+
+/// <summary>
+/// Gets the radius of the units paths are found for.
+/// </summary>
+/// <returns>The radius in grid squares. Zero if blocker distances are ignored.</returns>
+unsigned int Pathfinder::getUnitRadius() const {
+	return unitRadius;
+}
+
+/// <summary>
+/// Creates an unblocked path of adjacent grid squares to for each path request.
+/// When more than one worker thread is set, the requests are solved in parallel. Each worker starts on its own
+/// contiguous share of the batch and steals requests from the other shares once its own share is finished.
+/// The navigation grid is only read, so it must not be modified while pathFind runs.
+/// Grid squares modified since the last search must have been reported with updateGridSquares.
+/// pathFind must not be called by more than one thread at a time on the same Pathfinder.
+/// </summary>
+/// <param name="pathRequests">vector containing the requirements for each path.</param>
+/// <param name="returnedPaths">vector containing the found path for each PathRequest. The path is found at the same index as its corresponding request.</param>
+void Pathfinder::pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) const {
+
+	//ensure that returned paths is big enough to store all results
+	returnedPaths->resize(pathRequests.size());
+	const unsigned int workerCount = prepareBatch(pathRequests);
+	if (workerCount == 0) {
+		return;
+	}
+
+	// answer repeated requests from the cache
+	cachedRequestMarks.clear();
+	if (isPathCacheEnabled()) {
+		cachedRequestMarks.resize(pathRequests.size());
+		for (std::size_t i = 0; i < pathRequests.size(); i++) {
+			cachedRequestMarks[i] = findCachedPath(pathRequests[i], (*returnedPaths)[i]);
+		}
+	}
+
+	searchBatch(PathBatch{&pathRequests, returnedPaths, workerCount});
+
+	// remember the newly found paths
+	if (isPathCacheEnabled()) {
+		for (std::size_t i = 0; i < pathRequests.size(); i++) {
+			if (!isCachedRequest(i) && isPathCacheable(pathRequests[i])) {
+				pathCache.insert(resolveSearchMode(pathRequests[i]), (*returnedPaths)[i]);
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Creates a path for each path request like pathFind, and stores every path in one contiguous buffer.
+/// Each worker encodes the paths it finds into its own batch as they are reconstructed. The batches are joined in
+/// request order afterwards by copying the encoded paths.
+/// </summary>
+/// <param name="pathRequests">vector containing the requirements for each path.</param>
+/// <param name="returnedPaths">Replaced by the found path for each PathRequest, in the encoding of the batch. The path is found at the same index as its corresponding request.</param>
+void Pathfinder::pathFind(const std::vector<PathRequest>& pathRequests, PackedPathBatch* const returnedPaths) const {
+	returnedPaths->clear();
+	const unsigned int workerCount = prepareBatch(pathRequests);
+	if (workerCount == 0) {
+		return;
+	}
+
+	if (workerPackedPaths.size() < workerCount) {
+		workerPackedPaths.resize(workerCount);
+	}
+	for (unsigned int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		workerPackedPaths[workerIndex].setEncoding(returnedPaths->getEncoding());
+	}
+	packedPathLocations.resize(pathRequests.size());
+
+	// answer repeated requests from the cache. Cached paths are stored with the paths of the first worker.
+	cachedRequestMarks.clear();
+	if (isPathCacheEnabled()) {
+		cachedRequestMarks.resize(pathRequests.size());
+		for (std::size_t i = 0; i < pathRequests.size(); i++) {
+			cachedRequestMarks[i] = findCachedPath(pathRequests[i], cachedPath);
+			if (cachedRequestMarks[i]) {
+				packedPathLocations[i] = PackedPathLocation{0, workerPackedPaths[0].getPathCount()};
+				workerPackedPaths[0].appendPath(cachedPath);
+			}
+		}
+	}
+
+	const bool hasCachedPaths = (workerPackedPaths[0].getPathCount() != 0);
+
+	searchBatch(PathBatch{&pathRequests, nullptr, workerCount});
+
+	// a single worker found every path in request order, so its batch is already complete
+	if (workerCount == 1 && !hasCachedPaths) {
+		std::swap(*returnedPaths, workerPackedPaths[0]);
+	}
+	else {
+		for (const PackedPathLocation& packedPathLocation : packedPathLocations) {
+			returnedPaths->appendPath(workerPackedPaths[packedPathLocation.workerIndex], packedPathLocation.pathIndex);
+		}
+	}
+
+	// remember the newly found paths
+	if (isPathCacheEnabled()) {
+		for (std::size_t i = 0; i < pathRequests.size(); i++) {
+			if (!isCachedRequest(i) && isPathCacheable(pathRequests[i])) {
+				returnedPaths->getPath(i, cachedPath);
+				pathCache.insert(resolveSearchMode(pathRequests[i]), cachedPath);
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Queues a path request to be solved over several calls to advancePathRequests or advancePathRequestsFor,
+/// so a long search can be spread across frames instead of stalling one.
+/// Requests are searched one at a time in the order they were made.
+/// The navigation grid must not be modified while requests are pending. Cancel and request them again after modifying it.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <returns>A handle used to check the progress of the request and to take its path.</returns>
+PathRequestHandle Pathfinder::requestPath(const PathRequest& pathRequest) {
+	const PathRequestHandle pathRequestHandle = ++lastPathRequestHandle;
+	timeSlicedPathRequests.emplace(pathRequestHandle, TimeSlicedPathRequest{pathRequest, {}, false});
+	queuedPathRequests.push_back(pathRequestHandle);
+	return pathRequestHandle;
+}
+
+/// <summary>
+/// Stops the search of a path request made with requestPath, or discards its path if the search is finished.
+/// The handle is invalid afterwards.
+/// </summary>
+/// <param name="pathRequestHandle">The handle returned by requestPath.</param>
+void Pathfinder::cancelPathRequest(PathRequestHandle pathRequestHandle) {
+	if (timeSlicedPathRequests.erase(pathRequestHandle) == 0) {
+		return;
+	}
+	const auto queuedIt = std::find(queuedPathRequests.begin(), queuedPathRequests.end(), pathRequestHandle);
+	if (queuedIt == queuedPathRequests.end()) {
+		return; // the search was already finished
+	}
+	if (queuedIt == queuedPathRequests.begin()) {
+		isTimeSlicedSearchStarted = false;
+	}
+	queuedPathRequests.erase(queuedIt);
+}
+
+/// <summary>
+/// Advances the searches of pending path requests made with requestPath.
+/// Stops once the passed number of grid squares were expanded or no request is pending.
+/// </summary>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>The number of grid squares that were expanded.</returns>
+std::size_t Pathfinder::advancePathRequests(std::size_t maxExpandedNodes) {
+	std::size_t expandedNodeCount = 0;
+	while (expandedNodeCount < maxExpandedNodes && !queuedPathRequests.empty()) {
+		expandedNodeCount += advanceQueuedPathRequest(maxExpandedNodes - expandedNodeCount);
+	}
+	return expandedNodeCount;
+}
+
+/// <summary>
+/// Advances the searches of pending path requests made with requestPath.
+/// Stops once the passed time ran out or no request is pending. The clock is only checked every few expansions,
+/// so the time can be exceeded by the duration of a few expansions. At least one step is taken if a request is pending.
+/// </summary>
+/// <param name="maxMicroseconds">The most time to spend searching in microseconds.</param>
+/// <returns>The number of grid squares that were expanded.</returns>
+std::size_t Pathfinder::advancePathRequestsFor(sf::Int64 maxMicroseconds) {
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(maxMicroseconds);
+	std::size_t expandedNodeCount = 0;
+	while (!queuedPathRequests.empty()) {
+		expandedNodeCount += advanceQueuedPathRequest(EXPANSIONS_PER_CLOCK_CHECK);
+		if (std::chrono::steady_clock::now() >= deadline) {
+			break;
+		}
+	}
+	return expandedNodeCount;
+}
+
+/// <summary>
+/// Takes the path of a path request made with requestPath once its search is finished.
+/// The handle is invalid afterwards.
+/// </summary>
+/// <param name="pathRequestHandle">The handle returned by requestPath.</param>
+/// <param name="returnedPath">The found path. Empty if no path exists.</param>
+/// <returns>True if the path was taken. False if the request is still pending or the handle is invalid.</returns>
+bool Pathfinder::takePath(PathRequestHandle pathRequestHandle, std::deque<sf::Vector2i>& returnedPath) {
+	const auto requestIt = timeSlicedPathRequests.find(pathRequestHandle);
+	if (requestIt == timeSlicedPathRequests.end() || !requestIt->second.isComplete) {
+		return false;
+	}
+	returnedPath = std::move(requestIt->second.path);
+	timeSlicedPathRequests.erase(requestIt);
+	return true;
+}
+
+/// <summary>
+/// Reports grid squares whose weight changed. Cached paths that start at or pass through them are discarded.
+/// Paths elsewhere stay cached, even if a cheaper path now exists through a grid square whose weight was lowered.
+/// Call invalidatePathCache instead when that matters, or when large parts of the grid changed.
+/// Weights lowered below every other weight of the grid must be reported here, or heuristics may overestimate.
+/// Changed weights must be reported before the next jump point search, which finds its jump distances again.
+/// </summary>
+/// <param name="changedGridSquares">The grid squares whose weight changed.</param>
+void Pathfinder::updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares) {
+	// a grid square can move the jump points of whole rows and columns, so the jump distances are found again
+	if (!changedGridSquares.empty()) {
+		isJumpDistancesStale = true;
+	}
+
+	// heuristics must stay below the cost of any path, so they follow lowered weights
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		if (!isMinGridWeightStale && isInGrid(gridSquare)) {
+			minGridWeight = std::min(minGridWeight, std::max(getGridWeight(gridSquare), 0));
+		}
+	}
+
+	// A grid square decides whether the diagonal steps past it are allowed, and whether units fit on the grid squares around it,
+	// so paths that far from it are affected as well.
+	int reach = (compactNavigationGrid != nullptr) ? 0 : static_cast<int>(unitRadius);
+	if (neighborhood != PATH_NEIGHBORHOOD_FOUR && cornerCutting != PATH_CORNER_CUTTING_ALLOWED) {
+		++reach;
+	}
+	if (reach == 0) {
+		pathCache.updateGridSquares(changedGridSquares);
+		return;
+	}
+
+	std::vector<sf::Vector2i> affectedGridSquares;
+	const std::size_t sideLength = static_cast<std::size_t>(2 * reach + 1);
+	affectedGridSquares.reserve(changedGridSquares.size() * sideLength * sideLength);
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		for (int x = -reach; x <= reach; ++x) {
+			for (int y = -reach; y <= reach; ++y) {
+				affectedGridSquares.push_back(gridSquare + sf::Vector2i(x, y));
+			}
+		}
+	}
+	pathCache.updateGridSquares(affectedGridSquares);
+}
+
+/// <summary>
+/// Advances the version of the navigation grid, so no path that was cached before is used again.
+/// </summary>
+void Pathfinder::invalidatePathCache() {
+	pathCache.invalidate();
+}
+
+/// <summary>
+/// Advances the search of the path request at the front of the queue, starting it if needed.
+/// The request is completed and removed from the queue once its search is finished.
+/// </summary>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>The number of grid squares that were expanded.</returns>
+std::size_t Pathfinder::advanceQueuedPathRequest(std::size_t maxExpandedNodes) {
+	TimeSlicedPathRequest& timeSlicedRequest = timeSlicedPathRequests.at(queuedPathRequests.front());
+	const std::size_t previousExpandedNodeCount = timeSlicedWorkspace.getExpandedNodeCount();
+
+	bool isFinished = true;
+	bool isSearched = true;
+	if (!hasNavigationGrid()) {
+		timeSlicedRequest.path.clear();
+		isSearched = false;
+	}
+	else if (!isTimeSlicedSearchStarted && isPathCacheEnabled() && findCachedPath(timeSlicedRequest.pathRequest, timeSlicedRequest.path)) {
+		isSearched = false;
+	}
+	else if (!isTimeSlicedSearchStarted) {
+		const std::size_t gridSize = static_cast<std::size_t>(getGridSizeX()) * getGridSizeY();
+		if (timeSlicedWorkspace.fitToGridSize(gridSize)) {
+			++workspaceAllocationCount;
+		}
+		updateMinGridWeight();
+		if (isJumpPointSearch(timeSlicedRequest.pathRequest)) {
+			updateJumpDistances();
+		}
+		isTimeSlicedSearchStarted = true;
+		isFinished = !beginSearch(timeSlicedRequest.pathRequest, timeSlicedWorkspace) ||
+			continueSearch(timeSlicedRequest.pathRequest, timeSlicedWorkspace, maxExpandedNodes);
+	}
+	else {
+		isFinished = continueSearch(timeSlicedRequest.pathRequest, timeSlicedWorkspace, maxExpandedNodes);
+	}
+
+	if (isFinished) {
+		if (isSearched) {
+			const std::vector<sf::Vector2i>& reversedPath = timeSlicedWorkspace.getPathBuffer();
+			timeSlicedRequest.path.assign(reversedPath.rbegin(), reversedPath.rend());
+		}
+		if (isSearched && isPathCacheEnabled() && isPathCacheable(timeSlicedRequest.pathRequest)) {
+			pathCache.insert(resolveSearchMode(timeSlicedRequest.pathRequest), timeSlicedRequest.path);
+		}
+		timeSlicedRequest.isComplete = true;
+		queuedPathRequests.pop_front();
+		isTimeSlicedSearchStarted = false;
+	}
+	return timeSlicedWorkspace.getExpandedNodeCount() - previousExpandedNodeCount;
+}
+
+/// <summary>
+/// Determines if the path cache is used.
+/// </summary>
+/// <returns>True if the path cache has memory.</returns>
+bool Pathfinder::isPathCacheEnabled() const {
+	return pathCache.getMemoryLimit() > 0;
+}
+
+/// <summary>
+/// Looks up the path of a path request in the path cache.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+/// <param name="returnedPath">The cached path. Unchanged if no path is cached.</param>
+/// <returns>True if a path was cached for the request.</returns>
+bool Pathfinder::findCachedPath(const PathRequest& pathRequest, std::deque<sf::Vector2i>& returnedPath) const {
+	if (!isPathCacheable(pathRequest)) {
+		return false;
+	}
+	pathCache.fitToGridSize(sf::Vector2u(getGridSizeX(), getGridSizeY()));
+	return pathCache.find(resolveSearchMode(pathRequest), returnedPath);
+}
+
+/// <summary>
+/// Determines if a request of the current batch was answered by the path cache.
+/// </summary>
+/// <param name="requestIndex">The index of the request in the batch.</param>
+/// <returns>True if the path of the request was found in the cache.</returns>
+bool Pathfinder::isCachedRequest(std::size_t requestIndex) const {
+	return !cachedRequestMarks.empty() && cachedRequestMarks[requestIndex];
+}
+
+/// <summary>
+/// Determines if the path of a request may be stored in the path cache.
+/// Any angle paths skip the grid squares between their turns, so the cache could not tell when a change to one of them invalidates the path.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+/// <returns>True if the path can be cached.</returns>
+bool Pathfinder::isPathCacheable(const PathRequest& pathRequest) const {
+	return resolveSearchMode(pathRequest).searchMode != PATH_SEARCH_MODE_ANY_ANGLE;
+}
+
+/// <summary>
+/// Replaces PATH_SEARCH_MODE_DEFAULT in a path request with the search mode of the Pathfinder.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+/// <returns>The path request with the search mode that solves it.</returns>
+PathRequest Pathfinder::resolveSearchMode(const PathRequest& pathRequest) const {
+	PathRequest resolvedRequest = pathRequest;
+	if (resolvedRequest.searchMode == PATH_SEARCH_MODE_DEFAULT) {
+		resolvedRequest.searchMode = searchMode;
+
+		// long requests search from both ends
+		const unsigned int distance = static_cast<unsigned int>(std::abs(pathRequest.end.x - pathRequest.start.x) + std::abs(pathRequest.end.y - pathRequest.start.y));
+		if (searchMode == PATH_SEARCH_MODE_STANDARD && bidirectionalSearchDistance != 0 && distance >= bidirectionalSearchDistance) {
+			resolvedRequest.searchMode = PATH_SEARCH_MODE_BIDIRECTIONAL;
+		}
+	}
+	return resolvedRequest;
+}
+
+/// <summary>
+/// Creates an unblocked path of adjacent grid squares for a single path request.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="workspace">Search storage that is fit to the navigation grid. Its previous search is discarded.
+/// Its path buffer receives the found path, which is empty if no path exists.</param>
+void Pathfinder::findPath(const PathRequest& pathRequest, PathSearchWorkspace& workspace) const {
+	if (beginSearch(pathRequest, workspace)) {
+		continueSearch(pathRequest, workspace, std::numeric_limits<std::size_t>::max());
+	}
+}
+
+/// <summary>
+/// Starts the search of a path request without expanding any grid square.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="workspace">Search storage that is fit to the navigation grid. Its previous search is discarded.
+/// Its path buffer is cleared, and stays empty if the search is already finished.</param>
+/// <returns>True if the search must be continued. False if no path exists.</returns>
+bool Pathfinder::beginSearch(const PathRequest& pathRequest, PathSearchWorkspace& workspace) const {
+
+	//initialize path as empty
+	workspace.getPathBuffer().clear();
+
+	//grid address of start and end points
+	const sf::Vector2i startPoint = pathRequest.start;
+	const sf::Vector2i endPoint = pathRequest.end;
+	if (!isInGrid(startPoint) ||
+		!isInGrid(endPoint)) {
+		return false; // there is no path to or from outside of the grid
+	}
+	if (isReachabilityIndexUsable() && !reachabilityIndex->isReachable(startPoint, endPoint)) {
+		return false; // the end is walled off from the start
+	}
+	const unsigned int startIndex = flattenGridCoordinate(startPoint);
+
+	const PATH_SEARCH_MODE_TYPE requestSearchMode = resolveSearchMode(pathRequest).searchMode;
+	const bool isBidirectional = (requestSearchMode == PATH_SEARCH_MODE_BIDIRECTIONAL);
+	if (isBidirectional) {
+		if (startPoint == endPoint || getGridWeight(endPoint) >= BLOCKED_GRID_WEIGHT) {
+			return false; // the path is empty, or the end can not be entered
+		}
+		workspace.fitReverseSearch();
+	}
+	else if (requestSearchMode == PATH_SEARCH_MODE_ANY_ANGLE) {
+		workspace.fitAnyAngleSearch();
+	}
+
+	workspace.beginSearch();
+	workspace.setState(startIndex, PATH_SEARCH_NODE_OPEN);
+	workspace.setScore(startIndex, 0);
+	workspace.setCameFrom(startIndex, PathSearchWorkspace::NO_NODE);
+	workspace.getOpenSet().pushOrUpdate(startIndex, 0);
+
+	// the reverse half starts at the end point
+	if (isBidirectional) {
+		const unsigned int endIndex = flattenGridCoordinate(endPoint);
+		workspace.setState(endIndex, PATH_SEARCH_NODE_OPEN, PATH_SEARCH_DIRECTION_REVERSE);
+		workspace.setScore(endIndex, 0, PATH_SEARCH_DIRECTION_REVERSE);
+		workspace.setCameFrom(endIndex, PathSearchWorkspace::NO_NODE, PATH_SEARCH_DIRECTION_REVERSE);
+		workspace.getOpenSet(PATH_SEARCH_DIRECTION_REVERSE).pushOrUpdate(endIndex, 0);
+	}
+	return true;
+}
+
+/// <summary>
+/// Continues a search started by beginSearch until the path is found, no path exists, or the passed number of grid squares were expanded.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path. Must match the request the search was started with.</param>
+/// <param name="workspace">The workspace of the running search. Its path buffer receives the found path once the search is finished.</param>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>True if the search is finished. False if it must be continued.</returns>
+bool Pathfinder::continueSearch(const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const {
+	return visitGridReader([&](const auto& gridReader) {
+		return continueSearch(gridReader, pathRequest, workspace, maxExpandedNodes);
+	});
+}
+
+/// <summary>
+/// Continues a search on the grid read by the passed reader, like continueSearch.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="pathRequest">The requirements for the path. Must match the request the search was started with.</param>
+/// <param name="workspace">The workspace of the running search. Its path buffer receives the found path once the search is finished.</param>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>True if the search is finished. False if it must be continued.</returns>
+template <typename GridReader>
+bool Pathfinder::continueSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const {
+	const sf::Vector2i endPoint = pathRequest.end;
+	const unsigned int endIndex = gridReader.flattenGridCoordinate(endPoint);
+
+	const PATH_SEARCH_MODE_TYPE requestSearchMode = resolveSearchMode(pathRequest).searchMode;
+	if (requestSearchMode == PATH_SEARCH_MODE_BIDIRECTIONAL) {
+		return continueBidirectionalSearch(gridReader, pathRequest, workspace, maxExpandedNodes);
+	}
+	if (requestSearchMode == PATH_SEARCH_MODE_ANY_ANGLE) {
+		return continueAnyAngleSearch(gridReader, pathRequest, workspace, maxExpandedNodes);
+	}
+
+	// the currently discovered nodes that are not evaluated yet, ordered by how promising they are
+	IndexedPriorityQueue<std::uint64_t>& openSet = workspace.getOpenSet();
+
+	//search for path
+	for (std::size_t expandedNodeCount = 0; !openSet.isEmpty(); ++expandedNodeCount) {
+		if (expandedNodeCount == maxExpandedNodes) {
+			return false;
+		}
+
+		//check current grid square
+		const unsigned int currentIndex = openSet.pop();
+		if (currentIndex == endIndex) {
+			//reconstruct path, and add to output
+			reconstructPath(endIndex, workspace, requestSearchMode);
+			return true;
+		}
+		workspace.setState(currentIndex, PATH_SEARCH_NODE_CLOSED);
+		workspace.countExpandedNode();
+
+		if (neighborhood != PATH_NEIGHBORHOOD_FOUR) {
+			expandNeighborhood(gridReader, currentIndex, endPoint, workspace);
+		}
+		else if (requestSearchMode == PATH_SEARCH_MODE_JUMP_POINT) {
+			expandJumpPoints(gridReader, currentIndex, endPoint, workspace);
+		}
+		else {
+			expandNeighbors(gridReader, currentIndex, endPoint, workspace);
+		}
+	}
+	return true;
+}
+
+/// <summary>
+/// Continues a bidirectional search started by beginSearch until the path is found, no path exists, or the passed number of grid squares were expanded.
+/// Each step expands the half with fewer open grid squares. Whenever a grid square is reached by both halves, the path through it
+/// is remembered if it is the cheapest so far. The search ends once the estimate of either half reaches the cost of that path,
+/// since neither half can reach a cheaper path any more.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="pathRequest">The requirements for the path. Must match the request the search was started with.</param>
+/// <param name="workspace">The workspace of the running search. Its path buffer receives the found path once the search is finished.</param>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>True if the search is finished. False if it must be continued.</returns>
+template <typename GridReader>
+bool Pathfinder::continueBidirectionalSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const {
+	IndexedPriorityQueue<std::uint64_t>& forwardOpenSet = workspace.getOpenSet(PATH_SEARCH_DIRECTION_FORWARD);
+	IndexedPriorityQueue<std::uint64_t>& reverseOpenSet = workspace.getOpenSet(PATH_SEARCH_DIRECTION_REVERSE);
+	for (std::size_t expandedNodeCount = 0; ; ++expandedNodeCount) {
+		// a half without open grid squares has reached everything it can, including any meeting
+		if (forwardOpenSet.isEmpty() || reverseOpenSet.isEmpty()) {
+			break;
+		}
+		if (workspace.getMeetingNode() != PathSearchWorkspace::NO_NODE) {
+			const std::uint64_t meetingCost = static_cast<std::uint64_t>(workspace.getMeetingScore()) * static_cast<std::uint64_t>(getScoreScale(PATH_SEARCH_MODE_BIDIRECTIONAL));
+			if ((std::max(forwardOpenSet.getTopPriority(), reverseOpenSet.getTopPriority()) >> TIE_BREAK_BITS) >= meetingCost) {
+				break;
+			}
+		}
+		if (expandedNodeCount == maxExpandedNodes) {
+			return false;
+		}
+
+		// expanding the smaller half keeps both halves small
+		const PATH_SEARCH_DIRECTION_TYPE direction = (forwardOpenSet.size() <= reverseOpenSet.size()) ? PATH_SEARCH_DIRECTION_FORWARD : PATH_SEARCH_DIRECTION_REVERSE;
+		const unsigned int currentIndex = workspace.getOpenSet(direction).pop();
+		workspace.setState(currentIndex, PATH_SEARCH_NODE_CLOSED, direction);
+		workspace.countExpandedNode();
+		expandBidirectionalNeighbors(gridReader, currentIndex, direction, pathRequest, workspace);
+	}
+
+	if (workspace.getMeetingNode() != PathSearchWorkspace::NO_NODE) {
+		reconstructBidirectionalPath(workspace);
+	}
+	return true;
+}
+
+/// <summary>
+/// Continues an any angle search started by beginSearch until the path is found, no path exists, or the passed number of grid squares were expanded.
+/// The search is a lazy Theta*. A discovered grid square is linked straight to the predecessor of the grid square that discovered it,
+/// and the line of sight between them is only checked once the grid square is expanded. Most discovered grid squares are never expanded,
+/// so each expansion checks at most one line of sight. When the line is blocked, or crosses heavier grid squares than assumed,
+/// the grid square falls back to the cheapest step from an expanded neighbor.
+/// Paths are not guaranteed to be the cheapest, but they are close to the straight line cost and have few turns.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="pathRequest">The requirements for the path. Must match the request the search was started with.</param>
+/// <param name="workspace">The workspace of the running search. Its path buffer receives the found path once the search is finished.</param>
+/// <param name="maxExpandedNodes">The most grid squares to expand.</param>
+/// <returns>True if the search is finished. False if it must be continued.</returns>
+template <typename GridReader>
+bool Pathfinder::continueAnyAngleSearch(const GridReader& gridReader, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::size_t maxExpandedNodes) const {
+	const sf::Vector2i endPoint = pathRequest.end;
+	const unsigned int endIndex = gridReader.flattenGridCoordinate(endPoint);
+	IndexedPriorityQueue<std::uint64_t>& openSet = workspace.getOpenSet();
+
+	for (std::size_t expandedNodeCount = 0; !openSet.isEmpty(); ++expandedNodeCount) {
+		if (expandedNodeCount == maxExpandedNodes) {
+			return false;
+		}
+
+		const unsigned int currentIndex = openSet.pop();
+		verifyAnyAngleParent(gridReader, currentIndex, workspace);
+		if (currentIndex == endIndex) {
+			reconstructPath(endIndex, workspace, PATH_SEARCH_MODE_ANY_ANGLE);
+			return true;
+		}
+		workspace.setState(currentIndex, PATH_SEARCH_NODE_CLOSED);
+		workspace.countExpandedNode();
+		expandAnyAngleNeighbors(gridReader, currentIndex, endPoint, workspace);
+	}
+	return true;
+}
+
+/// <summary>
+/// Discovers every unblocked neighbor of an evaluated grid square.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the evaluated grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::expandNeighbors(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const {
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const int currentWeight = gridReader.getWeight(current);
+	const int currentScore = workspace.getScore(currentIndex);
+
+	//find neighbors
+	std::vector<sf::Vector2i>& neighbors = workspace.getNeighborBuffer();
+	getNeighbors(gridReader, current, neighbors);
+	for (const sf::Vector2i& neighbor : neighbors) {
+		const unsigned int neighborIndex = gridReader.flattenGridCoordinate(neighbor);
+		if (workspace.getState(neighborIndex) == PATH_SEARCH_NODE_CLOSED) {
+			continue;// no need to evaluate already evaluated nodes
+		}
+
+		//add blocked neighbors to closed set
+		const int neighborWeight = gridReader.getWeight(neighbor);
+		if (neighborWeight >= BLOCKED_GRID_WEIGHT) {
+			workspace.setState(neighborIndex, PATH_SEARCH_NODE_CLOSED);
+			continue;
+		}
+
+		//cost of reaching neighbor using current path
+		const int transitionCost = calcStepCost(currentWeight, neighborWeight);
+		discoverGridSquare(neighborIndex, neighbor, currentIndex, currentScore + transitionCost, endPoint, workspace);
+	}
+}
+
+/// <summary>
+/// Discovers every unblocked neighbor of an evaluated grid square in an eight or custom neighborhood.
+/// Steps cost their scaled length times the average weight of both grid squares.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the evaluated grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::expandNeighborhood(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const {
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const int currentWeight = gridReader.getWeight(current);
+	const int currentScore = workspace.getScore(currentIndex);
+
+	for (std::size_t i = 0; i < neighborOffsets.size(); ++i) {
+		const sf::Vector2i neighbor = current + neighborOffsets[i];
+		if (!gridReader.isInGrid(neighbor)) {
+			continue;
+		}
+		const unsigned int neighborIndex = gridReader.flattenGridCoordinate(neighbor);
+		if (workspace.getState(neighborIndex) == PATH_SEARCH_NODE_CLOSED) {
+			continue;// no need to evaluate already evaluated nodes
+		}
+
+		//add blocked neighbors to closed set
+		const int neighborWeight = gridReader.getWeight(neighbor);
+		if (neighborWeight >= BLOCKED_GRID_WEIGHT) {
+			workspace.setState(neighborIndex, PATH_SEARCH_NODE_CLOSED);
+			continue;
+		}
+		if (!isCornerCutAllowed(gridReader, current, neighborOffsets[i])) {
+			continue;
+		}
+
+		//cost of reaching neighbor using current path
+		const int tentativeScore = currentScore + calcStepCost(currentWeight, neighborWeight, neighborStepLengths[i]);
+		discoverGridSquare(neighborIndex, neighbor, currentIndex, tentativeScore, endPoint, workspace);
+	}
+}
+
+/// <summary>
+/// Discovers the neighbors of a grid square evaluated by one half of a bidirectional search, and records where the halves meet.
+/// The reverse half follows steps backwards, so it reaches the grid squares a step leads from.
+/// This keeps both halves correct in neighborhoods whose steps can not be reversed.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the evaluated grid square.</param>
+/// <param name="direction">The half that evaluated the grid square.</param>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::expandBidirectionalNeighbors(const GridReader& gridReader, unsigned int currentIndex, PATH_SEARCH_DIRECTION_TYPE direction, const PathRequest& pathRequest, PathSearchWorkspace& workspace) const {
+	const bool isForward = (direction == PATH_SEARCH_DIRECTION_FORWARD);
+	const PATH_SEARCH_DIRECTION_TYPE oppositeDirection = isForward ? PATH_SEARCH_DIRECTION_REVERSE : PATH_SEARCH_DIRECTION_FORWARD;
+	const sf::Vector2i& target = isForward ? pathRequest.end : pathRequest.start;
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const int currentWeight = gridReader.getWeight(current);
+	const int currentScore = workspace.getScore(currentIndex, direction);
+
+	for (std::size_t i = 0; i < neighborOffsets.size(); ++i) {
+		const sf::Vector2i& offset = neighborOffsets[i];
+		const sf::Vector2i neighbor = isForward ? current + offset : current - offset;
+		if (!gridReader.isInGrid(neighbor)) {
+			continue;
+		}
+		const unsigned int neighborIndex = gridReader.flattenGridCoordinate(neighbor);
+		if (workspace.getState(neighborIndex, direction) == PATH_SEARCH_NODE_CLOSED) {
+			continue;// no need to evaluate already evaluated nodes
+		}
+
+		// paths never enter a blocked grid square, but may leave a blocked start point
+		const int neighborWeight = gridReader.getWeight(neighbor);
+		if (neighborWeight >= BLOCKED_GRID_WEIGHT && (isForward || neighbor != pathRequest.start)) {
+			continue;
+		}
+		if (!isCornerCutAllowed(gridReader, isForward ? current : neighbor, offset)) {
+			continue;
+		}
+
+		//cost of reaching neighbor using current path. Four neighborhood steps are not scaled.
+		const int stepLength = (neighborhood == PATH_NEIGHBORHOOD_FOUR) ? 1 : neighborStepLengths[i];
+		const int tentativeScore = currentScore + calcStepCost(currentWeight, neighborWeight, stepLength);
+		if (!improveGridSquare(neighborIndex, currentIndex, tentativeScore, workspace, direction)) {
+			continue;
+		}
+		workspace.getOpenSet(direction).pushOrUpdate(neighborIndex, calcGridSquarePriority(neighbor, target, tentativeScore, PATH_SEARCH_MODE_BIDIRECTIONAL));
+
+		// the other half already reached the neighbor, so a path runs through it
+		if (workspace.getState(neighborIndex, oppositeDirection) != PATH_SEARCH_NODE_UNVISITED) {
+			const int pathScore = tentativeScore + workspace.getScore(neighborIndex, oppositeDirection);
+			if (workspace.getMeetingNode() == PathSearchWorkspace::NO_NODE || pathScore < workspace.getMeetingScore()) {
+				workspace.setMeeting(neighborIndex, pathScore);
+			}
+		}
+	}
 }
 
-//getters / setters
+/// <summary>
+/// Discovers the unblocked neighbors of a grid square evaluated by an any angle search.
+/// Each neighbor is reached either by a step from the evaluated grid square or by a line from its predecessor,
+/// whichever is cheaper. Lines are assumed to only cross grid squares as heavy as the neighbor until verifyAnyAngleParent checks them.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the evaluated grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::expandAnyAngleNeighbors(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const {
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const int currentWeight = gridReader.getWeight(current);
+	const int currentScore = workspace.getScore(currentIndex);
 
-//setters
+	// the start has no predecessor, so its neighbors can only be stepped to
+	const unsigned int parentIndex = workspace.getCameFrom(currentIndex);
+	const bool hasParent = (parentIndex != PathSearchWorkspace::NO_NODE);
+	const sf::Vector2i parent = hasParent ? gridReader.expandGridIndex(parentIndex) : current;
+	const int parentScore = hasParent ? workspace.getScore(parentIndex) : 0;
+	const int parentWeight = gridReader.getWeight(parent);
+
+	for (std::size_t i = 0; i < neighborOffsets.size(); ++i) {
+		const sf::Vector2i neighbor = current + neighborOffsets[i];
+		if (!gridReader.isInGrid(neighbor)) {
+			continue;
+		}
+		const unsigned int neighborIndex = gridReader.flattenGridCoordinate(neighbor);
+		if (workspace.getState(neighborIndex) == PATH_SEARCH_NODE_CLOSED) {
+			continue;// no need to evaluate already evaluated nodes
+		}
+		const int neighborWeight = gridReader.getWeight(neighbor);
+		if (neighborWeight >= BLOCKED_GRID_WEIGHT || !isCornerCutAllowed(gridReader, current, neighborOffsets[i])) {
+			continue;
+		}
+
+		// a line is rounded once while steps add up their rounding, so a line up to two scaled length units
+		// more expensive than the steps is still the straighter path. Taking it saves a turn.
+		int tentativeScore = currentScore + calcStepCost(currentWeight, neighborWeight, neighborStepLengths[i]);
+		unsigned int cameFrom = currentIndex;
+		if (hasParent) {
+			const int lineScore = parentScore + calcLineCost(parent, neighbor, parentWeight, neighborWeight);
+			if (lineScore <= tentativeScore + parentWeight + neighborWeight) {
+				tentativeScore = lineScore;
+				cameFrom = parentIndex;
+			}
+		}
+		if (improveGridSquare(neighborIndex, cameFrom, tentativeScore, workspace, PATH_SEARCH_DIRECTION_FORWARD)) {
+			workspace.getOpenSet().pushOrUpdate(neighborIndex, calcGridSquarePriority(neighbor, endPoint, tentativeScore, PATH_SEARCH_MODE_ANY_ANGLE));
+		}
+	}
+}
 
 /// <summary>
-/// Sets the navigation grid.
+/// Checks the line from a grid square about to be expanded by an any angle search to its predecessor.
+/// If the line is blocked or costs more than assumed, the grid square is relinked to the cheapest of the line
+/// and the steps from its expanded neighbors. The neighbor that discovered the grid square is always one of them.
+/// Like in expandAnyAngleNeighbors, the line is kept if it is at most two scaled length units more expensive than the steps.
+/// The weight of a kept line is stored, so lines that continue it to a further grid square only need to check their last part.
 /// </summary>
-/// <param name="navigationGrid">The navigation grid.</param>
-void Pathfinder::setNavigationGrid(NavigationGrid* newNavigationGrid) {
-	this->navigationGrid = newNavigationGrid;
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the grid square.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::verifyAnyAngleParent(const GridReader& gridReader, unsigned int currentIndex, PathSearchWorkspace& workspace) const {
+	const unsigned int parentIndex = workspace.getCameFrom(currentIndex);
+	if (parentIndex == PathSearchWorkspace::NO_NODE) {
+		workspace.setLineWeight(currentIndex, PathSearchWorkspace::NO_LINE_WEIGHT);
+		return;
+	}
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const sf::Vector2i parent = gridReader.expandGridIndex(parentIndex);
+	const int currentWeight = gridReader.getWeight(current);
+	const sf::Vector2i offset = current - parent;
+	if (std::abs(offset.x) + std::abs(offset.y) == 1) {
+		workspace.setLineWeight(currentIndex, currentWeight);
+		return; // a line to a grid square sharing a side only crosses the grid square itself
+	}
+
+	// the last grid square the line passes through the center of continues the line from the same predecessor.
+	// Its line was checked when it was expanded, so only the rest of the line needs to be walked.
+	int lineWeight = PathSearchWorkspace::NO_LINE_WEIGHT;
+	const int centerCount = std::gcd(std::abs(offset.x), std::abs(offset.y));
+	if (centerCount > 1) {
+		const sf::Vector2i previous = current - offset / centerCount;
+		const unsigned int previousIndex = gridReader.flattenGridCoordinate(previous);
+		if (workspace.getState(previousIndex) == PATH_SEARCH_NODE_CLOSED && workspace.getCameFrom(previousIndex) == parentIndex &&
+			workspace.getLineWeight(previousIndex) != PathSearchWorkspace::NO_LINE_WEIGHT) {
+			lineWeight = std::max(workspace.getLineWeight(previousIndex), gridReader.calcLineWeight(previous, current));
+		}
+	}
+	if (lineWeight == PathSearchWorkspace::NO_LINE_WEIGHT) {
+		workspace.countLineOfSightCheck();
+		lineWeight = gridReader.calcLineWeight(parent, current);
+	}
+	const bool isLineClear = (lineWeight < BLOCKED_GRID_WEIGHT);
+	const int parentWeight = gridReader.getWeight(parent);
+	const int lineScore = isLineClear ? workspace.getScore(parentIndex) + calcLineCost(parent, current, parentWeight, lineWeight) : 0;
+	if (isLineClear && lineScore <= workspace.getScore(currentIndex)) {
+		workspace.setScore(currentIndex, lineScore);
+		workspace.setLineWeight(currentIndex, lineWeight);
+		return; // the line is as cheap as assumed
+	}
+
+	// the steps that lead into the grid square start at its neighbors against each offset
+	int bestScore = std::numeric_limits<int>::max();
+	unsigned int bestParentIndex = parentIndex;
+	for (std::size_t i = 0; i < neighborOffsets.size(); ++i) {
+		const sf::Vector2i neighbor = current - neighborOffsets[i];
+		if (!gridReader.isInGrid(neighbor)) {
+			continue;
+		}
+		const unsigned int neighborIndex = gridReader.flattenGridCoordinate(neighbor);
+		if (workspace.getState(neighborIndex) != PATH_SEARCH_NODE_CLOSED || !isCornerCutAllowed(gridReader, neighbor, neighborOffsets[i])) {
+			continue;
+		}
+		const int stepScore = workspace.getScore(neighborIndex) + calcStepCost(gridReader.getWeight(neighbor), currentWeight, neighborStepLengths[i]);
+		if (stepScore < bestScore) {
+			bestScore = stepScore;
+			bestParentIndex = neighborIndex;
+		}
+	}
+
+	if (isLineClear && lineScore <= bestScore + parentWeight + lineWeight) {
+		workspace.setScore(currentIndex, lineScore);
+		workspace.setLineWeight(currentIndex, lineWeight);
+		return;
+	}
+	workspace.setScore(currentIndex, bestScore);
+	workspace.setCameFrom(currentIndex, bestParentIndex);
+	workspace.setLineWeight(currentIndex, PathSearchWorkspace::NO_LINE_WEIGHT);
 }
 
-//setters
+/// <summary>
+/// Calculates the cost of an any angle line. The line costs its scaled length times the average of the weight
+/// of the grid square it starts in and the heaviest grid square it crosses, which matches the cost of steps.
+/// </summary>
+/// <param name="from">The grid square the line starts in.</param>
+/// <param name="to">The grid square the line ends in.</param>
+/// <param name="fromWeight">The weight of the grid square the line starts in.</param>
+/// <param name="lineWeight">The heaviest weight of the grid squares the line crosses after its start.</param>
+/// <returns>The cost of the line.</returns>
+int Pathfinder::calcLineCost(const sf::Vector2i& from, const sf::Vector2i& to, int fromWeight, int lineWeight) const {
+	const double xDistance = to.x - from.x;
+	const double yDistance = to.y - from.y;
+	const int lineLength = static_cast<int>(std::lround(std::sqrt(xDistance * xDistance + yDistance * yDistance) * STEP_LENGTH_SCALE));
+	return calcStepCost(fromWeight, lineWeight, lineLength);
+}
 
 /// <summary>
-/// Gets the navigation grid.
+/// Discovers the jump points reachable from an evaluated grid square.
+/// Paths through an area of equal weight are only allowed to move vertically first and to turn horizontally afterwards,
+/// unless an obstacle forces an earlier turn. Every other path through the area has the same cost as one of these,
+/// so the grid squares in between never need to be evaluated. Grid squares that border a different weight
+/// are always jump points and also step into their neighbors of a different weight one grid square at a time,
+/// which falls back to the standard search where weights change.
 /// </summary>
-/// <returns>NavigationGrid pointer</returns>
-NavigationGrid* Pathfinder::getNavigationGrid() {
-	return navigationGrid;
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="currentIndex">The flattened coordinate of the evaluated grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+template <typename GridReader>
+void Pathfinder::expandJumpPoints(const GridReader& gridReader, unsigned int currentIndex, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const {
+	const sf::Vector2i current = gridReader.expandGridIndex(currentIndex);
+	const int regionWeight = gridReader.getWeight(current);
+	const int currentScore = workspace.getScore(currentIndex);
+
+	// find the direction the current grid square was entered from within its area.
+	// the start and grid squares entered from another weight have no direction and expand everywhere.
+	sf::Vector2i arrivalDirection{0, 0};
+	const unsigned int cameFromIndex = workspace.getCameFrom(currentIndex);
+	if (cameFromIndex != PathSearchWorkspace::NO_NODE) {
+		const sf::Vector2i cameFrom = gridReader.expandGridIndex(cameFromIndex);
+		if (gridReader.getWeight(cameFrom) == regionWeight) {
+			arrivalDirection = sf::Vector2i{calcSign(current.x - cameFrom.x), calcSign(current.y - cameFrom.y)};
+		}
+	}
+
+	// find the directions a path through the current grid square can continue in
+	std::vector<sf::Vector2i>& directions = workspace.getNeighborBuffer();
+	directions.clear();
+	if (arrivalDirection.x != 0) {
+		// horizontal paths only turn where the vertical neighbor could not have been reached before turning
+		directions.push_back(arrivalDirection);
+		for (const int yDirection : {1, -1}) {
+			if (!gridReader.isInRegion(sf::Vector2i{current.x - arrivalDirection.x, current.y + yDirection}, regionWeight) &&
+				gridReader.isInRegion(sf::Vector2i{current.x, current.y + yDirection}, regionWeight)) {
+				directions.emplace_back(sf::Vector2i{0, yDirection});
+			}
+		}
+	}
+	else if (arrivalDirection.y != 0) {
+		// vertical paths may continue or turn horizontally
+		directions.push_back(arrivalDirection);
+		directions.emplace_back(sf::Vector2i{1, 0});
+		directions.emplace_back(sf::Vector2i{-1, 0});
+	}
+	else {
+		directions.emplace_back(sf::Vector2i{1, 0});
+		directions.emplace_back(sf::Vector2i{-1, 0});
+		directions.emplace_back(sf::Vector2i{0, 1});
+		directions.emplace_back(sf::Vector2i{0, -1});
+	}
+
+	// leave the area wherever it borders a different weight
+	if (arrivalDirection != sf::Vector2i{0, 0}) {
+		for (const sf::Vector2i& neighborOffset : FOUR_NEIGHBOR_OFFSETS) {
+			if (isOtherUnblockedWeight(gridReader.getWeightOrBlocked(current + neighborOffset), regionWeight) &&
+				std::find(directions.begin(), directions.end(), neighborOffset) == directions.end()) {
+				directions.push_back(neighborOffset);
+			}
+		}
+	}
+
+	for (const sf::Vector2i& direction : directions) {
+		sf::Vector2i jumpPoint;
+		if (!findJumpPoint(gridReader, current, direction, regionWeight, endPoint, jumpPoint)) {
+			continue;
+		}
+		const unsigned int jumpPointIndex = gridReader.flattenGridCoordinate(jumpPoint);
+		if (workspace.getState(jumpPointIndex) == PATH_SEARCH_NODE_CLOSED) {
+			continue;// no need to evaluate already evaluated nodes
+		}
+
+		// every step within the area costs its weight. a step out of the area costs the average of both weights.
+		const int jumpPointWeight = gridReader.getWeight(jumpPoint);
+		const int transitionCost = (jumpPointWeight == regionWeight) ?
+			calcStepCost(regionWeight, regionWeight) * (std::abs(jumpPoint.x - current.x) + std::abs(jumpPoint.y - current.y)) :
+			calcStepCost(regionWeight, jumpPointWeight);
+		discoverGridSquare(jumpPointIndex, jumpPoint, currentIndex, currentScore + transitionCost, endPoint, workspace);
+	}
 }
 
 /// <summary>
-/// Creates an unblocked path of adjacent grid squares to for each path request.
+/// Moves in a straight line from a grid square until a jump point is found.
+/// Grid squares of a different weight than the area being jumped through are treated as obstacles,
+/// except that stepping directly onto an unblocked one ends the jump there.
 /// </summary>
-/// <param name="pathRequests">vector containing the requirements for each path.</param>
-/// <param name="returnedPaths">vector containing the found path for each PathRequest. The path is found at the same index as its corresponding request.</param>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="origin">The grid square the jump starts at. It is not a candidate jump point.</param>
+/// <param name="direction">The horizontal or vertical unit step of the jump.</param>
+/// <param name="regionWeight">The weight of the area being jumped through.</param>
+/// <param name="endPoint">The end point of the path request. Always a jump point.</param>
+/// <param name="jumpPoint">Output coordinate. Receives the found jump point.</param>
+/// <returns>True if a jump point was found. False if the jump ran into an obstacle or the edge of the grid.</returns>
+template <typename GridReader>
+bool Pathfinder::findJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& direction, int regionWeight, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const {
+	const sf::Vector2i next = origin + direction;
+	const int nextWeight = gridReader.getWeightOrBlocked(next);
+	if (nextWeight >= BLOCKED_GRID_WEIGHT) {
+		return false;
+	}
 
-void Pathfinder::pathFind(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const returnedPaths) const {
+	// leave the area one grid square at a time
+	if (nextWeight != regionWeight) {
+		jumpPoint = next;
+		return true;
+	}
 
-	using GridValuePair = std::pair<sf::Vector2i, int>;
+	if (direction.x != 0) {
+		return findHorizontalJumpPoint(gridReader, origin, direction.x, endPoint, jumpPoint);
+	}
+	return findVerticalJumpPoint(gridReader, origin, direction.y, regionWeight, endPoint, jumpPoint);
+}
 
-	//ensure that returned paths is big enough to store all results
-	returnedPaths->resize(pathRequests.size());
+/// <summary>
+/// Moves horizontally through an area of equal weight until a jump point is found.
+/// A grid square is a jump point if it is the end point, borders a different unblocked weight,
+/// or has a vertical neighbor in the area whose counterpart behind the grid square is not in the area.
+/// The jump is looked up in the jump distances, so no grid square in between is read.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="origin">The grid square the jump starts at. The next grid square must be in the area.</param>
+/// <param name="xDirection">1 to move towards higher x, -1 to move towards lower x.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="jumpPoint">Output coordinate. Receives the found jump point.</param>
+/// <returns>True if a jump point was found. False if the jump ran into an obstacle or the edge of the grid.</returns>
+template <typename GridReader>
+bool Pathfinder::findHorizontalJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, int xDirection, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const {
+	const int jumpDistance = getJumpDistance(gridReader, origin, sf::Vector2i{xDirection, 0});
 
-	//find result for each path request
-	for (unsigned int i = 0; i < pathRequests.size(); i++) {
+	// the jump passes the end point before it reaches its jump point or obstacle
+	const int endDistance = (endPoint.x - origin.x) * xDirection;
+	if (endPoint.y == origin.y && endDistance > 0 && endDistance <= std::abs(jumpDistance)) {
+		jumpPoint = endPoint;
+		return true;
+	}
 
-		PathRequest pathRequest = pathRequests[i];
+	if (jumpDistance < 0) {
+		return false;
+	}
+	jumpPoint = sf::Vector2i{origin.x + jumpDistance * xDirection, origin.y};
+	return true;
+}
 
-		//grid address of start and end points
-		sf::Vector2i startPoint = pathRequest.start;
-		sf::Vector2i endPoint = pathRequest.end;
+/// <summary>
+/// Moves vertically through an area of equal weight until a jump point is found.
+/// A grid square is a jump point if it is the end point, borders a different unblocked weight,
+/// or a horizontal jump from it finds a jump point.
+/// The jump is looked up in the jump distances. Only the row of the end point is read, since the end point is not part of them.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="origin">The grid square the jump starts at. The next grid square must be in the area.</param>
+/// <param name="yDirection">1 to move towards higher y, -1 to move towards lower y.</param>
+/// <param name="regionWeight">The weight of the area being jumped through.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="jumpPoint">Output coordinate. Receives the found jump point.</param>
+/// <returns>True if a jump point was found. False if the jump ran into an obstacle or the edge of the grid.</returns>
+template <typename GridReader>
+bool Pathfinder::findVerticalJumpPoint(const GridReader& gridReader, const sf::Vector2i& origin, int yDirection, int regionWeight, const sf::Vector2i& endPoint, sf::Vector2i& jumpPoint) const {
+	const int jumpDistance = getJumpDistance(gridReader, origin, sf::Vector2i{0, yDirection});
 
-		// the set of nodes already evaluated
-		std::set<sf::Vector2i, IsVector2Less<int>> closedSet;
+	// the jump passes the row of the end point before it reaches its jump point or obstacle.
+	// the grid square of that row is a jump point if it is the end point, or if a horizontal jump from it passes the end point.
+	const int endDistance = (endPoint.y - origin.y) * yDirection;
+	if (endDistance > 0 && endDistance <= std::abs(jumpDistance)) {
+		const sf::Vector2i endRowGridSquare{origin.x, endPoint.y};
+		const sf::Vector2i turnDirection{calcSign(endPoint.x - origin.x), 0};
+		if (turnDirection.x == 0) {
+			jumpPoint = endPoint;
+			return true;
+		}
+		if (gridReader.isInRegion(endRowGridSquare + turnDirection, regionWeight) &&
+			std::abs(endPoint.x - origin.x) <= std::abs(getJumpDistance(gridReader, endRowGridSquare, turnDirection))) {
+			jumpPoint = endRowGridSquare;
+			return true;
+		}
+	}
 
-		// the set of currently discovered nodes that are already evaluated.
-		std::set<sf::Vector2i, IsVector2Less<int>> openSet;
-		openSet.insert(startPoint);
+	if (jumpDistance < 0) {
+		return false;
+	}
+	jumpPoint = sf::Vector2i{origin.x, origin.y + jumpDistance * yDirection};
+	return true;
+}
 
-		// cost to move to a point from the start
-		std::map<sf::Vector2i, int, IsVector2Less<int>> score;
-		score.insert(GridValuePair(startPoint, 0));
+/// <summary>
+/// Determines if a path request is solved by a jump point search, which only runs in the four neighborhood.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+/// <returns>True if the request needs the jump distances.</returns>
+bool Pathfinder::isJumpPointSearch(const PathRequest& pathRequest) const {
+	return neighborhood == PATH_NEIGHBORHOOD_FOUR && resolveSearchMode(pathRequest).searchMode == PATH_SEARCH_MODE_JUMP_POINT;
+}
 
-		// For each node, which node it can most efficiently be reached from.
-		// If a node can be reached from many nodes, cameFrom will eventually contain the
-		// most efficient previous step.
-		std::map<sf::Vector2i, sf::Vector2i, IsVector2Less<int>> cameFrom;
+/// <summary>
+/// Finds how far a jump from each grid square moves in each of the four directions, so jumps never walk the grid (JPS+).
+/// A positive distance reaches a jump point. A negative distance ends at an obstacle or the edge of the grid after that many grid squares.
+/// Zero means the next grid square is not in the area of the grid square, which findJumpPoint handles on its own.
+/// The end point of a request is not a jump point here, so findHorizontalJumpPoint and findVerticalJumpPoint add it.
+/// Every distance continues the distance of the next grid square, so the grid is walked once against each direction.
+/// Only runs after the grid, the unit radius or a reported grid square changed.
+/// </summary>
+void Pathfinder::updateJumpDistances() const {
+	if (!isJumpDistancesStale || !hasNavigationGrid()) {
+		return;
+	}
 
-		//search for path
-		(*returnedPaths)[i] = std::deque<sf::Vector2i>(); //initialize path as empty
-		while (!openSet.empty()) {
-			//check current grid square
-			sf::Vector2i current = chooseNextGridSquare(pathRequest, openSet, score);
-			if (current == endPoint) {
-				//reconstruct path, and add to output vector
+	visitGridReader([this](const auto& gridReader) {
+		updateJumpDistances(gridReader);
+	});
+	isJumpDistancesStale = false;
+}
 
-				std::deque<sf::Vector2i> inOrderPath = reconstructPath(endPoint, cameFrom);
-				(*returnedPaths)[i] = inOrderPath;
-				break;
+/// <summary>
+/// Finds the jump distances of every grid square of the grid read by the passed reader, like updateJumpDistances.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+template <typename GridReader>
+void Pathfinder::updateJumpDistances(const GridReader& gridReader) const {
+	const int gridSizeX = static_cast<int>(gridReader.getGridSize().x);
+	const int gridSizeY = static_cast<int>(gridReader.getGridSize().y);
+	jumpDistances.assign(static_cast<std::size_t>(gridSizeX) * static_cast<std::size_t>(gridSizeY) * FOUR_NEIGHBOR_COUNT, 0);
+	const auto setJumpDistance = [this, &gridReader](const sf::Vector2i& origin, const sf::Vector2i& direction, int jumpDistance) {
+		jumpDistances[static_cast<std::size_t>(gridReader.flattenGridCoordinate(origin)) * FOUR_NEIGHBOR_COUNT + getFourNeighborIndex(direction)] = jumpDistance;
+	};
+	const auto continueJumpDistance = [this, &gridReader](const sf::Vector2i& next, const sf::Vector2i& direction) {
+		const int nextJumpDistance = getJumpDistance(gridReader, next, direction);
+		return nextJumpDistance + calcSign(nextJumpDistance);
+	};
+
+	// horizontal jumps stop where a vertical neighbor enters the area, which depends on the grid square before it
+	for (const int xDirection : {1, -1}) {
+		const sf::Vector2i direction{xDirection, 0};
+		for (int y = 0; y < gridSizeY; ++y) {
+			for (int x = (xDirection > 0) ? gridSizeX - 1 : 0; x >= 0 && x < gridSizeX; x -= xDirection) {
+				const sf::Vector2i origin{x, y};
+				const sf::Vector2i next = origin + direction;
+				const int regionWeight = gridReader.getWeight(origin);
+				if (regionWeight >= BLOCKED_GRID_WEIGHT || !gridReader.isInRegion(next, regionWeight)) {
+					continue;
+				}
+
+				const int upWeight = gridReader.getWeightOrBlocked(sf::Vector2i{next.x, y + 1});
+				const int downWeight = gridReader.getWeightOrBlocked(sf::Vector2i{next.x, y - 1});
+				const int aheadWeight = gridReader.getWeightOrBlocked(next + direction);
+				if (isOtherUnblockedWeight(upWeight, regionWeight) ||
+					isOtherUnblockedWeight(downWeight, regionWeight) ||
+					isOtherUnblockedWeight(aheadWeight, regionWeight) ||
+					(upWeight == regionWeight && !gridReader.isInRegion(sf::Vector2i{x, y + 1}, regionWeight)) ||
+					(downWeight == regionWeight && !gridReader.isInRegion(sf::Vector2i{x, y - 1}, regionWeight))) {
+					setJumpDistance(origin, direction, 1);
+				}
+				else if (aheadWeight != regionWeight) {
+					setJumpDistance(origin, direction, -1);
+				}
+				else {
+					setJumpDistance(origin, direction, continueJumpDistance(next, direction));
+				}
 			}
-			openSet.erase(openSet.find(current));
-			closedSet.insert(current);
+		}
+	}
+
+	// vertical jumps stop wherever turning horizontally leads to a jump point
+	for (const int yDirection : {1, -1}) {
+		const sf::Vector2i direction{0, yDirection};
+		for (int x = 0; x < gridSizeX; ++x) {
+			for (int y = (yDirection > 0) ? gridSizeY - 1 : 0; y >= 0 && y < gridSizeY; y -= yDirection) {
+				const sf::Vector2i origin{x, y};
+				const sf::Vector2i next = origin + direction;
+				const int regionWeight = gridReader.getWeight(origin);
+				if (regionWeight >= BLOCKED_GRID_WEIGHT || !gridReader.isInRegion(next, regionWeight)) {
+					continue;
+				}
 
-			//find neighbors
-			std::vector<sf::Vector2i> neighbors = getNeighbors(current);
-			for (sf::Vector2i neighbor : neighbors) {
-				if (closedSet.find(neighbor) != closedSet.end()) {
-					continue;// no need to evaluate already evaluated nodes
+				const int rightWeight = gridReader.getWeightOrBlocked(sf::Vector2i{x + 1, next.y});
+				const int leftWeight = gridReader.getWeightOrBlocked(sf::Vector2i{x - 1, next.y});
+				const int aheadWeight = gridReader.getWeightOrBlocked(next + direction);
+				if (isOtherUnblockedWeight(rightWeight, regionWeight) ||
+					isOtherUnblockedWeight(leftWeight, regionWeight) ||
+					isOtherUnblockedWeight(aheadWeight, regionWeight) ||
+					(rightWeight == regionWeight && getJumpDistance(gridReader, next, sf::Vector2i{1, 0}) > 0) ||
+					(leftWeight == regionWeight && getJumpDistance(gridReader, next, sf::Vector2i{-1, 0}) > 0)) {
+					setJumpDistance(origin, direction, 1);
 				}
-				//cost of reaching neighbor using current path
-				int transitionCost = (navigationGrid->at(current.x, current.y)->weight + navigationGrid->at(neighbor.x, neighbor.y)->weight) / 2;
-				int tentativeScore = score.at(current) + transitionCost;
-
-				//discover new node
-				if (openSet.find(neighbor) == openSet.end()) {
-					//add blocked to closed set and unblocked to open set
-					if (navigationGrid->at(neighbor.x, neighbor.y)->weight >= BLOCKED_GRID_WEIGHT) {
-						closedSet.insert(neighbor);
-						continue;
-					}
-					openSet.insert(neighbor);
+				else if (aheadWeight != regionWeight) {
+					setJumpDistance(origin, direction, -1);
 				}
-				else if (tentativeScore >= score.at(neighbor)) {
-					continue; // found a worse path
+				else {
+					setJumpDistance(origin, direction, continueJumpDistance(next, direction));
 				}
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Gets how far a jump moves from a grid square, as found by updateJumpDistances.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="origin">The grid square the jump starts at. Must be within the navigation grid.</param>
+/// <param name="direction">The horizontal or vertical unit step of the jump.</param>
+/// <returns>The distance to the jump point if positive, or to the end of the jump if negative.</returns>
+template <typename GridReader>
+int Pathfinder::getJumpDistance(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& direction) const {
+	return jumpDistances[static_cast<std::size_t>(gridReader.flattenGridCoordinate(origin)) * FOUR_NEIGHBOR_COUNT + getFourNeighborIndex(direction)];
+}
+
+/// <summary>
+/// Opens a grid square or updates it if it was reached more cheaply than before.
+/// Used by the searches that follow steps, which share the scores of the standard search.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square. Must not be closed.</param>
+/// <param name="gridSquare">The coordinate of the grid square.</param>
+/// <param name="cameFrom">The flattened coordinate of the grid square it was reached from.</param>
+/// <param name="tentativeScore">The cost of reaching the grid square along the new path.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+void Pathfinder::discoverGridSquare(unsigned int gridIndex, const sf::Vector2i& gridSquare, unsigned int cameFrom, int tentativeScore, const sf::Vector2i& endPoint, PathSearchWorkspace& workspace) const {
+	if (improveGridSquare(gridIndex, cameFrom, tentativeScore, workspace, PATH_SEARCH_DIRECTION_FORWARD)) {
+		workspace.getOpenSet().pushOrUpdate(gridIndex, calcGridSquarePriority(gridSquare, endPoint, tentativeScore, PATH_SEARCH_MODE_STANDARD));
+	}
+}
+
+/// <summary>
+/// Opens a grid square or records a cheaper path to it. The caller queues the grid square with its priority.
+/// </summary>
+/// <param name="gridIndex">The flattened coordinate of the grid square. Must not be closed.</param>
+/// <param name="cameFrom">The flattened coordinate of the grid square it was reached from.</param>
+/// <param name="tentativeScore">The cost of reaching the grid square along the new path.</param>
+/// <param name="workspace">The workspace of the running search.</param>
+/// <param name="direction">The half of the search that reached the grid square.</param>
+/// <returns>True if the grid square must be queued with a new priority. False if the new path is not cheaper.</returns>
+bool Pathfinder::improveGridSquare(unsigned int gridIndex, unsigned int cameFrom, int tentativeScore, PathSearchWorkspace& workspace, PATH_SEARCH_DIRECTION_TYPE direction) const {
+	if (workspace.getState(gridIndex, direction) == PATH_SEARCH_NODE_OPEN) {
+		if (tentativeScore >= workspace.getScore(gridIndex, direction)) {
+			return false; // found a worse path
+		}
+	}
+	else {
+		workspace.setState(gridIndex, PATH_SEARCH_NODE_OPEN, direction);
+	}
+
+	//update or insert values for node
+	workspace.setCameFrom(gridIndex, cameFrom, direction);
+	workspace.setScore(gridIndex, tentativeScore, direction);
+	return true;
+}
+
+/// <summary>
+/// Determines if a step may pass the grid squares beside it under the corner cutting rule.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="origin">The grid square the step starts on.</param>
+/// <param name="offset">The offset of the step.</param>
+/// <returns>True if the step is allowed.</returns>
+template <typename GridReader>
+bool Pathfinder::isCornerCutAllowed(const GridReader& gridReader, const sf::Vector2i& origin, const sf::Vector2i& offset) const {
+	if (cornerCutting == PATH_CORNER_CUTTING_ALLOWED || offset.x == 0 || offset.y == 0) {
+		return true;
+	}
+	const bool isXSideBlocked = gridReader.isBlocked(sf::Vector2i(origin.x + calcSign(offset.x), origin.y));
+	const bool isYSideBlocked = gridReader.isBlocked(sf::Vector2i(origin.x, origin.y + calcSign(offset.y)));
+	if (cornerCutting == PATH_CORNER_CUTTING_FORBIDDEN) {
+		return !isXSideBlocked && !isYSideBlocked;
+	}
+	return !isXSideBlocked || !isYSideBlocked;
+}
+
+/// <summary>
+/// Gets the factor that brings scores to the scale of step lengths and heuristics.
+/// </summary>
+/// <param name="requestSearchMode">The resolved search mode of the request.</param>
+/// <returns>STEP_LENGTH_SCALE in the four neighborhood, whose steps are not scaled. 1 otherwise, and for any angle lines.</returns>
+int Pathfinder::getScoreScale(PATH_SEARCH_MODE_TYPE requestSearchMode) const {
+	return (neighborhood == PATH_NEIGHBORHOOD_FOUR && requestSearchMode != PATH_SEARCH_MODE_ANY_ANGLE) ? STEP_LENGTH_SCALE : 1;
+}
+
+/// <summary>
+/// Calculates how promising a grid square is for a path request. Lower values are explored first.
+/// The priority is the cost of reaching the grid square plus the weighted estimate of the remaining cost,
+/// with ties broken in favor of the smaller estimate.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="score">The cost to reach the grid square from the start point.</param>
+/// <param name="requestSearchMode">The resolved search mode of the request.</param>
+/// <returns>The priority of the grid square.</returns>
+std::uint64_t Pathfinder::calcGridSquarePriority(const sf::Vector2i& gridSquare, const sf::Vector2i& endPoint, int score, PATH_SEARCH_MODE_TYPE requestSearchMode) const {
+	const std::uint64_t scaledScore = static_cast<std::uint64_t>(score) * static_cast<std::uint64_t>(getScoreScale(requestSearchMode));
+	const std::uint64_t estimate = calcHeuristic(gridSquare, endPoint, requestSearchMode);
+	const std::uint64_t estimatedCost = scaledScore + static_cast<std::uint64_t>(static_cast<double>(estimate) * heuristicWeight);
+	const std::uint64_t tieBreak = std::min(estimate, (std::uint64_t{1} << TIE_BREAK_BITS) - 1);
+	return (estimatedCost << TIE_BREAK_BITS) | tieBreak;
+}
+
+/// <summary>
+/// Estimates the cost of reaching the end point, scaled by STEP_LENGTH_SCALE.
+/// Distances are multiplied by the cheapest weight of the grid, as no step costs less than its length times that weight.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="endPoint">The end point of the path request.</param>
+/// <param name="requestSearchMode">The resolved search mode of the request.</param>
+/// <returns>The estimated cost.</returns>
+std::uint64_t Pathfinder::calcHeuristic(const sf::Vector2i& gridSquare, const sf::Vector2i& endPoint, PATH_SEARCH_MODE_TYPE requestSearchMode) const {
+	const std::uint64_t xDistance = static_cast<std::uint64_t>(std::abs(gridSquare.x - endPoint.x));
+	const std::uint64_t yDistance = static_cast<std::uint64_t>(std::abs(gridSquare.y - endPoint.y));
+	const std::uint64_t weight = static_cast<std::uint64_t>(minGridWeight);
+	const std::uint64_t straightStep = STEP_LENGTH_SCALE;
+	const std::uint64_t diagonalStep = DIAGONAL_STEP_LENGTH;
+	switch (resolveHeuristic(requestSearchMode)) {
+	case PATH_HEURISTIC_MANHATTAN:
+		return straightStep * (xDistance + yDistance) * weight;
+	case PATH_HEURISTIC_OCTILE:
+		// every diagonal step replaces two straight steps
+		return (straightStep * std::max(xDistance, yDistance) + (diagonalStep - straightStep) * std::min(xDistance, yDistance)) * weight;
+	case PATH_HEURISTIC_EUCLIDEAN:
+		return static_cast<std::uint64_t>(std::sqrt(static_cast<double>(xDistance * xDistance + yDistance * yDistance)) * customHeuristicScale * minGridWeight);
+	case PATH_HEURISTIC_LANDMARK:
+		// both bounds never overestimate, so neither does the larger one. Landmark costs are already weighted.
+		return straightStep * std::max((xDistance + yDistance) * weight, static_cast<std::uint64_t>(landmarkTable->calcLowerBound(gridSquare, endPoint)));
+	default:
+		return 0;
+	}
+}
+
+/// <summary>
+/// Chooses the heuristic for PATH_HEURISTIC_AUTOMATIC, and replaces PATH_HEURISTIC_LANDMARK when the landmark table can not be used.
+/// Any angle lines are shorter than steps, so only the straight line distance never overestimates them.
+/// </summary>
+/// <param name="requestSearchMode">The resolved search mode of the request.</param>
+/// <returns>The heuristic used by searches.</returns>
+PATH_HEURISTIC_TYPE Pathfinder::resolveHeuristic(PATH_SEARCH_MODE_TYPE requestSearchMode) const {
+	const bool isAnyAngle = (requestSearchMode == PATH_SEARCH_MODE_ANY_ANGLE);
+	if (heuristic != PATH_HEURISTIC_AUTOMATIC && (heuristic != PATH_HEURISTIC_LANDMARK || (isLandmarkTableUsable() && !isAnyAngle))) {
+		return heuristic;
+	}
+	if (isAnyAngle) {
+		return PATH_HEURISTIC_EUCLIDEAN;
+	}
+	switch (neighborhood) {
+	case PATH_NEIGHBORHOOD_FOUR:
+		return isLandmarkTableUsable() ? PATH_HEURISTIC_LANDMARK : PATH_HEURISTIC_MANHATTAN;
+	case PATH_NEIGHBORHOOD_EIGHT:
+		return PATH_HEURISTIC_OCTILE;
+	default:
+		return PATH_HEURISTIC_EUCLIDEAN;
+	}
+}
+
+/// <summary>
+/// Recalculates the scaled length of each neighbor offset after the neighborhood changed.
+/// Searches that depended on the previous neighborhood are discarded.
+/// </summary>
+void Pathfinder::updateNeighborSteps() {
+	neighborStepLengths.clear();
+	customHeuristicScale = STEP_LENGTH_SCALE;
+	for (const sf::Vector2i& offset : neighborOffsets) {
+		const double length = std::hypot(offset.x, offset.y);
+		const int stepLength = (std::abs(offset.x) == 1 && std::abs(offset.y) == 1) ? DIAGONAL_STEP_LENGTH : std::max(static_cast<int>(std::lround(length * STEP_LENGTH_SCALE)), 1);
+		neighborStepLengths.push_back(stepLength);
+		customHeuristicScale = std::min(customHeuristicScale, stepLength / length);
+	}
+
+	// cached paths and running searches used the previous neighborhood
+	pathCache.invalidate();
+	isTimeSlicedSearchStarted = false;
+}
+
+/// <summary>
+/// Finds the cheapest weight of the searched grid, which scales the heuristics.
+/// Only scans the grid after the grid or the unit radius changed, since the grid is usually filled after it is set.
+/// Later edits are tracked by updateGridSquares, which is why weights edited in place must be reported there.
+/// Grids without an unblocked grid square and negative weights are treated as weighing 0.
+/// </summary>
+void Pathfinder::updateMinGridWeight() const {
+	if (!isMinGridWeightStale || !hasNavigationGrid()) {
+		return;
+	}
 
-				//update or insert values for node
-				cameFrom.insert_or_assign(neighbor, current);
-				score.insert_or_assign(neighbor, tentativeScore);
+	minGridWeight = visitGridReader([](const auto& gridReader) {
+		int minWeight = BLOCKED_GRID_WEIGHT;
+		const sf::Vector2u& gridSize = gridReader.getGridSize();
+		for (unsigned int x = 0; x < gridSize.x; ++x) {
+			for (unsigned int y = 0; y < gridSize.y; ++y) {
+				minWeight = std::min(minWeight, gridReader.getWeight(sf::Vector2i(static_cast<int>(x), static_cast<int>(y))));
 			}
 		}
+		return minWeight;
+	});
+	if (minGridWeight >= BLOCKED_GRID_WEIGHT) {
+		minGridWeight = 0;
 	}
+	minGridWeight = std::max(minGridWeight, 0);
+	isMinGridWeightStale = false;
 }
 
+/// <summary>
+/// Determines if the landmark table bounds paths on the navigation grid.
+/// Its costs are four neighborhood costs, and it must have been built for a grid of the same size.
+/// </summary>
+/// <returns>True if a landmark table is set and can be used.</returns>
+bool Pathfinder::isLandmarkTableUsable() const {
+	if (landmarkTable == nullptr || landmarkTable->getLandmarkCount() == 0 || !hasNavigationGrid() || neighborhood != PATH_NEIGHBORHOOD_FOUR) {
+		return false;
+	}
+	return landmarkTable->getGridSize() == sf::Vector2u(getGridSizeX(), getGridSizeY());
+}
 
-// private helper functions
+/// <summary>
+/// Determines if the reachability index labels the searched grid and agrees with the neighborhood about which grid squares are connected.
+/// The index connects grid squares that share a side, which steps past corners or over grid squares could bypass.
+/// Only an index built from the searched NavigationGrid at its current size is used, so swapping grids never rejects reachable requests.
+/// </summary>
+/// <returns>True if a reachability index is set and can be used.</returns>
+bool Pathfinder::isReachabilityIndexUsable() const {
+	if (reachabilityIndex == nullptr || !reachabilityIndex->isBuiltFor(navigationGrid)) {
+		return false;
+	}
+	return neighborhood == PATH_NEIGHBORHOOD_FOUR || (neighborhood == PATH_NEIGHBORHOOD_EIGHT && cornerCutting == PATH_CORNER_CUTTING_FORBIDDEN);
+}
 
 /// <summary>
-/// Chooses the next grid square for pathFind based on the pathRequest and the available grid squares.
+/// Prepares the workspaces and the grid caches for a batch of path requests.
 /// </summary>
-/// <param name="pathRequest">The path request.</param>
-/// <param name="gridSquares">The available gridSquares.</param>
-/// <returns>coordinates of the best available grid square for the passed pathRequest.</returns>
-sf::Vector2i Pathfinder::chooseNextGridSquare(const PathRequest& pathRequest, const std::set<sf::Vector2i, IsVector2Less<int>>& availableGridSquares, std::map<sf::Vector2i, int, IsVector2Less<int>>& score) const {
-	unsigned int shortestDistance = UINT_MAX;
-	sf::Vector2i bestGridSquare = {-1, -1};
-	for (const sf::Vector2i& gridSquare : availableGridSquares) {
-		unsigned int gridSquareDistance = GB::calcSquaredDistance2D<int>(gridSquare, pathRequest.end);
-		gridSquareDistance *= score.at(gridSquare);
-		if (gridSquareDistance < shortestDistance) {
-			shortestDistance = gridSquareDistance;
-			bestGridSquare = gridSquare;
+/// <param name="pathRequests">The path requests of the batch.</param>
+/// <returns>The number of workers that search the batch. Zero if the batch is empty.</returns>
+unsigned int Pathfinder::prepareBatch(const std::vector<PathRequest>& pathRequests) const {
+	for (PathSearchWorkspace& workspace : workspaces) {
+		workspace.resetSearchCounters();
+	}
+
+	// never start more workers than there are requests
+	const unsigned int workerCount = static_cast<unsigned int>(std::min<std::size_t>(getWorkerThreadCount(), pathRequests.size()));
+	if (workerCount == 0) {
+		return 0;
+	}
+
+	prepareWorkspaces(workerCount);
+	updateMinGridWeight();
+
+	// jump point searches share the jump distances of the grid, so they are found before any search starts
+	if (std::any_of(pathRequests.begin(), pathRequests.end(), [this](const PathRequest& pathRequest) { return isJumpPointSearch(pathRequest); })) {
+		updateJumpDistances();
+	}
+	return workerCount;
+}
+
+/// <summary>
+/// Searches every request of a batch that was not answered by the path cache.
+/// </summary>
+/// <param name="batch">The batch. Its workspaces must be prepared.</param>
+void Pathfinder::searchBatch(const PathBatch& batch) const {
+	const std::vector<PathRequest>& pathRequests = *batch.pathRequests;
+
+	//find result for each path request on the calling thread
+	if (batch.workerCount == 1) {
+		for (std::size_t i = 0; i < pathRequests.size(); i++) {
+			if (!isCachedRequest(i)) {
+				findPath(pathRequests[i], workspaces[0]);
+				storeFoundPath(batch, i, 0);
+			}
+		}
+		return;
+	}
+
+	// split the batch into one contiguous range for each worker
+	for (unsigned int workerIndex = 0; workerIndex < batch.workerCount; ++workerIndex) {
+		requestRanges[workerIndex].next = pathRequests.size() * workerIndex / batch.workerCount;
+		requestRanges[workerIndex].end = pathRequests.size() * (workerIndex + 1) / batch.workerCount;
+	}
+
+	//find result for each path request on the worker threads
+	// the job only captures this, so wrapping it in a std::function does not allocate
+	const PathBatch* const batchPtr = &batch;
+	workerPool->runOnAllWorkers([this, batchPtr](unsigned int workerIndex) {
+		if (workerIndex >= batchPtr->workerCount) {
+			return;
 		}
+		PathSearchWorkspace& workspace = workspaces[workerIndex];
+
+		// finish this worker's own range first, then steal from the ranges of the other workers
+		for (unsigned int rangeOffset = 0; rangeOffset < batchPtr->workerCount; ++rangeOffset) {
+			PathRequestRange& requestRange = requestRanges[(workerIndex + rangeOffset) % batchPtr->workerCount];
+			for (std::size_t i = requestRange.next++; i < requestRange.end; i = requestRange.next++) {
+				if (!isCachedRequest(i)) {
+					findPath((*batchPtr->pathRequests)[i], workspace);
+					storeFoundPath(*batchPtr, i, workerIndex);
+				}
+			}
+		}
+	});
+}
+
+/// <summary>
+/// Stores the path a worker found for a request of a batch.
+/// </summary>
+/// <param name="batch">The batch.</param>
+/// <param name="requestIndex">The index of the request in the batch.</param>
+/// <param name="workerIndex">The worker that found the path. Its workspace holds the path.</param>
+void Pathfinder::storeFoundPath(const PathBatch& batch, std::size_t requestIndex, unsigned int workerIndex) const {
+	const std::vector<sf::Vector2i>& reversedPath = workspaces[workerIndex].getPathBuffer();
+	if (batch.returnedPaths != nullptr) {
+		(*batch.returnedPaths)[requestIndex].assign(reversedPath.rbegin(), reversedPath.rend());
+		return;
 	}
+	PackedPathBatch& packedPaths = workerPackedPaths[workerIndex];
+	packedPathLocations[requestIndex] = PackedPathLocation{workerIndex, packedPaths.getPathCount()};
+	packedPaths.appendPath(reversedPath.rbegin(), reversedPath.rend());
+}
 
-	return bestGridSquare;
+/// <summary>
+/// Fits one workspace for each worker to the navigation grid. Only allocates when a workspace does not fit yet.
+/// </summary>
+/// <param name="workerCount">The number of workers that need a workspace.</param>
+void Pathfinder::prepareWorkspaces(unsigned int workerCount) const {
+	if (workspaces.size() < workerCount) {
+		workspaces.resize(workerCount);
+	}
+	const std::size_t gridSize = static_cast<std::size_t>(getGridSizeX()) * getGridSizeY();
+	for (unsigned int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+		if (workspaces[workerIndex].fitToGridSize(gridSize)) {
+			++workspaceAllocationCount;
+		}
+	}
 }
 
+// private helper functions
+
 /// <summary>
 /// Gets the neighbors of a gridSquare.
 /// </summary>
 /// <param name="gridCoordinate">The coordinate of the grid square to get neighbors for.</param>
-/// <returns>Vector containing all valid neighbors of the grid square at the passed coordinate.</returns>
-std::vector<sf::Vector2i> Pathfinder::getNeighbors(const sf::Vector2i & gridCoordinate) const {
+/// <param name="neighbors">Output vector. Replaced with all valid neighbors of the grid square at the passed coordinate.</param>
+void Pathfinder::getNeighbors(const sf::Vector2i & gridCoordinate, std::vector<sf::Vector2i>& neighbors) const {
+	visitGridReader([&](const auto& gridReader) {
+		getNeighbors(gridReader, gridCoordinate, neighbors);
+	});
+}
+
+/// <summary>
+/// Gets the neighbors of a gridSquare of the grid read by the passed reader, like getNeighbors.
+/// </summary>
+/// <param name="gridReader">Reads the searched grid.</param>
+/// <param name="gridCoordinate">The coordinate of the grid square to get neighbors for.</param>
+/// <param name="neighbors">Output vector. Replaced with all valid neighbors of the grid square at the passed coordinate.</param>
+template <typename GridReader>
+void Pathfinder::getNeighbors(const GridReader& gridReader, const sf::Vector2i & gridCoordinate, std::vector<sf::Vector2i>& neighbors) const {
 
 	//find the bounds of the active navigation grid
-	int maxX = navigationGrid->getArraySizeX();
-	int maxY = navigationGrid->getArraySizeY();
-	std::vector<sf::Vector2i> neighbors;
+	const int maxX = static_cast<int>(gridReader.getGridSize().x);
+	const int maxY = static_cast<int>(gridReader.getGridSize().y);
+	neighbors.clear();
 
 	bool xUp = (gridCoordinate.x + 1 < maxX);
 	bool xDown = (gridCoordinate.x - 1 >= 0);
@@ -179,30 +2254,134 @@ std::vector<sf::Vector2i> Pathfinder::getNeighbors(const sf::Vector2i & gridCoor
 	if (yDown) {
 		neighbors.emplace_back(sf::Vector2i{gridCoordinate.x, gridCoordinate.y - 1});
 	}
-
-
-	return neighbors;
-
 }
 
 /// <summary>
 /// Reconstructs the path of grid squares to the endpoint.
+/// The path is walked back from the end point, so its grid squares are stored from the end back to the start.
 /// </summary>
-/// <param name="endPoint">The end point.</param>
-/// <param name="cameFrom">A map containing each grid square's predecessor from.</param>
-/// <returns>A vector of grid square indexes representing an in-order path to the passed endPoint.</returns>
-std::deque<sf::Vector2i> Pathfinder::reconstructPath(const sf::Vector2i& endPoint, const std::map<sf::Vector2i, sf::Vector2i, IsVector2Less<int>>& cameFrom) const {
-	
-	std::deque<sf::Vector2i> inOrderPath;
+/// <param name="endIndex">The flattened coordinate of the end point.</param>
+/// <param name="workspace">The workspace of the finished search. Holds each grid square's predecessor. Its path buffer receives the grid squares of the path.</param>
+/// <param name="requestSearchMode">The resolved search mode of the request.</param>
+void Pathfinder::reconstructPath(unsigned int endIndex, PathSearchWorkspace& workspace, PATH_SEARCH_MODE_TYPE requestSearchMode) const {
+	std::vector<sf::Vector2i>& reversedPath = workspace.getPathBuffer();
 
 	//add grid squares until the beginning (grid square that did not come from anywhere) is found
 	// do not add first grid square. the path-finding object is already there.
-	auto foundSquare = cameFrom.find(endPoint);
-	while (foundSquare != cameFrom.end()) {
-		inOrderPath.push_front(foundSquare->first);
-		foundSquare = cameFrom.find(foundSquare->second);
+	// jump points are connected by straight lines, so fill in the grid squares between them
+	unsigned int foundSquare = endIndex;
+	while (workspace.getCameFrom(foundSquare) != PathSearchWorkspace::NO_NODE) {
+		const sf::Vector2i cameFrom = expandGridIndex(workspace.getCameFrom(foundSquare));
+		sf::Vector2i gridSquare = expandGridIndex(foundSquare);
+		if (neighborhood == PATH_NEIGHBORHOOD_CUSTOM || requestSearchMode == PATH_SEARCH_MODE_ANY_ANGLE) {
+			reversedPath.push_back(gridSquare); // custom steps and any angle lines may jump over grid squares on purpose
+		}
+		else {
+			const sf::Vector2i step{calcSign(cameFrom.x - gridSquare.x), calcSign(cameFrom.y - gridSquare.y)};
+			while (gridSquare != cameFrom) {
+				reversedPath.push_back(gridSquare);
+				gridSquare += step;
+			}
+		}
+		foundSquare = workspace.getCameFrom(foundSquare);
+	}
+}
+
+/// <summary>
+/// Reconstructs the path of a bidirectional search from the grid square where its halves meet.
+/// </summary>
+/// <param name="workspace">The workspace of the finished search. Holds the meeting grid square. Its path buffer receives the grid squares of the path, from the end back to the start.</param>
+void Pathfinder::reconstructBidirectionalPath(PathSearchWorkspace& workspace) const {
+	// the reverse half leads from the meeting grid square on to the end, and the forward half back to the start
+	std::vector<sf::Vector2i>& reversedPath = workspace.getPathBuffer();
+	const unsigned int meetingNode = workspace.getMeetingNode();
+	for (unsigned int node = workspace.getCameFrom(meetingNode, PATH_SEARCH_DIRECTION_REVERSE); node != PathSearchWorkspace::NO_NODE;
+		node = workspace.getCameFrom(node, PATH_SEARCH_DIRECTION_REVERSE)) {
+		reversedPath.push_back(expandGridIndex(node));
 	}
-	return inOrderPath;
+	std::reverse(reversedPath.begin(), reversedPath.end());
+	reconstructPath(meetingNode, workspace, PATH_SEARCH_MODE_BIDIRECTIONAL);
 }
 
+/// <summary>
+/// Determines if a navigation grid of any kind is set.
+/// </summary>
+/// <returns>True if a grid can be searched.</returns>
+bool Pathfinder::hasNavigationGrid() const {
+	return navigationGrid != nullptr || denseNavigationGrid != nullptr || compactNavigationGrid != nullptr || chunkedNavigationGrid != nullptr;
+}
+
+/// <summary>
+/// Gets the size of the searched grid in the x dimension.
+/// </summary>
+/// <returns>The number of grid squares along x.</returns>
+unsigned int Pathfinder::getGridSizeX() const {
+	if (denseNavigationGrid != nullptr) {
+		return denseNavigationGrid->getArraySizeX();
+	}
+	if (compactNavigationGrid != nullptr) {
+		return compactNavigationGrid->getArraySizeX();
+	}
+	if (chunkedNavigationGrid != nullptr) {
+		return chunkedNavigationGrid->getArraySizeX();
+	}
+	return navigationGrid->getArraySizeX();
+}
+
+/// <summary>
+/// Gets the size of the searched grid in the y dimension.
+/// </summary>
+/// <returns>The number of grid squares along y.</returns>
+unsigned int Pathfinder::getGridSizeY() const {
+	if (denseNavigationGrid != nullptr) {
+		return denseNavigationGrid->getArraySizeY();
+	}
+	if (compactNavigationGrid != nullptr) {
+		return compactNavigationGrid->getArraySizeY();
+	}
+	if (chunkedNavigationGrid != nullptr) {
+		return chunkedNavigationGrid->getArraySizeY();
+	}
+	return navigationGrid->getArraySizeY();
+}
+
+/// <summary>
+/// Determines if a coordinate is within the searched grid.
+/// </summary>
+/// <param name="gridCoordinate">The coordinate.</param>
+/// <returns>True if the coordinate is a grid square.</returns>
+bool Pathfinder::isInGrid(const sf::Vector2i& gridCoordinate) const {
+	return GB::isInGrid(gridCoordinate, sf::Vector2u(getGridSizeX(), getGridSizeY()));
+}
+
+/// <summary>
+/// Gets the weight of a grid square.
+/// Grid squares without room for the unit radius weigh BLOCKED_GRID_WEIGHT.
+/// Searches read the grid through a GridSquareReader instead, which does not check which kind of grid is set on every read.
+/// </summary>
+/// <param name="gridCoordinate">The coordinate of the grid square. Must be within the navigation grid.</param>
+/// <returns></returns>
+int Pathfinder::getGridWeight(const sf::Vector2i& gridCoordinate) const {
+	return visitGridReader([&gridCoordinate](const auto& gridReader) {
+		return gridReader.getWeight(gridCoordinate);
+	});
+}
+
+/// <summary>
+/// Flattens a coordinate of the navigation grid into an index for the per grid square search storage.
+/// Uses the same x major ordering as Array2D, so lower indexes are also lower according to IsVector2Less.
+/// </summary>
+/// <param name="gridCoordinate">The coordinate. Must be within the navigation grid.</param>
+/// <returns>The flattened index of the coordinate.</returns>
+unsigned int Pathfinder::flattenGridCoordinate(const sf::Vector2i& gridCoordinate) const {
+	return GB::flattenGridCoordinate(gridCoordinate, getGridSizeY());
+}
 
+/// <summary>
+/// Converts a flattened index back into a coordinate of the navigation grid.
+/// </summary>
+/// <param name="gridIndex">The flattened index.</param>
+/// <returns>The coordinate of the grid square.</returns>
+sf::Vector2i Pathfinder::expandGridIndex(unsigned int gridIndex) const {
+	return GB::expandGridIndex(gridIndex, getGridSizeY());
+}
@@ -0,0 +1,250 @@
+#include <GameBackbone/Navigation/PathSmoother.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+
+#include <algorithm>
+#include <climits>
+
+using namespace GB;
+
+namespace {
+
+	/// <summary>
+	/// Checks if a grid square continues the line through two others in the same direction.
+	/// </summary>
+	/// <param name="first">The first grid square of the line.</param>
+	/// <param name="middle">The grid square after the first.</param>
+	/// <param name="last">The grid square after the middle.</param>
+	/// <returns>True if the step from the middle points the same way as the step to it. False otherwise.</returns>
+	bool isCollinear(const sf::Vector2i& first, const sf::Vector2i& middle, const sf::Vector2i& last) {
+		const sf::Vector2i inStep = middle - first;
+		const sf::Vector2i outStep = last - middle;
+		const int crossProduct = inStep.x * outStep.y - inStep.y * outStep.x;
+		const int dotProduct = inStep.x * outStep.x + inStep.y * outStep.y;
+		return crossProduct == 0 && dotProduct > 0;
+	}
+
+	/// <summary>
+	/// Evaluates a uniform Catmull-Rom spline between two points.
+	/// </summary>
+	/// <param name="beforeStart">The point before the start of the segment.</param>
+	/// <param name="segmentStart">The point the curve passes at t = 0.</param>
+	/// <param name="segmentEnd">The point the curve passes at t = 1.</param>
+	/// <param name="afterEnd">The point after the end of the segment.</param>
+	/// <param name="t">How far along the segment to evaluate. In [0, 1].</param>
+	/// <returns>The point of the curve.</returns>
+	sf::Vector2f evaluateCatmullRom(const sf::Vector2f& beforeStart,
+									const sf::Vector2f& segmentStart,
+									const sf::Vector2f& segmentEnd,
+									const sf::Vector2f& afterEnd,
+									float t) {
+		const float tSquared = t * t;
+		const float tCubed = tSquared * t;
+		return 0.5f * ((2.0f * segmentStart) +
+					   (segmentEnd - beforeStart) * t +
+					   (2.0f * beforeStart - 5.0f * segmentStart + 4.0f * segmentEnd - afterEnd) * tSquared +
+					   (3.0f * segmentStart - beforeStart - 3.0f * segmentEnd + afterEnd) * tCubed);
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PathSmoother"/> class without a navigation grid.
+/// </summary>
+PathSmoother::PathSmoother() : PathSmoother(nullptr) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="PathSmoother"/> class.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid the paths were found in.</param>
+PathSmoother::PathSmoother(NavigationGrid* newNavigationGrid) : navigationGrid(newNavigationGrid) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid the paths were found in.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid.</param>
+void PathSmoother::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid the paths were found in.
+/// </summary>
+/// <returns>The navigation grid.</returns>
+NavigationGrid* PathSmoother::getNavigationGrid() {
+	return navigationGrid;
+}
+
+//operations
+
+/// <summary>
+/// Removes the waypoints that do not change the direction of a path.
+/// Does not need the navigation grid.
+/// </summary>
+/// <param name="start">The grid square the path starts from.</param>
+/// <param name="path">The path without its start. Keeps only the waypoints the path turns at and its end.</param>
+void PathSmoother::removeCollinearWaypoints(const sf::Vector2i& start, std::deque<sf::Vector2i>& path) const {
+	if (path.size() < 2) {
+		return;
+	}
+
+	// compact the kept waypoints to the front of the path
+	sf::Vector2i previous = start;
+	std::size_t keptCount = 0;
+	for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+		const sf::Vector2i current = path[i];
+		if (!isCollinear(previous, current, path[i + 1])) {
+			path[keptCount] = current;
+			++keptCount;
+		}
+		previous = current;
+	}
+	path[keptCount] = path.back();
+	path.resize(keptCount + 1);
+}
+
+/// <summary>
+/// Replaces the parts of a path that can be walked in a straight line by that line.
+/// A waypoint is skipped if the line past it only crosses grid squares that are no heavier than the heaviest grid square of
+/// the part of the path the line replaces. Only the waypoints the path turns at are tested, so the number of line of sight
+/// checks grows with the number of turns instead of the length of the path.
+/// </summary>
+/// <param name="start">The grid square the path starts from.</param>
+/// <param name="path">The path without its start. Keeps the waypoints a straight line can not reach past and its end.</param>
+void PathSmoother::pullStrings(const sf::Vector2i& start, std::deque<sf::Vector2i>& path) const {
+	if (path.size() < 2) {
+		return;
+	}
+
+	std::deque<sf::Vector2i> pulledPath;
+	sf::Vector2i anchor = start; // the last waypoint kept
+	sf::Vector2i lastVisible = start; // the last turn a straight line from the anchor reaches
+	int anchorMaxWeight = INT_MIN; // the heaviest grid square of the path from the anchor to the last visible turn
+	int runMaxWeight = INT_MIN; // the heaviest grid square of the path after the last visible turn
+	sf::Vector2i previous = start;
+	for (std::size_t i = 0; i < path.size(); ++i) {
+		const sf::Vector2i current = path[i];
+		runMaxWeight = std::max(runMaxWeight, getGridWeight(*navigationGrid, current));
+		const bool isTurn = (i + 1 == path.size()) || !isCollinear(previous, current, path[i + 1]);
+		previous = current;
+		if (!isTurn) {
+			continue;
+		}
+
+		// the first turn after the anchor is reached by the straight run of the path itself
+		const int maxWeight = std::max(anchorMaxWeight, runMaxWeight);
+		if (lastVisible != anchor && !hasLineOfSight(*navigationGrid, anchor, current, maxWeight)) {
+			pulledPath.push_back(lastVisible);
+			anchor = lastVisible;
+			anchorMaxWeight = runMaxWeight;
+		}
+		else {
+			anchorMaxWeight = maxWeight;
+		}
+		lastVisible = current;
+		runMaxWeight = INT_MIN;
+	}
+	pulledPath.push_back(path.back());
+	path.swap(pulledPath);
+}
+
+/// <summary>
+/// Pulls the strings of every path found for a group of path requests.
+/// </summary>
+/// <param name="pathRequests">The path requests the paths were found for.</param>
+/// <param name="paths">The paths in the same order as their requests.</param>
+void PathSmoother::pullStrings(const std::vector<PathRequest>& pathRequests, std::vector<std::deque<sf::Vector2i>>* const paths) const {
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		pullStrings(pathRequests[i].start, (*paths)[i]);
+	}
+}
+
+/// <summary>
+/// Turns a path in window coordinates into a Catmull-Rom curve through its waypoints.
+/// Each segment of the path is split into several points on the curve. A segment stays straight if its curve would touch a
+/// grid square that is heavier than both of its ends, so curves do not bulge into blockers.
+/// Works best on paths whose strings were pulled.
+/// </summary>
+/// <param name="start">The window position the path starts from.</param>
+/// <param name="path">The path without its start.</param>
+/// <param name="converter">Converts between the window and the navigation grid.</param>
+/// <param name="smoothedPath">Cleared. Filled with the points of the curve without the start. Ends at the end of the path.</param>
+/// <param name="samplesPerSegment">The number of points each segment is split into. One or less copies the path.</param>
+void PathSmoother::smoothPath(const sf::Vector2f& start,
+							  const WindowCoordinatePath& path,
+							  const CoordinateConverter& converter,
+							  WindowCoordinatePath& smoothedPath,
+							  unsigned int samplesPerSegment) const {
+	smoothedPath.clear();
+	if (samplesPerSegment <= 1) {
+		smoothedPath = path;
+		return;
+	}
+
+	for (std::size_t i = 0; i < path.size(); ++i) {
+		const sf::Vector2f& segmentStart = (i == 0) ? start : path[i - 1];
+		const sf::Vector2f& segmentEnd = path[i];
+
+		// the ends of the path are repeated so the curve starts and ends in them
+		const sf::Vector2f& beforeStart = (i < 2) ? start : path[i - 2];
+		const sf::Vector2f& afterEnd = (i + 1 < path.size()) ? path[i + 1] : segmentEnd;
+
+		if (isCurveClear(beforeStart, segmentStart, segmentEnd, afterEnd, converter, samplesPerSegment)) {
+			for (unsigned int sample = 1; sample < samplesPerSegment; ++sample) {
+				const float t = static_cast<float>(sample) / static_cast<float>(samplesPerSegment);
+				smoothedPath.push_back(evaluateCatmullRom(beforeStart, segmentStart, segmentEnd, afterEnd, t));
+			}
+		}
+		smoothedPath.push_back(segmentEnd);
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Checks if the curve of one segment stays in grid squares that are no heavier than the ends of the segment.
+/// </summary>
+/// <param name="beforeStart">The point before the start of the segment.</param>
+/// <param name="segmentStart">The start of the segment.</param>
+/// <param name="segmentEnd">The end of the segment.</param>
+/// <param name="afterEnd">The point after the end of the segment.</param>
+/// <param name="converter">Converts between the window and the navigation grid.</param>
+/// <param name="samplesPerSegment">The number of points the segment is split into.</param>
+/// <returns>True if a line of sight connects every point of the curve to the next. False otherwise.</returns>
+bool PathSmoother::isCurveClear(const sf::Vector2f& beforeStart,
+								const sf::Vector2f& segmentStart,
+								const sf::Vector2f& segmentEnd,
+								const sf::Vector2f& afterEnd,
+								const CoordinateConverter& converter,
+								unsigned int samplesPerSegment) const {
+	const sf::Vector2i startSquare = converter.convertCoordToNavGrid(segmentStart);
+	const sf::Vector2i endSquare = converter.convertCoordToNavGrid(segmentEnd);
+	const sf::Vector2u gridSize(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	if (!isInGrid(startSquare, gridSize) || !isInGrid(endSquare, gridSize)) {
+		return false;
+	}
+
+	// a blocked start only allows leaving it, so it does not raise the limit
+	const int startWeight = getGridWeight(*navigationGrid, startSquare);
+	const int endWeight = getGridWeight(*navigationGrid, endSquare);
+	const int maxWeight = (startWeight >= BLOCKED_GRID_WEIGHT) ? endWeight : std::max(startWeight, endWeight);
+
+	sf::Vector2i previousSquare = startSquare;
+	for (unsigned int sample = 1; sample < samplesPerSegment; ++sample) {
+		const float t = static_cast<float>(sample) / static_cast<float>(samplesPerSegment);
+		const sf::Vector2i sampleSquare = converter.convertCoordToNavGrid(evaluateCatmullRom(beforeStart, segmentStart, segmentEnd, afterEnd, t));
+		if (!isInGrid(sampleSquare, gridSize) || !hasLineOfSight(*navigationGrid, previousSquare, sampleSquare, maxWeight)) {
+			return false;
+		}
+		previousSquare = sampleSquare;
+	}
+	return hasLineOfSight(*navigationGrid, previousSquare, endSquare, maxWeight);
+}
@@ -0,0 +1,291 @@
+#include <GameBackbone/Navigation/PathfindingService.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+using namespace GB;
+
+namespace {
+
+	/// The number of grid squares a worker expands between checks for cancellation of its current request.
+	constexpr std::size_t EXPANSIONS_PER_CANCEL_CHECK = 256;
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Creates a PathfindingService that searches a copy of the passed navigation grid, and starts its threads.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid to copy. May be null, in which case no path is found until the snapshot is updated.</param>
+/// <param name="threadCount">The number of background threads. At least one thread is started.</param>
+PathfindingService::PathfindingService(NavigationGrid* navigationGrid, unsigned int threadCount) :
+	isStopping(false),
+	lastPathRequestHandle(0),
+	snapshot(copyNavigationGrid(navigationGrid)) {
+	threadCount = std::max(threadCount, 1u);
+	threads.reserve(threadCount);
+	for (unsigned int threadIndex = 0; threadIndex < threadCount; ++threadIndex) {
+		threads.emplace_back(&PathfindingService::runWorker, this);
+	}
+}
+
+/// <summary>
+/// Stops the background threads. Requests that were not delivered yet are canceled.
+/// </summary>
+PathfindingService::~PathfindingService() {
+	{
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		isStopping = true;
+		for (auto& job : jobs) {
+			job.second->isCanceled = true;
+		}
+	}
+	jobQueued.notify_all();
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	// never leave a future without a value
+	for (auto& job : jobs) {
+		if (!job.second->callback) {
+			job.second->promise.set_value(NavGridCoordinatePath());
+		}
+	}
+}
+
+//getters
+
+/// <summary>
+/// Gets the number of background threads.
+/// </summary>
+/// <returns></returns>
+unsigned int PathfindingService::getThreadCount() const {
+	return static_cast<unsigned int>(threads.size());
+}
+
+//operations
+
+/// <summary>
+/// Replaces the copy of the navigation grid that is searched.
+/// Searches that are already running finish on the previous copy. The grid is copied on the calling thread.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid to copy. May be null.</param>
+void PathfindingService::updateSnapshot(NavigationGrid* navigationGrid) {
+	std::shared_ptr<GridSnapshot> newSnapshot = copyNavigationGrid(navigationGrid);
+	std::lock_guard<std::mutex> lock(serviceMutex);
+	snapshot = std::move(newSnapshot);
+}
+
+/// <summary>
+/// Queues a path request. The returned future receives the path once the search finished.
+/// A canceled request receives an empty path.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="priority">The priority of the request.</param>
+/// <returns>The handle of the request and the future of its path.</returns>
+PathfindingService::PendingPath PathfindingService::requestPath(const PathRequest& pathRequest, PATH_REQUEST_PRIORITY_TYPE priority) {
+	std::shared_ptr<PathJob> job = std::make_shared<PathJob>();
+	job->pathRequest = pathRequest;
+	std::future<NavGridCoordinatePath> path = job->promise.get_future();
+	const PathRequestHandle handle = queueJob(std::move(job), priority);
+	return PendingPath{handle, std::move(path)};
+}
+
+/// <summary>
+/// Queues a path request. The callback receives the path during the first call to dispatchCompletedPaths after the search finished,
+/// on the thread calling dispatchCompletedPaths. The callback of a canceled request is never called.
+/// </summary>
+/// <param name="pathRequest">The requirements for the path.</param>
+/// <param name="priority">The priority of the request.</param>
+/// <param name="callback">Receives the path of the request.</param>
+/// <returns>The handle of the request.</returns>
+PathRequestHandle PathfindingService::requestPath(const PathRequest& pathRequest, PATH_REQUEST_PRIORITY_TYPE priority, PathCallback callback) {
+	std::shared_ptr<PathJob> job = std::make_shared<PathJob>();
+	job->pathRequest = pathRequest;
+	job->callback = std::move(callback);
+	return queueJob(std::move(job), priority);
+}
+
+/// <summary>
+/// Cancels a path request whose path was not delivered yet. A running search stops shortly after.
+/// </summary>
+/// <param name="pathRequestHandle">The handle of the request.</param>
+void PathfindingService::cancelPathRequest(PathRequestHandle pathRequestHandle) {
+	std::shared_ptr<PathJob> job;
+	{
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		const auto jobIt = jobs.find(pathRequestHandle);
+		if (jobIt == jobs.end()) {
+			return;
+		}
+		job = std::move(jobIt->second);
+		jobs.erase(jobIt);
+	}
+	job->isCanceled = true;
+	if (!job->callback) {
+		job->promise.set_value(NavGridCoordinatePath());
+	}
+}
+
+/// <summary>
+/// Calls the callbacks of every request whose search finished since the last call.
+/// Call regularly on the thread that should receive the paths, for example from the update of a region.
+/// </summary>
+/// <returns>The number of called callbacks.</returns>
+std::size_t PathfindingService::dispatchCompletedPaths() {
+	std::vector<std::shared_ptr<PathJob>> completedJobs;
+	{
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		for (PathRequestHandle handle : completedCallbackJobs) {
+			const auto jobIt = jobs.find(handle);
+			if (jobIt != jobs.end()) {
+				completedJobs.push_back(std::move(jobIt->second));
+				jobs.erase(jobIt);
+			}
+		}
+		completedCallbackJobs.clear();
+	}
+
+	// call the callbacks without holding the lock, so they may submit new requests
+	for (const std::shared_ptr<PathJob>& job : completedJobs) {
+		job->callback(job->handle, std::move(job->path));
+	}
+	return completedJobs.size();
+}
+
+// private helper functions
+
+/// <summary>
+/// Assigns a handle to a job and queues it.
+/// </summary>
+/// <param name="job">The job.</param>
+/// <param name="priority">The priority of the job.</param>
+/// <returns>The handle of the job.</returns>
+PathRequestHandle PathfindingService::queueJob(std::shared_ptr<PathJob> job, PATH_REQUEST_PRIORITY_TYPE priority) {
+	PathRequestHandle handle;
+	{
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		handle = ++lastPathRequestHandle;
+		job->handle = handle;
+		jobs.emplace(handle, job);
+		queuedJobs[priority].push_back(std::move(job));
+	}
+	jobQueued.notify_one();
+	return handle;
+}
+
+/// <summary>
+/// Runs on each background thread. Searches queued jobs until the service stops.
+/// </summary>
+void PathfindingService::runWorker() {
+	// each thread searches with its own Pathfinder, so the search storage is reused across jobs
+	Pathfinder pathfinder;
+	NavGridCoordinatePath path;
+
+	// setting a grid discards what the Pathfinder derived from the previous one, so it is only set when the snapshot was replaced.
+	// A weak reference lets replaced snapshots be freed while the thread waits, and never matches a new snapshot at a reused address.
+	std::weak_ptr<GridSnapshot> searchedSnapshot;
+	while (true) {
+		std::shared_ptr<PathJob> job;
+		std::shared_ptr<GridSnapshot> jobSnapshot;
+		{
+			std::unique_lock<std::mutex> lock(serviceMutex);
+			jobQueued.wait(lock, [this]() {
+				return isStopping || std::any_of(std::begin(queuedJobs), std::end(queuedJobs), [](const std::deque<std::shared_ptr<PathJob>>& queue) {
+					return !queue.empty();
+				});
+			});
+			if (isStopping) {
+				return;
+			}
+			job = popNextJob();
+			jobSnapshot = snapshot;
+		}
+		if (job == nullptr) {
+			continue; // every queued job was canceled
+		}
+
+		if (searchedSnapshot.lock() != jobSnapshot) {
+			pathfinder.setNavigationGrid(&jobSnapshot->navigationGrid);
+			searchedSnapshot = jobSnapshot;
+		}
+		if (searchPath(pathfinder, *job, path)) {
+			completeJob(job, path);
+		}
+	}
+}
+
+/// <summary>
+/// Removes the first job that was not canceled from the queue of the highest priority. The service mutex must be held.
+/// </summary>
+/// <returns>The job. Null if every queued job was canceled.</returns>
+std::shared_ptr<PathfindingService::PathJob> PathfindingService::popNextJob() {
+	for (std::deque<std::shared_ptr<PathJob>>& queue : queuedJobs) {
+		while (!queue.empty()) {
+			std::shared_ptr<PathJob> job = std::move(queue.front());
+			queue.pop_front();
+			if (!job->isCanceled) {
+				return job;
+			}
+		}
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Searches the path of a job in small steps, so the search stops soon after the job is canceled.
+/// </summary>
+/// <param name="pathfinder">The Pathfinder of the calling thread. Its navigation grid must be set.</param>
+/// <param name="job">The job.</param>
+/// <param name="returnedPath">The found path. Empty if no path exists.</param>
+/// <returns>True if the search finished. False if the job was canceled.</returns>
+bool PathfindingService::searchPath(Pathfinder& pathfinder, PathJob& job, NavGridCoordinatePath& returnedPath) const {
+	const PathRequestHandle searchHandle = pathfinder.requestPath(job.pathRequest);
+	while (pathfinder.getPendingPathRequestCount() > 0) {
+		if (job.isCanceled) {
+			pathfinder.cancelPathRequest(searchHandle);
+			return false;
+		}
+		pathfinder.advancePathRequests(EXPANSIONS_PER_CANCEL_CHECK);
+	}
+	return pathfinder.takePath(searchHandle, returnedPath);
+}
+
+/// <summary>
+/// Delivers the path of a finished job, unless it was canceled in the meantime.
+/// Futures receive the path immediately. Callbacks receive it during the next call to dispatchCompletedPaths.
+/// </summary>
+/// <param name="job">The job.</param>
+/// <param name="path">The found path. Moved from.</param>
+void PathfindingService::completeJob(const std::shared_ptr<PathJob>& job, NavGridCoordinatePath& path) {
+	if (job->callback) {
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		if (jobs.count(job->handle) != 0) {
+			job->path = std::move(path);
+			completedCallbackJobs.push_back(job->handle);
+		}
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(serviceMutex);
+		if (jobs.erase(job->handle) == 0) {
+			return; // canceled, so the future already has its value
+		}
+	}
+	job->promise.set_value(std::move(path));
+}
+
+/// <summary>
+/// Copies the weight and blocker distance of each grid square of a navigation grid.
+/// </summary>
+/// <param name="navigationGrid">The navigation grid. May be null, which creates an empty grid.</param>
+/// <returns>The copy.</returns>
+std::shared_ptr<PathfindingService::GridSnapshot> PathfindingService::copyNavigationGrid(NavigationGrid* navigationGrid) {
+	std::shared_ptr<GridSnapshot> gridSnapshot = std::make_shared<GridSnapshot>();
+	if (navigationGrid != nullptr) {
+		gridSnapshot->navigationGrid = DenseNavigationGrid(*navigationGrid);
+	}
+	return gridSnapshot;
+}
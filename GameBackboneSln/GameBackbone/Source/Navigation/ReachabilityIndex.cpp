@@ -0,0 +1,485 @@
+#include <GameBackbone/Navigation/ReachabilityIndex.h>
+#include <GameBackbone/Navigation/NavigationGridData.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+
+	/// The eight grid squares around a grid square in circular order. Consecutive entries are adjacent to each other.
+	/// The even entries are the adjacent grid squares.
+	const sf::Vector2i RING_OFFSETS[] = {{0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}};
+
+	/// The number of ring offsets.
+	const unsigned int RING_SIZE = 8;
+
+	/// Labels are compacted once there are this many times more labels than grid squares.
+	const std::size_t MAX_LABELS_PER_GRID_SQUARE = 2;
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="ReachabilityIndex"/> class without a navigation grid.
+/// </summary>
+ReachabilityIndex::ReachabilityIndex() : ReachabilityIndex(nullptr) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="ReachabilityIndex"/> class and labels the grid.
+/// </summary>
+/// <param name="navigationGrid">The grid to index. May be null.</param>
+ReachabilityIndex::ReachabilityIndex(NavigationGrid* newNavigationGrid) :
+	navigationGrid(newNavigationGrid),
+	indexSize(0, 0),
+	componentCount(0),
+	visitGeneration(0) {
+
+	rebuild();
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the navigation grid and labels it.
+/// </summary>
+/// <param name="newNavigationGrid">The navigation grid. May be null.</param>
+void ReachabilityIndex::setNavigationGrid(NavigationGrid* newNavigationGrid) {
+	navigationGrid = newNavigationGrid;
+	rebuild();
+}
+
+//getters
+
+/// <summary>
+/// Gets the navigation grid.
+/// </summary>
+/// <returns>NavigationGrid pointer</returns>
+NavigationGrid* ReachabilityIndex::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets the number of separate areas of unblocked grid squares.
+/// </summary>
+/// <returns></returns>
+std::size_t ReachabilityIndex::getComponentCount() const {
+	return componentCount;
+}
+
+/// <summary>
+/// Gets the area a grid square belongs to. Two grid squares are connected exactly when their components are equal.
+/// Component values may change whenever the index is updated.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square.</param>
+/// <returns>The component of the grid square. NO_COMPONENT if it is blocked or outside of the grid.</returns>
+unsigned int ReachabilityIndex::getComponent(const sf::Vector2i& gridSquare) const {
+	if (!isInGrid(gridSquare, indexSize)) {
+		return NO_COMPONENT;
+	}
+	const unsigned int label = gridSquareLabels[flattenGridCoordinate(gridSquare, indexSize.y)];
+	return (label == NO_COMPONENT) ? NO_COMPONENT : findLabel(label);
+}
+
+/// <summary>
+/// Determines if Pathfinder can find a path between two grid squares.
+/// Like Pathfinder, a blocked start can be left onto an unblocked neighbor, but a blocked end can not be reached.
+/// </summary>
+/// <param name="start">The start of the path.</param>
+/// <param name="end">The end of the path.</param>
+/// <returns>True if a path exists. False otherwise.</returns>
+bool ReachabilityIndex::isReachable(const sf::Vector2i& start, const sf::Vector2i& end) const {
+	const unsigned int endComponent = getComponent(end);
+	if (endComponent == NO_COMPONENT) {
+		return false;
+	}
+
+	const unsigned int startComponent = getComponent(start);
+	if (startComponent != NO_COMPONENT || !isInGrid(start, indexSize)) {
+		return startComponent == endComponent;
+	}
+
+	for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+		if (getComponent(start + offset) == endComponent) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/// <summary>
+/// Determines if the index labels the passed grid at its current size.
+/// </summary>
+/// <param name="otherNavigationGrid">The navigation grid.</param>
+/// <returns>True if the index was built from the passed grid and the grid has not changed size since.</returns>
+bool ReachabilityIndex::isBuiltFor(const NavigationGrid* otherNavigationGrid) const {
+	if (otherNavigationGrid == nullptr || otherNavigationGrid != navigationGrid) {
+		return false;
+	}
+	return otherNavigationGrid->getArraySizeX() == indexSize.x && otherNavigationGrid->getArraySizeY() == indexSize.y;
+}
+
+//operations
+
+/// <summary>
+/// Discards every label and labels the whole navigation grid again.
+/// </summary>
+void ReachabilityIndex::rebuild() {
+	gridSquareLabels.clear();
+	labelParents.clear();
+	labelSizes.clear();
+	componentCount = 0;
+	if (navigationGrid == nullptr) {
+		indexSize = sf::Vector2u(0, 0);
+		visitGenerations.clear();
+		visitSearches.clear();
+		return;
+	}
+
+	indexSize = sf::Vector2u(navigationGrid->getArraySizeX(), navigationGrid->getArraySizeY());
+	const std::size_t gridSquareCount = static_cast<std::size_t>(indexSize.x) * indexSize.y;
+	gridSquareLabels.assign(gridSquareCount, NO_COMPONENT);
+	visitGeneration = 0;
+	visitGenerations.assign(gridSquareCount, 0);
+	visitSearches.assign(gridSquareCount, 0);
+	for (unsigned int x = 0; x < indexSize.x; ++x) {
+		for (unsigned int y = 0; y < indexSize.y; ++y) {
+			const sf::Vector2i gridSquare(static_cast<int>(x), static_cast<int>(y));
+			if (gridSquareLabels[flattenGridCoordinate(gridSquare, indexSize.y)] == NO_COMPONENT && isUnblocked(gridSquare)) {
+				const unsigned int label = createLabel();
+				labelSizes[label] = static_cast<unsigned int>(floodComponent(gridSquare, label));
+				++componentCount;
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Updates the labels after grid squares were blocked or unblocked.
+/// Must be called after the navigation grid changes and before the index is queried again.
+/// </summary>
+/// <param name="changedGridSquares">The coordinates of the changed grid squares. Coordinates outside of the grid are ignored.</param>
+void ReachabilityIndex::updateGridSquares(const std::vector<sf::Vector2i>& changedGridSquares) {
+	if (navigationGrid == nullptr ||
+		indexSize.x != navigationGrid->getArraySizeX() || indexSize.y != navigationGrid->getArraySizeY()) {
+		rebuild();
+		return;
+	}
+
+	for (const sf::Vector2i& changedGridSquare : changedGridSquares) {
+		if (!isInGrid(changedGridSquare, indexSize)) {
+			continue;
+		}
+
+		// splitting areas leaves unused labels behind. Relabeling reads every current weight, so it covers the rest of the changes.
+		if (labelParents.size() > MAX_LABELS_PER_GRID_SQUARE * gridSquareLabels.size()) {
+			rebuild();
+			return;
+		}
+
+		if (isUnblocked(changedGridSquare)) {
+			unblockGridSquare(changedGridSquare);
+		}
+		else {
+			blockGridSquare(changedGridSquare);
+		}
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Removes a grid square from its area and splits the area if the grid square was the only connection between its parts.
+/// Grid squares are treated as blocked or unblocked according to their labels, so changes that were not applied yet are ignored.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square. Must be within the grid.</param>
+void ReachabilityIndex::blockGridSquare(const sf::Vector2i& gridSquare) {
+	const unsigned int gridIndex = flattenGridCoordinate(gridSquare, indexSize.y);
+	if (gridSquareLabels[gridIndex] == NO_COMPONENT) {
+		return; // already blocked
+	}
+	const unsigned int oldLabel = findLabel(gridSquareLabels[gridIndex]);
+	gridSquareLabels[gridIndex] = NO_COMPONENT;
+	--labelSizes[oldLabel];
+
+	if (!areNeighborsLocallyConnected(gridSquare)) {
+		sf::Vector2i neighbors[MAX_SPLIT_SEARCHES];
+		unsigned int neighborCount = 0;
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			if (getComponent(gridSquare + offset) == oldLabel) {
+				neighbors[neighborCount++] = gridSquare + offset;
+			}
+		}
+		splitComponent(neighbors, neighborCount, oldLabel);
+	}
+
+	if (labelSizes[oldLabel] == 0) {
+		--componentCount;
+	}
+}
+
+/// <summary>
+/// Finds the parts an area fell apart into after one of its grid squares was blocked, and gives each part but one a new label.
+/// Searches outwards from every unblocked neighbor of the blocked grid square, one grid square per search in turns.
+/// Searches that meet are connected. The searching stops once every search is connected, or once at most one group
+/// of connected searches can still grow. So the cost depends on the size of the smaller parts, not on the size of the area.
+/// </summary>
+/// <param name="neighbors">The unblocked neighbors of the blocked grid square.</param>
+/// <param name="neighborCount">The number of neighbors. At most MAX_SPLIT_SEARCHES.</param>
+/// <param name="oldLabel">The label of the area.</param>
+void ReachabilityIndex::splitComponent(const sf::Vector2i* neighbors, unsigned int neighborCount, unsigned int oldLabel) {
+	// each search belongs to a group of connected searches, identified by its lowest search
+	unsigned int searchGroups[MAX_SPLIT_SEARCHES];
+	std::size_t searchHeads[MAX_SPLIT_SEARCHES];
+	const auto findGroup = [&searchGroups](unsigned int search) {
+		while (searchGroups[search] != search) {
+			search = searchGroups[search];
+		}
+		return search;
+	};
+
+	++visitGeneration;
+	if (visitGeneration == 0) {
+		std::fill(visitGenerations.begin(), visitGenerations.end(), 0u);
+		visitGeneration = 1;
+	}
+	for (unsigned int search = 0; search < neighborCount; ++search) {
+		const unsigned int neighborIndex = flattenGridCoordinate(neighbors[search], indexSize.y);
+		visitGenerations[neighborIndex] = visitGeneration;
+		visitSearches[neighborIndex] = static_cast<unsigned char>(search);
+		splitBuffers[search].clear();
+		splitBuffers[search].push_back(neighbors[search]);
+		searchGroups[search] = search;
+		searchHeads[search] = 0;
+	}
+
+	while (true) {
+		unsigned int groupCount = 0;
+		unsigned int growingGroupCount = 0;
+		for (unsigned int group = 0; group < neighborCount; ++group) {
+			if (searchGroups[group] != group) {
+				continue;
+			}
+			++groupCount;
+			for (unsigned int search = 0; search < neighborCount; ++search) {
+				if (findGroup(search) == group && searchHeads[search] < splitBuffers[search].size()) {
+					++growingGroupCount;
+					break;
+				}
+			}
+		}
+		if (groupCount <= 1) {
+			return; // still one area
+		}
+		if (growingGroupCount <= 1) {
+			break; // every other group found all of its part
+		}
+
+		for (unsigned int search = 0; search < neighborCount; ++search) {
+			if (searchHeads[search] == splitBuffers[search].size()) {
+				continue;
+			}
+			const sf::Vector2i current = splitBuffers[search][searchHeads[search]++];
+			for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+				const sf::Vector2i neighbor = current + offset;
+				if (getComponent(neighbor) != oldLabel) {
+					continue;
+				}
+				const unsigned int neighborIndex = flattenGridCoordinate(neighbor, indexSize.y);
+				if (visitGenerations[neighborIndex] != visitGeneration) {
+					visitGenerations[neighborIndex] = visitGeneration;
+					visitSearches[neighborIndex] = static_cast<unsigned char>(search);
+					splitBuffers[search].push_back(neighbor);
+				}
+				else {
+					// the searches met, so they are in the same part
+					const unsigned int lhsGroup = findGroup(search);
+					const unsigned int rhsGroup = findGroup(visitSearches[neighborIndex]);
+					searchGroups[std::max(lhsGroup, rhsGroup)] = std::min(lhsGroup, rhsGroup);
+				}
+			}
+		}
+	}
+
+	// the part that may still grow keeps the old label. If every part was found completely, the largest one keeps it.
+	std::size_t groupSizes[MAX_SPLIT_SEARCHES] = {};
+	bool isGroupGrowing[MAX_SPLIT_SEARCHES] = {};
+	for (unsigned int search = 0; search < neighborCount; ++search) {
+		const unsigned int group = findGroup(search);
+		groupSizes[group] += splitBuffers[search].size();
+		isGroupGrowing[group] = isGroupGrowing[group] || searchHeads[search] < splitBuffers[search].size();
+	}
+	unsigned int keptGroup = 0;
+	for (unsigned int group = 0; group < neighborCount; ++group) {
+		if (searchGroups[group] == group && (isGroupGrowing[group] || (!isGroupGrowing[keptGroup] && groupSizes[group] > groupSizes[keptGroup]))) {
+			keptGroup = group;
+		}
+	}
+
+	for (unsigned int group = 0; group < neighborCount; ++group) {
+		if (searchGroups[group] != group || group == keptGroup) {
+			continue;
+		}
+		const unsigned int newLabel = createLabel();
+		for (unsigned int search = 0; search < neighborCount; ++search) {
+			if (findGroup(search) != group) {
+				continue;
+			}
+			for (const sf::Vector2i& partGridSquare : splitBuffers[search]) {
+				gridSquareLabels[flattenGridCoordinate(partGridSquare, indexSize.y)] = newLabel;
+			}
+		}
+		labelSizes[newLabel] = static_cast<unsigned int>(groupSizes[group]);
+		labelSizes[oldLabel] -= static_cast<unsigned int>(groupSizes[group]);
+		++componentCount;
+	}
+}
+
+/// <summary>
+/// Adds a grid square to the areas around it, merging them if there are several.
+/// Grid squares are treated as blocked or unblocked according to their labels, so changes that were not applied yet are ignored.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square. Must be within the grid.</param>
+void ReachabilityIndex::unblockGridSquare(const sf::Vector2i& gridSquare) {
+	const unsigned int gridIndex = flattenGridCoordinate(gridSquare, indexSize.y);
+	if (gridSquareLabels[gridIndex] != NO_COMPONENT) {
+		return; // already unblocked
+	}
+
+	unsigned int label = NO_COMPONENT;
+	for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+		const unsigned int neighborLabel = getComponent(gridSquare + offset);
+		if (neighborLabel == NO_COMPONENT || neighborLabel == label) {
+			continue;
+		}
+		if (label == NO_COMPONENT) {
+			label = neighborLabel;
+		}
+		else {
+			label = mergeLabels(label, neighborLabel);
+			--componentCount;
+		}
+	}
+
+	if (label == NO_COMPONENT) {
+		label = createLabel();
+		++componentCount;
+	}
+	gridSquareLabels[gridIndex] = label;
+	++labelSizes[label];
+}
+
+/// <summary>
+/// Determines if the unblocked neighbors of a grid square are still connected through the eight grid squares around it.
+/// If they are, removing the grid square can not split its area.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square. Must be within the grid.</param>
+/// <returns>True if the unblocked neighbors are connected around the grid square. False if they might not be connected.</returns>
+bool ReachabilityIndex::areNeighborsLocallyConnected(const sf::Vector2i& gridSquare) const {
+	bool isRingUnblocked[RING_SIZE];
+	for (unsigned int i = 0; i < RING_SIZE; ++i) {
+		isRingUnblocked[i] = getComponent(gridSquare + RING_OFFSETS[i]) != NO_COMPONENT;
+	}
+
+	// count the runs of unblocked grid squares around the ring that contain a neighbor
+	unsigned int neighborRunCount = 0;
+	for (unsigned int i = 0; i < RING_SIZE; ++i) {
+		const bool isRunStart = isRingUnblocked[i] && !isRingUnblocked[(i + RING_SIZE - 1) % RING_SIZE];
+		if (!isRunStart) {
+			continue;
+		}
+		bool hasNeighbor = false;
+		for (unsigned int j = i; isRingUnblocked[j % RING_SIZE] && j < i + RING_SIZE; ++j) {
+			hasNeighbor = hasNeighbor || (j % 2 == 0);
+		}
+		if (hasNeighbor) {
+			++neighborRunCount;
+		}
+	}
+	// a ring without a run start is either fully blocked or fully unblocked, which is connected either way
+	return neighborRunCount <= 1;
+}
+
+/// <summary>
+/// Labels every unlabeled unblocked grid square connected to a source.
+/// </summary>
+/// <param name="source">The unlabeled unblocked grid square to start from.</param>
+/// <param name="label">The label to give to the area.</param>
+/// <returns>The number of labeled grid squares.</returns>
+std::size_t ReachabilityIndex::floodComponent(const sf::Vector2i& source, unsigned int label) {
+	floodBuffer.clear();
+	floodBuffer.push_back(source);
+	gridSquareLabels[flattenGridCoordinate(source, indexSize.y)] = label;
+
+	for (std::size_t i = 0; i < floodBuffer.size(); ++i) {
+		const sf::Vector2i current = floodBuffer[i];
+		for (const sf::Vector2i& offset : FOUR_NEIGHBOR_OFFSETS) {
+			const sf::Vector2i neighbor = current + offset;
+			if (!isInGrid(neighbor, indexSize)) {
+				continue;
+			}
+
+			unsigned int& neighborLabel = gridSquareLabels[flattenGridCoordinate(neighbor, indexSize.y)];
+			if (neighborLabel == NO_COMPONENT && isUnblocked(neighbor)) {
+				neighborLabel = label;
+				floodBuffer.push_back(neighbor);
+			}
+		}
+	}
+	return floodBuffer.size();
+}
+
+/// <summary>
+/// Creates a new label for an area without any grid squares.
+/// </summary>
+/// <returns>The new label.</returns>
+unsigned int ReachabilityIndex::createLabel() {
+	const unsigned int label = static_cast<unsigned int>(labelParents.size());
+	labelParents.push_back(label);
+	labelSizes.push_back(0);
+	return label;
+}
+
+/// <summary>
+/// Follows merged labels to the label of the area. Merging by size keeps this logarithmic in the number of labels.
+/// </summary>
+/// <param name="label">The label. Must not be NO_COMPONENT.</param>
+/// <returns>The label of the area.</returns>
+unsigned int ReachabilityIndex::findLabel(unsigned int label) const {
+	while (labelParents[label] != label) {
+		label = labelParents[label];
+	}
+	return label;
+}
+
+/// <summary>
+/// Merges two areas. The smaller area is merged into the larger.
+/// </summary>
+/// <param name="lhs">The label of the first area. Must be the label of an area, not a merged label.</param>
+/// <param name="rhs">The label of the second area. Must be the label of an area, not a merged label.</param>
+/// <returns>The label of the merged area.</returns>
+unsigned int ReachabilityIndex::mergeLabels(unsigned int lhs, unsigned int rhs) {
+	if (lhs == rhs) {
+		return lhs;
+	}
+	if (labelSizes[lhs] < labelSizes[rhs]) {
+		std::swap(lhs, rhs);
+	}
+	labelParents[rhs] = lhs;
+	labelSizes[lhs] += labelSizes[rhs];
+	return lhs;
+}
+
+/// <summary>
+/// Determines if a grid square is unblocked according to the navigation grid.
+/// </summary>
+/// <param name="gridSquare">The coordinate of the grid square. Must be within the grid.</param>
+/// <returns>True if the weight of the grid square is below BLOCKED_GRID_WEIGHT.</returns>
+bool ReachabilityIndex::isUnblocked(const sf::Vector2i& gridSquare) const {
+	return getGridWeight(*navigationGrid, gridSquare) < BLOCKED_GRID_WEIGHT;
+}
@@ -0,0 +1,214 @@
+#include <GameBackbone/Navigation/ReservationTable.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace GB;
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="ReservationTable"/> class whose window only holds the current time.
+/// </summary>
+ReservationTable::ReservationTable() : ReservationTable(0) {
+}
+
+/// <summary>
+/// Initializes a new instance of the <see cref="ReservationTable"/> class.
+/// </summary>
+/// <param name="windowSize">The number of time steps after the current time that can be reserved.</param>
+ReservationTable::ReservationTable(unsigned int windowSize) :
+	currentTime(0),
+	reservationCount(0) {
+	setWindowSize(windowSize);
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets the number of time steps after the current time that can be reserved. Discards every reservation.
+/// </summary>
+/// <param name="windowSize">The number of time steps.</param>
+void ReservationTable::setWindowSize(unsigned int windowSize) {
+	layers.assign(static_cast<std::size_t>(windowSize) + 1, ReservationLayer());
+	reservationCount = 0;
+}
+
+//getters
+
+/// <summary>
+/// Gets the number of time steps after the current time that can be reserved.
+/// </summary>
+/// <returns>The window size.</returns>
+unsigned int ReservationTable::getWindowSize() const {
+	return static_cast<unsigned int>(layers.size() - 1);
+}
+
+/// <summary>
+/// Gets the first time step of the window.
+/// </summary>
+/// <returns>The current time.</returns>
+unsigned int ReservationTable::getCurrentTime() const {
+	return currentTime;
+}
+
+/// <summary>
+/// Gets the number of reservations in the window.
+/// </summary>
+/// <returns>The number of reservations.</returns>
+std::size_t ReservationTable::getReservationCount() const {
+	return reservationCount;
+}
+
+/// <summary>
+/// Gets the agent that reserved a grid square at a time step.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="time">The time step.</param>
+/// <returns>The agent. NO_AGENT if the grid square is not reserved or the time is outside of the window.</returns>
+unsigned int ReservationTable::getAgent(const sf::Vector2i& gridSquare, unsigned int time) const {
+	if (!isInWindow(time)) {
+		return NO_AGENT;
+	}
+	const ReservationLayer& layer = getLayer(time);
+	const auto reservationIt = layer.find(makeKey(gridSquare));
+	return (reservationIt == layer.end()) ? NO_AGENT : reservationIt->second;
+}
+
+//operations
+
+/// <summary>
+/// Reserves a grid square at a time step for an agent.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="time">The time step.</param>
+/// <param name="agent">The agent. Must not be NO_AGENT.</param>
+/// <returns>True if the agent holds the reservation. False if another agent holds it or the time is outside of the window.</returns>
+bool ReservationTable::reserve(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent) {
+	if (!isInWindow(time)) {
+		return false;
+	}
+	const auto insertResult = getLayer(time).emplace(makeKey(gridSquare), agent);
+	if (insertResult.second) {
+		++reservationCount;
+		return true;
+	}
+	return insertResult.first->second == agent;
+}
+
+/// <summary>
+/// Releases the reservation of a grid square at a time step if the agent holds it.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="time">The time step.</param>
+/// <param name="agent">The agent that made the reservation.</param>
+void ReservationTable::release(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent) {
+	if (!isInWindow(time)) {
+		return;
+	}
+	ReservationLayer& layer = getLayer(time);
+	const auto reservationIt = layer.find(makeKey(gridSquare));
+	if (reservationIt != layer.end() && reservationIt->second == agent) {
+		layer.erase(reservationIt);
+		--reservationCount;
+	}
+}
+
+/// <summary>
+/// Checks if an agent may occupy a grid square at a time step.
+/// Time steps outside of the window are always free.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <param name="time">The time step.</param>
+/// <param name="agent">The agent.</param>
+/// <returns>True if the grid square is not reserved or reserved by the agent. False otherwise.</returns>
+bool ReservationTable::isFree(const sf::Vector2i& gridSquare, unsigned int time, unsigned int agent) const {
+	const unsigned int reservingAgent = getAgent(gridSquare, time);
+	return reservingAgent == NO_AGENT || reservingAgent == agent;
+}
+
+/// <summary>
+/// Checks if an agent may move between two grid squares from one time step to the next.
+/// The target must be free when the agent arrives, and no other agent may move the opposite way at the same time.
+/// </summary>
+/// <param name="from">The grid square the agent occupies at the time step.</param>
+/// <param name="to">The grid square the agent occupies at the next time step. Equals from if the agent waits.</param>
+/// <param name="time">The time step the agent leaves from.</param>
+/// <param name="agent">The agent.</param>
+/// <returns>True if the move does not conflict with other reservations. False otherwise.</returns>
+bool ReservationTable::isMoveFree(const sf::Vector2i& from, const sf::Vector2i& to, unsigned int time, unsigned int agent) const {
+	if (!isFree(to, time + 1, agent)) {
+		return false;
+	}
+	if (from == to) {
+		return true;
+	}
+
+	// two agents can not pass through each other
+	const unsigned int oncomingAgent = getAgent(to, time);
+	return oncomingAgent == NO_AGENT || oncomingAgent == agent || getAgent(from, time + 1) != oncomingAgent;
+}
+
+/// <summary>
+/// Checks if a time step is inside of the window.
+/// </summary>
+/// <param name="time">The time step.</param>
+/// <returns>True if the time step is in [current time, current time + window size]. False otherwise.</returns>
+bool ReservationTable::isInWindow(unsigned int time) const {
+	return time >= currentTime && time - currentTime < layers.size();
+}
+
+/// <summary>
+/// Moves the window forward. Discards the reservations of the time steps that leave the window.
+/// </summary>
+/// <param name="steps">The number of time steps to move forward.</param>
+void ReservationTable::advanceTime(unsigned int steps) {
+	const std::size_t discardedLayerCount = std::min<std::size_t>(steps, layers.size());
+	for (std::size_t i = 0; i < discardedLayerCount; ++i) {
+		ReservationLayer& layer = getLayer(currentTime + static_cast<unsigned int>(i));
+		reservationCount -= layer.size();
+		layer.clear();
+	}
+	currentTime += steps;
+}
+
+/// <summary>
+/// Discards every reservation. The current time is kept.
+/// </summary>
+void ReservationTable::clear() {
+	for (ReservationLayer& layer : layers) {
+		layer.clear();
+	}
+	reservationCount = 0;
+}
+
+// private helper functions
+
+/// <summary>
+/// Gets the reservations of a time step inside of the window.
+/// </summary>
+/// <param name="time">The time step.</param>
+/// <returns>The layer that holds the time step.</returns>
+ReservationTable::ReservationLayer& ReservationTable::getLayer(unsigned int time) {
+	return layers[time % layers.size()];
+}
+
+/// <summary>
+/// Gets the reservations of a time step inside of the window.
+/// </summary>
+/// <param name="time">The time step.</param>
+/// <returns>The layer that holds the time step.</returns>
+const ReservationTable::ReservationLayer& ReservationTable::getLayer(unsigned int time) const {
+	return layers[time % layers.size()];
+}
+
+/// <summary>
+/// Packs the coordinates of a grid square into one key.
+/// </summary>
+/// <param name="gridSquare">The grid square.</param>
+/// <returns>The key of the grid square.</returns>
+std::uint64_t ReservationTable::makeKey(const sf::Vector2i& gridSquare) {
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(gridSquare.x)) << 32) | static_cast<std::uint32_t>(gridSquare.y);
+}
@@ -0,0 +1,140 @@
+#include <GameBackbone/Util/WorkerPool.h>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace GB;
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="WorkerPool"/> class.
+/// Starts workerCount - 1 threads. The calling thread of runOnAllWorkers is the remaining worker.
+/// </summary>
+/// <param name="workerCount">The number of workers. Values below 1 are treated as 1.</param>
+WorkerPool::WorkerPool(unsigned int workerCount) :
+	job(nullptr),
+	jobGeneration(0),
+	busyThreadCount(0),
+	isStopping(false) {
+
+	for (unsigned int workerIndex = 1; workerIndex < workerCount; ++workerIndex) {
+		threads.emplace_back(&WorkerPool::runWorker, this, workerIndex);
+	}
+}
+
+/// <summary>
+/// Stops and joins all of the threads of the pool.
+/// </summary>
+WorkerPool::~WorkerPool() {
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		isStopping = true;
+	}
+	jobStarted.notify_all();
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+}
+
+//getters
+
+/// <summary>
+/// Gets the number of workers, including the thread that calls runOnAllWorkers.
+/// </summary>
+/// <returns></returns>
+unsigned int WorkerPool::getWorkerCount() const {
+	return static_cast<unsigned int>(threads.size()) + 1;
+}
+
+//operations
+
+/// <summary>
+/// Runs the job once on every worker and blocks until all of them are finished.
+/// The job receives the index of the worker running it, in the range [0, getWorkerCount()).
+/// If any worker throws, the first exception is rethrown on the calling thread after every worker is finished.
+/// Must not be called by more than one thread at a time.
+/// </summary>
+/// <param name="newJob">The job to run.</param>
+void WorkerPool::runOnAllWorkers(const std::function<void(unsigned int)>& newJob) {
+	if (threads.empty()) {
+		newJob(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(poolMutex);
+		job = &newJob;
+		busyThreadCount = static_cast<unsigned int>(threads.size());
+		firstJobException = nullptr;
+		++jobGeneration;
+	}
+	jobStarted.notify_all();
+
+	// the calling thread is worker 0
+	runJob(newJob, 0);
+
+	std::exception_ptr jobException;
+	{
+		std::unique_lock<std::mutex> lock(poolMutex);
+		jobFinished.wait(lock, [this]() { return busyThreadCount == 0; });
+		job = nullptr;
+		jobException = firstJobException;
+		firstJobException = nullptr;
+	}
+	if (jobException) {
+		std::rethrow_exception(jobException);
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Main loop of a pool thread. Waits for jobs and runs them until the pool is stopped.
+/// </summary>
+/// <param name="workerIndex">The index of the worker.</param>
+void WorkerPool::runWorker(unsigned int workerIndex) {
+	unsigned int finishedGeneration = 0;
+	while (true) {
+		const std::function<void(unsigned int)>* currentJob = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(poolMutex);
+			jobStarted.wait(lock, [this, finishedGeneration]() { return isStopping || jobGeneration != finishedGeneration; });
+			if (isStopping) {
+				return;
+			}
+			finishedGeneration = jobGeneration;
+			currentJob = job;
+		}
+
+		runJob(*currentJob, workerIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(poolMutex);
+			--busyThreadCount;
+			if (busyThreadCount == 0) {
+				jobFinished.notify_one();
+			}
+		}
+	}
+}
+
+/// <summary>
+/// Runs the job for one worker and records the first exception thrown by any worker.
+/// </summary>
+/// <param name="currentJob">The job.</param>
+/// <param name="workerIndex">The index of the worker running the job.</param>
+void WorkerPool::runJob(const std::function<void(unsigned int)>& currentJob, unsigned int workerIndex) {
+	try {
+		currentJob(workerIndex);
+	}
+	catch (...) {
+		std::lock_guard<std::mutex> lock(poolMutex);
+		if (!firstJobException) {
+			firstJobException = std::current_exception();
+		}
+	}
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace BENCH {
+
+	/// <summary>
+	/// Gets the number of heap allocations made by the benchmark executable since it started.
+	/// The executable replaces the global operator new to count them. Allocations made inside the GameBackbone library are
+	/// counted where shared libraries use the allocation functions of the executable, which is not the case for Windows DLLs.
+	/// </summary>
+	/// <returns>The number of allocations.</returns>
+	std::size_t getAllocationCount();
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace BENCH {
+
+	/// <summary>
+	/// Runs one sample of a benchmark.
+	/// Returns the amount of work the sample did, such as the number of expanded grid squares, which is reported per second.
+	/// </summary>
+	using BenchmarkFunction = std::function<std::size_t()>;
+
+	/// <summary> The measurements of one benchmark. </summary>
+	struct BenchmarkResult {
+		std::string name;
+		std::string workName; // what the work returned by each sample counts
+		std::size_t sampleCount;
+		double p50Microseconds;
+		double p99Microseconds;
+		double meanMicroseconds;
+		double workPerSecond;
+		double allocationsPerSample;
+	};
+
+	/// <summary>
+	/// Times registered benchmarks and reports their latency percentiles, throughput and allocations.
+	/// Each benchmark runs one untimed warm up sample, then timed samples until both the minimum sample count and the
+	/// minimum duration are reached, or the maximum sample count is.
+	/// </summary>
+	class BenchmarkRunner {
+	public:
+
+		/// The number of timed samples every benchmark runs at least, if no other count is chosen.
+		static constexpr std::size_t DEFAULT_MIN_SAMPLE_COUNT = 10;
+
+		/// The number of timed samples no benchmark runs more than, if no other count is chosen.
+		static constexpr std::size_t DEFAULT_MAX_SAMPLE_COUNT = 1000;
+
+		/// The time in seconds every benchmark runs at least, if no other duration is chosen.
+		static constexpr double DEFAULT_MIN_DURATION = 0.5;
+
+		//ctr / dtr
+		BenchmarkRunner();
+
+		//getters / setters
+
+			//setters
+		void setFilter(const std::string& newFilter);
+		void setSampleCounts(std::size_t newMinSampleCount, std::size_t newMaxSampleCount);
+		void setMinDuration(double newMinDuration);
+
+			//getters
+		const std::vector<BenchmarkResult>& getResults() const;
+
+		//operations
+		void addBenchmark(const std::string& name, const std::string& workName, BenchmarkFunction function);
+		void runAll(std::ostream& output);
+		void writeCsv(std::ostream& output) const;
+
+	private:
+
+		/// <summary> A registered benchmark. </summary>
+		struct Benchmark {
+			std::string name;
+			std::string workName;
+			BenchmarkFunction function;
+		};
+
+		//helper functions
+		BenchmarkResult runBenchmark(const Benchmark& benchmark) const;
+
+		//data
+		std::vector<Benchmark> benchmarks;
+		std::vector<BenchmarkResult> results;
+		std::string filter; // only benchmarks whose names contain the filter run
+		std::size_t minSampleCount;
+		std::size_t maxSampleCount;
+		double minDuration;
+	};
+
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/BenchmarkRunner.h>
+
+namespace BENCH {
+
+	void addClusterGreenhouseBenchmarks(BenchmarkRunner& runner);
+
+}
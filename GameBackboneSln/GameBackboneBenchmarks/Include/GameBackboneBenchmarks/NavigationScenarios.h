@@ -0,0 +1,50 @@
+#pragma once
+
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BENCH {
+
+	/// <summary>
+	/// A navigation grid and path requests across it that are generated the same way on every platform, so results of
+	/// different releases can be compared. Owns the data of every grid square.
+	/// </summary>
+	class NavigationScenario {
+	public:
+		//ctr / dtr
+		NavigationScenario(const std::string& newName, unsigned int gridSize);
+		~NavigationScenario();
+
+		//deleted copy and assignment
+		NavigationScenario(const NavigationScenario&) = delete;
+		NavigationScenario(NavigationScenario&&) = delete;
+		NavigationScenario& operator=(const NavigationScenario&) = delete;
+		NavigationScenario& operator=(NavigationScenario&&) = delete;
+
+		//getters
+		const std::string& getName() const;
+		GB::NavigationGrid& getNavigationGrid();
+		const std::vector<GB::PathRequest>& getPathRequests() const;
+		std::vector<GB::PathRequest> getPathRequests(std::size_t requestCount) const;
+
+		//operations
+		void addRandomPathRequests(std::size_t requestCount, unsigned int seed);
+		void addPathRequest(const GB::PathRequest& pathRequest);
+
+	private:
+		std::string name;
+		GB::NavigationGrid navigationGrid;
+		std::vector<GB::PathRequest> pathRequests;
+	};
+
+	std::unique_ptr<NavigationScenario> makeOpenFieldScenario(unsigned int gridSize, std::size_t requestCount);
+	std::unique_ptr<NavigationScenario> makeMazeScenario(unsigned int gridSize, std::size_t requestCount);
+	std::unique_ptr<NavigationScenario> makeWeightedTerrainScenario(unsigned int gridSize, std::size_t requestCount);
+	std::unique_ptr<NavigationScenario> makeUnreachableScenario(unsigned int gridSize, std::size_t requestCount);
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <GameBackboneBenchmarks/BenchmarkRunner.h>
+
+namespace BENCH {
+
+	/// The number of path requests of the largest batch passed to pathFind.
+	constexpr unsigned int MAX_BATCH_SIZE = 1000;
+
+	void addPathfinderBenchmarks(BenchmarkRunner& runner, unsigned int gridSize);
+
+}
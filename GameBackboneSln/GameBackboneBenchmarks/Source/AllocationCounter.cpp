@@ -0,0 +1,76 @@
+#include <GameBackboneBenchmarks/AllocationCounter.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	/// The number of allocations made through the replaced operator new.
+	std::atomic<std::size_t> allocationCount{0};
+
+	/// <summary>
+	/// Allocates memory and counts the allocation.
+	/// </summary>
+	/// <param name="size">The number of bytes.</param>
+	/// <returns>The memory, or null if it could not be allocated.</returns>
+	void* countedAllocate(std::size_t size) {
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+		return std::malloc(size == 0 ? 1 : size);
+	}
+}
+
+/// <summary>
+/// Gets the number of heap allocations made by the benchmark executable since it started.
+/// </summary>
+/// <returns>The number of allocations.</returns>
+std::size_t BENCH::getAllocationCount() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+// replacements of the global allocation functions. The array and nothrow forms are replaced too, since the
+// standard forms they forward to by default are not guaranteed to be the replaced ones.
+
+void* operator new(std::size_t size) {
+	void* memory = countedAllocate(size);
+	if (memory == nullptr) {
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](std::size_t size) {
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return countedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+	std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+	std::free(memory);
+}
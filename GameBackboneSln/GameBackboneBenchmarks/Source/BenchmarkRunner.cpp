@@ -0,0 +1,177 @@
+#include <GameBackboneBenchmarks/BenchmarkRunner.h>
+#include <GameBackboneBenchmarks/AllocationCounter.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace BENCH;
+
+namespace {
+
+	/// <summary>
+	/// Gets a percentile of sorted samples by the nearest rank method.
+	/// </summary>
+	/// <param name="sortedSamples">The samples in ascending order. Must not be empty.</param>
+	/// <param name="percentile">The percentile. In (0, 100].</param>
+	/// <returns>The smallest sample that is at least as large as the percentile of the samples.</returns>
+	double calcPercentile(const std::vector<double>& sortedSamples, double percentile) {
+		const std::size_t rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedSamples.size())));
+		return sortedSamples[std::max<std::size_t>(rank, 1) - 1];
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Initializes a new instance of the <see cref="BenchmarkRunner"/> class that runs every benchmark with the default sample counts.
+/// </summary>
+BenchmarkRunner::BenchmarkRunner() :
+	minSampleCount(DEFAULT_MIN_SAMPLE_COUNT),
+	maxSampleCount(DEFAULT_MAX_SAMPLE_COUNT),
+	minDuration(DEFAULT_MIN_DURATION) {
+}
+
+//getters / setters
+
+//setters
+
+/// <summary>
+/// Sets which benchmarks run.
+/// </summary>
+/// <param name="newFilter">Only benchmarks whose names contain the filter run. Empty runs every benchmark.</param>
+void BenchmarkRunner::setFilter(const std::string& newFilter) {
+	filter = newFilter;
+}
+
+/// <summary>
+/// Sets how many timed samples each benchmark runs.
+/// </summary>
+/// <param name="newMinSampleCount">The number of samples every benchmark runs at least. At least 1.</param>
+/// <param name="newMaxSampleCount">The number of samples no benchmark runs more than. Raised to the minimum if it is below it.</param>
+void BenchmarkRunner::setSampleCounts(std::size_t newMinSampleCount, std::size_t newMaxSampleCount) {
+	minSampleCount = std::max<std::size_t>(newMinSampleCount, 1);
+	maxSampleCount = std::max(newMaxSampleCount, minSampleCount);
+}
+
+/// <summary>
+/// Sets how long each benchmark runs at least, unless it reaches the maximum sample count first.
+/// </summary>
+/// <param name="newMinDuration">The duration in seconds.</param>
+void BenchmarkRunner::setMinDuration(double newMinDuration) {
+	minDuration = newMinDuration;
+}
+
+//getters
+
+/// <summary>
+/// Gets the results of the benchmarks run by the last call to runAll.
+/// </summary>
+/// <returns>The results in the order the benchmarks were added.</returns>
+const std::vector<BenchmarkResult>& BenchmarkRunner::getResults() const {
+	return results;
+}
+
+//operations
+
+/// <summary>
+/// Registers a benchmark.
+/// </summary>
+/// <param name="name">The name of the benchmark. Names are reported as they are, so they should be unique.</param>
+/// <param name="workName">What the work returned by each sample counts, such as "expansions".</param>
+/// <param name="function">Runs one sample of the benchmark.</param>
+void BenchmarkRunner::addBenchmark(const std::string& name, const std::string& workName, BenchmarkFunction function) {
+	benchmarks.push_back(Benchmark{name, workName, std::move(function)});
+}
+
+/// <summary>
+/// Runs every benchmark that passes the filter, and reports each result as soon as it is measured.
+/// </summary>
+/// <param name="output">Receives a table of the results.</param>
+void BenchmarkRunner::runAll(std::ostream& output) {
+	results.clear();
+	output << std::left << std::setw(48) << "benchmark" << std::right
+		<< std::setw(9) << "samples"
+		<< std::setw(14) << "p50 (us)"
+		<< std::setw(14) << "p99 (us)"
+		<< std::setw(16) << "work / s"
+		<< std::setw(14) << "allocs" << "  work\n";
+	for (const Benchmark& benchmark : benchmarks) {
+		if (benchmark.name.find(filter) == std::string::npos) {
+			continue;
+		}
+		results.push_back(runBenchmark(benchmark));
+		const BenchmarkResult& result = results.back();
+		output << std::left << std::setw(48) << result.name << std::right
+			<< std::setw(9) << result.sampleCount
+			<< std::fixed << std::setprecision(2)
+			<< std::setw(14) << result.p50Microseconds
+			<< std::setw(14) << result.p99Microseconds
+			<< std::setprecision(0)
+			<< std::setw(16) << result.workPerSecond
+			<< std::setprecision(1)
+			<< std::setw(14) << result.allocationsPerSample
+			<< "  " << result.workName << std::endl;
+	}
+}
+
+/// <summary>
+/// Writes the results of the last call to runAll as comma separated values, so runs of different releases can be compared.
+/// </summary>
+/// <param name="output">Receives a header line and one line for each result.</param>
+void BenchmarkRunner::writeCsv(std::ostream& output) const {
+	output << "benchmark,samples,p50_us,p99_us,mean_us,work_per_second,allocations_per_sample,work\n";
+	for (const BenchmarkResult& result : results) {
+		output << result.name << ',' << result.sampleCount << ','
+			<< result.p50Microseconds << ',' << result.p99Microseconds << ',' << result.meanMicroseconds << ','
+			<< result.workPerSecond << ',' << result.allocationsPerSample << ',' << result.workName << '\n';
+	}
+}
+
+// private helper functions
+
+/// <summary>
+/// Runs the samples of one benchmark.
+/// The first sample is not timed, so storage that is reused between samples is already allocated.
+/// </summary>
+/// <param name="benchmark">The benchmark.</param>
+/// <returns>The measurements of the benchmark.</returns>
+BenchmarkResult BenchmarkRunner::runBenchmark(const Benchmark& benchmark) const {
+	benchmark.function();
+
+	std::vector<double> sampleMicroseconds;
+	sampleMicroseconds.reserve(minSampleCount);
+	std::size_t totalWork = 0;
+	std::size_t totalAllocations = 0;
+	double totalSeconds = 0;
+	while (sampleMicroseconds.size() < maxSampleCount && (sampleMicroseconds.size() < minSampleCount || totalSeconds < minDuration)) {
+		const std::size_t allocationsBefore = getAllocationCount();
+		const auto startTime = std::chrono::steady_clock::now();
+		totalWork += benchmark.function();
+		const auto endTime = std::chrono::steady_clock::now();
+		totalAllocations += getAllocationCount() - allocationsBefore;
+
+		const double elapsedSeconds = std::chrono::duration<double>(endTime - startTime).count();
+		totalSeconds += elapsedSeconds;
+		sampleMicroseconds.push_back(elapsedSeconds * 1000000.0);
+	}
+
+	std::sort(sampleMicroseconds.begin(), sampleMicroseconds.end());
+	const double sampleCount = static_cast<double>(sampleMicroseconds.size());
+	BenchmarkResult result;
+	result.name = benchmark.name;
+	result.workName = benchmark.workName;
+	result.sampleCount = sampleMicroseconds.size();
+	result.p50Microseconds = calcPercentile(sampleMicroseconds, 50.0);
+	result.p99Microseconds = calcPercentile(sampleMicroseconds, 99.0);
+	result.meanMicroseconds = totalSeconds * 1000000.0 / sampleCount;
+	result.workPerSecond = (totalSeconds > 0) ? static_cast<double>(totalWork) / totalSeconds : 0.0;
+	result.allocationsPerSample = static_cast<double>(totalAllocations) / sampleCount;
+	return result;
+}
@@ -0,0 +1,54 @@
+#include <GameBackboneBenchmarks/ClusterGreenhouseBenchmarks.h>
+
+#include <GameBackbone/Util/ClusterGreenhouse.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace BENCH;
+
+namespace {
+
+	/// The length of both sides of the graph of the ClusterGreenhouse benchmark.
+	/// The greenhouse copies a whole cluster for every point it adds, so its graph is kept small.
+	constexpr int GREENHOUSE_GRID_SIZE = 64;
+
+	/// The seed of every ClusterGreenhouse.
+	const char* const GREENHOUSE_SEED = "4";
+
+	/// The share of the graph each cluster of the ClusterGreenhouse grows to.
+	const double CLUSTER_FREQUENCIES[] = {0.2, 0.15, 0.1, 0.1, 0.05};
+
+	/// <summary>
+	/// Creates a ClusterGreenhouse whose random numbers are the same on every run.
+	/// </summary>
+	std::unique_ptr<GB::ClusterGreenhouse> makeGreenhouse(int gridSize) {
+		auto greenhouse = std::make_unique<GB::ClusterGreenhouse>(sf::Vector2i(gridSize, gridSize));
+		std::string seed = GREENHOUSE_SEED;
+		greenhouse->RandomGenerator.setSeed(&seed);
+		return greenhouse;
+	}
+}
+
+/// <summary>
+/// Adds the benchmark of ClusterGreenhouse::generateClusteredGraph, which grows the same clusters on a small graph every sample.
+/// The work of a sample is the number of grid squares added to a cluster.
+/// </summary>
+/// <param name="runner">Receives the benchmarks.</param>
+void BENCH::addClusterGreenhouseBenchmarks(BenchmarkRunner& runner) {
+	runner.addBenchmark("clusterGreenhouse/generateClusteredGraph/" + std::to_string(GREENHOUSE_GRID_SIZE), "grid squares",
+		[]() {
+			std::unique_ptr<GB::ClusterGreenhouse> greenhouse = makeGreenhouse(GREENHOUSE_GRID_SIZE);
+			const auto clusters = greenhouse->generateClusteredGraph(std::vector<double>(std::begin(CLUSTER_FREQUENCIES), std::end(CLUSTER_FREQUENCIES)));
+			std::size_t clusteredCount = 0;
+			for (const auto& cluster : clusters) {
+				clusteredCount += cluster.size();
+			}
+			return clusteredCount;
+		});
+}
@@ -0,0 +1,295 @@
+#include <GameBackboneBenchmarks/NavigationScenarios.h>
+
+#include <GameBackbone/Navigation/NavigationGridData.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace BENCH;
+
+namespace {
+
+	/// The seed of the path requests of every scenario.
+	constexpr unsigned int REQUEST_SEED = 1;
+
+	/// The seed of the walls of the maze scenario.
+	constexpr unsigned int MAZE_SEED = 2;
+
+	/// The seed of the weights of the weighted terrain scenario.
+	constexpr unsigned int TERRAIN_SEED = 3;
+
+	/// The width of the areas whose corners hold the random weights of the weighted terrain scenario.
+	constexpr unsigned int TERRAIN_FEATURE_SIZE = 16;
+
+	/// The heaviest unblocked weight of the weighted terrain scenario.
+	constexpr int MAX_TERRAIN_WEIGHT = 9;
+
+	/// <summary>
+	/// Draws a random number below a bound.
+	/// The raw output of the engine is used instead of a distribution, since distributions differ between standard libraries.
+	/// </summary>
+	/// <param name="engine">The random engine.</param>
+	/// <param name="bound">The bound. Must be above 0.</param>
+	/// <returns>The random number.</returns>
+	unsigned int drawBelow(std::minstd_rand& engine, unsigned int bound) {
+		return static_cast<unsigned int>(engine() % bound);
+	}
+
+	/// <summary>
+	/// Sets the weight of a grid square.
+	/// </summary>
+	void setWeight(GB::NavigationGrid& navigationGrid, unsigned int x, unsigned int y, int weight) {
+		navigationGrid.at(x, y)->weight = weight;
+	}
+
+	/// <summary>
+	/// Draws a random unblocked grid square.
+	/// </summary>
+	/// <param name="navigationGrid">The navigation grid. Must have an unblocked grid square.</param>
+	/// <param name="engine">The random engine.</param>
+	/// <returns>The grid square.</returns>
+	sf::Vector2i drawUnblockedGridSquare(GB::NavigationGrid& navigationGrid, std::minstd_rand& engine) {
+		while (true) {
+			const unsigned int x = drawBelow(engine, navigationGrid.getArraySizeX());
+			const unsigned int y = drawBelow(engine, navigationGrid.getArraySizeY());
+			if (navigationGrid.at(x, y)->weight < GB::BLOCKED_GRID_WEIGHT) {
+				return sf::Vector2i(static_cast<int>(x), static_cast<int>(y));
+			}
+		}
+	}
+}
+
+//ctr / dtr
+
+/// <summary>
+/// Creates an open square navigation grid without path requests.
+/// </summary>
+/// <param name="newName">The name of the scenario, used in the names of its benchmarks.</param>
+/// <param name="gridSize">The length of both sides of the navigation grid.</param>
+NavigationScenario::NavigationScenario(const std::string& newName, unsigned int gridSize) : name(newName), navigationGrid(gridSize) {
+	GB::initAllNavigationGridValues(navigationGrid, GB::NavigationGridData{1, 0});
+}
+
+/// <summary>
+/// Frees the data of every grid square.
+/// </summary>
+NavigationScenario::~NavigationScenario() {
+	GB::freeAllNavigationGridData(navigationGrid);
+}
+
+//getters
+
+/// <summary>
+/// Gets the name of the scenario.
+/// </summary>
+/// <returns>The name.</returns>
+const std::string& NavigationScenario::getName() const {
+	return name;
+}
+
+/// <summary>
+/// Gets the navigation grid of the scenario.
+/// </summary>
+/// <returns>The navigation grid.</returns>
+GB::NavigationGrid& NavigationScenario::getNavigationGrid() {
+	return navigationGrid;
+}
+
+/// <summary>
+/// Gets every path request of the scenario.
+/// </summary>
+/// <returns>The path requests.</returns>
+const std::vector<GB::PathRequest>& NavigationScenario::getPathRequests() const {
+	return pathRequests;
+}
+
+/// <summary>
+/// Gets a batch of path requests of the scenario. The requests are repeated if the batch is larger than the scenario.
+/// </summary>
+/// <param name="requestCount">The size of the batch.</param>
+/// <returns>The first requests of the scenario.</returns>
+std::vector<GB::PathRequest> NavigationScenario::getPathRequests(std::size_t requestCount) const {
+	std::vector<GB::PathRequest> batch;
+	batch.reserve(requestCount);
+	for (std::size_t i = 0; i < requestCount && !pathRequests.empty(); ++i) {
+		batch.push_back(pathRequests[i % pathRequests.size()]);
+	}
+	return batch;
+}
+
+//operations
+
+/// <summary>
+/// Adds path requests between random unblocked grid squares.
+/// </summary>
+/// <param name="requestCount">The number of requests.</param>
+/// <param name="seed">The seed of the random grid squares. The same seed always adds the same requests to the same grid.</param>
+void NavigationScenario::addRandomPathRequests(std::size_t requestCount, unsigned int seed) {
+	std::minstd_rand engine(seed);
+	for (std::size_t i = 0; i < requestCount; ++i) {
+		const sf::Vector2i start = drawUnblockedGridSquare(navigationGrid, engine);
+		sf::Vector2i end = drawUnblockedGridSquare(navigationGrid, engine);
+		while (end == start) {
+			end = drawUnblockedGridSquare(navigationGrid, engine);
+		}
+		pathRequests.push_back(GB::PathRequest{start, end});
+	}
+}
+
+/// <summary>
+/// Adds a path request.
+/// </summary>
+/// <param name="pathRequest">The path request.</param>
+void NavigationScenario::addPathRequest(const GB::PathRequest& pathRequest) {
+	pathRequests.push_back(pathRequest);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// scenarios
+
+/// <summary>
+/// Creates a navigation grid without blocked or weighted grid squares.
+/// </summary>
+/// <param name="gridSize">The length of both sides of the navigation grid.</param>
+/// <param name="requestCount">The number of path requests between random grid squares.</param>
+/// <returns>The scenario.</returns>
+std::unique_ptr<NavigationScenario> BENCH::makeOpenFieldScenario(unsigned int gridSize, std::size_t requestCount) {
+	auto scenario = std::make_unique<NavigationScenario>("open field", gridSize);
+	scenario->addRandomPathRequests(requestCount, REQUEST_SEED);
+	return scenario;
+}
+
+/// <summary>
+/// Creates a maze of one grid square wide corridors with exactly one path between any two corridor grid squares.
+/// Paths wind across most of the grid, so searches expand many grid squares that are not on the path.
+/// </summary>
+/// <param name="gridSize">The length of both sides of the navigation grid.</param>
+/// <param name="requestCount">The number of path requests between random corridor grid squares.</param>
+/// <returns>The scenario.</returns>
+std::unique_ptr<NavigationScenario> BENCH::makeMazeScenario(unsigned int gridSize, std::size_t requestCount) {
+	auto scenario = std::make_unique<NavigationScenario>("maze", gridSize);
+	GB::NavigationGrid& navigationGrid = scenario->getNavigationGrid();
+	for (unsigned int x = 0; x < gridSize; ++x) {
+		for (unsigned int y = 0; y < gridSize; ++y) {
+			setWeight(navigationGrid, x, y, GB::BLOCKED_GRID_WEIGHT);
+		}
+	}
+
+	// carve corridors between the cells at odd coordinates with a depth first search
+	const unsigned int cellCount = (gridSize - 1) / 2;
+	if (cellCount > 0) {
+		std::minstd_rand engine(MAZE_SEED);
+		std::vector<unsigned char> isVisited(static_cast<std::size_t>(cellCount) * cellCount, 0);
+		std::vector<sf::Vector2u> cellStack{sf::Vector2u(0, 0)};
+		isVisited[0] = 1;
+		setWeight(navigationGrid, 1, 1, 1);
+		const sf::Vector2i directions[] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+		while (!cellStack.empty()) {
+			const sf::Vector2u cell = cellStack.back();
+			sf::Vector2u unvisitedNeighbors[4];
+			unsigned int unvisitedNeighborCount = 0;
+			for (const sf::Vector2i& direction : directions) {
+				const sf::Vector2u neighbor(cell.x + static_cast<unsigned int>(direction.x), cell.y + static_cast<unsigned int>(direction.y));
+				if (neighbor.x < cellCount && neighbor.y < cellCount && !isVisited[neighbor.x * cellCount + neighbor.y]) {
+					unvisitedNeighbors[unvisitedNeighborCount] = neighbor;
+					++unvisitedNeighborCount;
+				}
+			}
+			if (unvisitedNeighborCount == 0) {
+				cellStack.pop_back();
+				continue;
+			}
+
+			// open the cell and the wall between it and the current cell
+			const sf::Vector2u next = unvisitedNeighbors[drawBelow(engine, unvisitedNeighborCount)];
+			isVisited[next.x * cellCount + next.y] = 1;
+			setWeight(navigationGrid, 2 * next.x + 1, 2 * next.y + 1, 1);
+			setWeight(navigationGrid, cell.x + next.x + 1, cell.y + next.y + 1, 1);
+			cellStack.push_back(next);
+		}
+	}
+
+	scenario->addRandomPathRequests(requestCount, REQUEST_SEED);
+	return scenario;
+}
+
+/// <summary>
+/// Creates rolling terrain of weights from 1 to 9 with scattered blocked grid squares.
+/// Weights are interpolated between random weights on a coarse lattice, so cheap and expensive areas are several grid squares wide.
+/// </summary>
+/// <param name="gridSize">The length of both sides of the navigation grid.</param>
+/// <param name="requestCount">The number of path requests between random unblocked grid squares.</param>
+/// <returns>The scenario.</returns>
+std::unique_ptr<NavigationScenario> BENCH::makeWeightedTerrainScenario(unsigned int gridSize, std::size_t requestCount) {
+	auto scenario = std::make_unique<NavigationScenario>("weighted terrain", gridSize);
+	GB::NavigationGrid& navigationGrid = scenario->getNavigationGrid();
+
+	std::minstd_rand engine(TERRAIN_SEED);
+	const unsigned int latticeSize = gridSize / TERRAIN_FEATURE_SIZE + 2;
+	std::vector<int> latticeWeights(static_cast<std::size_t>(latticeSize) * latticeSize);
+	for (int& latticeWeight : latticeWeights) {
+		latticeWeight = 1 + static_cast<int>(drawBelow(engine, MAX_TERRAIN_WEIGHT));
+	}
+
+	for (unsigned int x = 0; x < gridSize; ++x) {
+		for (unsigned int y = 0; y < gridSize; ++y) {
+			const unsigned int cellX = x / TERRAIN_FEATURE_SIZE;
+			const unsigned int cellY = y / TERRAIN_FEATURE_SIZE;
+			const int fractionX = static_cast<int>(x % TERRAIN_FEATURE_SIZE);
+			const int fractionY = static_cast<int>(y % TERRAIN_FEATURE_SIZE);
+			const int featureSize = static_cast<int>(TERRAIN_FEATURE_SIZE);
+			const int top = latticeWeights[cellX * latticeSize + cellY] * (featureSize - fractionX) +
+				latticeWeights[(cellX + 1) * latticeSize + cellY] * fractionX;
+			const int bottom = latticeWeights[cellX * latticeSize + cellY + 1] * (featureSize - fractionX) +
+				latticeWeights[(cellX + 1) * latticeSize + cellY + 1] * fractionX;
+			const int weight = (top * (featureSize - fractionY) + bottom * fractionY) / (featureSize * featureSize);
+			setWeight(navigationGrid, x, y, std::max(weight, 1));
+
+			// about one grid square in 25 is blocked
+			if (drawBelow(engine, 25) == 0) {
+				setWeight(navigationGrid, x, y, GB::BLOCKED_GRID_WEIGHT);
+			}
+		}
+	}
+
+	scenario->addRandomPathRequests(requestCount, REQUEST_SEED);
+	return scenario;
+}
+
+/// <summary>
+/// Creates an open field with a walled off area in its center that every path request ends in.
+/// No request has a path, so every search expands every grid square outside of the walls.
+/// </summary>
+/// <param name="gridSize">The length of both sides of the navigation grid. At least 8.</param>
+/// <param name="requestCount">The number of path requests from random grid squares outside of the walls.</param>
+/// <returns>The scenario.</returns>
+std::unique_ptr<NavigationScenario> BENCH::makeUnreachableScenario(unsigned int gridSize, std::size_t requestCount) {
+	auto scenario = std::make_unique<NavigationScenario>("unreachable target", gridSize);
+	GB::NavigationGrid& navigationGrid = scenario->getNavigationGrid();
+
+	// a ring of blocked grid squares around the target. Its inside is blocked while the starts are drawn.
+	const unsigned int center = gridSize / 2;
+	for (unsigned int x = center - 2; x <= center + 2; ++x) {
+		for (unsigned int y = center - 2; y <= center + 2; ++y) {
+			setWeight(navigationGrid, x, y, GB::BLOCKED_GRID_WEIGHT);
+		}
+	}
+
+	std::minstd_rand engine(REQUEST_SEED);
+	const sf::Vector2i target(static_cast<int>(center), static_cast<int>(center));
+	for (std::size_t i = 0; i < requestCount; ++i) {
+		scenario->addPathRequest(GB::PathRequest{drawUnblockedGridSquare(navigationGrid, engine), target});
+	}
+	for (unsigned int x = center - 1; x <= center + 1; ++x) {
+		for (unsigned int y = center - 1; y <= center + 1; ++y) {
+			setWeight(navigationGrid, x, y, 1);
+		}
+	}
+	return scenario;
+}
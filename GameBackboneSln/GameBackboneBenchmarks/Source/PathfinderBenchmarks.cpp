@@ -0,0 +1,192 @@
+#include <GameBackboneBenchmarks/PathfinderBenchmarks.h>
+#include <GameBackboneBenchmarks/NavigationScenarios.h>
+
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace GB {
+
+	/// <summary>
+	/// Calls the private steps of a Pathfinder search, so each step can be timed on its own.
+	/// </summary>
+	struct PathfinderBenchmarkAccess {
+
+		/// <summary>
+		/// Gets the neighbors a search would expand from a grid square.
+		/// </summary>
+		static void getNeighbors(const Pathfinder& pathfinder, const sf::Vector2i& gridSquare, std::vector<sf::Vector2i>& neighbors) {
+			pathfinder.getNeighbors(gridSquare, neighbors);
+		}
+
+		/// <summary>
+		/// Searches a path and keeps the finished search in a workspace.
+		/// </summary>
+		/// <returns>True if the request has a path. False otherwise.</returns>
+		static bool searchPath(const Pathfinder& pathfinder, const PathRequest& pathRequest, PathSearchWorkspace& workspace) {
+			workspace.fitToGridSize(static_cast<std::size_t>(pathfinder.getGridSizeX()) * pathfinder.getGridSizeY());
+			pathfinder.updateMinGridWeight();
+			if (pathfinder.isJumpPointSearch(pathRequest)) {
+				pathfinder.updateJumpDistances();
+			}
+			pathfinder.findPath(pathRequest, workspace);
+			return !workspace.getPathBuffer().empty();
+		}
+
+		/// <summary>
+		/// Rebuilds the path of a finished standard search, and copies it in order like pathFind.
+		/// </summary>
+		static void reconstructPath(const Pathfinder& pathfinder, const PathRequest& pathRequest, PathSearchWorkspace& workspace, std::deque<sf::Vector2i>& path) {
+			std::vector<sf::Vector2i>& reversedPath = workspace.getPathBuffer();
+			reversedPath.clear();
+			pathfinder.reconstructPath(pathfinder.flattenGridCoordinate(pathRequest.end), workspace, PATH_SEARCH_MODE_STANDARD);
+			path.assign(reversedPath.rbegin(), reversedPath.rend());
+		}
+	};
+
+}
+
+using namespace BENCH;
+
+namespace {
+
+	/// The batch sizes passed to pathFind.
+	const std::size_t BATCH_SIZES[] = {1, 10, 100, MAX_BATCH_SIZE};
+
+	/// The number of finished searches whose paths are rebuilt by each sample of the reconstructPath benchmarks.
+	constexpr std::size_t RECONSTRUCTED_PATH_COUNT = 16;
+
+	/// <summary>
+	/// A scenario and a Pathfinder on its navigation grid, shared by the benchmarks of the scenario.
+	/// Two more Pathfinders search a DenseNavigationGrid and a CompactNavigationGrid copy of the grid.
+	/// </summary>
+	struct ScenarioPathfinder {
+		std::unique_ptr<NavigationScenario> scenario;
+		GB::Pathfinder pathfinder;
+		GB::DenseNavigationGrid denseNavigationGrid;
+		GB::Pathfinder densePathfinder;
+		GB::CompactNavigationGrid compactNavigationGrid;
+		GB::Pathfinder compactPathfinder;
+
+		explicit ScenarioPathfinder(std::unique_ptr<NavigationScenario> newScenario) :
+			scenario(std::move(newScenario)),
+			pathfinder(&scenario->getNavigationGrid()),
+			denseNavigationGrid(scenario->getNavigationGrid()),
+			densePathfinder(&denseNavigationGrid),
+			compactNavigationGrid(scenario->getNavigationGrid()),
+			compactPathfinder(&compactNavigationGrid) {
+		}
+	};
+
+	/// <summary>
+	/// Adds the benchmarks of pathFind for every batch size, on each kind of navigation grid of the scenario.
+	/// </summary>
+	void addPathFindBenchmarks(BenchmarkRunner& runner, const std::shared_ptr<ScenarioPathfinder>& scenarioPathfinder) {
+		const std::pair<std::string, GB::Pathfinder*> gridPathfinders[] = {
+			{"pathFind/", &scenarioPathfinder->pathfinder},
+			{"pathFind dense/", &scenarioPathfinder->densePathfinder},
+			{"pathFind compact/", &scenarioPathfinder->compactPathfinder}
+		};
+		for (const std::pair<std::string, GB::Pathfinder*>& gridPathfinder : gridPathfinders) {
+			GB::Pathfinder* pathfinder = gridPathfinder.second;
+			for (std::size_t batchSize : BATCH_SIZES) {
+				auto pathRequests = std::make_shared<std::vector<GB::PathRequest>>(scenarioPathfinder->scenario->getPathRequests(batchSize));
+				auto paths = std::make_shared<std::vector<std::deque<sf::Vector2i>>>();
+				runner.addBenchmark(gridPathfinder.first + scenarioPathfinder->scenario->getName() + "/" + std::to_string(batchSize), "expansions",
+					[scenarioPathfinder, pathfinder, pathRequests, paths]() {
+						pathfinder->pathFind(*pathRequests, paths.get());
+						return pathfinder->getExpandedNodeCount();
+					});
+			}
+		}
+	}
+
+	/// <summary>
+	/// Adds the benchmark of getNeighbors, which gets the neighbors of every grid square once per sample.
+	/// The work of a sample is the number of neighbors found.
+	/// </summary>
+	void addGetNeighborsBenchmark(BenchmarkRunner& runner, const std::shared_ptr<ScenarioPathfinder>& scenarioPathfinder) {
+		auto neighbors = std::make_shared<std::vector<sf::Vector2i>>();
+		runner.addBenchmark("getNeighbors/" + scenarioPathfinder->scenario->getName(), "neighbors",
+			[scenarioPathfinder, neighbors]() {
+				const GB::NavigationGrid& navigationGrid = scenarioPathfinder->scenario->getNavigationGrid();
+				const int sizeX = static_cast<int>(navigationGrid.getArraySizeX());
+				const int sizeY = static_cast<int>(navigationGrid.getArraySizeY());
+				std::size_t neighborCount = 0;
+				for (int x = 0; x < sizeX; ++x) {
+					for (int y = 0; y < sizeY; ++y) {
+						GB::PathfinderBenchmarkAccess::getNeighbors(scenarioPathfinder->pathfinder, sf::Vector2i(x, y), *neighbors);
+						neighborCount += neighbors->size();
+					}
+				}
+				return neighborCount;
+			});
+	}
+
+	/// <summary>
+	/// Adds the benchmark of reconstructPath, which rebuilds the paths of the first requests of the scenario that have one.
+	/// The searches are run once while the benchmark is added, so only rebuilding the paths is timed.
+	/// </summary>
+	void addReconstructPathBenchmark(BenchmarkRunner& runner, const std::shared_ptr<ScenarioPathfinder>& scenarioPathfinder) {
+		auto searchedRequests = std::make_shared<std::vector<GB::PathRequest>>();
+		auto workspaces = std::make_shared<std::vector<GB::PathSearchWorkspace>>(RECONSTRUCTED_PATH_COUNT);
+		for (const GB::PathRequest& pathRequest : scenarioPathfinder->scenario->getPathRequests()) {
+			if (searchedRequests->size() == RECONSTRUCTED_PATH_COUNT) {
+				break;
+			}
+			if (GB::PathfinderBenchmarkAccess::searchPath(scenarioPathfinder->pathfinder, pathRequest, (*workspaces)[searchedRequests->size()])) {
+				searchedRequests->push_back(pathRequest);
+			}
+		}
+		if (searchedRequests->empty()) {
+			return;
+		}
+
+		auto path = std::make_shared<std::deque<sf::Vector2i>>();
+		runner.addBenchmark("reconstructPath/" + scenarioPathfinder->scenario->getName(), "waypoints",
+			[scenarioPathfinder, searchedRequests, workspaces, path]() {
+				std::size_t waypointCount = 0;
+				for (std::size_t i = 0; i < searchedRequests->size(); ++i) {
+					path->clear();
+					GB::PathfinderBenchmarkAccess::reconstructPath(scenarioPathfinder->pathfinder, (*searchedRequests)[i], (*workspaces)[i], *path);
+					waypointCount += path->size();
+				}
+				return waypointCount;
+			});
+	}
+}
+
+/// <summary>
+/// Adds the benchmarks of the Pathfinder on the open field, maze, weighted terrain and unreachable target scenarios.
+/// pathFind is timed for batches of 1 to MAX_BATCH_SIZE requests on a NavigationGrid, a DenseNavigationGrid and a
+/// CompactNavigationGrid, and reports the grid squares it expands per second.
+/// getNeighbors and reconstructPath are timed on their own.
+/// </summary>
+/// <param name="runner">Receives the benchmarks.</param>
+/// <param name="gridSize">The length of both sides of the navigation grid of every scenario.</param>
+void BENCH::addPathfinderBenchmarks(BenchmarkRunner& runner, unsigned int gridSize) {
+	std::shared_ptr<ScenarioPathfinder> scenarioPathfinders[] = {
+		std::make_shared<ScenarioPathfinder>(makeOpenFieldScenario(gridSize, MAX_BATCH_SIZE)),
+		std::make_shared<ScenarioPathfinder>(makeMazeScenario(gridSize, MAX_BATCH_SIZE)),
+		std::make_shared<ScenarioPathfinder>(makeWeightedTerrainScenario(gridSize, MAX_BATCH_SIZE)),
+		std::make_shared<ScenarioPathfinder>(makeUnreachableScenario(gridSize, MAX_BATCH_SIZE))
+	};
+
+	for (const std::shared_ptr<ScenarioPathfinder>& scenarioPathfinder : scenarioPathfinders) {
+		addPathFindBenchmarks(runner, scenarioPathfinder);
+	}
+	addGetNeighborsBenchmark(runner, scenarioPathfinders[0]);
+	for (const std::shared_ptr<ScenarioPathfinder>& scenarioPathfinder : scenarioPathfinders) {
+		addReconstructPathBenchmark(runner, scenarioPathfinder);
+	}
+}
@@ -0,0 +1,99 @@
+#include <GameBackboneBenchmarks/BenchmarkRunner.h>
+#include <GameBackboneBenchmarks/ClusterGreenhouseBenchmarks.h>
+#include <GameBackboneBenchmarks/PathfinderBenchmarks.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace BENCH;
+
+namespace {
+
+	/// The length of both sides of the navigation grids, if no other size is chosen.
+	constexpr unsigned int DEFAULT_GRID_SIZE = 256;
+
+	/// The smallest grid that fits the walls of the unreachable target scenario.
+	constexpr unsigned int MIN_GRID_SIZE = 8;
+
+	/// <summary>
+	/// Reads the value of a command line option of the form --name=value.
+	/// </summary>
+	/// <param name="argument">The command line argument.</param>
+	/// <param name="name">The name of the option with its leading dashes and trailing equals sign.</param>
+	/// <param name="value">Receives the value if the argument is the option.</param>
+	/// <returns>True if the argument is the option. False otherwise.</returns>
+	bool readOption(const std::string& argument, const std::string& name, std::string& value) {
+		if (argument.compare(0, name.size(), name) != 0) {
+			return false;
+		}
+		value = argument.substr(name.size());
+		return true;
+	}
+
+	/// <summary>
+	/// Prints the command line options.
+	/// </summary>
+	void printUsage() {
+		std::cout << "usage: GameBackboneBenchmarks [options]\n"
+			<< "  --filter=TEXT       only run benchmarks whose names contain TEXT\n"
+			<< "  --grid-size=N       length of both sides of every navigation grid, at least " << MIN_GRID_SIZE << " (default " << DEFAULT_GRID_SIZE << ")\n"
+			<< "  --min-samples=N     timed samples every benchmark runs at least (default " << BenchmarkRunner::DEFAULT_MIN_SAMPLE_COUNT << ")\n"
+			<< "  --max-samples=N     timed samples no benchmark runs more than (default " << BenchmarkRunner::DEFAULT_MAX_SAMPLE_COUNT << ")\n"
+			<< "  --min-time=SECONDS  time every benchmark runs at least (default " << BenchmarkRunner::DEFAULT_MIN_DURATION << ")\n"
+			<< "  --csv=FILE          also write the results to FILE as comma separated values\n";
+	}
+}
+
+int main(int argc, char* argv[]) {
+	BenchmarkRunner runner;
+	unsigned int gridSize = DEFAULT_GRID_SIZE;
+	std::size_t minSampleCount = BenchmarkRunner::DEFAULT_MIN_SAMPLE_COUNT;
+	std::size_t maxSampleCount = BenchmarkRunner::DEFAULT_MAX_SAMPLE_COUNT;
+	std::string csvPath;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string argument = argv[i];
+		std::string value;
+		if (readOption(argument, "--filter=", value)) {
+			runner.setFilter(value);
+		}
+		else if (readOption(argument, "--grid-size=", value)) {
+			gridSize = std::max(static_cast<unsigned int>(std::stoul(value)), MIN_GRID_SIZE);
+		}
+		else if (readOption(argument, "--min-samples=", value)) {
+			minSampleCount = std::stoul(value);
+		}
+		else if (readOption(argument, "--max-samples=", value)) {
+			maxSampleCount = std::stoul(value);
+		}
+		else if (readOption(argument, "--min-time=", value)) {
+			runner.setMinDuration(std::stod(value));
+		}
+		else if (readOption(argument, "--csv=", value)) {
+			csvPath = value;
+		}
+		else {
+			printUsage();
+			return (argument == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	runner.setSampleCounts(minSampleCount, maxSampleCount);
+
+	// the scenarios are generated before any benchmark runs
+	addPathfinderBenchmarks(runner, gridSize);
+	addClusterGreenhouseBenchmarks(runner);
+	runner.runAll(std::cout);
+
+	if (!csvPath.empty()) {
+		std::ofstream csvFile(csvPath);
+		if (!csvFile) {
+			std::cerr << "Failed to open " << csvPath << std::endl;
+			return EXIT_FAILURE;
+		}
+		runner.writeCsv(csvFile);
+	}
+	return EXIT_SUCCESS;
+}
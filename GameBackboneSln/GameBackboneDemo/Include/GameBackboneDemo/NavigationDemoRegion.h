@@ -3,12 +3,16 @@
 #include <GameBackboneDemo/DemoRegion.h>
 
 #include <GameBackbone/Navigation/CoordinateConverter.h>
+#include <GameBackbone/Navigation/FlowField.h>
+#include <GameBackbone/Navigation/PackedPathBatch.h>
 #include <GameBackbone/Navigation/PathFinder.h>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 namespace EXE {
 
@@ -64,6 +68,9 @@ namespace EXE {
 		void destroy();
 		virtual void reset() override;
 
+		// Navigator movement
+		void moveNavigator(std::size_t navigatorIndex, sf::Int64 elapsedTime);
+
 		// Sprite textures
 		std::unique_ptr<sf::Texture> navigatorTexture;
 		std::unique_ptr<sf::Texture> gridTexture;
@@ -73,10 +80,13 @@ namespace EXE {
 
 		// Pathfinding
 		GB::Pathfinder regionPathfinder;
+		GB::FlowField regionFlowField;
 		std::unique_ptr<GB::NavigationGrid> navGrid;
 		const unsigned int NAV_GRID_DIM = 20;
 		const float VISUAL_GRID_SCALE = 1.0f;
-		std::vector<GB::WindowCoordinatePathPtr> paths;
+		GB::PackedPathBatch packedPaths;
+		std::vector<GB::PackedPath> paths; // read from packedPaths
+		std::vector<sf::Vector2i> flowFieldWaypoints; // the grid square each navigator walks to next. Empty until a destination is clicked.
 		GB::CoordinateConverter coordinateConverter;
 
 		// GUI handle functions
@@ -52,20 +52,20 @@ void NavigationDemoRegion::update(sf::Int64 elapsedTime) {
 	case EXE::NAVIGATOR_1:
 	{
 		// Move the first navigator
-		GB::moveSpriteAlongPath(*navigators[0], paths[0], elapsedTime, 0.0005f);
+		moveNavigator(0, elapsedTime);
 		break;
 	}
 	case EXE::NAVIGATOR_2:
 	{
 		// Move the second navigator
-		GB::moveSpriteAlongPath(*navigators[1], paths[1], elapsedTime, 0.0005f);
+		moveNavigator(1, elapsedTime);
 		break;
 	}
 	case EXE::ALL_NAVIGATORS:
 	{
 		// Loop through and move all navigators
 		for (size_t i = 0; i < navigators.size(); i++) {
-			GB::moveSpriteAlongPath(*navigators[i], paths[i], elapsedTime, 0.0005f);
+			moveNavigator(i, elapsedTime);
 		}
 		break;
 	}
@@ -82,36 +82,37 @@ void NavigationDemoRegion::update(sf::Int64 elapsedTime) {
 void NavigationDemoRegion::handleMouseClick(sf::Vector2f clickPosition, sf::Mouse::Button button) {
 	// Check if the user left clicked
 	if (button == sf::Mouse::Left) {
-		// Create a vector to store the PathRequests that is the size of the number of navigators
-		std::vector<GB::PathRequest> pathRequests(navigators.size());
+		// Every navigator shares the clicked destination, so one flow field replaces a path search per navigator
+		sf::Vector2i endingPos = coordinateConverter.convertCoordToNavGrid(clickPosition);
+		regionFlowField.generate(endingPos);
 
-		// Create each PathRequest
+		// Each navigator first walks to the center of the grid square it is on, then follows the flow field from there
+		flowFieldWaypoints.resize(navigators.size());
 		for (size_t i = 0; i < navigators.size(); i++) {
-			// Get the current sf position of the navigator's sprite
-			sf::Vector2f sfPos = navigators[i]->getPosition();
-			// Convert the sfPos to NavGrid coordinates to use as the starting position
-			sf::Vector2i startingPos = coordinateConverter.convertCoordToNavGrid(sfPos);
-			// Convert the clicked position from sf to NavGrid coordinates to use as the end position
-			sf::Vector2i endingPos = coordinateConverter.convertCoordToNavGrid(clickPosition);
-			// Create and assign the PathRequest for the given start and end position
-			pathRequests[i] = GB::PathRequest{ startingPos, endingPos };
+			flowFieldWaypoints[i] = coordinateConverter.convertCoordToNavGrid(navigators[i]->getPosition());
 		}
+	}
+}
 
-		// Prepare a vector to be used as an output parameter
-		std::vector<GB::NavGridCoordinatePath> pathsReturn(pathRequests.size());
-		// Call pathFind to get the paths the navigators will use 
-		regionPathfinder.pathFind(pathRequests, &pathsReturn);
-
-		// Clear and resize the member variable to store the active paths
-		paths.clear();
-		paths.resize(pathsReturn.size());
-		for (unsigned int i = 0; i < navigators.size(); i++) {
-			// Convert the path to sf coordinates
-			GB::WindowCoordinatePath sfCoordPath = coordinateConverter.convertPathToWindow(pathsReturn[i]);
-			// Use std::move to avoid a copy when assigning the converted path to the member variable
-			paths[i] = std::make_shared<GB::WindowCoordinatePath>(std::move(sfCoordPath));
-		}
+/// <summary>
+/// Moves a navigator one step along its path, or along the flow field once a destination was clicked.
+/// The flow field is sampled at the grid square the navigator reached, so no path is built for it.
+/// </summary>
+/// <param name="navigatorIndex">The index of the navigator.</param>
+/// <param name="elapsedTime">The time passed in microseconds.</param>
+void NavigationDemoRegion::moveNavigator(std::size_t navigatorIndex, sf::Int64 elapsedTime) {
+	sf::Sprite& navigator = *navigators[navigatorIndex];
+	if (flowFieldWaypoints.empty()) {
+		GB::moveSpriteAlongPath(navigator, paths[navigatorIndex], coordinateConverter, elapsedTime, 0.0005f);
+		return;
+	}
+
+	// Once the navigator stands on its waypoint, the flow field tells it which grid square to walk to next
+	sf::Vector2i& waypoint = flowFieldWaypoints[navigatorIndex];
+	if (navigator.getPosition() == coordinateConverter.convertCoordToWindow(waypoint)) {
+		waypoint += regionFlowField.getDirection(waypoint);
 	}
+	GB::moveSpriteStepTowardsPoint(navigator, coordinateConverter.convertCoordToWindow(waypoint), elapsedTime * 0.0005f);
 }
 
 /// <summary>
@@ -122,6 +123,7 @@ void NavigationDemoRegion::init() {
 	navGrid = std::make_unique<GB::NavigationGrid>(NAV_GRID_DIM);
 	GB::initAllNavigationGridValues(*navGrid, NavigationDemoData());
 	regionPathfinder.setNavigationGrid(navGrid.get());
+	regionFlowField.setNavigationGrid(navGrid.get());
 
 
 	// Initialize the arrow textures for the navigators
@@ -186,15 +188,11 @@ void NavigationDemoRegion::init() {
 	GB::PathRequest pathRequest2{ navigator2StartingGrid, navigator1StartingGrid };
 	pathRequests.push_back(pathRequest2);
 
-	// Find the path
-	std::vector<std::deque<sf::Vector2i>> pathsReturn;
-	pathsReturn.resize(pathRequests.size());
-	regionPathfinder.pathFind(pathRequests, &pathsReturn);
-
-	// Convert paths to window coordinates
-	paths.resize(pathsReturn.size());
+	// Find the paths and pack them into one buffer
+	regionPathfinder.pathFind(pathRequests, &packedPaths);
+	paths.resize(packedPaths.getPathCount());
 	for (unsigned int i = 0; i < navigators.size(); i++) {
-		paths[i] = std::make_shared<std::deque<sf::Vector2f>>(coordinateConverter.convertPathToWindow(pathsReturn[i]));
+		paths[i] = packedPaths.getPath(i);
 	}
 
 	// All navigators will move to a mouse click by default
@@ -386,9 +384,12 @@ void NavigationDemoRegion::destroy() {
 
 	// Reset pathfinder
 	regionPathfinder.setNavigationGrid(nullptr);
+	regionFlowField.setNavigationGrid(nullptr);
 
 	// Clear paths
 	paths.clear();
+	packedPaths.clear();
+	flowFieldWaypoints.clear();
 
 	// Delete navigators
 	// The navigators are managed by the vector
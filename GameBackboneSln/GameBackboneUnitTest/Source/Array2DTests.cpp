@@ -2,6 +2,9 @@
 
 #include <GameBackbone/Util/Array2D.h>
 
+#include <cstddef>
+#include <vector>
+
 using namespace GB;
 
 BOOST_AUTO_TEST_SUITE(Array2D_Tests)
@@ -150,4 +153,66 @@ BOOST_AUTO_TEST_CASE(Array2D_operatorSqare_get_set) {
 
 BOOST_AUTO_TEST_SUITE_END() // end Array2D_Accessors
 
+BOOST_AUTO_TEST_SUITE(Array2D_Layouts)
+
+// Tests that the default layout stores the elements along y next to each other
+BOOST_AUTO_TEST_CASE(Array2D_ColumnMajorLayout_order) {
+	BOOST_CHECK_EQUAL(ColumnMajorLayout::flatten2dCoordinate(2, 3, 5, 7), 2u * 7u + 3u);
+	BOOST_CHECK_EQUAL(ColumnMajorLayout::calcStorageSize(5, 7), 35u);
+}
+
+// Tests that the row major layout stores the elements along x next to each other
+BOOST_AUTO_TEST_CASE(Array2D_RowMajorLayout_order) {
+	BOOST_CHECK_EQUAL(RowMajorLayout::flatten2dCoordinate(2, 3, 5, 7), 3u * 5u + 2u);
+	BOOST_CHECK_EQUAL(RowMajorLayout::calcStorageSize(5, 7), 35u);
+}
+
+// Tests that the Morton layout interleaves the bits of x and y inside of a block
+BOOST_AUTO_TEST_CASE(Array2D_MortonLayout_order) {
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(0, 1, 8, 8), 1u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(1, 0, 8, 8), 2u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(1, 1, 8, 8), 3u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(3, 3, 8, 8), 15u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(0, 4, 8, 8), 16u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::flatten2dCoordinate(4, 0, 8, 8), 32u);
+	BOOST_CHECK_EQUAL(MortonLayout<2>::calcStorageSize(5, 7), 64u);
+}
+
+// Tests that every element of a Morton layout has its own position within the storage
+BOOST_AUTO_TEST_CASE(Array2D_MortonLayout_unique_positions) {
+	const unsigned int xLength = 37;
+	const unsigned int yLength = 21;
+	std::vector<int> useCounts(MortonLayout<>::calcStorageSize(xLength, yLength), 0);
+	for (unsigned int x = 0; x < xLength; ++x) {
+		for (unsigned int y = 0; y < yLength; ++y) {
+			const std::size_t position = MortonLayout<>::flatten2dCoordinate(x, y, xLength, yLength);
+			BOOST_REQUIRE_LT(position, useCounts.size());
+			++useCounts[position];
+		}
+	}
+	for (int useCount : useCounts) {
+		BOOST_CHECK_LE(useCount, 1);
+	}
+}
+
+// Tests that every layout reads back the values written to an array whose sides are not powers of two
+BOOST_AUTO_TEST_CASE(Array2D_layouts_get_set) {
+	Array2D<int, RowMajorLayout> rowMajorArray(13, 29);
+	Array2D<int, MortonLayout<>> mortonArray(13, 29);
+	for (unsigned int i = 0; i < 13; ++i) {
+		for (unsigned int j = 0; j < 29; ++j) {
+			rowMajorArray(i, j) = static_cast<int>(i * 100 + j);
+			mortonArray.at(i, j) = static_cast<int>(i * 100 + j);
+		}
+	}
+	for (unsigned int i = 0; i < 13; ++i) {
+		for (unsigned int j = 0; j < 29; ++j) {
+			BOOST_CHECK_EQUAL(rowMajorArray.at(i, j), static_cast<int>(i * 100 + j));
+			BOOST_CHECK_EQUAL(mortonArray(i, j), static_cast<int>(i * 100 + j));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end Array2D_Layouts
+
 BOOST_AUTO_TEST_SUITE_END() // end Array3D_Tests
\ No newline at end of file
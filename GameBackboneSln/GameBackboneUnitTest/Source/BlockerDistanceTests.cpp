@@ -0,0 +1,284 @@
+#include "stdafx.h"
+#include "NavigationTestUtils.h"
+
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Finds the blocker distance of a grid square by comparing it against every blocked grid square and the edge of the grid.
+	/// </summary>
+	unsigned int calcBruteForceBlockerDist(const DenseNavigationGrid& navGrid, unsigned int x, unsigned int y) {
+		unsigned int blockerDist = std::min({x + 1, y + 1, navGrid.getArraySizeX() - x, navGrid.getArraySizeY() - y});
+		for (unsigned int blockerX = 0; blockerX < navGrid.getArraySizeX(); ++blockerX) {
+			for (unsigned int blockerY = 0; blockerY < navGrid.getArraySizeY(); ++blockerY) {
+				if (navGrid.getWeight(blockerX, blockerY) >= BLOCKED_GRID_WEIGHT) {
+					const int xDistance = std::abs(static_cast<int>(blockerX) - static_cast<int>(x));
+					const int yDistance = std::abs(static_cast<int>(blockerY) - static_cast<int>(y));
+					blockerDist = std::min(blockerDist, static_cast<unsigned int>(std::max(xDistance, yDistance)));
+				}
+			}
+		}
+		return blockerDist;
+	}
+
+	/// <summary>
+	/// Creates a 20 by 9 grid with a wall along x = 10. The wall has a gap one grid square wide at y = 1
+	/// and a gap three grid squares wide from y = 5 to y = 7.
+	/// </summary>
+	DenseNavigationGrid createWallWithGaps() {
+		DenseNavigationGrid navGrid(20, 9, NavigationGridData{ 1, 0 });
+		for (unsigned int y = 0; y < 9; ++y) {
+			if (y != 1 && (y < 5 || y > 7)) {
+				navGrid.setWeight(10, y, BLOCKED_GRID_WEIGHT);
+			}
+		}
+		calcBlockerDistances(navGrid);
+		return navGrid;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(BlockerDistance_Tests)
+
+BOOST_AUTO_TEST_SUITE(BlockerDistance_calcBlockerDistances)
+
+// Tests that a grid without blocked grid squares measures the distance to its edge
+BOOST_AUTO_TEST_CASE(calcBlockerDistances_no_blockers) {
+	DenseNavigationGrid navGrid(5, 7, NavigationGridData{ 1, 0 });
+
+	calcBlockerDistances(navGrid);
+
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(0, 0), 1u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(4, 6), 1u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(1, 3), 2u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(2, 3), 3u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(2, 1), 2u);
+}
+
+// Tests that blocked grid squares get 0 and the distance counts diagonal steps as 1
+BOOST_AUTO_TEST_CASE(calcBlockerDistances_single_blocker) {
+	DenseNavigationGrid navGrid(11, 11, NavigationGridData{ 1, 0 });
+	navGrid.setWeight(5, 5, BLOCKED_GRID_WEIGHT);
+
+	calcBlockerDistances(navGrid);
+
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(5, 5), 0u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(4, 4), 1u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(5, 7), 2u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(7, 3), 2u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(3, 6), 2u);
+}
+
+// Tests that every blocker distance matches the distance to the closest blocked grid square
+BOOST_AUTO_TEST_CASE(calcBlockerDistances_matches_brute_force) {
+	const unsigned int blockedOneIns[] = {3, 10, 60};
+	for (unsigned int blockedOneIn : blockedOneIns) {
+		DenseNavigationGrid navGrid(25, 17);
+		TEST::fillRandomWeights(navGrid, blockedOneIn, blockedOneIn);
+
+		calcBlockerDistances(navGrid);
+
+		for (unsigned int x = 0; x < 25; ++x) {
+			for (unsigned int y = 0; y < 17; ++y) {
+				BOOST_CHECK_EQUAL(navGrid.getBlockerDist(x, y), calcBruteForceBlockerDist(navGrid, x, y));
+			}
+		}
+	}
+}
+
+// Tests that a NavigationGrid gets the same blocker distances as a dense grid
+BOOST_AUTO_TEST_CASE(calcBlockerDistances_NavigationGrid_matches_dense) {
+	DenseNavigationGrid denseGrid(19, 23);
+	TEST::fillRandomWeights(denseGrid, 5, 8);
+	NavigationGrid navGrid(19, 23);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	for (unsigned int x = 0; x < 19; ++x) {
+		for (unsigned int y = 0; y < 23; ++y) {
+			navGrid[x][y]->weight = denseGrid.getWeight(x, y);
+		}
+	}
+
+	calcBlockerDistances(denseGrid);
+	calcBlockerDistances(navGrid);
+
+	for (unsigned int x = 0; x < 19; ++x) {
+		for (unsigned int y = 0; y < 23; ++y) {
+			BOOST_CHECK_EQUAL(navGrid[x][y]->blockerDist, denseGrid.getBlockerDist(x, y));
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end BlockerDistance_calcBlockerDistances
+
+BOOST_AUTO_TEST_SUITE(BlockerDistance_updateBlockerDistances)
+
+// Tests that repairing the distances after blocking and unblocking grid squares matches computing them again
+BOOST_AUTO_TEST_CASE(updateBlockerDistances_matches_calcBlockerDistances) {
+	DenseNavigationGrid navGrid(32, 27);
+	TEST::fillRandomWeights(navGrid, 9, 12);
+	calcBlockerDistances(navGrid);
+
+	std::minstd_rand random(21);
+	for (int edit = 0; edit < 60; ++edit) {
+		// flip a few grid squares near each other, including some that are already in the wanted state
+		std::vector<sf::Vector2i> changedGridSquares;
+		const unsigned int centerX = static_cast<unsigned int>(random() % 32);
+		const unsigned int centerY = static_cast<unsigned int>(random() % 27);
+		const unsigned int changeCount = static_cast<unsigned int>(random() % 6 + 1);
+		for (unsigned int i = 0; i < changeCount; ++i) {
+			const unsigned int x = std::min(centerX + static_cast<unsigned int>(random() % 4), 31u);
+			const unsigned int y = std::min(centerY + static_cast<unsigned int>(random() % 4), 26u);
+			navGrid.setWeight(x, y, (random() % 2 == 0) ? BLOCKED_GRID_WEIGHT : 1);
+			changedGridSquares.emplace_back(static_cast<int>(x), static_cast<int>(y));
+		}
+
+		updateBlockerDistances(navGrid, changedGridSquares);
+
+		DenseNavigationGrid expectedGrid = navGrid;
+		calcBlockerDistances(expectedGrid);
+		BOOST_REQUIRE(navGrid.getBlockerDists() == expectedGrid.getBlockerDists());
+	}
+}
+
+// Tests that removing the only blocker restores the distances to the edge of the grid
+BOOST_AUTO_TEST_CASE(updateBlockerDistances_remove_last_blocker) {
+	NavigationGrid navGrid(9, 9);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1, 0 });
+	navGrid[4][4]->weight = BLOCKED_GRID_WEIGHT;
+	calcBlockerDistances(navGrid);
+	BOOST_CHECK_EQUAL(navGrid[3][3]->blockerDist, 1u);
+
+	navGrid[4][4]->weight = 1;
+	updateBlockerDistances(navGrid, {sf::Vector2i(4, 4)});
+
+	for (unsigned int x = 0; x < 9; ++x) {
+		for (unsigned int y = 0; y < 9; ++y) {
+			BOOST_CHECK_EQUAL(navGrid[x][y]->blockerDist, std::min({x + 1, y + 1, 9 - x, 9 - y}));
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+// Tests that grid squares outside of the grid and grid squares whose weight changed without being blocked or unblocked are ignored
+BOOST_AUTO_TEST_CASE(updateBlockerDistances_ignores_unaffecting_changes) {
+	DenseNavigationGrid navGrid(6, 6, NavigationGridData{ 1, 0 });
+	navGrid.setWeight(2, 2, BLOCKED_GRID_WEIGHT);
+	calcBlockerDistances(navGrid);
+	const std::vector<unsigned int> blockerDists = navGrid.getBlockerDists();
+
+	navGrid.setWeight(4, 4, 7);
+	updateBlockerDistances(navGrid, {sf::Vector2i(-1, 2), sf::Vector2i(6, 0), sf::Vector2i(4, 4), sf::Vector2i(2, 2)});
+
+	BOOST_CHECK(navGrid.getBlockerDists() == blockerDists);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end BlockerDistance_updateBlockerDistances
+
+BOOST_AUTO_TEST_SUITE(BlockerDistance_Pathfinder)
+
+// Tests that the unit radius defaults to 0 and can be set
+BOOST_AUTO_TEST_CASE(Pathfinder_setUnitRadius) {
+	Pathfinder pathfinder;
+	BOOST_CHECK_EQUAL(pathfinder.getUnitRadius(), 0u);
+
+	pathfinder.setUnitRadius(2);
+	BOOST_CHECK_EQUAL(pathfinder.getUnitRadius(), 2u);
+}
+
+// Tests that a unit with a radius passes through the wide gap instead of the narrow one
+BOOST_AUTO_TEST_CASE(Pathfinder_unit_radius_avoids_narrow_gap) {
+	DenseNavigationGrid navGrid = createWallWithGaps();
+	Pathfinder pathfinder(&navGrid);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 1), sf::Vector2i(17, 1) } };
+	std::vector<std::deque<sf::Vector2i>> paths;
+
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_REQUIRE(!paths[0].empty());
+	BOOST_CHECK(std::find(paths[0].begin(), paths[0].end(), sf::Vector2i(10, 1)) != paths[0].end());
+
+	pathfinder.setUnitRadius(1);
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_REQUIRE(!paths[0].empty());
+	BOOST_CHECK(paths[0].back() == sf::Vector2i(17, 1));
+	BOOST_CHECK(std::find(paths[0].begin(), paths[0].end(), sf::Vector2i(10, 6)) != paths[0].end());
+	for (const sf::Vector2i& waypoint : paths[0]) {
+		BOOST_CHECK_GT(navGrid.getBlockerDist(static_cast<unsigned int>(waypoint.x), static_cast<unsigned int>(waypoint.y)), 1u);
+	}
+
+	pathfinder.setUnitRadius(2);
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK(paths[0].empty());
+}
+
+// Tests that the lines of an any angle path keep the clearance of the unit radius
+BOOST_AUTO_TEST_CASE(Pathfinder_unit_radius_any_angle) {
+	NavigationGrid navGrid(20, 9);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1, 0 });
+	const DenseNavigationGrid denseGrid = createWallWithGaps();
+	for (unsigned int x = 0; x < 20; ++x) {
+		for (unsigned int y = 0; y < 9; ++y) {
+			navGrid[x][y]->weight = denseGrid.getWeight(x, y);
+		}
+	}
+	calcBlockerDistances(navGrid);
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_ANY_ANGLE);
+	pathfinder.setUnitRadius(1);
+
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(17, 2) } };
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	BOOST_REQUIRE(!paths[0].empty());
+	BOOST_CHECK(paths[0].back() == sf::Vector2i(17, 2));
+	const auto getClearanceWeight = [&navGrid](int x, int y) {
+		return (navGrid.at(static_cast<unsigned int>(x), static_cast<unsigned int>(y))->blockerDist > 1) ? 1 : BLOCKED_GRID_WEIGHT;
+	};
+	sf::Vector2i lineStart = pathRequests[0].start;
+	for (const sf::Vector2i& waypoint : paths[0]) {
+		BOOST_CHECK_LT(walkLineOfSight(getClearanceWeight, lineStart, waypoint), BLOCKED_GRID_WEIGHT);
+		lineStart = waypoint;
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+// Tests that the radius is kept after the blocker distances are repaired for a changed grid
+BOOST_AUTO_TEST_CASE(Pathfinder_unit_radius_after_updateBlockerDistances) {
+	DenseNavigationGrid navGrid = createWallWithGaps();
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setUnitRadius(1);
+	pathfinder.setPathCacheMemoryLimit(1 << 16);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 1), sf::Vector2i(17, 1) } };
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_REQUIRE(!paths[0].empty());
+
+	// narrow the wide gap to two grid squares, leaving no room for the unit
+	navGrid.setWeight(10, 7, BLOCKED_GRID_WEIGHT);
+	const std::vector<sf::Vector2i> changedGridSquares{ sf::Vector2i(10, 7) };
+	updateBlockerDistances(navGrid, changedGridSquares);
+	pathfinder.updateGridSquares(changedGridSquares);
+
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK(paths[0].empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end BlockerDistance_Pathfinder
+
+BOOST_AUTO_TEST_SUITE_END() // end BlockerDistance_Tests
@@ -0,0 +1,230 @@
+#include "stdafx.h"
+#include "NavigationTestUtils.h"
+
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Util/ChunkedArray2D.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <deque>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(ChunkedArray2D_Tests)
+
+BOOST_AUTO_TEST_SUITE(ChunkedArray2D_CTRs)
+
+// Tests that the default constructor creates an array without elements
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_default_CTR) {
+	ChunkedArray2D<int> intArray;
+
+	BOOST_CHECK_EQUAL(intArray.getArraySizeX(), 0u);
+	BOOST_CHECK_EQUAL(intArray.getArraySizeY(), 0u);
+	BOOST_CHECK_EQUAL(intArray.getTileCountX(), 0u);
+	BOOST_CHECK(!intArray.isInArray(0, 0));
+}
+
+// Tests that the tiles cover the array and none of them are allocated
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_all_dim_CTR) {
+	const ChunkedArray2D<int, 16> intArray(40, 16, 7);
+
+	BOOST_CHECK_EQUAL(intArray.getArraySizeX(), 40u);
+	BOOST_CHECK_EQUAL(intArray.getArraySizeY(), 16u);
+	BOOST_CHECK_EQUAL(intArray.getTileCountX(), 3u);
+	BOOST_CHECK_EQUAL(intArray.getTileCountY(), 1u);
+	BOOST_CHECK_EQUAL(intArray.getTileSize(), 16u);
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 0u);
+	BOOST_CHECK_EQUAL(intArray.getDefaultValue(), 7);
+	BOOST_CHECK(intArray.isInArray(39, 15));
+	BOOST_CHECK(!intArray.isInArray(40, 0));
+	BOOST_CHECK(!intArray.isInArray(0, 16));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ChunkedArray2D_CTRs
+
+BOOST_AUTO_TEST_SUITE(ChunkedArray2D_Accessors)
+
+// Tests that reading through a const array returns the default value without allocating
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_const_at_reads_default) {
+	ChunkedArray2D<int, 8> intArray(20, 20, 3);
+	const ChunkedArray2D<int, 8>& constArray = intArray;
+
+	BOOST_CHECK_EQUAL(constArray.at(19, 19), 3);
+	BOOST_CHECK_EQUAL(constArray(5, 12), 3);
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 0u);
+	BOOST_CHECK(intArray.getTileData(0, 0) == nullptr);
+}
+
+// Tests that writing an element only allocates its own tile
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_at_allocates_tile) {
+	ChunkedArray2D<int, 8> intArray(20, 20, 3);
+
+	intArray.at(9, 17) = 42;
+
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 1u);
+	BOOST_CHECK(intArray.isTileAllocated(1, 2));
+	BOOST_CHECK(!intArray.isTileAllocated(1, 1));
+	BOOST_CHECK_EQUAL(intArray(9, 17), 42);
+	BOOST_CHECK_EQUAL(intArray(8, 16), 3);
+	BOOST_CHECK_EQUAL(intArray.getTileData(1, 2)[1 * 8 + 1], 42);
+}
+
+// Tests that every element can be written and read back
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_at_every_element) {
+	ChunkedArray2D<int, 4> intArray(11, 6);
+	for (unsigned int x = 0; x < 11; ++x) {
+		for (unsigned int y = 0; y < 6; ++y) {
+			intArray(x, y) = static_cast<int>(x * 100 + y);
+		}
+	}
+
+	const ChunkedArray2D<int, 4>& constArray = intArray;
+	for (unsigned int x = 0; x < 11; ++x) {
+		for (unsigned int y = 0; y < 6; ++y) {
+			BOOST_CHECK_EQUAL(constArray(x, y), static_cast<int>(x * 100 + y));
+		}
+	}
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 6u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ChunkedArray2D_Accessors
+
+BOOST_AUTO_TEST_SUITE(ChunkedArray2D_Tiles)
+
+// Tests that an evicted tile reads as the default value and can be loaded again
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_evictTile_loadTile) {
+	ChunkedArray2D<int, 4> intArray(8, 8, -1);
+	intArray(5, 6) = 9;
+	intArray(1, 1) = 2;
+
+	const ChunkedArray2D<int, 4>& constArray = intArray;
+
+	std::vector<int> evictedTile = intArray.evictTile(1, 1);
+	BOOST_CHECK_EQUAL(evictedTile.size(), 16u);
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 1u);
+	BOOST_CHECK_EQUAL(constArray(5, 6), -1);
+	BOOST_CHECK(intArray.evictTile(1, 1).empty());
+
+	intArray.loadTile(1, 1, std::move(evictedTile));
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 2u);
+	BOOST_CHECK_EQUAL(intArray(5, 6), 9);
+	BOOST_CHECK_EQUAL(intArray(1, 1), 2);
+}
+
+// Tests that a short tile is padded with the default value
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_loadTile_pads) {
+	ChunkedArray2D<int, 4> intArray(4, 4, 5);
+
+	intArray.loadTile(0, 0, {1, 2});
+
+	BOOST_CHECK_EQUAL(intArray(0, 0), 1);
+	BOOST_CHECK_EQUAL(intArray(0, 1), 2);
+	BOOST_CHECK_EQUAL(intArray(0, 2), 5);
+	BOOST_CHECK_EQUAL(intArray(3, 3), 5);
+}
+
+// Tests that only allocated tiles are visited, in x major order
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_forEachAllocatedTile) {
+	ChunkedArray2D<int, 4> intArray(16, 16);
+	intArray(13, 2) = 1;
+	intArray(2, 9) = 1;
+	intArray(3, 10) = 1;
+
+	std::vector<std::pair<unsigned int, unsigned int>> visitedTiles;
+	intArray.forEachAllocatedTile([&visitedTiles](unsigned int tileX, unsigned int tileY) {
+		visitedTiles.emplace_back(tileX, tileY);
+	});
+
+	BOOST_REQUIRE_EQUAL(visitedTiles.size(), 2u);
+	BOOST_CHECK(visitedTiles[0] == std::make_pair(0u, 2u));
+	BOOST_CHECK(visitedTiles[1] == std::make_pair(3u, 0u));
+}
+
+// Tests that the elements of an edge tile outside of the array are not visited
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_forEachInTile_edge_tile) {
+	ChunkedArray2D<int, 4> intArray(6, 5);
+
+	unsigned int visitCount = 0;
+	intArray.forEachInTile(1, 1, [&visitCount](unsigned int x, unsigned int y, int& value) {
+		BOOST_CHECK(x >= 4 && x < 6);
+		BOOST_CHECK_EQUAL(y, 4u);
+		value = 8;
+		++visitCount;
+	});
+
+	BOOST_CHECK_EQUAL(visitCount, 2u);
+	BOOST_CHECK_EQUAL(intArray(5, 4), 8);
+	BOOST_CHECK(intArray.isTileAllocated(1, 1));
+}
+
+// Tests that setting every value frees every tile
+BOOST_AUTO_TEST_CASE(ChunkedArray2D_initAllValues) {
+	ChunkedArray2D<int, 4> intArray(9, 9);
+	intArray(8, 8) = 4;
+
+	intArray.initAllValues(6);
+
+	const ChunkedArray2D<int, 4>& constArray = intArray;
+	BOOST_CHECK_EQUAL(intArray.getAllocatedTileCount(), 0u);
+	BOOST_CHECK_EQUAL(constArray(8, 8), 6);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ChunkedArray2D_Tiles
+
+BOOST_AUTO_TEST_SUITE(ChunkedNavigationGrid_Tests)
+
+// Tests that line of sight and blocker distances match a dense grid with the same weights
+BOOST_AUTO_TEST_CASE(ChunkedNavigationGrid_matches_dense) {
+	DenseNavigationGrid denseGrid(70, 45, NavigationGridData{ 1, 0 });
+	ChunkedNavigationGrid chunkedGrid(70, 45, NavigationGridData{ 1, 0 });
+	TEST::fillRandomWeights(denseGrid, 4);
+	for (unsigned int x = 0; x < 70; ++x) {
+		for (unsigned int y = 0; y < 45; ++y) {
+			chunkedGrid(x, y).weight = denseGrid.getWeight(x, y);
+		}
+	}
+
+	calcBlockerDistances(denseGrid);
+	calcBlockerDistances(chunkedGrid);
+	for (unsigned int x = 0; x < 70; ++x) {
+		for (unsigned int y = 0; y < 45; ++y) {
+			BOOST_CHECK_EQUAL(chunkedGrid(x, y).blockerDist, denseGrid.getBlockerDist(x, y));
+		}
+	}
+
+	std::minstd_rand random(8);
+	for (int i = 0; i < 100; ++i) {
+		const sf::Vector2i from(static_cast<int>(random() % 70), static_cast<int>(random() % 45));
+		const sf::Vector2i to(static_cast<int>(random() % 70), static_cast<int>(random() % 45));
+		BOOST_CHECK_EQUAL(calcLineOfSightWeight(chunkedGrid, from, to), calcLineOfSightWeight(denseGrid, from, to));
+	}
+}
+
+// Tests that searching a chunked grid only reads it, so no tile is allocated
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_chunked_allocates_no_tiles) {
+	ChunkedNavigationGrid chunkedGrid(100, 100, NavigationGridData{ 1, 0 });
+	for (unsigned int y = 0; y < 90; ++y) {
+		chunkedGrid(50, y).weight = BLOCKED_GRID_WEIGHT;
+	}
+	const std::size_t allocatedTileCount = chunkedGrid.getAllocatedTileCount();
+
+	Pathfinder chunkedPathfinder(&chunkedGrid);
+	chunkedPathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(10, 10), sf::Vector2i(90, 10) }, PathRequest{ sf::Vector2i(0, 99), sf::Vector2i(99, 0) } };
+	std::vector<std::deque<sf::Vector2i>> chunkedPaths;
+	chunkedPathfinder.pathFind(pathRequests, &chunkedPaths);
+
+	BOOST_CHECK(!chunkedPaths[0].empty());
+	BOOST_CHECK(!chunkedPaths[1].empty());
+	BOOST_CHECK_EQUAL(chunkedGrid.getAllocatedTileCount(), allocatedTileCount);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ChunkedNavigationGrid_Tests
+
+BOOST_AUTO_TEST_SUITE_END() // end ChunkedArray2D_Tests
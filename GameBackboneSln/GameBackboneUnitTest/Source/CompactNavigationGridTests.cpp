@@ -0,0 +1,167 @@
+#include "stdafx.h"
+#include "NavigationTestUtils.h"
+
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(CompactNavigationGrid_Tests)
+
+BOOST_AUTO_TEST_SUITE(CompactNavigationGrid_ctr)
+
+// Tests that a new grid is passable everywhere and weighs nothing
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_size_ctr) {
+	CompactNavigationGrid navGrid(70, 3);
+
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeX(), 70u);
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeY(), 3u);
+	BOOST_CHECK_EQUAL(navGrid.getCostPrecision(), NAVIGATION_COST_PRECISION_8_BIT);
+	BOOST_CHECK_EQUAL(navGrid.getWeightScale(), 1);
+	BOOST_CHECK_EQUAL(navGrid.getMaxWeight(), 255);
+	BOOST_CHECK_EQUAL(navGrid.getPassabilityWords().size(), 4u);
+	for (unsigned int x = 0; x < 70; ++x) {
+		for (unsigned int y = 0; y < 3; ++y) {
+			BOOST_CHECK(navGrid.isPassable(x, y));
+			BOOST_CHECK_EQUAL(navGrid.getWeight(x, y), 0);
+		}
+	}
+}
+
+// Tests that converting a NavigationGrid keeps small weights exactly
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_NavigationGrid_ctr) {
+	NavigationGrid navGrid(9, 9);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	TEST::fillRandomWeights(navGrid, 2);
+
+	CompactNavigationGrid compactGrid(navGrid);
+
+	BOOST_CHECK_EQUAL(compactGrid.getWeightScale(), 1);
+	for (unsigned int x = 0; x < 9; ++x) {
+		for (unsigned int y = 0; y < 9; ++y) {
+			BOOST_CHECK_EQUAL(compactGrid.getWeight(x, y), navGrid[x][y]->weight);
+			BOOST_CHECK_EQUAL(compactGrid.isPassable(x, y), navGrid[x][y]->weight < BLOCKED_GRID_WEIGHT);
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+// Tests that heavy weights raise the weight scale of 8 bit costs, and that 16 bit costs keep them exactly
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_DenseNavigationGrid_ctr_heavy_weights) {
+	DenseNavigationGrid denseGrid(2, 2, NavigationGridData{ 1, 0 });
+	denseGrid.setWeight(0, 1, 1000);
+	denseGrid.setWeight(1, 1, BLOCKED_GRID_WEIGHT + 5);
+
+	CompactNavigationGrid compactGrid8(denseGrid, NAVIGATION_COST_PRECISION_8_BIT);
+	CompactNavigationGrid compactGrid16(denseGrid, NAVIGATION_COST_PRECISION_16_BIT);
+
+	BOOST_CHECK_EQUAL(compactGrid8.getWeightScale(), 4);
+	BOOST_CHECK_EQUAL(compactGrid8.getWeight(0, 1), 1000);
+	BOOST_CHECK_EQUAL(compactGrid8.getWeight(0, 0), 0);
+	BOOST_CHECK_EQUAL(compactGrid8.getWeight(1, 1), BLOCKED_GRID_WEIGHT);
+	BOOST_CHECK_EQUAL(compactGrid16.getWeightScale(), 1);
+	BOOST_CHECK_EQUAL(compactGrid16.getWeight(0, 0), 1);
+	BOOST_CHECK_EQUAL(compactGrid16.getWeight(0, 1), 1000);
+	BOOST_CHECK(!compactGrid16.isPassable(1, 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CompactNavigationGrid_ctr
+
+BOOST_AUTO_TEST_SUITE(CompactNavigationGrid_getters_and_setters)
+
+// Tests that setting a weight updates the passability and the cost of the grid square together
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_setWeight) {
+	CompactNavigationGrid navGrid(4, 4, NAVIGATION_COST_PRECISION_8_BIT, 2);
+
+	navGrid.setWeight(1, 1, BLOCKED_GRID_WEIGHT);
+	BOOST_CHECK(!navGrid.isPassable(1, 1));
+	BOOST_CHECK_EQUAL(navGrid.getWeight(1, 1), BLOCKED_GRID_WEIGHT);
+
+	navGrid.setWeight(1, 1, 7);
+	BOOST_CHECK(navGrid.isPassable(1, 1));
+	BOOST_CHECK_EQUAL(navGrid.getWeight(1, 1), 8);
+
+	navGrid.setWeight(2, 3, 5000);
+	BOOST_CHECK_EQUAL(navGrid.getWeight(2, 3), navGrid.getMaxWeight());
+	navGrid.setWeight(3, 0, -3);
+	BOOST_CHECK_EQUAL(navGrid.getWeight(3, 0), 0);
+	BOOST_CHECK(navGrid.isPassable(3, 0));
+}
+
+// Tests that column runs are tested across the words of the passability plane
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_isColumnPassable) {
+	CompactNavigationGrid navGrid(3, 150);
+	navGrid.setWeight(1, 140, BLOCKED_GRID_WEIGHT);
+
+	BOOST_CHECK(navGrid.isColumnPassable(1, 0, 140));
+	BOOST_CHECK(!navGrid.isColumnPassable(1, 0, 141));
+	BOOST_CHECK(!navGrid.isColumnPassable(1, 140, 141));
+	BOOST_CHECK(navGrid.isColumnPassable(1, 141, 150));
+	BOOST_CHECK(navGrid.isColumnPassable(1, 30, 30));
+	BOOST_CHECK(navGrid.isColumnPassable(0, 0, 150));
+	BOOST_CHECK(navGrid.isColumnPassable(2, 0, 150));
+}
+
+// Tests that a 1024 by 1024 grid fits in a little more than a megabyte
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_getMemoryUsage) {
+	CompactNavigationGrid navGrid8(1024, 1024, NAVIGATION_COST_PRECISION_8_BIT);
+	CompactNavigationGrid navGrid16(1024, 1024, NAVIGATION_COST_PRECISION_16_BIT);
+
+	const std::size_t gridSquareCount = 1024 * 1024;
+	BOOST_CHECK_LE(navGrid8.getMemoryUsage(), gridSquareCount + gridSquareCount / 8 + 1024);
+	BOOST_CHECK_LE(navGrid16.getMemoryUsage(), 2 * gridSquareCount + gridSquareCount / 8 + 1024);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CompactNavigationGrid_getters_and_setters
+
+BOOST_AUTO_TEST_SUITE(CompactNavigationGrid_operations)
+
+// Tests that edits to the source NavigationGrid are copied for the changed grid squares only
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_updateGridSquares) {
+	NavigationGrid navGrid(4, 4);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1, 0 });
+	CompactNavigationGrid compactGrid(navGrid);
+
+	navGrid[2][2]->weight = BLOCKED_GRID_WEIGHT;
+	navGrid[0][3]->weight = 6;
+	navGrid[3][3]->weight = 9;
+	compactGrid.updateGridSquares(navGrid, {sf::Vector2i(2, 2), sf::Vector2i(0, 3), sf::Vector2i(-1, 2), sf::Vector2i(4, 0)});
+
+	BOOST_CHECK(!compactGrid.isPassable(2, 2));
+	BOOST_CHECK_EQUAL(compactGrid.getWeight(0, 3), 6);
+	BOOST_CHECK_EQUAL(compactGrid.getWeight(3, 3), 1);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+// Tests that line of sight on a compact grid matches line of sight on the NavigationGrid it was converted from
+BOOST_AUTO_TEST_CASE(CompactNavigationGrid_hasLineOfSight_matches_NavigationGrid) {
+	NavigationGrid navGrid(12, 80);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	TEST::fillRandomWeights(navGrid, 9);
+	CompactNavigationGrid compactGrid(navGrid);
+
+	for (int toX = 0; toX < 12; ++toX) {
+		for (int toY = 0; toY < 80; ++toY) {
+			const sf::Vector2i from(4, 37);
+			const sf::Vector2i to(toX, toY);
+			BOOST_CHECK_EQUAL(hasLineOfSight(compactGrid, from, to), hasLineOfSight(navGrid, from, to));
+			BOOST_CHECK_EQUAL(hasLineOfSight(compactGrid, from, to, 5), hasLineOfSight(navGrid, from, to, 5));
+			if (hasLineOfSight(navGrid, from, to)) {
+				BOOST_CHECK_EQUAL(calcLineOfSightWeight(compactGrid, from, to), calcLineOfSightWeight(navGrid, from, to));
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CompactNavigationGrid_operations
+
+BOOST_AUTO_TEST_SUITE_END() // end CompactNavigationGrid_Tests
@@ -0,0 +1,356 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/CooperativePathfinder.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Calculates the cost of a path in the four neighborhood. Every step costs the average weight of its grid squares.
+	/// </summary>
+	int calcPathCost(NavigationGrid& navGrid, const sf::Vector2i& start, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = start;
+		for (const sf::Vector2i& gridSquare : path) {
+			cost += (navGrid.at(previous.x, previous.y)->weight + navGrid.at(gridSquare.x, gridSquare.y)->weight) / 2;
+			previous = gridSquare;
+		}
+		return cost;
+	}
+
+	/// <summary>
+	/// Checks that no two agents occupy the same grid square and that no two agents swap grid squares.
+	/// Every agent must wait or step to an adjacent unblocked grid square.
+	/// </summary>
+	void checkStepIsFree(NavigationGrid& navGrid, const std::vector<sf::Vector2i>& previousPositions, const std::vector<sf::Vector2i>& positions) {
+		std::set<std::pair<int, int>> occupiedGridSquares;
+		for (std::size_t agent = 0; agent < positions.size(); ++agent) {
+			const sf::Vector2i& position = positions[agent];
+			BOOST_CHECK(occupiedGridSquares.insert(std::make_pair(position.x, position.y)).second);
+			BOOST_CHECK(std::abs(position.x - previousPositions[agent].x) + std::abs(position.y - previousPositions[agent].y) <= 1);
+			if (position != previousPositions[agent]) {
+				BOOST_CHECK(navGrid.at(position.x, position.y)->weight < BLOCKED_GRID_WEIGHT);
+			}
+			for (std::size_t other = 0; other < agent; ++other) {
+				BOOST_CHECK(!(position == previousPositions[other] && positions[other] == previousPositions[agent] && position != positions[other]));
+			}
+		}
+	}
+
+	/// <summary>
+	/// Checks that the planned paths of a batch do not conflict inside of the window.
+	/// </summary>
+	void checkPathsAreFree(NavigationGrid& navGrid, const std::vector<PathRequest>& pathRequests, const std::vector<std::deque<sf::Vector2i>>& paths, unsigned int windowSize) {
+		std::vector<sf::Vector2i> previousPositions;
+		for (const PathRequest& pathRequest : pathRequests) {
+			previousPositions.push_back(pathRequest.start);
+		}
+		for (std::size_t time = 1; time <= windowSize; ++time) {
+			std::vector<sf::Vector2i> positions;
+			for (std::size_t agent = 0; agent < paths.size(); ++agent) {
+				positions.push_back(paths[agent].empty() ? pathRequests[agent].start : paths[agent][std::min(time, paths[agent].size()) - 1]);
+			}
+			checkStepIsFree(navGrid, previousPositions, positions);
+			previousPositions = positions;
+		}
+	}
+
+	/// <summary>
+	/// Updates the pathfinder until every agent reached its goal, checking every step for conflicts.
+	/// </summary>
+	/// <returns>The number of updates. maxUpdates if some agent did not reach its goal.</returns>
+	int updateUntilArrived(NavigationGrid& navGrid, CooperativePathfinder& pathfinder, int maxUpdates) {
+		std::vector<sf::Vector2i> previousPositions;
+		for (unsigned int agent = 0; agent < pathfinder.getAgentCount(); ++agent) {
+			previousPositions.push_back(pathfinder.getAgentPosition(agent));
+		}
+		for (int updateCount = 0; updateCount < maxUpdates; ++updateCount) {
+			bool isArrived = true;
+			for (unsigned int agent = 0; agent < pathfinder.getAgentCount(); ++agent) {
+				isArrived = isArrived && pathfinder.getAgentPosition(agent) == pathfinder.getAgentGoal(agent);
+			}
+			if (isArrived) {
+				return updateCount;
+			}
+
+			pathfinder.update();
+			std::vector<sf::Vector2i> positions;
+			for (unsigned int agent = 0; agent < pathfinder.getAgentCount(); ++agent) {
+				positions.push_back(pathfinder.getAgentPosition(agent));
+			}
+			checkStepIsFree(navGrid, previousPositions, positions);
+			previousPositions = positions;
+		}
+		return maxUpdates;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(CooperativePathfinder_Tests)
+
+BOOST_AUTO_TEST_SUITE(CooperativePathfinder_CTRs)
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_default_CTR) {
+	CooperativePathfinder pathfinder;
+
+	BOOST_CHECK(pathfinder.getNavigationGrid() == nullptr);
+	BOOST_CHECK_EQUAL(pathfinder.getWindowSize(), CooperativePathfinder::DEFAULT_WINDOW_SIZE);
+	BOOST_CHECK_EQUAL(pathfinder.getCurrentTime(), 0);
+	BOOST_CHECK_EQUAL(pathfinder.getAgentCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_navigationGrid_CTR) {
+	NavigationGrid navGrid(10);
+	CooperativePathfinder pathfinder(&navGrid, 0);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, pathfinder.getNavigationGrid());
+
+	// the window holds at least one step
+	BOOST_CHECK_EQUAL(pathfinder.getWindowSize(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CooperativePathfinder_CTRs
+
+BOOST_AUTO_TEST_SUITE(CooperativePathfinder_pathFind)
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_pathFind_single_agent) {
+	const int SQUARE_DIM = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 13u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 4);
+		}
+	}
+	navGrid.at(1, 1)->weight = 1;
+	navGrid.at(18, 17)->weight = 1;
+	const PathRequest pathRequest{ sf::Vector2i(1, 1), sf::Vector2i(18, 17) };
+
+	Pathfinder referencePathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> referencePaths;
+	referencePathfinder.pathFind({ pathRequest }, &referencePaths);
+
+	// an agent that is alone follows the cheapest path, partly inside of the window and partly after it
+	CooperativePathfinder pathfinder(&navGrid, 8);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_REQUIRE(!paths[0].empty());
+	BOOST_CHECK(paths[0].back() == pathRequest.end);
+	BOOST_CHECK_EQUAL(paths[0].size(), referencePaths[0].size());
+	BOOST_CHECK_EQUAL(calcPathCost(navGrid, pathRequest.start, paths[0]), calcPathCost(navGrid, pathRequest.start, referencePaths[0]));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_pathFind_crossing_agents) {
+	const int SQUARE_DIM = 16;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// agents cross each other's paths from every side of the grid
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < 6; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i(0, 4 + i), sf::Vector2i(SQUARE_DIM - 1, 9 - i) });
+		pathRequests.push_back(PathRequest{ sf::Vector2i(5 + i, 0), sf::Vector2i(10 - i, SQUARE_DIM - 1) });
+	}
+
+	CooperativePathfinder pathfinder(&navGrid, 20);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathsAreFree(navGrid, pathRequests, paths, pathfinder.getWindowSize());
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_REQUIRE(!paths[i].empty());
+		BOOST_CHECK(paths[i].back() == pathRequests[i].end);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_pathFind_unreachable_goal) {
+	NavigationGrid navGrid(6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(5, 5)->weight = BLOCKED_GRID_WEIGHT;
+
+	// an agent that can not reach its goal waits, and the others walk around it
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(5, 5) },
+		PathRequest{ sf::Vector2i(0, 2), sf::Vector2i(4, 2) }
+	};
+	CooperativePathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK(paths[0].empty());
+	BOOST_REQUIRE(!paths[1].empty());
+	BOOST_CHECK(std::find(paths[1].begin(), paths[1].end(), sf::Vector2i(2, 2)) == paths[1].end());
+	BOOST_CHECK(paths[1].back() == pathRequests[1].end);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CooperativePathfinder_pathFind
+
+BOOST_AUTO_TEST_SUITE(CooperativePathfinder_update)
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_update_corridor) {
+	// a corridor with a single pocket where one agent can make way
+	NavigationGrid navGrid(9, 3);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ BLOCKED_GRID_WEIGHT,0 });
+	for (unsigned int x = 0; x < 9; ++x) {
+		navGrid.at(x, 1)->weight = 1;
+	}
+	navGrid.at(6, 0)->weight = 1;
+
+	CooperativePathfinder pathfinder(&navGrid);
+	pathfinder.addAgent(PathRequest{ sf::Vector2i(0, 1), sf::Vector2i(8, 1) });
+	pathfinder.addAgent(PathRequest{ sf::Vector2i(8, 1), sf::Vector2i(0, 1) });
+
+	const int MAX_UPDATES = 40;
+	BOOST_CHECK(updateUntilArrived(navGrid, pathfinder, MAX_UPDATES) < MAX_UPDATES);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_update_many_agents) {
+	const int SQUARE_DIM = 24;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 3; x < SQUARE_DIM - 2; x += 5) {
+		for (unsigned int y = 2; y < SQUARE_DIM - 2; ++y) {
+			if (y % 7 != 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+
+	// agents on the left and right swap sides through the gaps
+	const int NUM_AGENTS = 40;
+	CooperativePathfinder pathfinder(&navGrid, 12);
+	for (int i = 0; i < NUM_AGENTS / 2; ++i) {
+		pathfinder.addAgent(PathRequest{ sf::Vector2i(i % 2, i), sf::Vector2i(SQUARE_DIM - 1 - i % 2, SQUARE_DIM - 1 - i) });
+		pathfinder.addAgent(PathRequest{ sf::Vector2i(SQUARE_DIM - 1 - i % 2, i + 2), sf::Vector2i(i % 2, SQUARE_DIM - 3 - i) });
+	}
+
+	const int MAX_UPDATES = 200;
+	BOOST_CHECK(updateUntilArrived(navGrid, pathfinder, MAX_UPDATES) < MAX_UPDATES);
+
+	// only the reservations inside of the window are kept
+	BOOST_CHECK(pathfinder.getReservationTable().getReservationCount() <= NUM_AGENTS * (pathfinder.getWindowSize() + 1));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_update_agent_changes) {
+	NavigationGrid navGrid(12);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	CooperativePathfinder pathfinder(&navGrid, 6);
+	const unsigned int firstAgent = pathfinder.addAgent(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(11, 0) });
+	const unsigned int secondAgent = pathfinder.addAgent(PathRequest{ sf::Vector2i(0, 5), sf::Vector2i(11, 5) });
+	BOOST_CHECK_EQUAL(pathfinder.getReservationTable().getReservationCount(), 2 * 7);
+
+	// a new goal is planned right away
+	pathfinder.setAgentGoal(secondAgent, sf::Vector2i(0, 11));
+	std::deque<sf::Vector2i> path;
+	pathfinder.getAgentPath(secondAgent, path);
+	BOOST_REQUIRE(!path.empty());
+	BOOST_CHECK(path.back() == sf::Vector2i(0, 11));
+
+	// removed agents release their reservations and stay where they are
+	pathfinder.update();
+	const sf::Vector2i removedPosition = pathfinder.getAgentPosition(firstAgent);
+	const std::size_t reservationCount = pathfinder.getReservationTable().getReservationCount();
+	pathfinder.removeAgent(firstAgent);
+	BOOST_CHECK(pathfinder.getReservationTable().getReservationCount() < reservationCount);
+	BOOST_CHECK_EQUAL(pathfinder.getReservationTable().getAgent(removedPosition, pathfinder.getCurrentTime()), ReservationTable::NO_AGENT);
+	pathfinder.update();
+	BOOST_CHECK(pathfinder.getAgentPosition(firstAgent) == removedPosition);
+	BOOST_CHECK_EQUAL(pathfinder.getAgentCount(), 2);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CooperativePathfinder_update
+
+BOOST_AUTO_TEST_SUITE(CooperativePathfinder_perf_Tests)
+
+BOOST_AUTO_TEST_CASE(CooperativePathfinder_update_perf) {
+	const int SQUARE_DIM = 128;
+	const int NUM_AGENTS = 200;
+	const int NUM_UPDATES = 64;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// walls with narrow gaps that the agents crowd through
+	for (unsigned int x = 16; x < SQUARE_DIM; x += 16) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if (y % 32 > 1) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+
+	// half of the agents cross the map in each direction
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_AGENTS / 2; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i(i % 10, (i * 37) % SQUARE_DIM), sf::Vector2i(SQUARE_DIM - 1 - i % 10, (i * 53) % SQUARE_DIM) });
+		pathRequests.push_back(PathRequest{ sf::Vector2i(SQUARE_DIM - 11 + i % 10, (i * 41) % SQUARE_DIM), sf::Vector2i(10 - i % 10, (i * 59) % SQUARE_DIM) });
+	}
+
+	CooperativePathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	auto startTime = std::chrono::high_resolution_clock::now();
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> planTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+	checkPathsAreFree(navGrid, pathRequests, pathsReturn, pathfinder.getWindowSize());
+
+	std::stringstream planStream;
+	planStream << "Pathfinding time of: " << planTime.count() << " seconds and " << pathfinder.getExpandedNodeCount()
+		<< " expanded nodes for planning " << NUM_AGENTS << " cooperative agents perf test";
+	BOOST_TEST_MESSAGE(planStream.str());
+
+	std::vector<sf::Vector2i> previousPositions;
+	for (const PathRequest& pathRequest : pathRequests) {
+		previousPositions.push_back(pathRequest.start);
+	}
+	std::size_t expandedNodeCount = 0;
+	std::chrono::duration<double> updateTime(0);
+	for (int i = 0; i < NUM_UPDATES; ++i) {
+		const auto updateStartTime = std::chrono::high_resolution_clock::now();
+		pathfinder.update();
+		updateTime += std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - updateStartTime);
+		expandedNodeCount += pathfinder.getExpandedNodeCount();
+
+		std::vector<sf::Vector2i> positions;
+		for (unsigned int agent = 0; agent < pathfinder.getAgentCount(); ++agent) {
+			positions.push_back(pathfinder.getAgentPosition(agent));
+		}
+		checkStepIsFree(navGrid, previousPositions, positions);
+		previousPositions = positions;
+	}
+
+	std::stringstream updateStream;
+	updateStream << "Pathfinding time of: " << updateTime.count() / NUM_UPDATES << " seconds and " << expandedNodeCount / NUM_UPDATES
+		<< " expanded nodes per update of " << NUM_AGENTS << " cooperative agents perf test";
+	BOOST_TEST_MESSAGE(updateStream.str());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end CooperativePathfinder_perf_Tests
+
+BOOST_AUTO_TEST_SUITE_END() // end CooperativePathfinder_Tests
@@ -0,0 +1,212 @@
+#include "stdafx.h"
+#include "NavigationTestUtils.h"
+
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Custom grid square data, as a game might have derived from NavigationGridData.
+	/// </summary>
+	struct TerrainData {
+		int terrainType = 0;
+		bool isWater = false;
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(DenseNavigationGrid_Tests)
+
+BOOST_AUTO_TEST_SUITE(DenseNavigationGrid_ctr)
+
+// Tests that the default constructor creates a grid without grid squares
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_default_ctr) {
+	DenseNavigationGrid navGrid;
+
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeX(), 0u);
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeY(), 0u);
+	BOOST_CHECK(!navGrid.isInArray(0, 0));
+	BOOST_CHECK(navGrid.getWeights().empty());
+}
+
+// Tests that every grid square gets the passed data
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_size_ctr) {
+	DenseNavigationGrid navGrid(4, 7, NavigationGridData{ 3, 2 });
+
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeX(), 4u);
+	BOOST_CHECK_EQUAL(navGrid.getArraySizeY(), 7u);
+	BOOST_CHECK(navGrid.isInArray(3, 6));
+	BOOST_CHECK(!navGrid.isInArray(4, 0));
+	BOOST_CHECK(!navGrid.isInArray(0, 7));
+	for (unsigned int x = 0; x < 4; ++x) {
+		for (unsigned int y = 0; y < 7; ++y) {
+			BOOST_CHECK_EQUAL(navGrid.getWeight(x, y), 3);
+			BOOST_CHECK_EQUAL(navGrid.getBlockerDist(x, y), 2u);
+		}
+	}
+}
+
+// Tests that converting a NavigationGrid copies the data of every grid square
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_NavigationGrid_ctr) {
+	NavigationGrid navGrid(5, 3);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	for (unsigned int x = 0; x < 5; ++x) {
+		for (unsigned int y = 0; y < 3; ++y) {
+			navGrid[x][y]->weight = static_cast<int>(x * 10 + y);
+			navGrid[x][y]->blockerDist = y * 10 + x;
+		}
+	}
+
+	DenseNavigationGrid denseGrid(navGrid);
+
+	BOOST_CHECK_EQUAL(denseGrid.getArraySizeX(), 5u);
+	BOOST_CHECK_EQUAL(denseGrid.getArraySizeY(), 3u);
+	for (unsigned int x = 0; x < 5; ++x) {
+		for (unsigned int y = 0; y < 3; ++y) {
+			BOOST_CHECK_EQUAL(denseGrid.getWeight(x, y), navGrid[x][y]->weight);
+			BOOST_CHECK_EQUAL(denseGrid.getBlockerDist(x, y), navGrid[x][y]->blockerDist);
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end DenseNavigationGrid_ctr
+
+BOOST_AUTO_TEST_SUITE(DenseNavigationGrid_getters_and_setters)
+
+// Tests that setting a grid square only changes that grid square
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_setGridData) {
+	DenseNavigationGrid navGrid(3, 3);
+
+	navGrid.setWeight(1, 2, 7);
+	navGrid.setBlockerDist(2, 1, 4);
+	navGrid.setGridData(0, 0, NavigationGridData{ 5, 6 });
+
+	BOOST_CHECK_EQUAL(navGrid.getWeight(1, 2), 7);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(1, 2), 0u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDist(2, 1), 4u);
+	BOOST_CHECK_EQUAL(navGrid.getWeight(2, 1), 0);
+	BOOST_CHECK_EQUAL(navGrid.getGridData(0, 0).weight, 5);
+	BOOST_CHECK_EQUAL(navGrid.getGridData(0, 0).blockerDist, 6u);
+}
+
+// Tests that the planes are flattened in the same order as Array2D
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_getWeights_flattened_like_Array2D) {
+	DenseNavigationGrid navGrid(4, 3);
+	navGrid.setWeight(2, 1, 9);
+
+	BOOST_CHECK_EQUAL(navGrid.flattenGridCoordinate(2, 1), 2u * 3u + 1u);
+	BOOST_CHECK_EQUAL(navGrid.getWeights()[navGrid.flattenGridCoordinate(2, 1)], 9);
+	BOOST_CHECK_EQUAL(navGrid.getWeights().size(), 12u);
+	BOOST_CHECK_EQUAL(navGrid.getBlockerDists().size(), 12u);
+}
+
+// Tests that a 1024 by 1024 grid fits in a few megabytes
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_getMemoryUsage) {
+	DenseNavigationGrid navGrid(1024, 1024);
+
+	const std::size_t gridSquareCount = 1024 * 1024;
+	BOOST_CHECK_GE(navGrid.getMemoryUsage(), gridSquareCount * (sizeof(int) + sizeof(unsigned int)));
+	BOOST_CHECK_LE(navGrid.getMemoryUsage(), 9u * 1024 * 1024);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end DenseNavigationGrid_getters_and_setters
+
+BOOST_AUTO_TEST_SUITE(DenseNavigationGrid_operations)
+
+// Tests that initAllValues overwrites every grid square
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_initAllValues) {
+	DenseNavigationGrid navGrid(3, 2);
+	navGrid.setWeight(1, 1, 4);
+
+	navGrid.initAllValues(NavigationGridData{ 8, 1 });
+
+	for (unsigned int x = 0; x < 3; ++x) {
+		for (unsigned int y = 0; y < 2; ++y) {
+			BOOST_CHECK_EQUAL(navGrid.getWeight(x, y), 8);
+			BOOST_CHECK_EQUAL(navGrid.getBlockerDist(x, y), 1u);
+		}
+	}
+}
+
+// Tests that a copy does not share grid squares with the original
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_copy_is_independent) {
+	DenseNavigationGrid navGrid(2, 2, NavigationGridData{ 1, 0 });
+	DenseNavigationGrid copiedGrid = navGrid;
+
+	copiedGrid.setWeight(0, 0, BLOCKED_GRID_WEIGHT);
+
+	BOOST_CHECK_EQUAL(navGrid.getWeight(0, 0), 1);
+	BOOST_CHECK_EQUAL(copiedGrid.getWeight(0, 0), BLOCKED_GRID_WEIGHT);
+}
+
+// Tests that line of sight on a dense grid matches line of sight on the NavigationGrid it was copied from
+BOOST_AUTO_TEST_CASE(DenseNavigationGrid_calcLineOfSightWeight_matches_NavigationGrid) {
+	NavigationGrid navGrid(12, 12);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	TEST::fillRandomWeights(navGrid, 5);
+	DenseNavigationGrid denseGrid(navGrid);
+
+	for (int toX = 0; toX < 12; ++toX) {
+		for (int toY = 0; toY < 12; ++toY) {
+			const sf::Vector2i from(3, 7);
+			const sf::Vector2i to(toX, toY);
+			BOOST_CHECK_EQUAL(calcLineOfSightWeight(denseGrid, from, to), calcLineOfSightWeight(navGrid, from, to));
+			BOOST_CHECK_EQUAL(hasLineOfSight(denseGrid, from, to), hasLineOfSight(navGrid, from, to));
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end DenseNavigationGrid_operations
+
+BOOST_AUTO_TEST_SUITE(ExtendedNavigationGrid_Tests)
+
+// Tests that custom data is stored for each grid square next to the weights
+BOOST_AUTO_TEST_CASE(ExtendedNavigationGrid_getCustomData) {
+	ExtendedNavigationGrid<TerrainData> navGrid(3, 4, NavigationGridData{ 2, 0 }, TerrainData{ 1, false });
+
+	navGrid.getCustomData(2, 3).isWater = true;
+	navGrid.getCustomData(2, 3).terrainType = 5;
+
+	const ExtendedNavigationGrid<TerrainData>& constGrid = navGrid;
+	BOOST_CHECK(constGrid.getCustomData(2, 3).isWater);
+	BOOST_CHECK_EQUAL(constGrid.getCustomData(2, 3).terrainType, 5);
+	BOOST_CHECK(!constGrid.getCustomData(1, 3).isWater);
+	BOOST_CHECK_EQUAL(constGrid.getCustomData(1, 3).terrainType, 1);
+	BOOST_CHECK_EQUAL(constGrid.getWeight(2, 3), 2);
+	BOOST_CHECK_GE(navGrid.getMemoryUsage(), 12 * (sizeof(int) + sizeof(unsigned int) + sizeof(TerrainData)));
+}
+
+// Tests that the Pathfinder searches an extended grid like any other dense grid
+BOOST_AUTO_TEST_CASE(ExtendedNavigationGrid_pathFind) {
+	ExtendedNavigationGrid<TerrainData> navGrid(5, 5, NavigationGridData{ 1, 0 });
+	for (unsigned int y = 0; y < 4; ++y) {
+		navGrid.setWeight(2, y, BLOCKED_GRID_WEIGHT);
+		navGrid.getCustomData(2, y).terrainType = 3;
+	}
+	Pathfinder pathfinder(&navGrid);
+
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(4, 0) } };
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	BOOST_REQUIRE(!paths[0].empty());
+	BOOST_CHECK(paths[0].back() == sf::Vector2i(4, 0));
+	for (const sf::Vector2i& waypoint : paths[0]) {
+		BOOST_CHECK_NE(navGrid.getCustomData(static_cast<unsigned int>(waypoint.x), static_cast<unsigned int>(waypoint.y)).terrainType, 3);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ExtendedNavigationGrid_Tests
+
+BOOST_AUTO_TEST_SUITE_END() // end DenseNavigationGrid_Tests
@@ -0,0 +1,186 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/FlowField.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Sums the transition costs of a path the same way Pathfinder and FlowField do.
+	/// </summary>
+	int calculatePathCost(NavigationGrid& navGrid, const sf::Vector2i& start, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = start;
+		for (const sf::Vector2i& gridSquare : path) {
+			BOOST_CHECK_EQUAL(std::abs(gridSquare.x - previous.x) + std::abs(gridSquare.y - previous.y), 1);
+			cost += (navGrid.at(static_cast<unsigned int>(previous.x), static_cast<unsigned int>(previous.y))->weight +
+				navGrid.at(static_cast<unsigned int>(gridSquare.x), static_cast<unsigned int>(gridSquare.y))->weight) / 2;
+			previous = gridSquare;
+		}
+		return cost;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(FlowField_Tests)
+
+BOOST_AUTO_TEST_SUITE(FlowField_CTRs)
+
+BOOST_AUTO_TEST_CASE(FlowField_default_CTR) {
+	FlowField flowField;
+
+	BOOST_CHECK(flowField.getNavigationGrid() == nullptr);
+	BOOST_CHECK(!flowField.isReachable(sf::Vector2i(0, 0)));
+	BOOST_CHECK(flowField.getDirection(sf::Vector2i(0, 0)) == sf::Vector2i(0, 0));
+}
+
+BOOST_AUTO_TEST_CASE(FlowField_navigationGrid_CTR) {
+	NavigationGrid navGrid(5, 5);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	FlowField flowField(&navGrid);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, flowField.getNavigationGrid());
+
+	// nothing is reachable before the field is generated
+	BOOST_CHECK_EQUAL(flowField.getIntegratedCost(sf::Vector2i(2, 2)), FlowField::UNREACHABLE_COST);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end FlowField_CTRs
+
+BOOST_AUTO_TEST_SUITE(FlowField_generate)
+
+BOOST_AUTO_TEST_CASE(FlowField_generate_open_grid) {
+	NavigationGrid navGrid(10, 8);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 2,0 });
+	const sf::Vector2i destination(3, 4);
+
+	FlowField flowField(&navGrid);
+	flowField.generate(destination);
+
+	BOOST_CHECK(flowField.getDestination() == destination);
+	BOOST_CHECK_EQUAL(flowField.getIntegratedCost(destination), 0);
+	BOOST_CHECK(flowField.getDirection(destination) == sf::Vector2i(0, 0));
+
+	// every grid square costs its manhattan distance times the weight and steps one square closer
+	for (int x = 0; x < 10; ++x) {
+		for (int y = 0; y < 8; ++y) {
+			const sf::Vector2i gridSquare(x, y);
+			const int distance = std::abs(x - destination.x) + std::abs(y - destination.y);
+			BOOST_CHECK_EQUAL(flowField.getIntegratedCost(gridSquare), distance * 2);
+			if (distance > 0) {
+				const sf::Vector2i next = gridSquare + flowField.getDirection(gridSquare);
+				BOOST_CHECK_EQUAL(std::abs(next.x - destination.x) + std::abs(next.y - destination.y), distance - 1);
+			}
+		}
+	}
+
+	// outside of the grid
+	BOOST_CHECK(!flowField.isReachable(sf::Vector2i(-1, 0)));
+	BOOST_CHECK(flowField.getDirection(sf::Vector2i(10, 0)) == sf::Vector2i(0, 0));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(FlowField_generate_walls) {
+	NavigationGrid navGrid(7, 7);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// wall at x = 3 with a gap at y = 6. The corner at (6, 6) is enclosed.
+	for (unsigned int y = 0; y < 6; ++y) {
+		navGrid.at(3, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	navGrid.at(5, 6)->weight = BLOCKED_GRID_WEIGHT;
+	navGrid.at(6, 5)->weight = BLOCKED_GRID_WEIGHT;
+
+	FlowField flowField(&navGrid);
+	flowField.generate(sf::Vector2i(0, 0));
+
+	// the path around the wall goes through the gap
+	BOOST_CHECK_EQUAL(flowField.getIntegratedCost(sf::Vector2i(6, 0)), 2 + 6 + 4 + 6);
+	BOOST_CHECK(!flowField.isReachable(sf::Vector2i(6, 6)));
+	BOOST_CHECK(flowField.getDirection(sf::Vector2i(6, 6)) == sf::Vector2i(0, 0));
+
+	// blocked squares next to the open grid lead off of themselves
+	const sf::Vector2i blockedSquare(3, 0);
+	BOOST_CHECK(flowField.isReachable(blockedSquare));
+	BOOST_CHECK(flowField.getDirection(blockedSquare) == sf::Vector2i(-1, 0));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(FlowField_generate_blocked_destination) {
+	NavigationGrid navGrid(4, 4);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(2, 2)->weight = BLOCKED_GRID_WEIGHT;
+
+	FlowField flowField(&navGrid);
+	flowField.generate(sf::Vector2i(2, 2));
+	BOOST_CHECK(!flowField.isReachable(sf::Vector2i(0, 0)));
+
+	// destinations outside of the grid are not reachable either
+	flowField.generate(sf::Vector2i(4, 0));
+	BOOST_CHECK(!flowField.isReachable(sf::Vector2i(0, 0)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(FlowField_generate_matches_Pathfinder) {
+	NavigationGrid navGrid(20, 20);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// bands of varying weight and a few walls
+	for (unsigned int x = 0; x < 20; ++x) {
+		for (unsigned int y = 0; y < 20; ++y) {
+			navGrid.at(x, y)->weight = 1 + static_cast<int>((x * 7 + y * 3) % 5);
+		}
+	}
+	for (unsigned int y = 2; y < 18; ++y) {
+		navGrid.at(6, y)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(13, 19 - y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	const sf::Vector2i destination(18, 10);
+	FlowField flowField(&navGrid);
+	flowField.generate(destination);
+	Pathfinder pathfinder(&navGrid);
+
+	std::vector<PathRequest> pathRequests;
+	for (int x = 0; x < 20; x += 3) {
+		for (int y = 0; y < 20; y += 3) {
+			pathRequests.push_back(PathRequest{ sf::Vector2i(x, y), destination });
+		}
+	}
+	std::vector<std::deque<sf::Vector2i>> pathfinderPaths;
+	pathfinder.pathFind(pathRequests, &pathfinderPaths);
+
+	// Both are exact on reachability. The field always follows the cheapest path, which Pathfinder may only approach.
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		const sf::Vector2i& start = pathRequests[i].start;
+		NavGridCoordinatePath fieldPath;
+		flowField.extractPath(start, fieldPath);
+
+		BOOST_CHECK_EQUAL(fieldPath.empty(), pathfinderPaths[i].empty());
+		if (!fieldPath.empty()) {
+			BOOST_CHECK(fieldPath.back() == destination);
+			BOOST_CHECK_EQUAL(calculatePathCost(navGrid, start, fieldPath), flowField.getIntegratedCost(start));
+			BOOST_CHECK(flowField.getIntegratedCost(start) <= calculatePathCost(navGrid, start, pathfinderPaths[i]));
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end FlowField_generate
+
+BOOST_AUTO_TEST_SUITE_END() // end FlowField_Tests
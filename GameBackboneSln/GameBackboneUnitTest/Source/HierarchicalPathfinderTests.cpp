@@ -0,0 +1,250 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/HierarchicalPathfinder.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Checks that a path is a chain of adjacent unblocked grid squares from the start of a request to its end.
+	/// </summary>
+	void checkPathIsValid(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			BOOST_CHECK_EQUAL(std::abs(gridSquare.x - previous.x) + std::abs(gridSquare.y - previous.y), 1);
+			BOOST_CHECK(navGrid.at(gridSquare.x, gridSquare.y)->weight < BLOCKED_GRID_WEIGHT);
+			previous = gridSquare;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(HierarchicalPathfinder_Tests)
+
+BOOST_AUTO_TEST_SUITE(HierarchicalPathfinder_CTRs)
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_null_grid_CTR) {
+	HierarchicalPathfinder pathfinder(nullptr);
+
+	BOOST_CHECK(pathfinder.getNavigationGrid() == nullptr);
+	BOOST_CHECK_EQUAL(pathfinder.getClusterSize(), HierarchicalPathfinder::DEFAULT_CLUSTER_SIZE);
+	BOOST_CHECK_EQUAL(pathfinder.getClusterCount(), 0);
+	BOOST_CHECK_EQUAL(pathfinder.getAbstractNodeCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_navigationGrid_CTR) {
+	NavigationGrid navGrid(30, 20);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, pathfinder.getNavigationGrid());
+
+	// partial clusters cover the far edges of the grid
+	BOOST_CHECK_EQUAL(pathfinder.getClusterSize(), 8);
+	BOOST_CHECK_EQUAL(pathfinder.getClusterCount(), 4 * 3);
+	BOOST_CHECK(pathfinder.getAbstractNodeCount() > 0);
+	BOOST_CHECK_EQUAL(pathfinder.getClusterRebuildCount(), 4 * 3);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end HierarchicalPathfinder_CTRs
+
+BOOST_AUTO_TEST_SUITE(HierarchicalPathfinder_pathFind)
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_pathFind_open_grid) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{2,3}, sf::Vector2i{37, 35} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{1,1}, sf::Vector2i{6, 2} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{7,7}, sf::Vector2i{8, 8} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	BOOST_REQUIRE_EQUAL(pathsReturn.size(), pathRequests.size());
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_CHECK(pathsReturn[i].size() > 0);
+		checkPathIsValid(navGrid, pathRequests[i], pathsReturn[i]);
+	}
+
+	// a request inside one cluster finds the shortest path
+	BOOST_CHECK_EQUAL(pathsReturn[1].size(), 6);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_pathFind_no_path) {
+	const int SQUARE_DIM = 24;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// wall off the right side of the grid
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(12, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{0,0}, sf::Vector2i{20, 20} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{3,3}, sf::Vector2i{3, 3} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{3,3}, sf::Vector2i{12, 4} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{-1,3}, sf::Vector2i{2, 2} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	// walled off, already at the end, blocked end, outside of the grid
+	for (const std::deque<sf::Vector2i>& path : pathsReturn) {
+		BOOST_CHECK(path.empty());
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_pathFind_blocked_start_on_border) {
+	const int SQUARE_DIM = 16;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// the start can only leave its cluster by stepping across the border
+	navGrid.at(7, 4)->weight = BLOCKED_GRID_WEIGHT;
+	navGrid.at(6, 4)->weight = BLOCKED_GRID_WEIGHT;
+	navGrid.at(7, 3)->weight = BLOCKED_GRID_WEIGHT;
+	navGrid.at(7, 5)->weight = BLOCKED_GRID_WEIGHT;
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{7,4}, sf::Vector2i{0, 0} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	BOOST_REQUIRE(pathsReturn[0].size() > 0);
+	BOOST_CHECK(pathsReturn[0].front() == sf::Vector2i(8, 4));
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_pathFind_matches_reachability) {
+	const int SQUARE_DIM = 50;
+	const int NUM_REQUESTS = 60;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0,0 });
+
+	// build walls with gaps, weighted squares, and one closed wall
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if ((y + x) % 11 != 0 || x == 40) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+	for (unsigned int x = 1; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; y += 3) {
+			navGrid.at(x, y)->weight = 50;
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ i % 3, (i * 7) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 13), (i * 13) % SQUARE_DIM } });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> expectedPaths;
+	pathfinder.pathFind(pathRequests, &expectedPaths);
+
+	HierarchicalPathfinder hierarchicalPathfinder(&navGrid, 10);
+	std::vector<std::deque<sf::Vector2i>> hierarchicalPaths;
+	hierarchicalPathfinder.pathFind(pathRequests, &hierarchicalPaths);
+
+	// both find a path for the same requests
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_CHECK_EQUAL(hierarchicalPaths[i].empty(), expectedPaths[i].empty());
+		if (!hierarchicalPaths[i].empty()) {
+			checkPathIsValid(navGrid, pathRequests[i], hierarchicalPaths[i]);
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end HierarchicalPathfinder_pathFind
+
+BOOST_AUTO_TEST_SUITE(HierarchicalPathfinder_updateGridSquares)
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_updateGridSquares_only_rebuilds_affected_clusters) {
+	const int SQUARE_DIM = 64;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+	const std::size_t initialRebuildCount = pathfinder.getClusterRebuildCount();
+
+	// a change inside a cluster only rebuilds that cluster
+	navGrid.at(20, 20)->weight = 5;
+	pathfinder.updateGridSquares({ sf::Vector2i{20, 20} });
+	BOOST_CHECK_EQUAL(pathfinder.getClusterRebuildCount(), initialRebuildCount + 1);
+
+	// a change on a border also rebuilds the cluster across it
+	navGrid.at(23, 20)->weight = BLOCKED_GRID_WEIGHT;
+	pathfinder.updateGridSquares({ sf::Vector2i{23, 20} });
+	BOOST_CHECK_EQUAL(pathfinder.getClusterRebuildCount(), initialRebuildCount + 3);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalPathfinder_updateGridSquares_closes_and_opens_wall) {
+	const int SQUARE_DIM = 32;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// a wall on a cluster border with a single gap
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(15, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	navGrid.at(15, 25)->weight = 1;
+	HierarchicalPathfinder pathfinder(&navGrid, 8);
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{2,2}, sf::Vector2i{29, 2} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK(pathsReturn[0].size() > 0);
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+
+	// close the gap
+	navGrid.at(15, 25)->weight = BLOCKED_GRID_WEIGHT;
+	pathfinder.updateGridSquares({ sf::Vector2i{15, 25} });
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK(pathsReturn[0].empty());
+
+	// open a new gap near the request
+	navGrid.at(15, 3)->weight = 1;
+	pathfinder.updateGridSquares({ sf::Vector2i{15, 3} });
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK(pathsReturn[0].size() > 0);
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+
+	// the incremental update matches a full rebuild
+	HierarchicalPathfinder rebuiltPathfinder(&navGrid, 8);
+	BOOST_CHECK_EQUAL(pathfinder.getAbstractNodeCount(), rebuiltPathfinder.getAbstractNodeCount());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end HierarchicalPathfinder_updateGridSquares
+
+BOOST_AUTO_TEST_SUITE_END() // end HierarchicalPathfinder_Tests
@@ -0,0 +1,221 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/FlowField.h>
+#include <GameBackbone/Navigation/IncrementalPathfinder.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Checks that a path is a chain of adjacent unblocked grid squares from the start to the end, and returns its cost.
+	/// </summary>
+	int checkPathAndCalculateCost(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			BOOST_CHECK_EQUAL(std::abs(gridSquare.x - previous.x) + std::abs(gridSquare.y - previous.y), 1);
+			const int weight = navGrid.at(static_cast<unsigned int>(gridSquare.x), static_cast<unsigned int>(gridSquare.y))->weight;
+			BOOST_CHECK(weight < BLOCKED_GRID_WEIGHT);
+			cost += (navGrid.at(static_cast<unsigned int>(previous.x), static_cast<unsigned int>(previous.y))->weight + weight) / 2;
+			previous = gridSquare;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+		return cost;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(IncrementalPathfinder_Tests)
+
+BOOST_AUTO_TEST_SUITE(IncrementalPathfinder_CTRs)
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_default_CTR) {
+	IncrementalPathfinder pathfinder;
+
+	BOOST_CHECK(pathfinder.getNavigationGrid() == nullptr);
+
+	// no grid means no path
+	std::deque<sf::Vector2i> path;
+	pathfinder.setPathRequest(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(1, 0) });
+	pathfinder.pathFind(path);
+	BOOST_CHECK(path.empty());
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_navigationGrid_CTR) {
+	NavigationGrid navGrid(5, 5);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	IncrementalPathfinder pathfinder(&navGrid);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, pathfinder.getNavigationGrid());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end IncrementalPathfinder_CTRs
+
+BOOST_AUTO_TEST_SUITE(IncrementalPathfinder_pathFind)
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_pathFind_open_grid) {
+	NavigationGrid navGrid(10, 10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	IncrementalPathfinder pathfinder(&navGrid);
+	const PathRequest pathRequest{ sf::Vector2i(1, 2), sf::Vector2i(8, 6) };
+	pathfinder.setPathRequest(pathRequest);
+
+	std::deque<sf::Vector2i> path;
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(path.size(), 7 + 4);
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 7 + 4);
+
+	// nothing changed, so nothing is searched again
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+	BOOST_CHECK_EQUAL(path.size(), 7 + 4);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_pathFind_no_path) {
+	NavigationGrid navGrid(6, 6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 6; ++y) {
+		navGrid.at(3, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	IncrementalPathfinder pathfinder(&navGrid);
+	pathfinder.setPathRequest(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(5, 5) });
+
+	std::deque<sf::Vector2i> path;
+	pathfinder.pathFind(path);
+	BOOST_CHECK(path.empty());
+
+	// opening the wall creates a path
+	navGrid.at(3, 4)->weight = 1;
+	pathfinder.updateGridSquares({ sf::Vector2i(3, 4) });
+	pathfinder.pathFind(path);
+	BOOST_CHECK(!path.empty());
+	checkPathAndCalculateCost(navGrid, pathfinder.getPathRequest(), path);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end IncrementalPathfinder_pathFind
+
+BOOST_AUTO_TEST_SUITE(IncrementalPathfinder_updateGridSquares)
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_updateGridSquares_blocked_path) {
+	NavigationGrid navGrid(40, 40);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	// a wall with two doors
+	for (unsigned int y = 0; y < 40; ++y) {
+		if (y != 5 && y != 30) {
+			navGrid.at(20, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+
+	IncrementalPathfinder pathfinder(&navGrid);
+	const PathRequest pathRequest{ sf::Vector2i(2, 4), sf::Vector2i(37, 6) };
+	pathfinder.setPathRequest(pathRequest);
+
+	std::deque<sf::Vector2i> path;
+	pathfinder.pathFind(path);
+	const std::size_t initialExpandedNodeCount = pathfinder.getExpandedNodeCount();
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 35 + 2);
+
+	// closing the near door forces the path through the far door
+	navGrid.at(20, 5)->weight = BLOCKED_GRID_WEIGHT;
+	pathfinder.updateGridSquares({ sf::Vector2i(20, 5) });
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 35 + 26 + 24);
+
+	// reopening it only repairs the search around the door
+	navGrid.at(20, 5)->weight = 1;
+	pathfinder.updateGridSquares({ sf::Vector2i(20, 5) });
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 35 + 2);
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() < initialExpandedNodeCount);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_updateGridSquares_moving_start) {
+	NavigationGrid navGrid(30, 30);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 2,0 });
+	for (unsigned int x = 0; x < 30; ++x) {
+		for (unsigned int y = 0; y < 30; ++y) {
+			if ((x * 7 + y * 11) % 9 == 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+			else if ((x + y) % 4 == 0) {
+				navGrid.at(x, y)->weight = 5;
+			}
+		}
+	}
+	const sf::Vector2i end(28, 27);
+	navGrid.at(1, 1)->weight = 2;
+	navGrid.at(static_cast<unsigned int>(end.x), static_cast<unsigned int>(end.y))->weight = 2;
+
+	IncrementalPathfinder pathfinder(&navGrid);
+	pathfinder.setPathRequest(PathRequest{ sf::Vector2i(1, 1), end });
+	FlowField flowField(&navGrid);
+
+	// walk along the path while walls appear in front of the agent. Every replanned path must stay optimal.
+	std::deque<sf::Vector2i> path;
+	pathfinder.pathFind(path);
+	for (int step = 0; step < 10 && path.size() > 3; ++step) {
+		pathfinder.setStart(path.front());
+		const sf::Vector2i changedGridSquare = path[2];
+		navGrid.at(static_cast<unsigned int>(changedGridSquare.x), static_cast<unsigned int>(changedGridSquare.y))->weight = BLOCKED_GRID_WEIGHT;
+		pathfinder.updateGridSquares({ changedGridSquare });
+		pathfinder.pathFind(path);
+
+		flowField.generate(end);
+		const PathRequest& pathRequest = pathfinder.getPathRequest();
+		BOOST_REQUIRE_EQUAL(path.empty(), !flowField.isReachable(pathRequest.start));
+		if (!path.empty()) {
+			BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), flowField.getIntegratedCost(pathRequest.start));
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(IncrementalPathfinder_updateGridSquares_lower_weight) {
+	NavigationGrid navGrid(12, 12);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 4,0 });
+
+	IncrementalPathfinder pathfinder(&navGrid);
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(11, 0) };
+	pathfinder.setPathRequest(pathRequest);
+
+	std::deque<sf::Vector2i> path;
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 11 * 4);
+
+	// a cheap road below the lowest weight the search started with
+	for (unsigned int x = 0; x < 12; ++x) {
+		navGrid.at(x, 1)->weight = 1;
+	}
+	std::vector<sf::Vector2i> changedGridSquares;
+	for (int x = 0; x < 12; ++x) {
+		changedGridSquares.push_back(sf::Vector2i(x, 1));
+	}
+	pathfinder.updateGridSquares(changedGridSquares);
+	pathfinder.pathFind(path);
+	BOOST_CHECK_EQUAL(checkPathAndCalculateCost(navGrid, pathRequest, path), 2 + 11 + 2);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end IncrementalPathfinder_updateGridSquares
+
+BOOST_AUTO_TEST_SUITE_END() // end IncrementalPathfinder_Tests
@@ -0,0 +1,125 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Util/IndexedPriorityQueue.h>
+
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(IndexedPriorityQueue_Tests)
+
+BOOST_AUTO_TEST_SUITE(IndexedPriorityQueue_CTRs)
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_default_CTR) {
+	IndexedPriorityQueue<int> queue;
+
+	BOOST_CHECK(queue.isEmpty());
+	BOOST_CHECK_EQUAL(queue.getCapacity(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_capacity_CTR) {
+	IndexedPriorityQueue<int> queue(10);
+
+	BOOST_CHECK(queue.isEmpty());
+	BOOST_CHECK_EQUAL(queue.getCapacity(), 10);
+	for (unsigned int i = 0; i < 10; ++i) {
+		BOOST_CHECK(!queue.isQueued(i));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end IndexedPriorityQueue_CTRs
+
+BOOST_AUTO_TEST_SUITE(IndexedPriorityQueue_operations)
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_pop_in_priority_order) {
+	IndexedPriorityQueue<int> queue(8);
+	const std::vector<int> priorities{ 50, 3, 17, 8, 42, 1, 99, 23 };
+	for (unsigned int i = 0; i < priorities.size(); ++i) {
+		queue.pushOrUpdate(i, priorities[i]);
+	}
+	BOOST_CHECK_EQUAL(queue.size(), priorities.size());
+
+	int lastPriority = -1;
+	while (!queue.isEmpty()) {
+		const int topPriority = queue.getTopPriority();
+		const unsigned int handle = queue.pop();
+		BOOST_CHECK_EQUAL(priorities[handle], topPriority);
+		BOOST_CHECK(topPriority >= lastPriority);
+		BOOST_CHECK(!queue.isQueued(handle));
+		lastPriority = topPriority;
+	}
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_ties_pop_lowest_handle) {
+	IndexedPriorityQueue<int> queue(5);
+	queue.pushOrUpdate(4, 7);
+	queue.pushOrUpdate(2, 7);
+	queue.pushOrUpdate(3, 7);
+
+	BOOST_CHECK_EQUAL(queue.pop(), 2);
+	BOOST_CHECK_EQUAL(queue.pop(), 3);
+	BOOST_CHECK_EQUAL(queue.pop(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_decrease_priority) {
+	IndexedPriorityQueue<int> queue(3);
+	queue.pushOrUpdate(0, 10);
+	queue.pushOrUpdate(1, 20);
+	queue.pushOrUpdate(2, 30);
+
+	queue.pushOrUpdate(2, 5);
+
+	BOOST_CHECK_EQUAL(queue.size(), 3);
+	BOOST_CHECK_EQUAL(queue.getPriority(2), 5);
+	BOOST_CHECK_EQUAL(queue.getTop(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_increase_priority) {
+	IndexedPriorityQueue<int> queue(3);
+	queue.pushOrUpdate(0, 10);
+	queue.pushOrUpdate(1, 20);
+	queue.pushOrUpdate(2, 30);
+
+	queue.pushOrUpdate(0, 40);
+
+	BOOST_CHECK_EQUAL(queue.pop(), 1);
+	BOOST_CHECK_EQUAL(queue.pop(), 2);
+	BOOST_CHECK_EQUAL(queue.pop(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_remove) {
+	IndexedPriorityQueue<int> queue(4);
+	queue.pushOrUpdate(0, 4);
+	queue.pushOrUpdate(1, 3);
+	queue.pushOrUpdate(2, 2);
+	queue.pushOrUpdate(3, 1);
+
+	queue.remove(2);
+	queue.remove(2);
+
+	BOOST_CHECK_EQUAL(queue.size(), 3);
+	BOOST_CHECK(!queue.isQueued(2));
+	BOOST_CHECK_EQUAL(queue.pop(), 3);
+	BOOST_CHECK_EQUAL(queue.pop(), 1);
+	BOOST_CHECK_EQUAL(queue.pop(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IndexedPriorityQueue_clear) {
+	IndexedPriorityQueue<int> queue(4);
+	queue.pushOrUpdate(1, 3);
+	queue.pushOrUpdate(3, 1);
+
+	queue.clear();
+
+	BOOST_CHECK(queue.isEmpty());
+	BOOST_CHECK(!queue.isQueued(1));
+	BOOST_CHECK(!queue.isQueued(3));
+
+	// the queue is still usable after being cleared
+	queue.pushOrUpdate(3, 2);
+	BOOST_CHECK_EQUAL(queue.pop(), 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end IndexedPriorityQueue_operations
+
+BOOST_AUTO_TEST_SUITE_END() // end IndexedPriorityQueue_Tests
@@ -0,0 +1,232 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/LandmarkTable.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Gives a grid uneven weights and a few blocked squares.
+	/// </summary>
+	void initUnevenWeights(NavigationGrid& navGrid) {
+		initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+		for (unsigned int x = 0; x < navGrid.getArraySizeX(); ++x) {
+			for (unsigned int y = 0; y < navGrid.getArraySizeY(); ++y) {
+				const unsigned int hash = (x * 7919u + y * 104729u) % 17u;
+				navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 6);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Finds the cost of the cheapest path between two grid squares. -1 if no path exists.
+	/// </summary>
+	int calcCheapestCost(NavigationGrid& navGrid, const sf::Vector2i& start, const sf::Vector2i& end) {
+		Pathfinder pathfinder(&navGrid);
+		pathfinder.setHeuristic(PATH_HEURISTIC_NONE);
+		std::vector<std::deque<sf::Vector2i>> paths;
+		pathfinder.pathFind({ PathRequest{ start, end } }, &paths);
+		if (paths[0].empty()) {
+			return (start == end) ? 0 : -1;
+		}
+		int cost = 0;
+		sf::Vector2i previous = start;
+		for (const sf::Vector2i& gridSquare : paths[0]) {
+			cost += (navGrid.at(previous.x, previous.y)->weight + navGrid.at(gridSquare.x, gridSquare.y)->weight) / 2;
+			previous = gridSquare;
+		}
+		return cost;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(LandmarkTable_Tests)
+
+BOOST_AUTO_TEST_SUITE(LandmarkTable_CTRs)
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_default_CTR) {
+	LandmarkTable landmarkTable;
+
+	BOOST_CHECK(landmarkTable.getNavigationGrid() == nullptr);
+	BOOST_CHECK_EQUAL(landmarkTable.getLandmarkCount(), 0);
+	BOOST_CHECK_EQUAL(landmarkTable.getMemoryUsage(), 0);
+	BOOST_CHECK_EQUAL(landmarkTable.calcLowerBound(sf::Vector2i(0, 0), sf::Vector2i(1, 1)), 0);
+	BOOST_CHECK_EQUAL(landmarkTable.getCost(0, sf::Vector2i(0, 0)), LandmarkTable::UNREACHABLE_COST);
+}
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_navigationGrid_CTR) {
+	NavigationGrid navGrid(12, 9);
+	initUnevenWeights(navGrid);
+
+	LandmarkTable landmarkTable(&navGrid, 4);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, landmarkTable.getNavigationGrid());
+
+	BOOST_CHECK(landmarkTable.getGridSize() == sf::Vector2u(12, 9));
+	BOOST_REQUIRE_EQUAL(landmarkTable.getLandmarkCount(), 4);
+	BOOST_CHECK_EQUAL(landmarkTable.getMemoryUsage(), 4 * 12 * 9 * sizeof(unsigned int) + 4 * sizeof(sf::Vector2i));
+
+	// landmarks are distinct unblocked grid squares
+	const std::vector<sf::Vector2i>& landmarks = landmarkTable.getLandmarks();
+	for (unsigned int landmark = 0; landmark < landmarks.size(); ++landmark) {
+		BOOST_CHECK(navGrid.at(landmarks[landmark].x, landmarks[landmark].y)->weight < BLOCKED_GRID_WEIGHT);
+		BOOST_CHECK_EQUAL(landmarkTable.getCost(landmark, landmarks[landmark]), 0);
+		BOOST_CHECK_EQUAL(std::count(landmarks.begin(), landmarks.end(), landmarks[landmark]), 1);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end LandmarkTable_CTRs
+
+BOOST_AUTO_TEST_SUITE(LandmarkTable_build)
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_build_matches_Pathfinder_costs) {
+	NavigationGrid navGrid(14, 11);
+	initUnevenWeights(navGrid);
+	LandmarkTable landmarkTable(&navGrid, 3);
+
+	for (unsigned int landmark = 0; landmark < landmarkTable.getLandmarkCount(); ++landmark) {
+		for (unsigned int x = 0; x < 14; x += 3) {
+			for (unsigned int y = 0; y < 11; y += 2) {
+				const sf::Vector2i gridSquare(static_cast<int>(x), static_cast<int>(y));
+				const int cheapestCost = calcCheapestCost(navGrid, landmarkTable.getLandmarks()[landmark], gridSquare);
+				if (cheapestCost < 0 || navGrid.at(x, y)->weight >= BLOCKED_GRID_WEIGHT) {
+					BOOST_CHECK_EQUAL(landmarkTable.getCost(landmark, gridSquare), LandmarkTable::UNREACHABLE_COST);
+				}
+				else {
+					BOOST_CHECK_EQUAL(landmarkTable.getCost(landmark, gridSquare), static_cast<unsigned int>(cheapestCost));
+				}
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_build_lower_bound) {
+	NavigationGrid navGrid(16, 13);
+	initUnevenWeights(navGrid);
+	LandmarkTable landmarkTable(&navGrid, 4);
+
+	// the bound never exceeds the cheapest path
+	unsigned int seed = 3;
+	for (int i = 0; i < 60; ++i) {
+		seed = seed * 1103515245u + 12345u;
+		const sf::Vector2i start(static_cast<int>((seed >> 8) % 16), static_cast<int>((seed >> 16) % 13));
+		seed = seed * 1103515245u + 12345u;
+		const sf::Vector2i end(static_cast<int>((seed >> 8) % 16), static_cast<int>((seed >> 16) % 13));
+		const int cheapestCost = calcCheapestCost(navGrid, start, end);
+		if (cheapestCost >= 0) {
+			BOOST_CHECK(landmarkTable.calcLowerBound(start, end) <= static_cast<unsigned int>(cheapestCost));
+		}
+	}
+
+	// the bound between a landmark and any grid square is exact
+	const sf::Vector2i landmark = landmarkTable.getLandmarks()[0];
+	BOOST_CHECK_EQUAL(landmarkTable.calcLowerBound(landmark, sf::Vector2i(7, 6)), static_cast<unsigned int>(calcCheapestCost(navGrid, landmark, sf::Vector2i(7, 6))));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_build_largest_area) {
+	NavigationGrid navGrid(10, 6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	// a wall leaves a small area on the left
+	for (unsigned int y = 0; y < 6; ++y) {
+		navGrid.at(2, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	LandmarkTable landmarkTable(&navGrid, 3);
+
+	BOOST_REQUIRE_EQUAL(landmarkTable.getLandmarkCount(), 3);
+	for (const sf::Vector2i& landmark : landmarkTable.getLandmarks()) {
+		BOOST_CHECK(landmark.x > 2);
+	}
+	// paths in the small area are not bounded
+	BOOST_CHECK_EQUAL(landmarkTable.calcLowerBound(sf::Vector2i(0, 0), sf::Vector2i(1, 5)), 0);
+	BOOST_CHECK(landmarkTable.calcLowerBound(sf::Vector2i(3, 0), sf::Vector2i(9, 5)) > 0);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_build_small_grid) {
+	NavigationGrid navGrid(2, 1);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// there can not be more landmarks than grid squares
+	LandmarkTable landmarkTable(&navGrid, 5);
+	BOOST_CHECK_EQUAL(landmarkTable.getLandmarkCount(), 2);
+
+	// or any landmark on a blocked grid
+	initAllNavigationGridValues(navGrid, NavigationGridData{ BLOCKED_GRID_WEIGHT,0 });
+	landmarkTable.build(5);
+	BOOST_CHECK_EQUAL(landmarkTable.getLandmarkCount(), 0);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end LandmarkTable_build
+
+BOOST_AUTO_TEST_SUITE(LandmarkTable_serialize)
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_serialize_round_trip) {
+	NavigationGrid navGrid(12, 9);
+	initUnevenWeights(navGrid);
+	LandmarkTable landmarkTable(&navGrid, 3);
+
+	// tables built offline are loaded without a grid
+	LandmarkTable loadedTable;
+	BOOST_REQUIRE(loadedTable.deserialize(landmarkTable.serialize()));
+	BOOST_CHECK(loadedTable.getNavigationGrid() == nullptr);
+	BOOST_CHECK(loadedTable.getGridSize() == landmarkTable.getGridSize());
+	BOOST_CHECK(loadedTable.getLandmarks() == landmarkTable.getLandmarks());
+	for (unsigned int landmark = 0; landmark < landmarkTable.getLandmarkCount(); ++landmark) {
+		for (int x = 0; x < 12; ++x) {
+			for (int y = 0; y < 9; ++y) {
+				BOOST_CHECK_EQUAL(loadedTable.getCost(landmark, sf::Vector2i(x, y)), landmarkTable.getCost(landmark, sf::Vector2i(x, y)));
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL(loadedTable.serialize(), landmarkTable.serialize());
+
+	// the loaded tables remember the weights they were built from
+	BOOST_CHECK(loadedTable.isBuiltFor(&navGrid));
+	navGrid.at(5, 5)->weight += 1;
+	BOOST_CHECK(!loadedTable.isBuiltFor(&navGrid));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(LandmarkTable_deserialize_invalid) {
+	NavigationGrid navGrid(6, 5);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	LandmarkTable landmarkTable(&navGrid, 2);
+	const std::string serializedTable = landmarkTable.serialize();
+
+	BOOST_CHECK(!landmarkTable.deserialize(""));
+	BOOST_CHECK(!landmarkTable.deserialize(serializedTable.substr(0, serializedTable.size() - 1)));
+	BOOST_CHECK(!landmarkTable.deserialize(serializedTable + "x"));
+	std::string wrongTag = serializedTable;
+	wrongTag[0] = 'X';
+	BOOST_CHECK(!landmarkTable.deserialize(wrongTag));
+
+	// failed loads keep the current tables
+	BOOST_CHECK_EQUAL(landmarkTable.getLandmarkCount(), 2);
+	BOOST_CHECK(landmarkTable.isBuiltFor(&navGrid));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end LandmarkTable_serialize
+
+BOOST_AUTO_TEST_SUITE_END() // end LandmarkTable_Tests
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathRequest.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <random>
+#include <vector>
+
+namespace TEST {
+
+	/// <summary>
+	/// Draws the weight of one grid square. Unblocked grid squares weigh from 1 to 9.
+	/// </summary>
+	/// <param name="random">The generator of the grid being filled.</param>
+	/// <param name="blockedOneIn">Roughly one grid square in this many is blocked.</param>
+	/// <returns>The weight of the grid square.</returns>
+	inline int drawRandomWeight(std::minstd_rand& random, unsigned int blockedOneIn) {
+		return (random() % blockedOneIn == 0) ? GB::BLOCKED_GRID_WEIGHT : static_cast<int>(random() % 9) + 1;
+	}
+
+	/// <summary>
+	/// Fills a navigation grid with random weights that are the same on every platform. The grid data must be initialized.
+	/// </summary>
+	/// <param name="navGrid">The navigation grid.</param>
+	/// <param name="seed">The seed of the weights.</param>
+	/// <param name="blockedOneIn">Roughly one grid square in this many is blocked.</param>
+	inline void fillRandomWeights(GB::NavigationGrid& navGrid, unsigned int seed, unsigned int blockedOneIn = 5) {
+		std::minstd_rand random(seed);
+		for (unsigned int x = 0; x < navGrid.getArraySizeX(); ++x) {
+			for (unsigned int y = 0; y < navGrid.getArraySizeY(); ++y) {
+				navGrid[x][y]->weight = drawRandomWeight(random, blockedOneIn);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Fills a dense navigation grid with the same random weights a NavigationGrid of its size gets from the same seed.
+	/// </summary>
+	/// <param name="navGrid">The dense navigation grid.</param>
+	/// <param name="seed">The seed of the weights.</param>
+	/// <param name="blockedOneIn">Roughly one grid square in this many is blocked.</param>
+	inline void fillRandomWeights(GB::DenseNavigationGrid& navGrid, unsigned int seed, unsigned int blockedOneIn = 5) {
+		std::minstd_rand random(seed);
+		for (unsigned int x = 0; x < navGrid.getArraySizeX(); ++x) {
+			for (unsigned int y = 0; y < navGrid.getArraySizeY(); ++y) {
+				navGrid.setWeight(x, y, drawRandomWeight(random, blockedOneIn));
+			}
+		}
+	}
+
+	/// <summary>
+	/// Creates path requests between random grid squares of a grid.
+	/// </summary>
+	/// <param name="gridSize">The size of the grid.</param>
+	/// <param name="requestCount">The number of path requests.</param>
+	/// <param name="seed">The seed of the grid squares.</param>
+	/// <returns>The path requests. Their ends may be blocked.</returns>
+	inline std::vector<GB::PathRequest> makeRandomPathRequests(const sf::Vector2u& gridSize, unsigned int requestCount, unsigned int seed) {
+		std::minstd_rand random(seed);
+		std::vector<GB::PathRequest> pathRequests;
+		for (unsigned int i = 0; i < requestCount; ++i) {
+			const sf::Vector2i start(static_cast<int>(random() % gridSize.x), static_cast<int>(random() % gridSize.y));
+			const sf::Vector2i end(static_cast<int>(random() % gridSize.x), static_cast<int>(random() % gridSize.y));
+			pathRequests.push_back(GB::PathRequest{ start, end });
+		}
+		return pathRequests;
+	}
+
+}
@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include <cfloat>
+#include <climits>
 
 
 using namespace GB;
@@ -371,5 +372,77 @@ BOOST_AUTO_TEST_CASE(initAllNavigationGridValues_Test_Inheritance) {
 
 BOOST_AUTO_TEST_SUITE_END() // end initAllNavigationGridValuesTests
 
+BOOST_AUTO_TEST_SUITE(hasLineOfSightTests)
+
+BOOST_AUTO_TEST_CASE(hasLineOfSight_Open_Grid) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 4)));
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(9, 4), sf::Vector2i(0, 0)));
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(3, 3), sf::Vector2i(3, 3)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(hasLineOfSight_Blocked) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(4, 2)->weight = BLOCKED_GRID_WEIGHT;
+
+	// the line from (0, 0) to (8, 4) passes through the center of (4, 2)
+	BOOST_CHECK(!hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(8, 4)));
+	BOOST_CHECK(!hasLineOfSight(navGrid, sf::Vector2i(8, 4), sf::Vector2i(0, 0)));
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(8, 0)));
+
+	// a blocked start may be left, but a blocked end can not be seen
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(4, 2), sf::Vector2i(4, 9)));
+	BOOST_CHECK(!hasLineOfSight(navGrid, sf::Vector2i(4, 9), sf::Vector2i(4, 2)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(hasLineOfSight_Corner) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(3, 2)->weight = BLOCKED_GRID_WEIGHT;
+
+	// a diagonal line touches both grid squares at each corner it passes
+	BOOST_CHECK(!hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(5, 5)));
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(0, 1), sf::Vector2i(5, 6)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(hasLineOfSight_Max_Weight) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(5, 0)->weight = 5;
+
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 0)));
+	BOOST_CHECK(hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 0), 5));
+	BOOST_CHECK(!hasLineOfSight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 0), 4));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(calcLineOfSightWeight_Heaviest_Weight) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(0, 0)->weight = 9;
+	navGrid.at(3, 0)->weight = 4;
+	navGrid.at(6, 0)->weight = BLOCKED_GRID_WEIGHT;
+
+	// the start is ignored, and the walk stops at the first grid square past the max weight
+	BOOST_CHECK_EQUAL(calcLineOfSightWeight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(5, 0)), 4);
+	BOOST_CHECK_EQUAL(calcLineOfSightWeight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 0)), BLOCKED_GRID_WEIGHT);
+	BOOST_CHECK_EQUAL(calcLineOfSightWeight(navGrid, sf::Vector2i(0, 0), sf::Vector2i(9, 0), 3), 4);
+	BOOST_CHECK_EQUAL(calcLineOfSightWeight(navGrid, sf::Vector2i(2, 2), sf::Vector2i(2, 2)), INT_MIN);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end hasLineOfSightTests
+
 // keep at end of file
 BOOST_AUTO_TEST_SUITE_END() // end NavigationToolsTests
\ No newline at end of file
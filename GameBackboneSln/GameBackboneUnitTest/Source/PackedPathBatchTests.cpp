@@ -0,0 +1,352 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/CoordinateConverter.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PackedPathBatch.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <chrono>
+#include <deque>
+#include <sstream>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Creates paths that cover each kind of offset: none, grid steps, repeated steps, and long jumps in every direction.
+	/// </summary>
+	std::vector<std::deque<sf::Vector2i>> makeTestPaths() {
+		std::vector<std::deque<sf::Vector2i>> paths(4);
+		for (int x = 1; x <= 10; ++x) {
+			paths[1].push_back(sf::Vector2i(x, 0));
+		}
+		for (int y = 1; y <= 5; ++y) {
+			paths[1].push_back(sf::Vector2i(10, -y));
+		}
+		paths[2] = { sf::Vector2i(3, 4), sf::Vector2i(3, 4), sf::Vector2i(-1, 2) };
+		paths[3] = { sf::Vector2i(100000, -70000), sf::Vector2i(-1000000, 2000000), sf::Vector2i(0, 0), sf::Vector2i(64, -65) };
+		return paths;
+	}
+
+	/// <summary>
+	/// Checks that every path of a batch matches the path it was packed from.
+	/// </summary>
+	void checkBatchMatches(const PackedPathBatch& batch, const std::vector<std::deque<sf::Vector2i>>& paths) {
+		BOOST_REQUIRE_EQUAL(batch.getPathCount(), paths.size());
+		for (std::size_t i = 0; i < paths.size(); ++i) {
+			const PackedPath packedPath = batch.getPath(i);
+			BOOST_CHECK_EQUAL(packedPath.size(), paths[i].size());
+			BOOST_CHECK(std::vector<sf::Vector2i>(packedPath.begin(), packedPath.end()) == std::vector<sf::Vector2i>(paths[i].begin(), paths[i].end()));
+		}
+	}
+
+	/// <summary>
+	/// A movable object that records its position and rotation.
+	/// </summary>
+	struct TestMovable {
+		sf::Vector2f position;
+		float rotation = 0;
+
+		const sf::Vector2f& getPosition() const { return position; }
+		void setPosition(const sf::Vector2f& newPosition) { position = newPosition; }
+		void move(float x, float y) { position += sf::Vector2f(x, y); }
+		void setRotation(float newRotation) { rotation = newRotation; }
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(PackedPathBatch_Tests)
+
+BOOST_AUTO_TEST_SUITE(PackedPathBatch_CTRs)
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_default_CTR) {
+	PackedPathBatch batch;
+
+	BOOST_CHECK_EQUAL(batch.getEncoding(), PATH_ENCODING_NONE);
+	BOOST_CHECK_EQUAL(batch.getPathCount(), 0);
+	BOOST_CHECK_EQUAL(batch.getWaypointCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_encoding_CTR) {
+	PackedPathBatch batch(PATH_ENCODING_RUN_LENGTH);
+
+	BOOST_CHECK_EQUAL(batch.getEncoding(), PATH_ENCODING_RUN_LENGTH);
+	BOOST_CHECK_EQUAL(batch.getPathCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PackedPathBatch_CTRs
+
+BOOST_AUTO_TEST_SUITE(PackedPathBatch_packing)
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_assign_every_encoding) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	for (PATH_ENCODING_TYPE encoding : { PATH_ENCODING_NONE, PATH_ENCODING_DELTA, PATH_ENCODING_RUN_LENGTH }) {
+		PackedPathBatch batch(encoding);
+		batch.assign(paths);
+
+		checkBatchMatches(batch, paths);
+		BOOST_CHECK_EQUAL(batch.getWaypointCount(), 22);
+		BOOST_CHECK(batch.getPath(0).empty());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_appendPath) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	PackedPathBatch batch(PATH_ENCODING_DELTA);
+	for (const std::deque<sf::Vector2i>& path : paths) {
+		batch.appendPath(path);
+	}
+
+	checkBatchMatches(batch, paths);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_appendPath_other_batch) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	for (PATH_ENCODING_TYPE encoding : { PATH_ENCODING_NONE, PATH_ENCODING_DELTA, PATH_ENCODING_RUN_LENGTH }) {
+		PackedPathBatch otherBatch(encoding);
+		otherBatch.assign(paths);
+
+		// the paths are copied in reverse order without decoding them
+		PackedPathBatch batch(encoding);
+		std::vector<std::deque<sf::Vector2i>> reversedPaths;
+		for (std::size_t i = paths.size(); i > 0; --i) {
+			batch.appendPath(otherBatch, i - 1);
+			reversedPaths.push_back(paths[i - 1]);
+		}
+		checkBatchMatches(batch, reversedPaths);
+		BOOST_CHECK_EQUAL(batch.getWaypointCount(), otherBatch.getWaypointCount());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_appendPath_reverse_iterators) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	for (PATH_ENCODING_TYPE encoding : { PATH_ENCODING_NONE, PATH_ENCODING_DELTA, PATH_ENCODING_RUN_LENGTH }) {
+		PackedPathBatch batch(encoding);
+		std::vector<std::deque<sf::Vector2i>> reversedPaths;
+		for (const std::deque<sf::Vector2i>& path : paths) {
+			batch.appendPath(path.rbegin(), path.rend());
+			reversedPaths.emplace_back(path.rbegin(), path.rend());
+		}
+		checkBatchMatches(batch, reversedPaths);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_getPath_deque) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	PackedPathBatch batch(PATH_ENCODING_RUN_LENGTH);
+	batch.assign(paths);
+
+	std::deque<sf::Vector2i> path{ sf::Vector2i(7, 7) };
+	batch.getPath(1, path);
+	BOOST_CHECK(path == paths[1]);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_assign_replaces_paths) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	PackedPathBatch batch;
+	batch.assign(paths);
+
+	const std::vector<std::deque<sf::Vector2i>> otherPaths{ paths[3] };
+	batch.assign(otherPaths);
+	checkBatchMatches(batch, otherPaths);
+	BOOST_CHECK_EQUAL(batch.getWaypointCount(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_setEncoding_clears) {
+	PackedPathBatch batch;
+	batch.assign(makeTestPaths());
+
+	batch.setEncoding(PATH_ENCODING_DELTA);
+	BOOST_CHECK_EQUAL(batch.getEncoding(), PATH_ENCODING_DELTA);
+	BOOST_CHECK_EQUAL(batch.getPathCount(), 0);
+	BOOST_CHECK_EQUAL(batch.getWaypointCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_encoding_memory) {
+	// a long path of grid steps that turns once
+	std::vector<std::deque<sf::Vector2i>> paths(1);
+	for (int x = 1; x <= 1000; ++x) {
+		paths[0].push_back(sf::Vector2i(x, 0));
+	}
+	for (int y = 1; y <= 1000; ++y) {
+		paths[0].push_back(sf::Vector2i(1000, y));
+	}
+
+	PackedPathBatch unencodedBatch(PATH_ENCODING_NONE);
+	PackedPathBatch deltaBatch(PATH_ENCODING_DELTA);
+	PackedPathBatch runLengthBatch(PATH_ENCODING_RUN_LENGTH);
+	unencodedBatch.assign(paths);
+	deltaBatch.assign(paths);
+	runLengthBatch.assign(paths);
+
+	// grid steps take two bytes each with delta encoding, and each run only a few bytes with run length encoding
+	BOOST_CHECK(deltaBatch.getMemoryUsage() * 2 < unencodedBatch.getMemoryUsage());
+	BOOST_CHECK(runLengthBatch.getMemoryUsage() * 10 < deltaBatch.getMemoryUsage());
+	checkBatchMatches(runLengthBatch, paths);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PackedPathBatch_packing
+
+BOOST_AUTO_TEST_SUITE(PackedPath_Tests)
+
+BOOST_AUTO_TEST_CASE(PackedPath_popFront) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	PackedPathBatch batch(PATH_ENCODING_RUN_LENGTH);
+	batch.assign(paths);
+
+	PackedPath path = batch.getPath(1);
+	for (const sf::Vector2i& waypoint : paths[1]) {
+		BOOST_REQUIRE(!path.empty());
+		BOOST_CHECK_EQUAL(path.front().x, waypoint.x);
+		BOOST_CHECK_EQUAL(path.front().y, waypoint.y);
+		path.popFront();
+	}
+	BOOST_CHECK(path.empty());
+	BOOST_CHECK(path.begin() == path.end());
+}
+
+BOOST_AUTO_TEST_CASE(PackedPath_default_CTR) {
+	PackedPath path;
+
+	BOOST_CHECK(path.empty());
+	BOOST_CHECK_EQUAL(path.size(), 0);
+	BOOST_CHECK(path.begin() == path.end());
+}
+
+BOOST_AUTO_TEST_CASE(PackedPath_convertPathToWindow) {
+	const std::vector<std::deque<sf::Vector2i>> paths = makeTestPaths();
+	PackedPathBatch batch(PATH_ENCODING_DELTA);
+	batch.assign(paths);
+	CoordinateConverter converter(10.0f, sf::Vector2f(5.0f, 0.0f));
+
+	std::vector<sf::Vector2f> windowPath{ sf::Vector2f(1.0f, 1.0f) };
+	converter.convertPathToWindow(batch.getPath(1), windowPath);
+	const WindowCoordinatePath expectedWindowPath = converter.convertPathToWindow(paths[1]);
+	BOOST_CHECK(windowPath == std::vector<sf::Vector2f>(expectedWindowPath.begin(), expectedWindowPath.end()));
+}
+
+BOOST_AUTO_TEST_CASE(PackedPath_moveSpriteAlongPath) {
+	const std::vector<std::deque<sf::Vector2i>> paths{ { sf::Vector2i(1, 0), sf::Vector2i(1, 1) } };
+	PackedPathBatch batch(PATH_ENCODING_RUN_LENGTH);
+	batch.assign(paths);
+	CoordinateConverter converter(10.0f, sf::Vector2f(0.0f, 0.0f));
+	TestMovable movable;
+	movable.position = converter.convertCoordToWindow(sf::Vector2i(0, 0));
+
+	// each call reaches one waypoint, then drops it from the path
+	PackedPath path = batch.getPath(0);
+	moveSpriteAlongPath(movable, path, converter, 1000, 1.0f);
+	BOOST_CHECK(movable.position == converter.convertCoordToWindow(sf::Vector2i(1, 0)));
+	BOOST_CHECK_EQUAL(path.size(), 1);
+	moveSpriteAlongPath(movable, path, converter, 1000, 1.0f);
+	BOOST_CHECK(movable.position == converter.convertCoordToWindow(sf::Vector2i(1, 1)));
+	BOOST_CHECK(path.empty());
+
+	// an empty path does not move the sprite
+	moveSpriteAlongPath(movable, path, converter, 1000, 1.0f);
+	BOOST_CHECK(movable.position == converter.convertCoordToWindow(sf::Vector2i(1, 1)));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PackedPath_Tests
+
+BOOST_AUTO_TEST_SUITE(PackedPathBatch_pathFind)
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_pathFind_matches_deques) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 30; ++y) {
+		navGrid.at(20, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(37, 5) },
+		PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(20, 5) }, // blocked end
+		PathRequest{ sf::Vector2i(35, 35), sf::Vector2i(1, 1), PATH_SEARCH_MODE_ANY_ANGLE }
+	};
+	Pathfinder pathfinder(&navGrid);
+
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	for (PATH_ENCODING_TYPE encoding : { PATH_ENCODING_NONE, PATH_ENCODING_DELTA, PATH_ENCODING_RUN_LENGTH }) {
+		PackedPathBatch batch(encoding);
+		pathfinder.pathFind(pathRequests, &batch);
+		checkBatchMatches(batch, paths);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_pathFind_workers_and_cache) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 30; ++y) {
+		navGrid.at(20, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < 24; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 7) % SQUARE_DIM, (i * 13) % SQUARE_DIM }, sf::Vector2i{ (i * 11 + 20) % SQUARE_DIM, (i * 3) % SQUARE_DIM } });
+	}
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// the paths found by each worker are joined in request order, and cached paths are packed in between
+	pathfinder.setWorkerThreadCount(4);
+	pathfinder.setPathCacheMemoryLimit(1 << 20);
+	PackedPathBatch batch(PATH_ENCODING_RUN_LENGTH);
+	pathfinder.pathFind(std::vector<PathRequest>(pathRequests.begin(), pathRequests.begin() + 8), &batch);
+	for (unsigned int workerThreadCount : { 4u, 1u }) {
+		pathfinder.setWorkerThreadCount(workerThreadCount);
+		pathfinder.pathFind(pathRequests, &batch);
+		checkBatchMatches(batch, paths);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PackedPathBatch_pathFind_perf) {
+	const int SQUARE_DIM = 200;
+	const int NUM_REQUESTS = 1000;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 37) % SQUARE_DIM, (i * 53) % SQUARE_DIM }, sf::Vector2i{ (i * 71) % SQUARE_DIM, (i * 29) % SQUARE_DIM } });
+	}
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// read every waypoint of the batch, as sprites following their paths would
+	const char* encodingNames[] = { "no", "delta", "run length" };
+	for (PATH_ENCODING_TYPE encoding : { PATH_ENCODING_NONE, PATH_ENCODING_DELTA, PATH_ENCODING_RUN_LENGTH }) {
+		PackedPathBatch batch(encoding);
+		batch.assign(paths);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		long long coordinateSum = 0;
+		for (std::size_t i = 0; i < batch.getPathCount(); ++i) {
+			for (const sf::Vector2i& waypoint : batch.getPath(i)) {
+				coordinateSum += waypoint.x + waypoint.y;
+			}
+		}
+		auto endTime = std::chrono::high_resolution_clock::now();
+
+		std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+		std::stringstream strStream;
+		strStream << "Reading time of: " << elapsedTime.count() << " seconds for " << batch.getWaypointCount() << " waypoints in "
+			<< batch.getMemoryUsage() << " bytes with " << encodingNames[encoding] << " encoding perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+		BOOST_CHECK(coordinateSum > 0);
+		checkBatchMatches(batch, paths);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PackedPathBatch_pathFind
+
+BOOST_AUTO_TEST_SUITE_END() // end PackedPathBatch_Tests
@@ -0,0 +1,169 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/PathCache.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <deque>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Creates a straight path along the x axis from the start of a request to its end.
+	/// </summary>
+	std::deque<sf::Vector2i> makeStraightPath(const PathRequest& pathRequest) {
+		std::deque<sf::Vector2i> path;
+		for (int x = pathRequest.start.x + 1; x <= pathRequest.end.x; ++x) {
+			path.push_back(sf::Vector2i(x, pathRequest.start.y));
+		}
+		return path;
+	}
+
+	/// <summary>
+	/// Creates a path request along the x axis that is solved by the standard search.
+	/// </summary>
+	PathRequest makeRequest(int startX, int endX, int y) {
+		return PathRequest{ sf::Vector2i(startX, y), sf::Vector2i(endX, y), PATH_SEARCH_MODE_STANDARD };
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(PathCache_Tests)
+
+BOOST_AUTO_TEST_SUITE(PathCache_CTRs)
+
+BOOST_AUTO_TEST_CASE(PathCache_default_CTR) {
+	PathCache pathCache;
+
+	BOOST_CHECK_EQUAL(pathCache.getMemoryLimit(), 0);
+	BOOST_CHECK_EQUAL(pathCache.getMemoryUsage(), 0);
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 0);
+	BOOST_CHECK_EQUAL(pathCache.getHitCount(), 0);
+	BOOST_CHECK_EQUAL(pathCache.getMissCount(), 0);
+
+	// without memory nothing is cached
+	pathCache.fitToGridSize(sf::Vector2u(10, 10));
+	const PathRequest pathRequest = makeRequest(0, 5, 0);
+	pathCache.insert(pathRequest, makeStraightPath(pathRequest));
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(!pathCache.find(pathRequest, path));
+	BOOST_CHECK_EQUAL(pathCache.getMissCount(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathCache_CTRs
+
+BOOST_AUTO_TEST_SUITE(PathCache_find)
+
+BOOST_AUTO_TEST_CASE(PathCache_find_keys) {
+	PathCache pathCache;
+	pathCache.setMemoryLimit(4096);
+	pathCache.fitToGridSize(sf::Vector2u(10, 10));
+
+	const PathRequest pathRequest = makeRequest(1, 6, 2);
+	const std::deque<sf::Vector2i> expectedPath = makeStraightPath(pathRequest);
+	pathCache.insert(pathRequest, expectedPath);
+
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(pathCache.find(pathRequest, path));
+	BOOST_CHECK(path == expectedPath);
+
+	// every part of the key must match
+	PathRequest otherModeRequest = pathRequest;
+	otherModeRequest.searchMode = PATH_SEARCH_MODE_JUMP_POINT;
+	BOOST_CHECK(!pathCache.find(otherModeRequest, path));
+	BOOST_CHECK(!pathCache.find(makeRequest(1, 6, 3), path));
+	BOOST_CHECK(!pathCache.find(makeRequest(1, 5, 2), path));
+
+	// a new grid version hides every path
+	pathCache.invalidate();
+	BOOST_CHECK(!pathCache.find(pathRequest, path));
+
+	BOOST_CHECK_EQUAL(pathCache.getHitCount(), 1);
+	BOOST_CHECK_EQUAL(pathCache.getMissCount(), 4);
+	pathCache.resetCounters();
+	BOOST_CHECK_EQUAL(pathCache.getMissCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PathCache_find_empty_path_not_cached) {
+	PathCache pathCache;
+	pathCache.setMemoryLimit(4096);
+	pathCache.fitToGridSize(sf::Vector2u(10, 10));
+
+	pathCache.insert(makeRequest(1, 6, 2), std::deque<sf::Vector2i>());
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathCache_find
+
+BOOST_AUTO_TEST_SUITE(PathCache_memory)
+
+BOOST_AUTO_TEST_CASE(PathCache_memory_least_recently_used_discarded) {
+	PathCache pathCache;
+	pathCache.fitToGridSize(sf::Vector2u(200, 200));
+
+	// measure the memory of one path, then allow three
+	pathCache.setMemoryLimit(100000);
+	pathCache.insert(makeRequest(0, 10, 0), makeStraightPath(makeRequest(0, 10, 0)));
+	const std::size_t pathBytes = pathCache.getMemoryUsage();
+	pathCache.clear();
+	pathCache.setMemoryLimit(3 * pathBytes);
+
+	for (int y = 0; y < 3; ++y) {
+		pathCache.insert(makeRequest(0, 10, y), makeStraightPath(makeRequest(0, 10, y)));
+	}
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 3);
+	BOOST_CHECK_EQUAL(pathCache.getMemoryUsage(), 3 * pathBytes);
+
+	// using the oldest path keeps it, so the second path is discarded instead
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(pathCache.find(makeRequest(0, 10, 0), path));
+	pathCache.insert(makeRequest(0, 10, 3), makeStraightPath(makeRequest(0, 10, 3)));
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 3);
+	BOOST_CHECK(pathCache.getMemoryUsage() <= pathCache.getMemoryLimit());
+	BOOST_CHECK(pathCache.find(makeRequest(0, 10, 0), path));
+	BOOST_CHECK(!pathCache.find(makeRequest(0, 10, 1), path));
+	BOOST_CHECK(pathCache.find(makeRequest(0, 10, 2), path));
+	BOOST_CHECK(pathCache.find(makeRequest(0, 10, 3), path));
+
+	// paths larger than the whole cache are not cached
+	pathCache.insert(makeRequest(0, 199, 4), makeStraightPath(makeRequest(0, 199, 4)));
+	BOOST_CHECK(!pathCache.find(makeRequest(0, 199, 4), path));
+
+	// shrinking the limit discards paths until they fit
+	pathCache.setMemoryLimit(pathBytes);
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathCache_memory
+
+BOOST_AUTO_TEST_SUITE(PathCache_updateGridSquares)
+
+BOOST_AUTO_TEST_CASE(PathCache_updateGridSquares_discards_changed_paths) {
+	PathCache pathCache;
+	pathCache.setMemoryLimit(4096);
+	pathCache.fitToGridSize(sf::Vector2u(10, 10));
+	for (int y = 0; y < 3; ++y) {
+		pathCache.insert(makeRequest(0, 5, y), makeStraightPath(makeRequest(0, 5, y)));
+	}
+
+	// changes away from every path keep them all
+	pathCache.updateGridSquares({ sf::Vector2i(8, 8), sf::Vector2i(-1, 0) });
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 3);
+
+	// a change on a path or at its start discards only that path
+	pathCache.updateGridSquares({ sf::Vector2i(3, 1), sf::Vector2i(0, 2) });
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(pathCache.find(makeRequest(0, 5, 0), path));
+	BOOST_CHECK(!pathCache.find(makeRequest(0, 5, 1), path));
+	BOOST_CHECK(!pathCache.find(makeRequest(0, 5, 2), path));
+
+	// the same grid square can be changed again
+	pathCache.insert(makeRequest(0, 5, 1), makeStraightPath(makeRequest(0, 5, 1)));
+	pathCache.updateGridSquares({ sf::Vector2i(3, 1) });
+	BOOST_CHECK(!pathCache.find(makeRequest(0, 5, 1), path));
+	BOOST_CHECK_EQUAL(pathCache.getPathCount(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathCache_updateGridSquares
+
+BOOST_AUTO_TEST_SUITE_END() // end PathCache_Tests
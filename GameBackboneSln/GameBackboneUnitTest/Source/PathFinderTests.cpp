@@ -1,15 +1,214 @@
 #include "stdafx.h"
+#include "NavigationTestUtils.h"
 
+#include <GameBackbone/Navigation/CompactNavigationGrid.h>
+#include <GameBackbone/Navigation/DenseNavigationGrid.h>
+#include <GameBackbone/Navigation/HierarchicalPathfinder.h>
+#include <GameBackbone/Navigation/LandmarkTable.h>
 #include <GameBackbone/Navigation/NavigationTools.h>
 #include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Navigation/ReachabilityIndex.h>
+#include <GameBackbone/Util/ChunkedArray2D.h>
 
 #include <SFML/System/Vector2.hpp>
 
+#include <boost/mpl/list.hpp>
+
+#include <algorithm>
 #include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <limits>
 #include <sstream>
 
 using namespace GB;
 
+namespace {
+	/// <summary>
+	/// Checks that a path is a chain of adjacent unblocked grid squares from the start of a request to its end.
+	/// </summary>
+	void checkPathIsValid(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			BOOST_CHECK_EQUAL(std::abs(gridSquare.x - previous.x) + std::abs(gridSquare.y - previous.y), 1);
+			BOOST_CHECK(navGrid.at(gridSquare.x, gridSquare.y)->weight < BLOCKED_GRID_WEIGHT);
+			previous = gridSquare;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+	}
+
+	/// <summary>
+	/// Calculates the cost of a path in the four neighborhood. Every step costs the average weight of its grid squares.
+	/// </summary>
+	int calcFourNeighborhoodPathCost(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			cost += (navGrid.at(previous.x, previous.y)->weight + navGrid.at(gridSquare.x, gridSquare.y)->weight) / 2;
+			previous = gridSquare;
+		}
+		return cost;
+	}
+
+	/// <summary>
+	/// Calculates the cost of a path in the eight neighborhood. Straight steps cost 10 and diagonal steps 14 times the average weight.
+	/// </summary>
+	int calcEightNeighborhoodPathCost(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			const int xDistance = std::abs(gridSquare.x - previous.x);
+			const int yDistance = std::abs(gridSquare.y - previous.y);
+			BOOST_CHECK_EQUAL(std::max(xDistance, yDistance), 1);
+			const int stepLength = (xDistance + yDistance == 2) ? 14 : 10;
+			cost += stepLength * (navGrid.at(previous.x, previous.y)->weight + navGrid.at(gridSquare.x, gridSquare.y)->weight) / 2;
+			previous = gridSquare;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+		return cost;
+	}
+
+	/// <summary>
+	/// Calculates the cost of a path in a custom neighborhood. Every step costs its length in tenths times the average weight.
+	/// </summary>
+	int calcCustomNeighborhoodPathCost(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		int cost = 0;
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& gridSquare : path) {
+			const sf::Vector2i offset = gridSquare - previous;
+			const int stepLength = static_cast<int>(std::lround(10.0 * std::sqrt(static_cast<double>(offset.x * offset.x + offset.y * offset.y))));
+			cost += stepLength * (navGrid.at(previous.x, previous.y)->weight + navGrid.at(gridSquare.x, gridSquare.y)->weight) / 2;
+			previous = gridSquare;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+		return cost;
+	}
+
+	/// <summary>
+	/// Checks that an any angle path is a chain of unblocked lines of sight from the start of a request to its end.
+	/// </summary>
+	void checkAnyAnglePathIsValid(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& waypoint : path) {
+			BOOST_CHECK(hasLineOfSight(navGrid, previous, waypoint));
+			previous = waypoint;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+	}
+
+	/// <summary>
+	/// Calculates the straight line length of a path through its waypoints.
+	/// </summary>
+	double calcPathLength(const PathRequest& pathRequest, const std::deque<sf::Vector2i>& path) {
+		double length = 0;
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& waypoint : path) {
+			length += std::hypot(waypoint.x - previous.x, waypoint.y - previous.y);
+			previous = waypoint;
+		}
+		return length;
+	}
+
+	/// <summary>
+	/// Finds the cost of the cheapest path in the eight neighborhood by trying every grid square. -1 if no path exists.
+	/// </summary>
+	int calcCheapestEightNeighborhoodCost(NavigationGrid& navGrid, const PathRequest& pathRequest, bool isCornerCuttingForbidden) {
+		const int sizeX = static_cast<int>(navGrid.getArraySizeX());
+		const int sizeY = static_cast<int>(navGrid.getArraySizeY());
+		const auto isBlocked = [&navGrid, sizeX, sizeY](int x, int y) {
+			return x < 0 || y < 0 || x >= sizeX || y >= sizeY || navGrid.at(x, y)->weight >= BLOCKED_GRID_WEIGHT;
+		};
+		std::vector<int> costs(static_cast<std::size_t>(sizeX * sizeY), INT_MAX);
+		std::vector<bool> isDone(costs.size(), false);
+		costs[static_cast<std::size_t>(pathRequest.start.x * sizeY + pathRequest.start.y)] = 0;
+		while (true) {
+			int current = -1;
+			for (int i = 0; i < sizeX * sizeY; ++i) {
+				if (!isDone[static_cast<std::size_t>(i)] && costs[static_cast<std::size_t>(i)] != INT_MAX &&
+					(current == -1 || costs[static_cast<std::size_t>(i)] < costs[static_cast<std::size_t>(current)])) {
+					current = i;
+				}
+			}
+			if (current == -1) {
+				return -1;
+			}
+			const int x = current / sizeY;
+			const int y = current % sizeY;
+			if (sf::Vector2i(x, y) == pathRequest.end) {
+				return costs[static_cast<std::size_t>(current)];
+			}
+			isDone[static_cast<std::size_t>(current)] = true;
+			for (int dx = -1; dx <= 1; ++dx) {
+				for (int dy = -1; dy <= 1; ++dy) {
+					if ((dx == 0 && dy == 0) || isBlocked(x + dx, y + dy)) {
+						continue;
+					}
+					const bool isDiagonal = dx != 0 && dy != 0;
+					if (isDiagonal && isCornerCuttingForbidden && (isBlocked(x + dx, y) || isBlocked(x, y + dy))) {
+						continue;
+					}
+					const int stepCost = (isDiagonal ? 14 : 10) * (navGrid.at(x, y)->weight + navGrid.at(x + dx, y + dy)->weight) / 2;
+					int& neighborCost = costs[static_cast<std::size_t>((x + dx) * sizeY + y + dy)];
+					neighborCost = std::min(neighborCost, costs[static_cast<std::size_t>(current)] + stepCost);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// A DenseNavigationGrid copied from a NavigationGrid, so tests of every kind of grid can compare it to the NavigationGrid.
+	/// </summary>
+	struct DenseSearchedGrid {
+		explicit DenseSearchedGrid(NavigationGrid& navGrid) : grid(navGrid) {}
+
+		/// <summary> Checks if a pathfinder searches this grid. </summary>
+		bool isSearchedBy(Pathfinder& pathfinder) const {
+			return pathfinder.getDenseNavigationGrid() == &grid;
+		}
+
+		DenseNavigationGrid grid;
+	};
+
+	/// <summary>
+	/// A CompactNavigationGrid converted from a NavigationGrid, so tests of every kind of grid can compare it to the NavigationGrid.
+	/// </summary>
+	struct CompactSearchedGrid {
+		explicit CompactSearchedGrid(NavigationGrid& navGrid) : grid(navGrid) {}
+
+		/// <summary> Checks if a pathfinder searches this grid. </summary>
+		bool isSearchedBy(Pathfinder& pathfinder) const {
+			return pathfinder.getCompactNavigationGrid() == &grid;
+		}
+
+		CompactNavigationGrid grid;
+	};
+
+	/// <summary>
+	/// A ChunkedNavigationGrid copied from a NavigationGrid, so tests of every kind of grid can compare it to the NavigationGrid.
+	/// </summary>
+	struct ChunkedSearchedGrid {
+		explicit ChunkedSearchedGrid(NavigationGrid& navGrid) : grid(navGrid.getArraySizeX(), navGrid.getArraySizeY()) {
+			for (unsigned int x = 0; x < navGrid.getArraySizeX(); ++x) {
+				for (unsigned int y = 0; y < navGrid.getArraySizeY(); ++y) {
+					grid(x, y) = *navGrid[x][y];
+				}
+			}
+		}
+
+		/// <summary> Checks if a pathfinder searches this grid. </summary>
+		bool isSearchedBy(Pathfinder& pathfinder) const {
+			return pathfinder.getChunkedNavigationGrid() == &grid;
+		}
+
+		ChunkedNavigationGrid grid;
+	};
+
+	/// The kinds of grids the Pathfinder can search besides the NavigationGrid.
+	using SearchedGridTypes = boost::mpl::list<DenseSearchedGrid, CompactSearchedGrid, ChunkedSearchedGrid>;
+}
+
 BOOST_AUTO_TEST_SUITE(Pathfinder_Tests)
 
 BOOST_AUTO_TEST_SUITE(Pathfinder_CTRs)
@@ -47,6 +246,87 @@ BOOST_AUTO_TEST_CASE(Pathfinder_setNavigationGrid) {
 	delete pathfinder;
 }
 
+BOOST_AUTO_TEST_CASE(Pathfinder_setWorkerThreadCount) {
+	Pathfinder pathfinder;
+
+	// single threaded by default
+	BOOST_CHECK_EQUAL(pathfinder.getWorkerThreadCount(), 1);
+
+	pathfinder.setWorkerThreadCount(4);
+	BOOST_CHECK_EQUAL(pathfinder.getWorkerThreadCount(), 4);
+
+	// zero workers is treated as one
+	pathfinder.setWorkerThreadCount(0);
+	BOOST_CHECK_EQUAL(pathfinder.getWorkerThreadCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_setSearchMode) {
+	Pathfinder pathfinder;
+
+	// standard search by default
+	BOOST_CHECK_EQUAL(pathfinder.getSearchMode(), PATH_SEARCH_MODE_STANDARD);
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+	BOOST_CHECK_EQUAL(pathfinder.getSearchMode(), PATH_SEARCH_MODE_JUMP_POINT);
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_ANY_ANGLE);
+	BOOST_CHECK_EQUAL(pathfinder.getSearchMode(), PATH_SEARCH_MODE_ANY_ANGLE);
+
+	// the default mode of a Pathfinder is the standard search
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_DEFAULT);
+	BOOST_CHECK_EQUAL(pathfinder.getSearchMode(), PATH_SEARCH_MODE_STANDARD);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_setReachabilityIndex) {
+	Pathfinder pathfinder;
+
+	// no index by default
+	BOOST_CHECK(pathfinder.getReachabilityIndex() == nullptr);
+
+	ReachabilityIndex reachabilityIndex;
+	pathfinder.setReachabilityIndex(&reachabilityIndex);
+	BOOST_CHECK_EQUAL(pathfinder.getReachabilityIndex(), &reachabilityIndex);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_setHeuristic) {
+	Pathfinder pathfinder;
+
+	// automatic unweighted heuristic by default
+	BOOST_CHECK_EQUAL(pathfinder.getHeuristic(), PATH_HEURISTIC_AUTOMATIC);
+	BOOST_CHECK_EQUAL(pathfinder.getHeuristicWeight(), 1.0);
+
+	pathfinder.setHeuristic(PATH_HEURISTIC_EUCLIDEAN);
+	BOOST_CHECK_EQUAL(pathfinder.getHeuristic(), PATH_HEURISTIC_EUCLIDEAN);
+
+	pathfinder.setHeuristicWeight(2.5);
+	BOOST_CHECK_EQUAL(pathfinder.getHeuristicWeight(), 2.5);
+
+	// negative weights are not allowed
+	pathfinder.setHeuristicWeight(-1.0);
+	BOOST_CHECK_EQUAL(pathfinder.getHeuristicWeight(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_setLandmarkTable) {
+	Pathfinder pathfinder;
+
+	// no table by default
+	BOOST_CHECK(pathfinder.getLandmarkTable() == nullptr);
+
+	LandmarkTable landmarkTable;
+	pathfinder.setLandmarkTable(&landmarkTable);
+	BOOST_CHECK_EQUAL(pathfinder.getLandmarkTable(), &landmarkTable);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_setBidirectionalSearchDistance) {
+	Pathfinder pathfinder;
+
+	// requests are never switched by default
+	BOOST_CHECK_EQUAL(pathfinder.getBidirectionalSearchDistance(), 0);
+
+	pathfinder.setBidirectionalSearchDistance(64);
+	BOOST_CHECK_EQUAL(pathfinder.getBidirectionalSearchDistance(), 64);
+}
+
 BOOST_AUTO_TEST_SUITE(Pathfinder_pathFind_Tests)
 
 BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_one_simple_path_no_sol) {
@@ -539,11 +819,1665 @@ BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_two_path_different_weight_paths_flipped
 	delete pathfinder;
 }
 
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_end_outside_grid) {
+	const int SQUARE_DIM = 3;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	//ensure all grid squares are clear
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0,0 });
+
+	//create requests that leave the grid
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{0,0}, sf::Vector2i{SQUARE_DIM, 0} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{-1,0}, sf::Vector2i{2, 2} });
+
+	//create return value
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	//find the path
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	//ensure the returned paths are empty
+	BOOST_CHECK_EQUAL(pathsReturn.size(), pathRequests.size());
+	BOOST_CHECK(pathsReturn[0].empty());
+	BOOST_CHECK(pathsReturn[1].empty());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_multithreaded_matches_single_threaded) {
+	const int SQUARE_DIM = 40;
+	const int NUM_REQUESTS = 60;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	//ensure all grid squares are clear
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0,0 });
+
+	// build walls with gaps and some weighted squares
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if ((y + x) % 11 != 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+	for (unsigned int x = 1; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; y += 3) {
+			navGrid.at(x, y)->weight = 50;
+		}
+	}
+
+	//create requests crossing the walls
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ i % 3, (i * 7) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 2), (i * 13) % SQUARE_DIM } });
+	}
+
+	//find the paths on one thread
+	Pathfinder singleThreadedPathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> singleThreadedPaths;
+	singleThreadedPathfinder.pathFind(pathRequests, &singleThreadedPaths);
+
+	//find the paths on several threads
+	Pathfinder multiThreadedPathfinder(&navGrid);
+	multiThreadedPathfinder.setWorkerThreadCount(4);
+	std::vector<std::deque<sf::Vector2i>> multiThreadedPaths;
+	multiThreadedPathfinder.pathFind(pathRequests, &multiThreadedPaths);
+
+	//ensure the paths are identical
+	BOOST_REQUIRE_EQUAL(multiThreadedPaths.size(), singleThreadedPaths.size());
+	for (std::size_t i = 0; i < singleThreadedPaths.size(); ++i) {
+		BOOST_CHECK(singleThreadedPaths[i].size() > 0);
+		BOOST_CHECK(multiThreadedPaths[i] == singleThreadedPaths[i]);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_reuses_workspace) {
+	const int SQUARE_DIM = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	//ensure all grid squares are clear
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0,0 });
+	BOOST_CHECK_EQUAL(pathfinder.getWorkspaceAllocationCount(), 0);
+
+	//create requests
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{0,0}, sf::Vector2i{SQUARE_DIM - 1, SQUARE_DIM - 1} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{5,3}, sf::Vector2i{0, SQUARE_DIM - 1} });
+	pathRequests.push_back(PathRequest{ sf::Vector2i{SQUARE_DIM - 1,0}, sf::Vector2i{2, 2} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	// the first call sizes the workspace to the grid
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::size_t allocationsAfterFirstCall = pathfinder.getWorkspaceAllocationCount();
+	BOOST_CHECK_EQUAL(allocationsAfterFirstCall, 1);
+
+	// later calls on the same grid reuse it
+	for (int i = 0; i < 5; ++i) {
+		pathfinder.pathFind(pathRequests, &pathsReturn);
+	}
+	BOOST_CHECK_EQUAL(pathfinder.getWorkspaceAllocationCount(), allocationsAfterFirstCall);
+	BOOST_CHECK(pathsReturn[0].size() > 0);
+	BOOST_CHECK(pathsReturn[1].size() > 0);
+	BOOST_CHECK(pathsReturn[2].size() > 0);
+
+	// each worker thread gets its own workspace once
+	pathfinder.setWorkerThreadCount(3);
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::size_t allocationsAfterThreading = pathfinder.getWorkspaceAllocationCount();
+	BOOST_CHECK_EQUAL(allocationsAfterThreading, 3);
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK_EQUAL(pathfinder.getWorkspaceAllocationCount(), allocationsAfterThreading);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_jump_point_open_grid) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+
+	//ensure all grid squares have the same weight
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	//create request
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{2,3}, sf::Vector2i{25, 27} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	// every grid square between the jump points is part of the path, and the path is as short as possible
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+	BOOST_CHECK_EQUAL(pathsReturn[0].size(), 23 + 24);
+
+	// only the start and the turn are expanded
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 2);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_jump_point_per_request) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	//ensure all grid squares have the same weight
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{0,0}, sf::Vector2i{SQUARE_DIM - 1, SQUARE_DIM - 1} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::size_t standardExpandedNodeCount = pathfinder.getExpandedNodeCount();
+
+	// the request overrides the search mode of the Pathfinder
+	pathRequests[0].searchMode = PATH_SEARCH_MODE_JUMP_POINT;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() < standardExpandedNodeCount);
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+	pathRequests[0].searchMode = PATH_SEARCH_MODE_STANDARD;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), standardExpandedNodeCount);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_jump_point_updateGridSquares) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+
+	//ensure all grid squares have the same weight
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	std::vector<PathRequest> pathRequests;
+	pathRequests.push_back(PathRequest{ sf::Vector2i{0,5}, sf::Vector2i{SQUARE_DIM - 1, 5} });
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	BOOST_CHECK_EQUAL(pathsReturn[0].size(), SQUARE_DIM - 1);
+
+	// a reported wall across the straight path moves the jump points of the next search
+	std::vector<sf::Vector2i> changedGridSquares;
+	for (int y = 0; y < SQUARE_DIM - 1; ++y) {
+		navGrid.at(15, y)->weight = BLOCKED_GRID_WEIGHT;
+		changedGridSquares.push_back(sf::Vector2i{15, y});
+	}
+	pathfinder.updateGridSquares(changedGridSquares);
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	checkPathIsValid(navGrid, pathRequests[0], pathsReturn[0]);
+	BOOST_CHECK_EQUAL(pathsReturn[0].size(), SQUARE_DIM - 1 + 2 * (SQUARE_DIM - 1 - 5));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_jump_point_walls_and_weights) {
+	const int SQUARE_DIM = 40;
+	const int NUM_REQUESTS = 60;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	//ensure all grid squares are clear
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0,0 });
+
+	// build walls with gaps and some weighted squares
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if ((y + x) % 11 != 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+	for (unsigned int x = 1; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM; y += 3) {
+			navGrid.at(x, y)->weight = 50;
+		}
+	}
+	// close one wall completely so that some requests have no path
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(34, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ i % 3, (i * 7) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 9), (i * 13) % SQUARE_DIM } });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> standardPaths;
+	pathfinder.pathFind(pathRequests, &standardPaths);
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+	std::vector<std::deque<sf::Vector2i>> jumpPointPaths;
+	pathfinder.pathFind(pathRequests, &jumpPointPaths);
+
+	// both searches agree on which requests have a path, and every jump point path avoids blocked squares
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_CHECK_EQUAL(jumpPointPaths[i].empty(), standardPaths[i].empty());
+		if (!jumpPointPaths[i].empty()) {
+			checkPathIsValid(navGrid, pathRequests[i], jumpPointPaths[i]);
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_cheapest_path) {
+	const int SQUARE_DIM = 30;
+	const int NUM_REQUESTS = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	// uneven weights with scattered blocked squares
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 23u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 5);
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 11) % SQUARE_DIM, (i * 7) % SQUARE_DIM }, sf::Vector2i{ (i * 17 + 5) % SQUARE_DIM, (i * 23 + 3) % SQUARE_DIM } });
+	}
+
+	// without a heuristic the search is an exhaustive search of the cheapest grid squares first
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setHeuristic(PATH_HEURISTIC_NONE);
+	std::vector<std::deque<sf::Vector2i>> cheapestPaths;
+	pathfinder.pathFind(pathRequests, &cheapestPaths);
+
+	// every heuristic that never overestimates finds paths of the same cost, in both search modes
+	const PATH_HEURISTIC_TYPE heuristics[] = { PATH_HEURISTIC_AUTOMATIC, PATH_HEURISTIC_OCTILE, PATH_HEURISTIC_EUCLIDEAN };
+	for (const PATH_HEURISTIC_TYPE heuristic : heuristics) {
+		for (const PATH_SEARCH_MODE_TYPE searchMode : { PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_JUMP_POINT }) {
+			pathfinder.setHeuristic(heuristic);
+			pathfinder.setSearchMode(searchMode);
+			std::vector<std::deque<sf::Vector2i>> paths;
+			pathfinder.pathFind(pathRequests, &paths);
+			for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+				BOOST_REQUIRE_EQUAL(paths[i].empty(), cheapestPaths[i].empty());
+				if (!paths[i].empty()) {
+					checkPathIsValid(navGrid, pathRequests[i], paths[i]);
+					BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[i], paths[i]), calcFourNeighborhoodPathCost(navGrid, pathRequests[i], cheapestPaths[i]));
+				}
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_weight_lowered_in_place) {
+	const int SQUARE_DIM = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 5,0 });
+	const std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(0, 10), sf::Vector2i(SQUARE_DIM - 1, 10) } };
+
+	// the first search scales the heuristic by the cheapest weight of the grid
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[0], paths[0]), 5 * (SQUARE_DIM - 1));
+
+	// a free detour is edited into the grid in place and reported before the next search
+	std::vector<sf::Vector2i> changedGridSquares;
+	for (int i = 2; i <= 10; ++i) {
+		changedGridSquares.push_back(sf::Vector2i(0, i));
+		changedGridSquares.push_back(sf::Vector2i(SQUARE_DIM - 1, i));
+	}
+	for (int x = 1; x < SQUARE_DIM - 1; ++x) {
+		changedGridSquares.push_back(sf::Vector2i(x, 2));
+	}
+	for (const sf::Vector2i& gridSquare : changedGridSquares) {
+		navGrid.at(gridSquare.x, gridSquare.y)->weight = 0;
+	}
+	pathfinder.updateGridSquares(changedGridSquares);
+
+	// the second search follows the lowered weight like a search without a heuristic
+	std::vector<std::deque<sf::Vector2i>> cheapestPaths;
+	pathfinder.pathFind(pathRequests, &paths);
+	pathfinder.setHeuristic(PATH_HEURISTIC_NONE);
+	pathfinder.pathFind(pathRequests, &cheapestPaths);
+	checkPathIsValid(navGrid, pathRequests[0], paths[0]);
+	BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[0], paths[0]), calcFourNeighborhoodPathCost(navGrid, pathRequests[0], cheapestPaths[0]));
+	BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[0], paths[0]), 0);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_cheapest_path_zero_weights) {
+	const int SQUARE_DIM = 30;
+	const int NUM_REQUESTS = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	// weights of at least 2, so the heuristics are scaled by 2 before any weight is lowered
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 2,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 23u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(2 + hash % 3);
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 11) % SQUARE_DIM, (i * 7) % SQUARE_DIM }, sf::Vector2i{ (i * 17 + 5) % SQUARE_DIM, (i * 23 + 3) % SQUARE_DIM } });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// free corridors of weight 0, reported to the pathfinder
+	std::vector<sf::Vector2i> changedGridSquares;
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if ((x % 5 == 2 || y % 7 == 3) && navGrid.at(x, y)->weight < BLOCKED_GRID_WEIGHT) {
+				navGrid.at(x, y)->weight = 0;
+				changedGridSquares.push_back(sf::Vector2i(static_cast<int>(x), static_cast<int>(y)));
+			}
+		}
+	}
+	pathfinder.updateGridSquares(changedGridSquares);
+
+	// a heuristic that assumed steps cost at least their length would skip the free corridors
+	for (const PATH_NEIGHBORHOOD_TYPE neighborhood : { PATH_NEIGHBORHOOD_FOUR, PATH_NEIGHBORHOOD_EIGHT }) {
+		pathfinder.setNeighborhood(neighborhood);
+		pathfinder.setHeuristic(PATH_HEURISTIC_NONE);
+		std::vector<std::deque<sf::Vector2i>> cheapestPaths;
+		pathfinder.pathFind(pathRequests, &cheapestPaths);
+
+		for (const PATH_HEURISTIC_TYPE heuristic : { PATH_HEURISTIC_AUTOMATIC, PATH_HEURISTIC_MANHATTAN, PATH_HEURISTIC_OCTILE, PATH_HEURISTIC_EUCLIDEAN }) {
+			if (neighborhood == PATH_NEIGHBORHOOD_EIGHT && heuristic == PATH_HEURISTIC_MANHATTAN) {
+				continue;
+			}
+			pathfinder.setHeuristic(heuristic);
+			pathfinder.pathFind(pathRequests, &paths);
+			for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+				BOOST_REQUIRE_EQUAL(paths[i].empty(), cheapestPaths[i].empty());
+				if (paths[i].empty()) {
+					continue;
+				}
+				if (neighborhood == PATH_NEIGHBORHOOD_FOUR) {
+					checkPathIsValid(navGrid, pathRequests[i], paths[i]);
+					BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[i], paths[i]), calcFourNeighborhoodPathCost(navGrid, pathRequests[i], cheapestPaths[i]));
+				}
+				else {
+					BOOST_CHECK_EQUAL(calcEightNeighborhoodPathCost(navGrid, pathRequests[i], paths[i]), calcEightNeighborhoodPathCost(navGrid, pathRequests[i], cheapestPaths[i]));
+				}
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_heuristic_weight_bound) {
+	const int SQUARE_DIM = 30;
+	const int NUM_REQUESTS = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 19u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 4);
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 13) % SQUARE_DIM, (i * 5) % SQUARE_DIM }, sf::Vector2i{ (i * 19 + 7) % SQUARE_DIM, (i * 29 + 1) % SQUARE_DIM } });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> cheapestPaths;
+	pathfinder.pathFind(pathRequests, &cheapestPaths);
+
+	// a weighted search never finds a path that costs more than the weight times the cheapest path
+	for (const double heuristicWeight : { 1.5, 2.0, 4.0 }) {
+		pathfinder.setHeuristicWeight(heuristicWeight);
+		std::vector<std::deque<sf::Vector2i>> paths;
+		pathfinder.pathFind(pathRequests, &paths);
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			BOOST_REQUIRE_EQUAL(paths[i].empty(), cheapestPaths[i].empty());
+			if (!paths[i].empty()) {
+				checkPathIsValid(navGrid, pathRequests[i], paths[i]);
+				const int cheapestCost = calcFourNeighborhoodPathCost(navGrid, pathRequests[i], cheapestPaths[i]);
+				BOOST_CHECK(calcFourNeighborhoodPathCost(navGrid, pathRequests[i], paths[i]) <= heuristicWeight * cheapestCost);
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_landmark_table) {
+	const int SQUARE_DIM = 30;
+	const int NUM_REQUESTS = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 23u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 5);
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 11) % SQUARE_DIM, (i * 7) % SQUARE_DIM }, sf::Vector2i{ (i * 17 + 5) % SQUARE_DIM, (i * 23 + 3) % SQUARE_DIM } });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> manhattanPaths;
+	pathfinder.pathFind(pathRequests, &manhattanPaths);
+	const std::size_t manhattanExpandedNodeCount = pathfinder.getExpandedNodeCount();
+
+	// the landmark bound finds paths of the same cost while expanding fewer grid squares
+	LandmarkTable landmarkTable(&navGrid, 6);
+	pathfinder.setLandmarkTable(&landmarkTable);
+	for (const PATH_SEARCH_MODE_TYPE searchMode : { PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_JUMP_POINT }) {
+		pathfinder.setSearchMode(searchMode);
+		std::vector<std::deque<sf::Vector2i>> landmarkPaths;
+		pathfinder.pathFind(pathRequests, &landmarkPaths);
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			BOOST_REQUIRE_EQUAL(landmarkPaths[i].empty(), manhattanPaths[i].empty());
+			if (!landmarkPaths[i].empty()) {
+				checkPathIsValid(navGrid, pathRequests[i], landmarkPaths[i]);
+				BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[i], landmarkPaths[i]), calcFourNeighborhoodPathCost(navGrid, pathRequests[i], manhattanPaths[i]));
+			}
+		}
+		if (searchMode == PATH_SEARCH_MODE_STANDARD) {
+			BOOST_CHECK(pathfinder.getExpandedNodeCount() < manhattanExpandedNodeCount);
+		}
+	}
+
+	// a table built for a grid of another size is ignored
+	NavigationGrid otherNavGrid(SQUARE_DIM + 1);
+	initAllNavigationGridValues(otherNavGrid, NavigationGridData{ 1,0 });
+	LandmarkTable otherLandmarkTable(&otherNavGrid, 2);
+	pathfinder.setLandmarkTable(&otherLandmarkTable);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_STANDARD);
+	std::vector<std::deque<sf::Vector2i>> ignoredTablePaths;
+	pathfinder.pathFind(pathRequests, &ignoredTablePaths);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), manhattanExpandedNodeCount);
+
+	freeAllNavigationGridData(otherNavGrid);
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_reachability_index) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// wall off a room around the end of the second request
+	for (unsigned int i = 20; i <= 26; ++i) {
+		navGrid.at(20, i)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(26, i)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(i, 20)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(i, 26)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(1, 1), sf::Vector2i(28, 2) },
+		PathRequest{ sf::Vector2i(1, 1), sf::Vector2i(23, 23) }
+	};
+
+	Pathfinder pathfinder(&navGrid);
+	ReachabilityIndex reachabilityIndex(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+
+	// without the index the walled off request searches everything outside of the room
+	pathfinder.pathFind({ pathRequests[1] }, &paths);
+	BOOST_CHECK(paths[0].empty());
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() > 500);
+
+	// with the index it is rejected without searching
+	pathfinder.setReachabilityIndex(&reachabilityIndex);
+	pathfinder.pathFind({ pathRequests[1] }, &paths);
+	BOOST_CHECK(paths[0].empty());
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+
+	// reachable requests are still solved
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathIsValid(navGrid, pathRequests[0], paths[0]);
+	BOOST_CHECK(paths[1].empty());
+
+	// a door into the room is found once the index is updated
+	navGrid.at(23, 20)->weight = 1;
+	reachabilityIndex.updateGridSquares({ sf::Vector2i(23, 20) });
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathIsValid(navGrid, pathRequests[1], paths[1]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_reachability_index_other_grid) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid walledNavGrid(SQUARE_DIM);
+	NavigationGrid openNavGrid(SQUARE_DIM);
+	NavigationGrid largerNavGrid(SQUARE_DIM + 10);
+	initAllNavigationGridValues(walledNavGrid, NavigationGridData{ 1,0 });
+	initAllNavigationGridValues(openNavGrid, NavigationGridData{ 1,0 });
+	initAllNavigationGridValues(largerNavGrid, NavigationGridData{ 1,0 });
+
+	// wall off a room around the end of the request, only on the indexed grid
+	for (unsigned int i = 20; i <= 26; ++i) {
+		walledNavGrid.at(20, i)->weight = BLOCKED_GRID_WEIGHT;
+		walledNavGrid.at(26, i)->weight = BLOCKED_GRID_WEIGHT;
+		walledNavGrid.at(i, 20)->weight = BLOCKED_GRID_WEIGHT;
+		walledNavGrid.at(i, 26)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	const std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(1, 1), sf::Vector2i(23, 23) } };
+
+	Pathfinder pathfinder(&walledNavGrid);
+	ReachabilityIndex reachabilityIndex(&walledNavGrid);
+	pathfinder.setReachabilityIndex(&reachabilityIndex);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK(paths[0].empty());
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+
+	// the index of the walled grid does not reject requests on grids swapped in under it
+	pathfinder.setNavigationGrid(&openNavGrid);
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathIsValid(openNavGrid, pathRequests[0], paths[0]);
+
+	pathfinder.setNavigationGrid(&largerNavGrid);
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathIsValid(largerNavGrid, pathRequests[0], paths[0]);
+
+	DenseNavigationGrid denseNavGrid(openNavGrid);
+	pathfinder.setNavigationGrid(&denseNavGrid);
+	pathfinder.pathFind(pathRequests, &paths);
+	checkPathIsValid(openNavGrid, pathRequests[0], paths[0]);
+
+	freeAllNavigationGridData(walledNavGrid);
+	freeAllNavigationGridData(openNavGrid);
+	freeAllNavigationGridData(largerNavGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_bidirectional) {
+	const int SQUARE_DIM = 30;
+	const int NUM_REQUESTS = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 13u;
+			navGrid.at(x, y)->weight = (hash == 0) ? BLOCKED_GRID_WEIGHT : static_cast<int>(1 + hash % 5);
+		}
+	}
+	// a closed room that no path can enter or leave
+	for (unsigned int i = 20; i <= 26; ++i) {
+		navGrid.at(i, 20)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(i, 26)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(20, i)->weight = BLOCKED_GRID_WEIGHT;
+		navGrid.at(26, i)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 11) % SQUARE_DIM, (i * 7) % SQUARE_DIM }, sf::Vector2i{ (i * 17 + 5) % SQUARE_DIM, (i * 23 + 3) % SQUARE_DIM } });
+	}
+	pathRequests.push_back(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(23, 23) }); // no path
+	pathRequests.push_back(PathRequest{ sf::Vector2i(4, 4), sf::Vector2i(4, 4) });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		if (navGrid.at(x, 0)->weight >= BLOCKED_GRID_WEIGHT) {
+			pathRequests.push_back(PathRequest{ sf::Vector2i(static_cast<int>(x), 0), sf::Vector2i(2, SQUARE_DIM - 3) }); // blocked start
+			pathRequests.push_back(PathRequest{ sf::Vector2i(2, SQUARE_DIM - 3), sf::Vector2i(static_cast<int>(x), 0) }); // blocked end
+			break;
+		}
+	}
+
+	// searching from both ends finds paths of the same cost in every neighborhood
+	Pathfinder pathfinder(&navGrid);
+	for (int neighborhood = 0; neighborhood < 3; ++neighborhood) {
+		if (neighborhood == 0) {
+			pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_FOUR);
+		}
+		else if (neighborhood == 1) {
+			pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+		}
+		else {
+			// steps that can not be reversed
+			pathfinder.setCustomNeighborhood({ {1, 0}, {0, 1}, {-1, -1}, {2, -1}, {-1, 2} });
+		}
+
+		pathfinder.setSearchMode(PATH_SEARCH_MODE_STANDARD);
+		std::vector<std::deque<sf::Vector2i>> standardPaths;
+		pathfinder.pathFind(pathRequests, &standardPaths);
+
+		pathfinder.setSearchMode(PATH_SEARCH_MODE_BIDIRECTIONAL);
+		std::vector<std::deque<sf::Vector2i>> bidirectionalPaths;
+		pathfinder.pathFind(pathRequests, &bidirectionalPaths);
+
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			BOOST_REQUIRE_EQUAL(bidirectionalPaths[i].empty(), standardPaths[i].empty());
+			if (bidirectionalPaths[i].empty()) {
+				continue;
+			}
+			if (neighborhood == 0) {
+				checkPathIsValid(navGrid, pathRequests[i], bidirectionalPaths[i]);
+				BOOST_CHECK_EQUAL(calcFourNeighborhoodPathCost(navGrid, pathRequests[i], bidirectionalPaths[i]), calcFourNeighborhoodPathCost(navGrid, pathRequests[i], standardPaths[i]));
+			}
+			else if (neighborhood == 1) {
+				BOOST_CHECK_EQUAL(calcEightNeighborhoodPathCost(navGrid, pathRequests[i], bidirectionalPaths[i]), calcEightNeighborhoodPathCost(navGrid, pathRequests[i], standardPaths[i]));
+			}
+			else {
+				BOOST_CHECK_EQUAL(calcCustomNeighborhoodPathCost(navGrid, pathRequests[i], bidirectionalPaths[i]), calcCustomNeighborhoodPathCost(navGrid, pathRequests[i], standardPaths[i]));
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_bidirectional_distance) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM - 3; ++y) {
+			navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+	const std::vector<PathRequest> longPathRequests{ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, 2) } };
+	const std::vector<PathRequest> shortPathRequests{ PathRequest{ sf::Vector2i(1, 5), sf::Vector2i(2, 9) } };
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_BIDIRECTIONAL);
+	pathfinder.pathFind(longPathRequests, &paths);
+	const std::size_t bidirectionalExpandedNodeCount = pathfinder.getExpandedNodeCount();
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_STANDARD);
+	pathfinder.pathFind(shortPathRequests, &paths);
+	const std::size_t standardExpandedNodeCount = pathfinder.getExpandedNodeCount();
+
+	// only requests at least the distance apart search from both ends
+	pathfinder.setBidirectionalSearchDistance(20);
+	pathfinder.pathFind(longPathRequests, &paths);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), bidirectionalExpandedNodeCount);
+	pathfinder.pathFind(shortPathRequests, &paths);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), standardExpandedNodeCount);
+
+	// requests that choose their own search mode keep it
+	std::vector<PathRequest> jumpPointPathRequests = longPathRequests;
+	jumpPointPathRequests[0].searchMode = PATH_SEARCH_MODE_JUMP_POINT;
+	pathfinder.pathFind(jumpPointPathRequests, &paths);
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() != bidirectionalExpandedNodeCount);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_any_angle_open_grid) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(20, 7) },
+		PathRequest{ sf::Vector2i(25, 3), sf::Vector2i(2, 28) },
+		PathRequest{ sf::Vector2i(4, 4), sf::Vector2i(4, 4) }
+	};
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_ANY_ANGLE);
+	std::vector<std::deque<sf::Vector2i>> paths;
+
+	// every end is in sight of its start, so the paths go straight there in both neighborhoods
+	const PATH_NEIGHBORHOOD_TYPE neighborhoods[] = { PATH_NEIGHBORHOOD_FOUR, PATH_NEIGHBORHOOD_EIGHT };
+	for (PATH_NEIGHBORHOOD_TYPE neighborhood : neighborhoods) {
+		pathfinder.setNeighborhood(neighborhood);
+		pathfinder.pathFind(pathRequests, &paths);
+		for (std::size_t i = 0; i < 2; ++i) {
+			BOOST_REQUIRE_EQUAL(paths[i].size(), 1);
+			BOOST_CHECK(paths[i][0] == pathRequests[i].end);
+		}
+		BOOST_CHECK(paths[2].empty());
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_any_angle_walls) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = (x % 12 == 4) ? 0 : 3; y < ((x % 12 == 4) ? SQUARE_DIM - 3 : SQUARE_DIM); ++y) {
+			navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, 20) },
+		PathRequest{ sf::Vector2i(1, 30), sf::Vector2i(14, 10) }
+	};
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> stepPaths;
+	pathfinder.pathFind(pathRequests, &stepPaths);
+
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_ANY_ANGLE);
+	std::vector<std::deque<sf::Vector2i>> anyAnglePaths;
+	pathfinder.pathFind(pathRequests, &anyAnglePaths);
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		checkAnyAnglePathIsValid(navGrid, pathRequests[i], anyAnglePaths[i]);
+
+		// the paths cut the corners of the step paths and only keep their turns
+		BOOST_CHECK(calcPathLength(pathRequests[i], anyAnglePaths[i]) < static_cast<double>(stepPaths[i].size()));
+		BOOST_CHECK(anyAnglePaths[i].size() * 4 < stepPaths[i].size());
+	}
+
+	// each expansion checks at most one line of sight
+	BOOST_CHECK(pathfinder.getLineOfSightCheckCount() > 0);
+	BOOST_CHECK(pathfinder.getLineOfSightCheckCount() <= pathfinder.getExpandedNodeCount());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_any_angle_weights) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// rough terrain between the start and the end, with a way around it
+	for (unsigned int x = 10; x < 20; ++x) {
+		for (unsigned int y = 0; y < 25; ++y) {
+			navGrid.at(x, y)->weight = 20;
+		}
+	}
+	const std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 5), sf::Vector2i(27, 5), PATH_SEARCH_MODE_ANY_ANGLE } };
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	checkAnyAnglePathIsValid(navGrid, pathRequests[0], paths[0]);
+
+	// the lines of sight go around the rough terrain instead of through it
+	sf::Vector2i previous = pathRequests[0].start;
+	for (const sf::Vector2i& waypoint : paths[0]) {
+		BOOST_CHECK(hasLineOfSight(navGrid, previous, waypoint, 1));
+		previous = waypoint;
+	}
+
+	// without a way around, the path crosses the rough terrain straight along its row
+	for (unsigned int x = 10; x < 20; ++x) {
+		for (unsigned int y = 25; y < SQUARE_DIM; ++y) {
+			navGrid.at(x, y)->weight = 20;
+		}
+	}
+	pathfinder.pathFind(pathRequests, &paths);
+	checkAnyAnglePathIsValid(navGrid, pathRequests[0], paths[0]);
+	for (const sf::Vector2i& waypoint : paths[0]) {
+		BOOST_CHECK_EQUAL(waypoint.y, 5);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_any_angle_blocked) {
+	const int SQUARE_DIM = 10;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(0, 0)->weight = BLOCKED_GRID_WEIGHT;
+	navGrid.at(9, 9)->weight = BLOCKED_GRID_WEIGHT;
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(7, 3) }, // blocked start
+		PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(9, 9) } // blocked end
+	};
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_ANY_ANGLE);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// a blocked start can be left, but a blocked end can not be reached
+	checkAnyAnglePathIsValid(navGrid, pathRequests[0], paths[0]);
+	BOOST_CHECK(paths[1].empty());
+
+	freeAllNavigationGridData(navGrid);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // end Pathfinder_pathFind_Tests
 
+BOOST_AUTO_TEST_SUITE(Pathfinder_requestPath_Tests)
+
+BOOST_AUTO_TEST_CASE(Pathfinder_requestPath_matches_pathFind) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM - 3; ++y) {
+			navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(SQUARE_DIM / 2, y)->weight += 3;
+	}
+	std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, 2) },
+		PathRequest{ sf::Vector2i(1, 5), sf::Vector2i(2, 9) },
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(4, 2) }, // blocked end
+		PathRequest{ sf::Vector2i(3, 3), sf::Vector2i(3, 3) },
+		PathRequest{ sf::Vector2i(-1, 3), sf::Vector2i(3, 3) },
+		PathRequest{ sf::Vector2i(SQUARE_DIM - 1, 0), sf::Vector2i(0, SQUARE_DIM - 1), PATH_SEARCH_MODE_JUMP_POINT },
+		PathRequest{ sf::Vector2i(SQUARE_DIM - 1, 0), sf::Vector2i(0, SQUARE_DIM - 1), PATH_SEARCH_MODE_BIDIRECTIONAL },
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(4, 2), PATH_SEARCH_MODE_BIDIRECTIONAL },
+		PathRequest{ sf::Vector2i(SQUARE_DIM - 1, 0), sf::Vector2i(0, SQUARE_DIM - 1), PATH_SEARCH_MODE_ANY_ANGLE },
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(4, 2), PATH_SEARCH_MODE_ANY_ANGLE }
+	};
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> expectedPaths;
+	pathfinder.pathFind(pathRequests, &expectedPaths);
+
+	std::vector<PathRequestHandle> handles;
+	for (const PathRequest& pathRequest : pathRequests) {
+		handles.push_back(pathfinder.requestPath(pathRequest));
+		BOOST_CHECK_EQUAL(pathfinder.getPathRequestStatus(handles.back()), PATH_REQUEST_STATUS_PENDING);
+	}
+
+	// every update stays within its budget, and the searches take several updates
+	const std::size_t EXPANSION_BUDGET = 25;
+	int updateCount = 0;
+	while (pathfinder.getPendingPathRequestCount() > 0) {
+		BOOST_CHECK(pathfinder.advancePathRequests(EXPANSION_BUDGET) <= EXPANSION_BUDGET);
+		++updateCount;
+	}
+	BOOST_CHECK(updateCount > 10);
+
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_CHECK_EQUAL(pathfinder.getPathRequestStatus(handles[i]), PATH_REQUEST_STATUS_COMPLETE);
+		std::deque<sf::Vector2i> path;
+		BOOST_CHECK(pathfinder.takePath(handles[i], path));
+		BOOST_CHECK(path == expectedPaths[i]);
+
+		// the path can only be taken once
+		BOOST_CHECK_EQUAL(pathfinder.getPathRequestStatus(handles[i]), PATH_REQUEST_STATUS_INVALID);
+		BOOST_CHECK(!pathfinder.takePath(handles[i], path));
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_requestPath_cancel) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, SQUARE_DIM - 1) };
+
+	Pathfinder pathfinder(&navGrid);
+	const PathRequestHandle canceledHandle = pathfinder.requestPath(pathRequest);
+	const PathRequestHandle handle = pathfinder.requestPath(pathRequest);
+	BOOST_CHECK(canceledHandle != handle);
+
+	// cancel the first request in the middle of its search
+	pathfinder.advancePathRequests(10);
+	BOOST_CHECK_EQUAL(pathfinder.getPathRequestStatus(canceledHandle), PATH_REQUEST_STATUS_PENDING);
+	pathfinder.cancelPathRequest(canceledHandle);
+	BOOST_CHECK_EQUAL(pathfinder.getPathRequestStatus(canceledHandle), PATH_REQUEST_STATUS_INVALID);
+	BOOST_CHECK_EQUAL(pathfinder.getPendingPathRequestCount(), 1);
+
+	// the second request starts its own search
+	while (pathfinder.getPendingPathRequestCount() > 0) {
+		pathfinder.advancePathRequests(10);
+	}
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(!pathfinder.takePath(canceledHandle, path));
+	BOOST_CHECK(pathfinder.takePath(handle, path));
+	BOOST_CHECK_EQUAL(path.size(), 2 * (SQUARE_DIM - 1));
+	checkPathIsValid(navGrid, pathRequest, path);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_advancePathRequestsFor) {
+	const int SQUARE_DIM = 50;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, SQUARE_DIM - 1) };
+
+	Pathfinder pathfinder(&navGrid);
+	const PathRequestHandle handle = pathfinder.requestPath(pathRequest);
+
+	// even without any time, every update makes progress
+	while (pathfinder.getPendingPathRequestCount() > 0) {
+		BOOST_CHECK(pathfinder.advancePathRequestsFor(0) > 0 || pathfinder.getPendingPathRequestCount() == 0);
+	}
+	BOOST_CHECK_EQUAL(pathfinder.advancePathRequestsFor(1000), 0);
+
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(pathfinder.takePath(handle, path));
+	checkPathIsValid(navGrid, pathRequest, path);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end Pathfinder_requestPath_Tests
+
+BOOST_AUTO_TEST_SUITE(Pathfinder_pathCache_Tests)
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathCache_repeated_requests) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(20, 5) },
+		PathRequest{ sf::Vector2i(3, 25), sf::Vector2i(28, 28) },
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(20, 5), PATH_SEARCH_MODE_JUMP_POINT }
+	};
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setPathCacheMemoryLimit(64 * 1024);
+	std::vector<std::deque<sf::Vector2i>> firstPaths;
+	pathfinder.pathFind(pathRequests, &firstPaths);
+	BOOST_CHECK_EQUAL(pathfinder.getPathCache().getMissCount(), 3);
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() > 0);
+
+	// repeated requests are answered without searching
+	std::vector<std::deque<sf::Vector2i>> cachedPaths;
+	pathfinder.pathFind(pathRequests, &cachedPaths);
+	BOOST_CHECK_EQUAL(pathfinder.getPathCache().getHitCount(), 3);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+	BOOST_CHECK(cachedPaths == firstPaths);
+
+	// so are time sliced requests
+	const PathRequestHandle handle = pathfinder.requestPath(pathRequests[1]);
+	BOOST_CHECK_EQUAL(pathfinder.advancePathRequests(1), 0);
+	std::deque<sf::Vector2i> path;
+	BOOST_CHECK(pathfinder.takePath(handle, path));
+	BOOST_CHECK(path == firstPaths[1]);
+
+	// multithreaded batches use the cache as well
+	pathfinder.setWorkerThreadCount(2);
+	pathfinder.pathFind(pathRequests, &cachedPaths);
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+	BOOST_CHECK(cachedPaths == firstPaths);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathCache_grid_changes) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const std::vector<PathRequest> pathRequests{
+		PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(20, 0) },
+		PathRequest{ sf::Vector2i(0, 20), sf::Vector2i(20, 20) }
+	};
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setPathCacheMemoryLimit(64 * 1024);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// block a grid square on the first path only
+	const sf::Vector2i blockedGridSquare = paths[0][paths[0].size() / 2];
+	navGrid.at(blockedGridSquare.x, blockedGridSquare.y)->weight = BLOCKED_GRID_WEIGHT;
+	pathfinder.updateGridSquares({ blockedGridSquare });
+
+	std::vector<std::deque<sf::Vector2i>> newPaths;
+	pathfinder.pathFind(pathRequests, &newPaths);
+	checkPathIsValid(navGrid, pathRequests[0], newPaths[0]);
+	BOOST_CHECK(std::find(newPaths[0].begin(), newPaths[0].end(), blockedGridSquare) == newPaths[0].end());
+	BOOST_CHECK(newPaths[1] == paths[1]);
+	BOOST_CHECK_EQUAL(pathfinder.getPathCache().getHitCount(), 1);
+
+	// invalidating the cache searches every request again
+	const std::uint64_t gridVersion = pathfinder.getPathCache().getGridVersion();
+	pathfinder.invalidatePathCache();
+	BOOST_CHECK(pathfinder.getPathCache().getGridVersion() != gridVersion);
+	pathfinder.pathFind(pathRequests, &newPaths);
+	BOOST_CHECK_EQUAL(pathfinder.getPathCache().getHitCount(), 1);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathCache_any_angle) {
+	const int SQUARE_DIM = 30;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(20, 5), PATH_SEARCH_MODE_ANY_ANGLE } };
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setPathCacheMemoryLimit(64 * 1024);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+
+	// the grid squares between the waypoints could change unnoticed, so any angle paths are never cached
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK_EQUAL(pathfinder.getPathCache().getHitCount(), 0);
+	BOOST_CHECK(pathfinder.getExpandedNodeCount() > 0);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end Pathfinder_pathCache_Tests
+
+BOOST_AUTO_TEST_SUITE(Pathfinder_neighborhood_Tests)
+
+BOOST_AUTO_TEST_CASE(Pathfinder_neighborhood_eight_open_grid) {
+	NavigationGrid navGrid(20);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	Pathfinder pathfinder(&navGrid);
+	BOOST_CHECK_EQUAL(pathfinder.getNeighborhood(), PATH_NEIGHBORHOOD_FOUR);
+	BOOST_CHECK_EQUAL(pathfinder.getNeighborOffsets().size(), 4);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	BOOST_CHECK_EQUAL(pathfinder.getNeighborOffsets().size(), 8);
+
+	// diagonal steps replace the stair steps of the four neighborhood
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(10, 6) };
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 10);
+	BOOST_CHECK_EQUAL(calcEightNeighborhoodPathCost(navGrid, pathRequest, paths[0]), 6 * 14 + 4 * 10);
+
+	// switching back restores the four neighborhood
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_FOUR);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 16);
+	checkPathIsValid(navGrid, pathRequest, paths[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_neighborhood_corner_cutting) {
+	NavigationGrid navGrid(5);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(1, 0)->weight = BLOCKED_GRID_WEIGHT;
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(1, 1) };
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	std::vector<std::deque<sf::Vector2i>> paths;
+
+	// one blocked side
+	BOOST_CHECK_EQUAL(pathfinder.getCornerCutting(), PATH_CORNER_CUTTING_ALLOWED);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 1);
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_NO_SQUEEZING);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 1);
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_FORBIDDEN);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 2);
+
+	// both sides blocked
+	navGrid.at(0, 1)->weight = BLOCKED_GRID_WEIGHT;
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK(paths[0].empty());
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_NO_SQUEEZING);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK(paths[0].empty());
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_ALLOWED);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 1);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_neighborhood_eight_cheapest_path) {
+	const int SQUARE_DIM = 24;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (int x = 0; x < SQUARE_DIM; ++x) {
+		for (int y = 0; y < SQUARE_DIM; ++y) {
+			if ((x * 7 + y * 3) % 11 == 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+			else if ((x + 2 * y) % 5 == 0) {
+				navGrid.at(x, y)->weight = 4;
+			}
+		}
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < 12; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i(1 + i, 1), sf::Vector2i(SQUARE_DIM - 2 - i, SQUARE_DIM - 2) });
+	}
+
+	for (int cornerCutting = PATH_CORNER_CUTTING_ALLOWED; cornerCutting <= PATH_CORNER_CUTTING_FORBIDDEN; cornerCutting += PATH_CORNER_CUTTING_FORBIDDEN) {
+		pathfinder.setCornerCutting(static_cast<PATH_CORNER_CUTTING_TYPE>(cornerCutting));
+		std::vector<std::deque<sf::Vector2i>> paths;
+		pathfinder.pathFind(pathRequests, &paths);
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			const int cheapestCost = calcCheapestEightNeighborhoodCost(navGrid, pathRequests[i], cornerCutting == PATH_CORNER_CUTTING_FORBIDDEN);
+			BOOST_REQUIRE_EQUAL(paths[i].empty(), cheapestCost == -1);
+			if (!paths[i].empty()) {
+				BOOST_CHECK_EQUAL(calcEightNeighborhoodPathCost(navGrid, pathRequests[i], paths[i]), cheapestCost);
+			}
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_neighborhood_custom) {
+	NavigationGrid navGrid(12);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// knight moves, with the zero offset and a repeated offset ignored
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setCustomNeighborhood({ {1, 2}, {2, 1}, {-1, 2}, {-2, 1}, {1, -2}, {2, -1}, {-1, -2}, {-2, -1}, {0, 0}, {1, 2} });
+	BOOST_CHECK_EQUAL(pathfinder.getNeighborhood(), PATH_NEIGHBORHOOD_CUSTOM);
+	BOOST_CHECK_EQUAL(pathfinder.getNeighborOffsets().size(), 8);
+
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind({ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(2, 4) } }, &paths);
+	BOOST_REQUIRE_EQUAL(paths[0].size(), 2);
+	BOOST_CHECK(paths[0][0] == sf::Vector2i(1, 2));
+	BOOST_CHECK(paths[0][1] == sf::Vector2i(2, 4));
+
+	// a knight can not reach a neighboring grid square in one move
+	pathfinder.pathFind({ PathRequest{ sf::Vector2i(5, 5), sf::Vector2i(6, 5) } }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 3);
+
+	// the jump point search mode does not apply to other neighborhoods
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+	pathfinder.pathFind({ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(2, 4) } }, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 2);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_neighborhood_reachability_index) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// a diagonal wall only separates the grid when corners can not be cut
+	for (int i = 0; i < 10; ++i) {
+		navGrid.at(i, 9 - i)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(9, 9) };
+	ReachabilityIndex reachabilityIndex(&navGrid);
+
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setReachabilityIndex(&reachabilityIndex);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK(!paths[0].empty());
+
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_FORBIDDEN);
+	pathfinder.pathFind({ pathRequest }, &paths);
+	BOOST_CHECK(paths[0].empty());
+	BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), 0);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end Pathfinder_neighborhood_Tests
+
+BOOST_AUTO_TEST_SUITE(Pathfinder_gridType_Tests)
+
+// Tests that the Pathfinder finds the same paths on every kind of grid as on the NavigationGrid it was copied from
+BOOST_AUTO_TEST_CASE_TEMPLATE(Pathfinder_pathFind_matches_NavigationGrid, SearchedGrid, SearchedGridTypes) {
+	NavigationGrid navGrid(30, 30);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	TEST::fillRandomWeights(navGrid, 11);
+	SearchedGrid searchedGrid(navGrid);
+	const std::vector<PathRequest> pathRequests = TEST::makeRandomPathRequests(sf::Vector2u(30, 30), 40, 3);
+
+	const PATH_SEARCH_MODE_TYPE searchModes[] = {PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_BIDIRECTIONAL, PATH_SEARCH_MODE_ANY_ANGLE};
+	const PATH_CORNER_CUTTING_TYPE cornerCuttings[] = {PATH_CORNER_CUTTING_ALLOWED, PATH_CORNER_CUTTING_NO_SQUEEZING, PATH_CORNER_CUTTING_FORBIDDEN};
+	for (PATH_SEARCH_MODE_TYPE searchMode : searchModes) {
+		for (PATH_CORNER_CUTTING_TYPE cornerCutting : cornerCuttings) {
+			Pathfinder pathfinder(&navGrid);
+			Pathfinder searchedGridPathfinder(&searchedGrid.grid);
+			for (Pathfinder* configuredPathfinder : {&pathfinder, &searchedGridPathfinder}) {
+				configuredPathfinder->setSearchMode(searchMode);
+				configuredPathfinder->setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+				configuredPathfinder->setCornerCutting(cornerCutting);
+			}
+
+			std::vector<std::deque<sf::Vector2i>> paths;
+			std::vector<std::deque<sf::Vector2i>> searchedGridPaths;
+			pathfinder.pathFind(pathRequests, &paths);
+			searchedGridPathfinder.pathFind(pathRequests, &searchedGridPaths);
+
+			BOOST_CHECK(paths == searchedGridPaths);
+			BOOST_CHECK_EQUAL(pathfinder.getExpandedNodeCount(), searchedGridPathfinder.getExpandedNodeCount());
+		}
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+// Tests that setting any kind of grid replaces the NavigationGrid, and that setting a NavigationGrid replaces it again
+BOOST_AUTO_TEST_CASE_TEMPLATE(Pathfinder_setNavigationGrid_replaces_NavigationGrid, SearchedGrid, SearchedGridTypes) {
+	NavigationGrid navGrid(3, 3);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 0, 0 });
+	NavigationGrid largerNavGrid(4, 4);
+	initAllNavigationGridValues(largerNavGrid, NavigationGridData{ 0, 0 });
+	SearchedGrid searchedGrid(largerNavGrid);
+	Pathfinder pathfinder(&navGrid);
+
+	pathfinder.setNavigationGrid(&searchedGrid.grid);
+	BOOST_CHECK(pathfinder.getNavigationGrid() == nullptr);
+	BOOST_CHECK(searchedGrid.isSearchedBy(pathfinder));
+
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(3, 3) } };
+	std::vector<std::deque<sf::Vector2i>> paths;
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK_EQUAL(paths[0].size(), 6u);
+
+	pathfinder.setNavigationGrid(&navGrid);
+	BOOST_CHECK(pathfinder.getNavigationGrid() == &navGrid);
+	BOOST_CHECK(!searchedGrid.isSearchedBy(pathfinder));
+	pathfinder.pathFind(pathRequests, &paths);
+	BOOST_CHECK(paths[0].empty());
+
+	pathfinder.setNavigationGrid(nullptr);
+	BOOST_CHECK(pathfinder.getNavigationGrid() == nullptr);
+	BOOST_CHECK(!searchedGrid.isSearchedBy(pathfinder));
+
+	freeAllNavigationGridData(navGrid);
+	freeAllNavigationGridData(largerNavGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end Pathfinder_gridType_Tests
+
 
 BOOST_AUTO_TEST_SUITE(Pathfinder_perf_Tests)
 
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_jump_point_vs_standard) {
+	const int SQUARE_DIM = 200;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	// mostly open terrain of equal weight with scattered walls and a slow band through the middle
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (int x = 10; x < SQUARE_DIM; x += 20) {
+		for (int y = 0; y < SQUARE_DIM - 30; ++y) {
+			navGrid.at(x, (y + x * 3) % SQUARE_DIM)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+	for (int x = 0; x < SQUARE_DIM; ++x) {
+		for (int y = 95; y < 105; ++y) {
+			if (navGrid.at(x, y)->weight < BLOCKED_GRID_WEIGHT) {
+				navGrid.at(x, y)->weight = 3;
+			}
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 7), (i * 71) % SQUARE_DIM } });
+	}
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	// the first jump point search finds the jump distances of the grid, which later searches reuse
+	pathfinder.setSearchMode(PATH_SEARCH_MODE_JUMP_POINT);
+	auto startTime = std::chrono::high_resolution_clock::now();
+	pathfinder.pathFind(std::vector<PathRequest>{ pathRequests[0] }, &pathsReturn);
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> buildTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+	std::stringstream buildStream;
+	buildStream << "Jump distance build and first search time of: " << buildTime.count() << " seconds";
+	BOOST_TEST_MESSAGE(buildStream.str());
+
+	// the fastest of several runs, so a busy machine does not decide the comparison
+	const int NUM_RUNS = 3;
+	const PATH_SEARCH_MODE_TYPE searchModes[] = { PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_JUMP_POINT };
+	const char* searchModeNames[] = { "standard", "jump point" };
+	std::size_t expandedNodeCounts[2];
+	double elapsedTimes[2];
+	for (int mode = 0; mode < 2; ++mode) {
+		pathfinder.setSearchMode(searchModes[mode]);
+
+		elapsedTimes[mode] = std::numeric_limits<double>::max();
+		for (int run = 0; run < NUM_RUNS; ++run) {
+			startTime = std::chrono::high_resolution_clock::now();
+			pathfinder.pathFind(pathRequests, &pathsReturn);
+			endTime = std::chrono::high_resolution_clock::now();
+			std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+			elapsedTimes[mode] = std::min(elapsedTimes[mode], elapsedTime.count());
+		}
+		expandedNodeCounts[mode] = pathfinder.getExpandedNodeCount();
+
+		std::stringstream strStream;
+		strStream << "Pathfinding time of: " << elapsedTimes[mode] << " seconds and " << expandedNodeCounts[mode]
+			<< " expanded grid squares for " << searchModeNames[mode] << " search perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+	}
+
+	BOOST_CHECK(expandedNodeCounts[1] < expandedNodeCounts[0]);
+	BOOST_CHECK(elapsedTimes[1] <= elapsedTimes[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_heuristic_settings) {
+	const int SQUARE_DIM = 200;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	// a few walls on terrain of uneven weight
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			navGrid.at(x, y)->weight = static_cast<int>(1 + (x * 7919u + y * 104729u) % 13u % 4u);
+		}
+	}
+	for (int x = 20; x < SQUARE_DIM; x += 40) {
+		for (int y = x % 60; y < x % 60 + 100; ++y) {
+			navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 7), (i * 71) % SQUARE_DIM } });
+	}
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	struct HeuristicSetting {
+		PATH_HEURISTIC_TYPE heuristic;
+		double heuristicWeight;
+		const char* name;
+	};
+	const HeuristicSetting settings[] = {
+		{ PATH_HEURISTIC_NONE, 1.0, "no" },
+		{ PATH_HEURISTIC_EUCLIDEAN, 1.0, "euclidean" },
+		{ PATH_HEURISTIC_MANHATTAN, 1.0, "manhattan" },
+		{ PATH_HEURISTIC_MANHATTAN, 1.5, "manhattan weighted 1.5" },
+		{ PATH_HEURISTIC_MANHATTAN, 2.0, "manhattan weighted 2" },
+		{ PATH_HEURISTIC_MANHATTAN, 5.0, "manhattan weighted 5" }
+	};
+	const std::size_t SETTING_COUNT = sizeof(settings) / sizeof(settings[0]);
+	std::size_t expandedNodeCounts[SETTING_COUNT];
+	int totalCosts[SETTING_COUNT];
+	for (std::size_t setting = 0; setting < SETTING_COUNT; ++setting) {
+		pathfinder.setHeuristic(settings[setting].heuristic);
+		pathfinder.setHeuristicWeight(settings[setting].heuristicWeight);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		pathfinder.pathFind(pathRequests, &pathsReturn);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		expandedNodeCounts[setting] = pathfinder.getExpandedNodeCount();
+		totalCosts[setting] = 0;
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			totalCosts[setting] += calcFourNeighborhoodPathCost(navGrid, pathRequests[i], pathsReturn[i]);
+		}
+
+		std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+		std::stringstream strStream;
+		strStream << "Pathfinding time of: " << elapsedTime.count() << " seconds, " << expandedNodeCounts[setting]
+			<< " expanded grid squares and a total path cost of " << totalCosts[setting] << " for " << settings[setting].name << " heuristic perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+	}
+
+	// unweighted heuristics find the cheapest paths, and closer estimates expand fewer grid squares
+	BOOST_CHECK_EQUAL(totalCosts[1], totalCosts[0]);
+	BOOST_CHECK_EQUAL(totalCosts[2], totalCosts[0]);
+	BOOST_CHECK(expandedNodeCounts[1] < expandedNodeCounts[0]);
+	BOOST_CHECK(expandedNodeCounts[2] < expandedNodeCounts[1]);
+
+	// larger weights trade path cost for fewer expanded grid squares
+	for (std::size_t setting = 3; setting < SETTING_COUNT; ++setting) {
+		BOOST_CHECK(totalCosts[setting] <= settings[setting].heuristicWeight * totalCosts[0]);
+		BOOST_CHECK(expandedNodeCounts[setting] < expandedNodeCounts[setting - 1]);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_landmark_vs_manhattan) {
+	const int SQUARE_DIM = 300;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	// slow terrain crossed by fast roads, which no distance based estimate accounts for
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 6,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			if (x % 30 == 5 || y % 30 == 5) {
+				navGrid.at(x, y)->weight = 1;
+			}
+		}
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 1 - (i % 7), (i * 71) % SQUARE_DIM } });
+	}
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	LandmarkTable landmarkTable(&navGrid, 8);
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> buildTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+	std::stringstream buildStream;
+	buildStream << "Landmark table build time of: " << buildTime.count() << " seconds for " << landmarkTable.getMemoryUsage() << " bytes of tables";
+	BOOST_TEST_MESSAGE(buildStream.str());
+
+	const char* heuristicNames[] = { "manhattan", "landmark" };
+	std::size_t expandedNodeCounts[2];
+	int totalCosts[2];
+	for (int heuristic = 0; heuristic < 2; ++heuristic) {
+		pathfinder.setLandmarkTable((heuristic == 0) ? nullptr : &landmarkTable);
+
+		startTime = std::chrono::high_resolution_clock::now();
+		pathfinder.pathFind(pathRequests, &pathsReturn);
+		endTime = std::chrono::high_resolution_clock::now();
+		expandedNodeCounts[heuristic] = pathfinder.getExpandedNodeCount();
+		totalCosts[heuristic] = 0;
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			totalCosts[heuristic] += calcFourNeighborhoodPathCost(navGrid, pathRequests[i], pathsReturn[i]);
+		}
+
+		std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+		std::stringstream strStream;
+		strStream << "Pathfinding time of: " << elapsedTime.count() << " seconds and " << expandedNodeCounts[heuristic]
+			<< " expanded grid squares for " << heuristicNames[heuristic] << " heuristic perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+	}
+
+	BOOST_CHECK_EQUAL(totalCosts[1], totalCosts[0]);
+	BOOST_CHECK(expandedNodeCounts[1] < expandedNodeCounts[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_bidirectional_vs_standard) {
+	const int SQUARE_DIM = 400;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+
+	// scattered rough terrain across a large open map
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 29u;
+			if (hash == 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+			else if (hash < 6) {
+				navGrid.at(x, y)->weight = 4;
+			}
+		}
+	}
+
+	// long requests across the map
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ 1 + (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 2 - (i % 7), (i * 71) % SQUARE_DIM } });
+	}
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	const PATH_SEARCH_MODE_TYPE searchModes[] = { PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_BIDIRECTIONAL };
+	const char* searchModeNames[] = { "standard", "bidirectional" };
+	std::size_t expandedNodeCounts[2];
+	int totalCosts[2];
+	for (int searchMode = 0; searchMode < 2; ++searchMode) {
+		pathfinder.setSearchMode(searchModes[searchMode]);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		pathfinder.pathFind(pathRequests, &pathsReturn);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		expandedNodeCounts[searchMode] = pathfinder.getExpandedNodeCount();
+		totalCosts[searchMode] = 0;
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			totalCosts[searchMode] += calcFourNeighborhoodPathCost(navGrid, pathRequests[i], pathsReturn[i]);
+		}
+
+		std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+		std::stringstream strStream;
+		strStream << "Pathfinding time of: " << elapsedTime.count() << " seconds and " << expandedNodeCounts[searchMode]
+			<< " expanded grid squares for " << searchModeNames[searchMode] << " search perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+	}
+
+	BOOST_CHECK_EQUAL(totalCosts[1], totalCosts[0]);
+	BOOST_CHECK(expandedNodeCounts[1] < expandedNodeCounts[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_hierarchical_vs_standard) {
+	const int SQUARE_DIM = 512;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+
+	// rooms separated by walls with doors, and scattered rough terrain
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 29u;
+			if ((x % 64 == 32 && y % 64 > 8) || (y % 64 == 32 && x % 64 < 56)) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+			else if (hash < 5) {
+				navGrid.at(x, y)->weight = 4;
+			}
+		}
+	}
+
+	// long requests across the map
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ 1 + (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 2 - (i % 7), (i * 71) % SQUARE_DIM } });
+		navGrid.at(pathRequests.back().start.x, pathRequests.back().start.y)->weight = 1;
+		navGrid.at(pathRequests.back().end.x, pathRequests.back().end.y)->weight = 1;
+	}
+	std::vector<std::deque<sf::Vector2i>> standardPaths;
+	std::vector<std::deque<sf::Vector2i>> hierarchicalPaths;
+
+	Pathfinder pathfinder(&navGrid);
+	auto startTime = std::chrono::high_resolution_clock::now();
+	pathfinder.pathFind(pathRequests, &standardPaths);
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> standardTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+
+	// the abstraction is built once for the grid and reused by every batch
+	startTime = std::chrono::high_resolution_clock::now();
+	HierarchicalPathfinder hierarchicalPathfinder(&navGrid);
+	endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> buildTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+
+	startTime = std::chrono::high_resolution_clock::now();
+	hierarchicalPathfinder.pathFind(pathRequests, &hierarchicalPaths);
+	endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> hierarchicalTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+
+	int totalCosts[2] = { 0, 0 };
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		BOOST_REQUIRE_EQUAL(hierarchicalPaths[i].empty(), standardPaths[i].empty());
+		if (!hierarchicalPaths[i].empty()) {
+			checkPathIsValid(navGrid, pathRequests[i], hierarchicalPaths[i]);
+		}
+		totalCosts[0] += calcFourNeighborhoodPathCost(navGrid, pathRequests[i], standardPaths[i]);
+		totalCosts[1] += calcFourNeighborhoodPathCost(navGrid, pathRequests[i], hierarchicalPaths[i]);
+	}
+
+	std::stringstream strStream;
+	strStream << "Pathfinding time of: " << standardTime.count() << " seconds and a total path cost of " << totalCosts[0] << " for standard search perf test" << std::endl
+		<< "Abstraction build time of: " << buildTime.count() << " seconds for " << hierarchicalPathfinder.getAbstractNodeCount() << " abstract nodes" << std::endl
+		<< "Pathfinding time of: " << hierarchicalTime.count() << " seconds and a total path cost of " << totalCosts[1] << " for hierarchical search perf test";
+	BOOST_TEST_MESSAGE(strStream.str());
+
+	// the hierarchical paths are close to the cheapest paths, and found in less time
+	BOOST_CHECK(totalCosts[1] >= totalCosts[0]);
+	BOOST_CHECK(totalCosts[1] * 10 <= totalCosts[0] * 12);
+	BOOST_CHECK(hierarchicalTime.count() <= standardTime.count());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_any_angle_vs_standard) {
+	const int SQUARE_DIM = 256;
+	const int NUM_REQUESTS = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	Pathfinder pathfinder(&navGrid);
+	pathfinder.setNeighborhood(PATH_NEIGHBORHOOD_EIGHT);
+	pathfinder.setCornerCutting(PATH_CORNER_CUTTING_FORBIDDEN);
+
+	// scattered blockers and rough terrain across the map
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < SQUARE_DIM; ++x) {
+		for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+			const unsigned int hash = (x * 7919u + y * 104729u) % 29u;
+			if (hash == 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+			else if (hash < 6) {
+				navGrid.at(x, y)->weight = 4;
+			}
+		}
+	}
+
+	// long requests across the map
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < NUM_REQUESTS; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i{ 1 + (i * 37) % 9, (i * 53) % SQUARE_DIM }, sf::Vector2i{ SQUARE_DIM - 2 - (i % 7), (i * 71) % SQUARE_DIM } });
+		navGrid.at(pathRequests.back().start.x, pathRequests.back().start.y)->weight = 1;
+		navGrid.at(pathRequests.back().end.x, pathRequests.back().end.y)->weight = 1;
+	}
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+
+	const PATH_SEARCH_MODE_TYPE searchModes[] = { PATH_SEARCH_MODE_STANDARD, PATH_SEARCH_MODE_ANY_ANGLE };
+	const char* searchModeNames[] = { "standard", "any angle" };
+	std::size_t waypointCounts[2];
+	for (int searchMode = 0; searchMode < 2; ++searchMode) {
+		pathfinder.setSearchMode(searchModes[searchMode]);
+
+		auto startTime = std::chrono::high_resolution_clock::now();
+		pathfinder.pathFind(pathRequests, &pathsReturn);
+		auto endTime = std::chrono::high_resolution_clock::now();
+		waypointCounts[searchMode] = 0;
+		for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+			BOOST_CHECK(!pathsReturn[i].empty());
+			waypointCounts[searchMode] += pathsReturn[i].size();
+		}
+
+		std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+		std::stringstream strStream;
+		strStream << "Pathfinding time of: " << elapsedTime.count() << " seconds, " << pathfinder.getExpandedNodeCount()
+			<< " expanded grid squares, " << pathfinder.getLineOfSightCheckCount() << " line of sight checks and "
+			<< waypointCounts[searchMode] << " waypoints for " << searchModeNames[searchMode] << " search perf test";
+		BOOST_TEST_MESSAGE(strStream.str());
+	}
+
+	BOOST_CHECK(pathfinder.getLineOfSightCheckCount() <= pathfinder.getExpandedNodeCount());
+	BOOST_CHECK(waypointCounts[1] * 3 < waypointCounts[0]);
+
+	freeAllNavigationGridData(navGrid);
+}
+
 // BOOST_AUTO_TEST_CASE(Pathfinder_pathFind_many_long_paths) {
 // 	const int SQUARE_DIM = 1000;
 // 	const int NUM_REQUESTS = 1000;
@@ -0,0 +1,120 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/PathSearchWorkspace.h>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(PathSearchWorkspace_Tests)
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_default_CTR) {
+	PathSearchWorkspace workspace;
+
+	BOOST_CHECK_EQUAL(workspace.getGridSize(), 0);
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_fitToGridSize_only_allocates_on_change) {
+	PathSearchWorkspace workspace;
+
+	BOOST_CHECK(workspace.fitToGridSize(100));
+	BOOST_CHECK_EQUAL(workspace.getGridSize(), 100);
+	BOOST_CHECK_EQUAL(workspace.getOpenSet().getCapacity(), 100);
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 1);
+
+	BOOST_CHECK(!workspace.fitToGridSize(100));
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 1);
+
+	BOOST_CHECK(workspace.fitToGridSize(25));
+	BOOST_CHECK_EQUAL(workspace.getGridSize(), 25);
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_fitAnyAngleSearch_only_allocates_on_change) {
+	PathSearchWorkspace workspace;
+	workspace.fitToGridSize(10);
+
+	BOOST_CHECK(workspace.fitAnyAngleSearch());
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 2);
+	BOOST_CHECK_EQUAL(workspace.getLineWeight(3), PathSearchWorkspace::NO_LINE_WEIGHT);
+
+	workspace.setLineWeight(3, 4);
+	BOOST_CHECK_EQUAL(workspace.getLineWeight(3), 4);
+
+	BOOST_CHECK(!workspace.fitAnyAngleSearch());
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 2);
+
+	// a new grid size discards the line weights
+	workspace.fitToGridSize(25);
+	BOOST_CHECK(workspace.fitAnyAngleSearch());
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 4);
+	BOOST_CHECK_EQUAL(workspace.getLineWeight(3), PathSearchWorkspace::NO_LINE_WEIGHT);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_node_values) {
+	PathSearchWorkspace workspace;
+	workspace.fitToGridSize(10);
+	workspace.beginSearch();
+
+	BOOST_CHECK_EQUAL(workspace.getState(3), PATH_SEARCH_NODE_UNVISITED);
+
+	workspace.setState(3, PATH_SEARCH_NODE_OPEN);
+	workspace.setScore(3, 42);
+	workspace.setCameFrom(3, 2);
+
+	BOOST_CHECK_EQUAL(workspace.getState(3), PATH_SEARCH_NODE_OPEN);
+	BOOST_CHECK_EQUAL(workspace.getScore(3), 42);
+	BOOST_CHECK_EQUAL(workspace.getCameFrom(3), 2);
+	BOOST_CHECK_EQUAL(workspace.getState(4), PATH_SEARCH_NODE_UNVISITED);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_beginSearch_resets_nodes) {
+	PathSearchWorkspace workspace;
+	workspace.fitToGridSize(10);
+	workspace.beginSearch();
+
+	workspace.setState(1, PATH_SEARCH_NODE_CLOSED);
+	workspace.setState(2, PATH_SEARCH_NODE_OPEN);
+	workspace.getOpenSet().pushOrUpdate(2, 7);
+
+	workspace.beginSearch();
+
+	BOOST_CHECK_EQUAL(workspace.getState(1), PATH_SEARCH_NODE_UNVISITED);
+	BOOST_CHECK_EQUAL(workspace.getState(2), PATH_SEARCH_NODE_UNVISITED);
+	BOOST_CHECK(workspace.getOpenSet().isEmpty());
+	BOOST_CHECK_EQUAL(workspace.getAllocationCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_expanded_node_count) {
+	PathSearchWorkspace workspace;
+	workspace.fitToGridSize(10);
+	BOOST_CHECK_EQUAL(workspace.getExpandedNodeCount(), 0);
+
+	// the count spans searches until it is reset
+	workspace.beginSearch();
+	workspace.countExpandedNode();
+	workspace.countExpandedNode();
+	workspace.beginSearch();
+	workspace.countExpandedNode();
+	BOOST_CHECK_EQUAL(workspace.getExpandedNodeCount(), 3);
+
+	workspace.resetSearchCounters();
+	BOOST_CHECK_EQUAL(workspace.getExpandedNodeCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PathSearchWorkspace_line_of_sight_check_count) {
+	PathSearchWorkspace workspace;
+	workspace.fitToGridSize(10);
+	BOOST_CHECK_EQUAL(workspace.getLineOfSightCheckCount(), 0);
+
+	workspace.countLineOfSightCheck();
+	workspace.countLineOfSightCheck();
+	BOOST_CHECK_EQUAL(workspace.getLineOfSightCheckCount(), 2);
+
+	// both counters are reset together
+	workspace.countExpandedNode();
+	workspace.resetSearchCounters();
+	BOOST_CHECK_EQUAL(workspace.getLineOfSightCheckCount(), 0);
+	BOOST_CHECK_EQUAL(workspace.getExpandedNodeCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathSearchWorkspace_Tests
@@ -0,0 +1,252 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/CoordinateConverter.h>
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Navigation/PathSmoother.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <chrono>
+#include <deque>
+#include <sstream>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Checks that every segment of a pulled path is a line of sight that is no heavier than the original path.
+	/// </summary>
+	void checkPulledPathIsValid(NavigationGrid& navGrid, const PathRequest& pathRequest, const std::deque<sf::Vector2i>& originalPath, const std::deque<sf::Vector2i>& pulledPath) {
+		int maxWeight = 0;
+		for (const sf::Vector2i& gridSquare : originalPath) {
+			maxWeight = std::max(maxWeight, navGrid.at(gridSquare.x, gridSquare.y)->weight);
+		}
+
+		sf::Vector2i previous = pathRequest.start;
+		for (const sf::Vector2i& waypoint : pulledPath) {
+			BOOST_CHECK(hasLineOfSight(navGrid, previous, waypoint, maxWeight));
+			previous = waypoint;
+		}
+		BOOST_CHECK(previous == pathRequest.end);
+	}
+
+	/// <summary>
+	/// Blocks a column of the navigation grid except for one gap.
+	/// </summary>
+	void buildWall(NavigationGrid& navGrid, unsigned int x, unsigned int gapY) {
+		for (unsigned int y = 0; y < navGrid.getArraySizeY(); ++y) {
+			if (y != gapY) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(PathSmoother_Tests)
+
+BOOST_AUTO_TEST_CASE(PathSmoother_CTRs) {
+	PathSmoother defaultSmoother;
+	BOOST_CHECK(defaultSmoother.getNavigationGrid() == nullptr);
+
+	NavigationGrid navGrid(4);
+	PathSmoother smoother(&navGrid);
+	BOOST_CHECK(smoother.getNavigationGrid() == &navGrid);
+
+	defaultSmoother.setNavigationGrid(&navGrid);
+	BOOST_CHECK(defaultSmoother.getNavigationGrid() == &navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_removeCollinearWaypoints) {
+	PathSmoother smoother;
+
+	// an L shaped path keeps its corner and its end
+	std::deque<sf::Vector2i> path{ {1, 0}, {2, 0}, {3, 0}, {3, 1}, {3, 2} };
+	smoother.removeCollinearWaypoints(sf::Vector2i(0, 0), path);
+	BOOST_REQUIRE_EQUAL(path.size(), 2);
+	BOOST_CHECK(path[0] == sf::Vector2i(3, 0));
+	BOOST_CHECK(path[1] == sf::Vector2i(3, 2));
+
+	// a staircase turns at every step
+	std::deque<sf::Vector2i> staircase{ {1, 0}, {1, 1}, {2, 1} };
+	smoother.removeCollinearWaypoints(sf::Vector2i(0, 0), staircase);
+	BOOST_CHECK_EQUAL(staircase.size(), 3);
+
+	// turning back is not collinear
+	std::deque<sf::Vector2i> reversed{ {1, 0}, {0, 0} };
+	smoother.removeCollinearWaypoints(sf::Vector2i(0, 0), reversed);
+	BOOST_CHECK_EQUAL(reversed.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_pullStrings_open_grid) {
+	const int SQUARE_DIM = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(15, 7) } };
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+
+	// every grid square sees every other one
+	PathSmoother smoother(&navGrid);
+	smoother.pullStrings(pathRequests[0].start, pathsReturn[0]);
+	BOOST_REQUIRE_EQUAL(pathsReturn[0].size(), 1);
+	BOOST_CHECK(pathsReturn[0][0] == pathRequests[0].end);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_pullStrings_wall) {
+	const int SQUARE_DIM = 20;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	buildWall(navGrid, 10, 15);
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(18, 3) } };
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::deque<sf::Vector2i> originalPath = pathsReturn[0];
+
+	PathSmoother smoother(&navGrid);
+	smoother.pullStrings(pathRequests, &pathsReturn);
+	checkPulledPathIsValid(navGrid, pathRequests[0], originalPath, pathsReturn[0]);
+
+	// the path has to turn around the gap in the wall
+	BOOST_CHECK(pathsReturn[0].size() >= 2);
+	BOOST_CHECK(pathsReturn[0].size() <= 4);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_pullStrings_weights) {
+	const int SQUARE_DIM = 12;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// a costly block between the start and the end that the path goes around
+	for (unsigned int x = 3; x < 9; ++x) {
+		for (unsigned int y = 0; y < 9; ++y) {
+			navGrid.at(x, y)->weight = 50;
+		}
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(1, 1), sf::Vector2i(10, 1) } };
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::deque<sf::Vector2i> originalPath = pathsReturn[0];
+
+	PathSmoother smoother(&navGrid);
+	smoother.pullStrings(pathRequests[0].start, pathsReturn[0]);
+	checkPulledPathIsValid(navGrid, pathRequests[0], originalPath, pathsReturn[0]);
+
+	// the straight line through the costly block is not taken
+	BOOST_CHECK(pathsReturn[0].size() > 1);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_pullStrings_blocked_start) {
+	NavigationGrid navGrid(8);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	navGrid.at(0, 0)->weight = BLOCKED_GRID_WEIGHT;
+
+	std::deque<sf::Vector2i> path{ {1, 0}, {2, 0}, {2, 1}, {3, 1}, {3, 2} };
+	PathSmoother smoother(&navGrid);
+	smoother.pullStrings(sf::Vector2i(0, 0), path);
+	BOOST_REQUIRE_EQUAL(path.size(), 1);
+	BOOST_CHECK(path[0] == sf::Vector2i(3, 2));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathSmoother_smoothPath) {
+	const int SQUARE_DIM = 20;
+	const unsigned int SAMPLES_PER_SEGMENT = 5;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	buildWall(navGrid, 10, 15);
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<PathRequest> pathRequests{ PathRequest{ sf::Vector2i(2, 2), sf::Vector2i(18, 3) } };
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	PathSmoother smoother(&navGrid);
+	smoother.pullStrings(pathRequests[0].start, pathsReturn[0]);
+
+	CoordinateConverter converter(10, sf::Vector2f(0, 0));
+	const sf::Vector2f start = converter.convertCoordToWindow(pathRequests[0].start);
+	const WindowCoordinatePath windowPath = converter.convertPathToWindow(pathsReturn[0]);
+	WindowCoordinatePath smoothedPath;
+	smoother.smoothPath(start, windowPath, converter, smoothedPath, SAMPLES_PER_SEGMENT);
+
+	// the curve passes every waypoint and ends at the end of the path
+	BOOST_CHECK(smoothedPath.size() > windowPath.size());
+	BOOST_CHECK(smoothedPath.size() <= windowPath.size() * SAMPLES_PER_SEGMENT);
+	BOOST_CHECK(smoothedPath.back() == windowPath.back());
+
+	// no point of the curve is blocked
+	for (const sf::Vector2f& point : smoothedPath) {
+		const sf::Vector2i gridSquare = converter.convertCoordToNavGrid(point);
+		BOOST_CHECK(navGrid.at(gridSquare.x, gridSquare.y)->weight < BLOCKED_GRID_WEIGHT);
+	}
+
+	// one sample per segment keeps the path
+	WindowCoordinatePath copiedPath;
+	smoother.smoothPath(start, windowPath, converter, copiedPath, 1);
+	BOOST_CHECK(copiedPath == windowPath);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE(PathSmoother_perf_Tests)
+
+BOOST_AUTO_TEST_CASE(PathSmoother_pullStrings_perf) {
+	const int SQUARE_DIM = 256;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	// walls with alternating gaps force the paths to weave across the map
+	for (unsigned int x = 32; x < SQUARE_DIM; x += 32) {
+		buildWall(navGrid, x, (x % 64 == 0) ? 16 : SQUARE_DIM - 16);
+	}
+
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < 64; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i(i % 16, (i * 37) % SQUARE_DIM), sf::Vector2i(SQUARE_DIM - 1 - i % 16, (i * 53) % SQUARE_DIM) });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> pathsReturn;
+	pathfinder.pathFind(pathRequests, &pathsReturn);
+	const std::vector<std::deque<sf::Vector2i>> originalPaths = pathsReturn;
+
+	PathSmoother smoother(&navGrid);
+	auto startTime = std::chrono::high_resolution_clock::now();
+	smoother.pullStrings(pathRequests, &pathsReturn);
+	auto endTime = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double> elapsedTime = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+
+	std::size_t originalWaypointCount = 0;
+	std::size_t pulledWaypointCount = 0;
+	for (std::size_t i = 0; i < pathRequests.size(); ++i) {
+		checkPulledPathIsValid(navGrid, pathRequests[i], originalPaths[i], pathsReturn[i]);
+		originalWaypointCount += originalPaths[i].size();
+		pulledWaypointCount += pathsReturn[i].size();
+	}
+	BOOST_CHECK(pulledWaypointCount * 10 < originalWaypointCount);
+
+	std::stringstream strStream;
+	strStream << "Pathfinding time of: " << elapsedTime.count() << " seconds to pull " << originalWaypointCount
+		<< " waypoints down to " << pulledWaypointCount << " for PathSmoother perf test";
+	BOOST_TEST_MESSAGE(strStream.str());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathSmoother_perf_Tests
+
+BOOST_AUTO_TEST_SUITE_END() // end PathSmoother_Tests
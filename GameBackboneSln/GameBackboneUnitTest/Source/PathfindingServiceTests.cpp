@@ -0,0 +1,233 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/PathFinder.h>
+#include <GameBackbone/Navigation/PathfindingService.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Dispatches completed paths until the passed number of callbacks were called or a generous timeout passed.
+	/// </summary>
+	void dispatchUntil(PathfindingService& service, std::size_t& dispatchedCount, std::size_t expectedCount) {
+		const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+		while (dispatchedCount < expectedCount && std::chrono::steady_clock::now() < timeout) {
+			dispatchedCount += service.dispatchCompletedPaths();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(PathfindingService_Tests)
+
+BOOST_AUTO_TEST_SUITE(PathfindingService_CTRs)
+
+BOOST_AUTO_TEST_CASE(PathfindingService_null_grid_CTR) {
+	PathfindingService service(nullptr, 0);
+
+	// at least one thread is started
+	BOOST_CHECK_EQUAL(service.getThreadCount(), 1);
+
+	// no grid means no path
+	PathfindingService::PendingPath pendingPath = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(1, 0) });
+	BOOST_CHECK(pendingPath.path.get().empty());
+}
+
+BOOST_AUTO_TEST_CASE(PathfindingService_destructor_delivers_pending_futures) {
+	NavigationGrid navGrid(300);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 300; ++y) {
+		navGrid.at(150, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	std::vector<std::future<NavGridCoordinatePath>> paths;
+	{
+		PathfindingService service(&navGrid, 1);
+		for (int i = 0; i < 10; ++i) {
+			paths.push_back(service.requestPath(PathRequest{ sf::Vector2i(0, i), sf::Vector2i(299, i) }).path);
+		}
+	}
+
+	// every future has a value, so waiting on it does not throw
+	for (std::future<NavGridCoordinatePath>& path : paths) {
+		BOOST_CHECK(path.get().empty());
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathfindingService_CTRs
+
+BOOST_AUTO_TEST_SUITE(PathfindingService_requestPath)
+
+BOOST_AUTO_TEST_CASE(PathfindingService_requestPath_matches_Pathfinder) {
+	const int SQUARE_DIM = 40;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 4; x < SQUARE_DIM; x += 6) {
+		for (unsigned int y = 0; y < SQUARE_DIM - 3; ++y) {
+			navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+		}
+	}
+	std::vector<PathRequest> pathRequests;
+	for (int i = 0; i < 20; ++i) {
+		pathRequests.push_back(PathRequest{ sf::Vector2i(i % 4, i), sf::Vector2i(SQUARE_DIM - 1 - i, SQUARE_DIM - 1 - (i % 3)) });
+	}
+
+	Pathfinder pathfinder(&navGrid);
+	std::vector<std::deque<sf::Vector2i>> expectedPaths;
+	pathfinder.pathFind(pathRequests, &expectedPaths);
+
+	PathfindingService service(&navGrid, 3);
+	std::vector<PathfindingService::PendingPath> pendingPaths;
+	for (const PathRequest& pathRequest : pathRequests) {
+		pendingPaths.push_back(service.requestPath(pathRequest));
+	}
+	for (std::size_t i = 0; i < pendingPaths.size(); ++i) {
+		BOOST_CHECK(pendingPaths[i].path.get() == expectedPaths[i]);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathfindingService_requestPath_callback) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+
+	PathfindingService service(&navGrid, 2);
+	std::vector<PathRequestHandle> calledHandles;
+	std::vector<std::size_t> pathSizes;
+	const auto callback = [&calledHandles, &pathSizes](PathRequestHandle handle, NavGridCoordinatePath path) {
+		calledHandles.push_back(handle);
+		pathSizes.push_back(path.size());
+	};
+	const PathRequestHandle firstHandle = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(9, 9) }, PATH_REQUEST_PRIORITY_NORMAL, callback);
+	const PathRequestHandle secondHandle = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(3, 0) }, PATH_REQUEST_PRIORITY_NORMAL, callback);
+	BOOST_CHECK(firstHandle != secondHandle);
+
+	// callbacks are only called from dispatchCompletedPaths
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	BOOST_CHECK(calledHandles.empty());
+
+	std::size_t dispatchedCount = 0;
+	dispatchUntil(service, dispatchedCount, 2);
+	BOOST_REQUIRE_EQUAL(calledHandles.size(), 2);
+	for (std::size_t i = 0; i < calledHandles.size(); ++i) {
+		BOOST_CHECK_EQUAL(pathSizes[i], (calledHandles[i] == firstHandle) ? 18 : 3);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(PathfindingService_requestPath_priority) {
+	const int SQUARE_DIM = 400;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(SQUARE_DIM / 2, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	PathfindingService service(&navGrid, 1);
+	std::vector<PathRequestHandle> completionOrder;
+	const auto callback = [&completionOrder](PathRequestHandle handle, NavGridCoordinatePath) {
+		completionOrder.push_back(handle);
+	};
+
+	// a slow first request keeps the only thread busy while the others are queued
+	const PathRequest slowRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, 0) };
+	service.requestPath(slowRequest, PATH_REQUEST_PRIORITY_LOW, callback);
+	std::vector<PathRequestHandle> lowHandles;
+	for (int i = 0; i < 3; ++i) {
+		lowHandles.push_back(service.requestPath(PathRequest{ sf::Vector2i(0, i), sf::Vector2i(5, i) }, PATH_REQUEST_PRIORITY_LOW, callback));
+	}
+	const PathRequestHandle normalHandle = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(0, 5) }, PATH_REQUEST_PRIORITY_NORMAL, callback);
+	const PathRequestHandle highHandle = service.requestPath(PathRequest{ sf::Vector2i(1, 0), sf::Vector2i(1, 5) }, PATH_REQUEST_PRIORITY_HIGH, callback);
+
+	std::size_t dispatchedCount = 0;
+	dispatchUntil(service, dispatchedCount, 6);
+	BOOST_REQUIRE_EQUAL(completionOrder.size(), 6);
+
+	// the slow request may or may not have started before the others were queued, but every other request waits for its priority
+	const auto completionIndex = [&completionOrder](PathRequestHandle handle) {
+		return std::find(completionOrder.begin(), completionOrder.end(), handle) - completionOrder.begin();
+	};
+	BOOST_CHECK(completionIndex(highHandle) < completionIndex(normalHandle));
+	for (PathRequestHandle lowHandle : lowHandles) {
+		BOOST_CHECK(completionIndex(normalHandle) < completionIndex(lowHandle));
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathfindingService_requestPath
+
+BOOST_AUTO_TEST_SUITE(PathfindingService_cancelPathRequest)
+
+BOOST_AUTO_TEST_CASE(PathfindingService_cancelPathRequest_running_and_queued) {
+	const int SQUARE_DIM = 400;
+	NavigationGrid navGrid(SQUARE_DIM);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < SQUARE_DIM; ++y) {
+		navGrid.at(SQUARE_DIM / 2, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	PathfindingService service(&navGrid, 1);
+	bool isCanceledCallbackCalled = false;
+	PathfindingService::PendingPath slowPath = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(SQUARE_DIM - 1, 0) });
+	const PathRequestHandle queuedHandle = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(3, 0) }, PATH_REQUEST_PRIORITY_NORMAL,
+		[&isCanceledCallbackCalled](PathRequestHandle, NavGridCoordinatePath) {
+			isCanceledCallbackCalled = true;
+		});
+	PathfindingService::PendingPath path = service.requestPath(PathRequest{ sf::Vector2i(0, 0), sf::Vector2i(0, 4) });
+
+	service.cancelPathRequest(queuedHandle);
+	service.cancelPathRequest(slowPath.handle);
+
+	// canceled futures receive an empty path, and the remaining request is still solved
+	BOOST_CHECK(slowPath.path.get().empty());
+	BOOST_CHECK_EQUAL(path.path.get().size(), 4);
+	service.dispatchCompletedPaths();
+	BOOST_CHECK(!isCanceledCallbackCalled);
+
+	// canceling a delivered request does nothing
+	service.cancelPathRequest(path.handle);
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathfindingService_cancelPathRequest
+
+BOOST_AUTO_TEST_SUITE(PathfindingService_updateSnapshot)
+
+BOOST_AUTO_TEST_CASE(PathfindingService_updateSnapshot_isolates_grid) {
+	NavigationGrid navGrid(10);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	const PathRequest pathRequest{ sf::Vector2i(0, 0), sf::Vector2i(9, 0) };
+
+	PathfindingService service(&navGrid, 1);
+
+	// changes to the grid are not seen until the snapshot is updated
+	for (unsigned int y = 0; y < 10; ++y) {
+		navGrid.at(5, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+	BOOST_CHECK_EQUAL(service.requestPath(pathRequest).path.get().size(), 9);
+
+	service.updateSnapshot(&navGrid);
+	BOOST_CHECK(service.requestPath(pathRequest).path.get().empty());
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end PathfindingService_updateSnapshot
+
+BOOST_AUTO_TEST_SUITE_END() // end PathfindingService_Tests
@@ -0,0 +1,190 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/NavigationTools.h>
+#include <GameBackbone/Navigation/ReachabilityIndex.h>
+
+#include <SFML/System/Vector2.hpp>
+
+#include <map>
+#include <vector>
+
+using namespace GB;
+
+namespace {
+	/// <summary>
+	/// Checks that two indexes split the grid into the same areas, even if they label them differently.
+	/// </summary>
+	void checkSameComponents(const ReachabilityIndex& lhs, const ReachabilityIndex& rhs, unsigned int sizeX, unsigned int sizeY) {
+		BOOST_CHECK_EQUAL(lhs.getComponentCount(), rhs.getComponentCount());
+		std::map<unsigned int, unsigned int> lhsToRhs;
+		std::map<unsigned int, unsigned int> rhsToLhs;
+		for (unsigned int x = 0; x < sizeX; ++x) {
+			for (unsigned int y = 0; y < sizeY; ++y) {
+				const sf::Vector2i gridSquare(static_cast<int>(x), static_cast<int>(y));
+				const unsigned int lhsComponent = lhs.getComponent(gridSquare);
+				const unsigned int rhsComponent = rhs.getComponent(gridSquare);
+				BOOST_REQUIRE_EQUAL(lhsComponent == ReachabilityIndex::NO_COMPONENT, rhsComponent == ReachabilityIndex::NO_COMPONENT);
+				if (lhsComponent == ReachabilityIndex::NO_COMPONENT) {
+					continue;
+				}
+				BOOST_CHECK_EQUAL(lhsToRhs.emplace(lhsComponent, rhsComponent).first->second, rhsComponent);
+				BOOST_CHECK_EQUAL(rhsToLhs.emplace(rhsComponent, lhsComponent).first->second, lhsComponent);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(ReachabilityIndex_Tests)
+
+BOOST_AUTO_TEST_SUITE(ReachabilityIndex_CTRs)
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_default_CTR) {
+	ReachabilityIndex reachabilityIndex;
+
+	BOOST_CHECK(reachabilityIndex.getNavigationGrid() == nullptr);
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 0);
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponent(sf::Vector2i(0, 0)), ReachabilityIndex::NO_COMPONENT);
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(0, 0)));
+}
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_navigationGrid_CTR) {
+	NavigationGrid navGrid(8, 6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	// a wall splitting the grid in two
+	for (unsigned int y = 0; y < 6; ++y) {
+		navGrid.at(3, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	ReachabilityIndex reachabilityIndex(&navGrid);
+
+	//ensure the grid is not copied
+	BOOST_CHECK_EQUAL(&navGrid, reachabilityIndex.getNavigationGrid());
+
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 2);
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponent(sf::Vector2i(3, 2)), ReachabilityIndex::NO_COMPONENT);
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponent(sf::Vector2i(0, 0)), reachabilityIndex.getComponent(sf::Vector2i(2, 5)));
+	BOOST_CHECK(reachabilityIndex.getComponent(sf::Vector2i(0, 0)) != reachabilityIndex.getComponent(sf::Vector2i(4, 0)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ReachabilityIndex_CTRs
+
+BOOST_AUTO_TEST_SUITE(ReachabilityIndex_isReachable)
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_isReachable_matches_Pathfinder_rules) {
+	NavigationGrid navGrid(8, 6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 6; ++y) {
+		navGrid.at(3, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	ReachabilityIndex reachabilityIndex(&navGrid);
+
+	BOOST_CHECK(reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(2, 5)));
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(7, 5)));
+
+	// a blocked start can be left, a blocked end can not be reached
+	BOOST_CHECK(reachabilityIndex.isReachable(sf::Vector2i(3, 1), sf::Vector2i(7, 5)));
+	BOOST_CHECK(reachabilityIndex.isReachable(sf::Vector2i(3, 1), sf::Vector2i(0, 0)));
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(3, 1)));
+
+	// outside of the grid
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(-1, 0), sf::Vector2i(0, 0)));
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(8, 0)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_isBuiltFor) {
+	NavigationGrid navGrid(8, 6);
+	NavigationGrid otherNavGrid(8, 6);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	initAllNavigationGridValues(otherNavGrid, NavigationGridData{ 1,0 });
+
+	ReachabilityIndex reachabilityIndex(&navGrid);
+	BOOST_CHECK(reachabilityIndex.isBuiltFor(&navGrid));
+
+	// grids of the same size are still different grids
+	BOOST_CHECK(!reachabilityIndex.isBuiltFor(&otherNavGrid));
+	BOOST_CHECK(!reachabilityIndex.isBuiltFor(nullptr));
+
+	ReachabilityIndex emptyReachabilityIndex;
+	BOOST_CHECK(!emptyReachabilityIndex.isBuiltFor(nullptr));
+
+	freeAllNavigationGridData(navGrid);
+	freeAllNavigationGridData(otherNavGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ReachabilityIndex_isReachable
+
+BOOST_AUTO_TEST_SUITE(ReachabilityIndex_updateGridSquares)
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_updateGridSquares_door) {
+	NavigationGrid navGrid(9, 5);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int y = 0; y < 5; ++y) {
+		navGrid.at(4, y)->weight = BLOCKED_GRID_WEIGHT;
+	}
+
+	ReachabilityIndex reachabilityIndex(&navGrid);
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 2);
+
+	// opening a door merges both sides
+	navGrid.at(4, 2)->weight = 1;
+	reachabilityIndex.updateGridSquares({ sf::Vector2i(4, 2) });
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 1);
+	BOOST_CHECK(reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(8, 4)));
+
+	// closing it splits them again
+	navGrid.at(4, 2)->weight = BLOCKED_GRID_WEIGHT;
+	reachabilityIndex.updateGridSquares({ sf::Vector2i(4, 2) });
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 2);
+	BOOST_CHECK(!reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(8, 4)));
+
+	// blocking a square that is not a connection keeps the area whole
+	navGrid.at(1, 1)->weight = BLOCKED_GRID_WEIGHT;
+	reachabilityIndex.updateGridSquares({ sf::Vector2i(1, 1) });
+	BOOST_CHECK_EQUAL(reachabilityIndex.getComponentCount(), 2);
+	BOOST_CHECK(reachabilityIndex.isReachable(sf::Vector2i(0, 0), sf::Vector2i(3, 4)));
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_CASE(ReachabilityIndex_updateGridSquares_matches_rebuild) {
+	const unsigned int sizeX = 24;
+	const unsigned int sizeY = 17;
+	NavigationGrid navGrid(sizeX, sizeY);
+	initAllNavigationGridValues(navGrid, NavigationGridData{ 1,0 });
+	for (unsigned int x = 0; x < sizeX; ++x) {
+		for (unsigned int y = 0; y < sizeY; ++y) {
+			if ((x * 5 + y * 3) % 7 == 0) {
+				navGrid.at(x, y)->weight = BLOCKED_GRID_WEIGHT;
+			}
+		}
+	}
+	ReachabilityIndex reachabilityIndex(&navGrid);
+
+	// toggle squares in batches, including squares changed twice in the same batch
+	unsigned int seed = 7;
+	for (int step = 0; step < 100; ++step) {
+		std::vector<sf::Vector2i> changedGridSquares;
+		for (int i = 0; i < 4; ++i) {
+			seed = seed * 1103515245u + 12345u;
+			const unsigned int x = (seed >> 8) % sizeX;
+			const unsigned int y = (seed >> 20) % sizeY;
+			navGrid.at(x, y)->weight = ((seed >> 4) % 2 == 0) ? BLOCKED_GRID_WEIGHT : 1;
+			changedGridSquares.push_back(sf::Vector2i(static_cast<int>(x), static_cast<int>(y)));
+		}
+		reachabilityIndex.updateGridSquares(changedGridSquares);
+
+		ReachabilityIndex rebuiltIndex(&navGrid);
+		checkSameComponents(reachabilityIndex, rebuiltIndex, sizeX, sizeY);
+	}
+
+	freeAllNavigationGridData(navGrid);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ReachabilityIndex_updateGridSquares
+
+BOOST_AUTO_TEST_SUITE_END() // end ReachabilityIndex_Tests
@@ -0,0 +1,133 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Navigation/ReservationTable.h>
+
+#include <SFML/System/Vector2.hpp>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(ReservationTable_Tests)
+
+BOOST_AUTO_TEST_SUITE(ReservationTable_CTRs)
+
+BOOST_AUTO_TEST_CASE(ReservationTable_default_CTR) {
+	ReservationTable reservationTable;
+
+	BOOST_CHECK_EQUAL(reservationTable.getWindowSize(), 0);
+	BOOST_CHECK_EQUAL(reservationTable.getCurrentTime(), 0);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 0);
+
+	// only the current time can be reserved
+	BOOST_CHECK(reservationTable.reserve(sf::Vector2i(1, 1), 0, 3));
+	BOOST_CHECK(!reservationTable.reserve(sf::Vector2i(1, 1), 1, 3));
+}
+
+BOOST_AUTO_TEST_CASE(ReservationTable_windowSize_CTR) {
+	ReservationTable reservationTable(8);
+
+	BOOST_CHECK_EQUAL(reservationTable.getWindowSize(), 8);
+	BOOST_CHECK(reservationTable.isInWindow(0));
+	BOOST_CHECK(reservationTable.isInWindow(8));
+	BOOST_CHECK(!reservationTable.isInWindow(9));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ReservationTable_CTRs
+
+BOOST_AUTO_TEST_CASE(ReservationTable_reserve) {
+	ReservationTable reservationTable(4);
+	const sf::Vector2i gridSquare(2, 3);
+
+	BOOST_CHECK(reservationTable.reserve(gridSquare, 2, 7));
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(gridSquare, 2), 7);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 1);
+
+	// the grid square is only reserved at that time step
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(gridSquare, 1), ReservationTable::NO_AGENT);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(sf::Vector2i(3, 2), 2), ReservationTable::NO_AGENT);
+
+	// another agent can not take the reservation, but its holder can reserve again
+	BOOST_CHECK(!reservationTable.reserve(gridSquare, 2, 8));
+	BOOST_CHECK(reservationTable.reserve(gridSquare, 2, 7));
+	BOOST_CHECK(reservationTable.isFree(gridSquare, 2, 7));
+	BOOST_CHECK(!reservationTable.isFree(gridSquare, 2, 8));
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 1);
+
+	// time steps outside of the window can not be reserved
+	BOOST_CHECK(!reservationTable.reserve(gridSquare, 5, 7));
+	BOOST_CHECK(reservationTable.isFree(gridSquare, 5, 8));
+}
+
+BOOST_AUTO_TEST_CASE(ReservationTable_release) {
+	ReservationTable reservationTable(4);
+	const sf::Vector2i gridSquare(2, 3);
+	reservationTable.reserve(gridSquare, 1, 7);
+
+	// only the holder releases a reservation
+	reservationTable.release(gridSquare, 1, 8);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(gridSquare, 1), 7);
+
+	reservationTable.release(gridSquare, 1, 7);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(gridSquare, 1), ReservationTable::NO_AGENT);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ReservationTable_isMoveFree) {
+	ReservationTable reservationTable(4);
+	const sf::Vector2i left(0, 0);
+	const sf::Vector2i right(1, 0);
+
+	// agent 1 moves from right to left
+	reservationTable.reserve(right, 0, 1);
+	reservationTable.reserve(left, 1, 1);
+
+	// agent 2 can not pass through it or move into its grid square
+	BOOST_CHECK(!reservationTable.isMoveFree(left, right, 0, 2));
+	BOOST_CHECK(!reservationTable.isMoveFree(left, left, 0, 2));
+
+	// but it can follow it
+	BOOST_CHECK(reservationTable.isMoveFree(sf::Vector2i(2, 0), right, 0, 2));
+
+	// agents never conflict with themselves
+	BOOST_CHECK(reservationTable.isMoveFree(right, left, 0, 1));
+}
+
+BOOST_AUTO_TEST_CASE(ReservationTable_advanceTime) {
+	ReservationTable reservationTable(3);
+	for (unsigned int time = 0; time <= 3; ++time) {
+		BOOST_CHECK(reservationTable.reserve(sf::Vector2i(0, static_cast<int>(time)), time, 1));
+	}
+
+	// the window moves forward and discards the reservations that leave it
+	reservationTable.advanceTime(2);
+	BOOST_CHECK_EQUAL(reservationTable.getCurrentTime(), 2);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 2);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(sf::Vector2i(0, 0), 0), ReservationTable::NO_AGENT);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(sf::Vector2i(0, 3), 3), 1);
+
+	// the new time steps start out free
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(sf::Vector2i(0, 0), 4), ReservationTable::NO_AGENT);
+	BOOST_CHECK(reservationTable.reserve(sf::Vector2i(0, 5), 5, 2));
+
+	// moving past the whole window discards everything
+	reservationTable.advanceTime(10);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 0);
+	BOOST_CHECK_EQUAL(reservationTable.getAgent(sf::Vector2i(0, 5), 5), ReservationTable::NO_AGENT);
+}
+
+BOOST_AUTO_TEST_CASE(ReservationTable_clear) {
+	ReservationTable reservationTable(3);
+	reservationTable.advanceTime(5);
+	reservationTable.reserve(sf::Vector2i(0, 0), 6, 1);
+
+	reservationTable.clear();
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 0);
+	BOOST_CHECK_EQUAL(reservationTable.getCurrentTime(), 5);
+
+	// a new window size discards every reservation as well
+	reservationTable.reserve(sf::Vector2i(0, 0), 6, 1);
+	reservationTable.setWindowSize(6);
+	BOOST_CHECK_EQUAL(reservationTable.getReservationCount(), 0);
+	BOOST_CHECK(reservationTable.isInWindow(11));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end ReservationTable_Tests
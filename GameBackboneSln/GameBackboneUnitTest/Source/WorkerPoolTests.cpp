@@ -0,0 +1,93 @@
+#include "stdafx.h"
+
+#include <GameBackbone/Util/WorkerPool.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace GB;
+
+BOOST_AUTO_TEST_SUITE(WorkerPool_Tests)
+
+BOOST_AUTO_TEST_SUITE(WorkerPool_CTRs)
+
+BOOST_AUTO_TEST_CASE(WorkerPool_single_worker_CTR) {
+	WorkerPool workerPool(1);
+
+	BOOST_CHECK_EQUAL(workerPool.getWorkerCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_zero_workers_CTR) {
+	WorkerPool workerPool(0);
+
+	// the calling thread is always a worker
+	BOOST_CHECK_EQUAL(workerPool.getWorkerCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_many_workers_CTR) {
+	WorkerPool workerPool(4);
+
+	BOOST_CHECK_EQUAL(workerPool.getWorkerCount(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end WorkerPool_CTRs
+
+BOOST_AUTO_TEST_SUITE(WorkerPool_runOnAllWorkers)
+
+BOOST_AUTO_TEST_CASE(WorkerPool_runOnAllWorkers_runs_every_worker_once) {
+	const unsigned int WORKER_COUNT = 4;
+	WorkerPool workerPool(WORKER_COUNT);
+
+	std::vector<std::atomic<int>> runCounts(WORKER_COUNT);
+	for (std::atomic<int>& runCount : runCounts) {
+		runCount = 0;
+	}
+
+	workerPool.runOnAllWorkers([&runCounts](unsigned int workerIndex) {
+		++runCounts[workerIndex];
+	});
+
+	for (const std::atomic<int>& runCount : runCounts) {
+		BOOST_CHECK_EQUAL(runCount.load(), 1);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_runOnAllWorkers_many_jobs) {
+	const unsigned int WORKER_COUNT = 3;
+	const int JOB_COUNT = 100;
+	WorkerPool workerPool(WORKER_COUNT);
+
+	std::atomic<int> totalRuns{0};
+	for (int i = 0; i < JOB_COUNT; ++i) {
+		workerPool.runOnAllWorkers([&totalRuns](unsigned int) {
+			++totalRuns;
+		});
+	}
+
+	BOOST_CHECK_EQUAL(totalRuns.load(), JOB_COUNT * static_cast<int>(WORKER_COUNT));
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_runOnAllWorkers_rethrows) {
+	WorkerPool workerPool(2);
+
+	BOOST_CHECK_THROW(
+		workerPool.runOnAllWorkers([](unsigned int workerIndex) {
+			if (workerIndex == 1) {
+				throw std::runtime_error("worker failed");
+			}
+		}),
+		std::runtime_error
+	);
+
+	// the pool is still usable after a job throws
+	std::atomic<int> totalRuns{0};
+	workerPool.runOnAllWorkers([&totalRuns](unsigned int) {
+		++totalRuns;
+	});
+	BOOST_CHECK_EQUAL(totalRuns.load(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // end WorkerPool_runOnAllWorkers
+
+BOOST_AUTO_TEST_SUITE_END() // end WorkerPool_Tests